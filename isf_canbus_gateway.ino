@@ -12,6 +12,8 @@
 #include "./src/can/twai_wrapper.h"
 #include "./src/services/gt86_service.h"
 #include "./src/services/isf_service.h"
+#include "./src/uds/uds_image.h"
+#include "./src/signals/derived_signals.h"
 
 // Define LED pin if it's not already defined
 #ifndef LED_BUILTIN
@@ -77,6 +79,7 @@ void gt86Task(void *parameter)
     {
         try
         {
+            // Blocks until the next GT86 frame release, so no cooldown delay is needed
             gt86Service->listen();
         }
         catch (...)
@@ -84,8 +87,6 @@ void gt86Task(void *parameter)
             LOG_ERROR("Exception in GT86 task - recovering");
             vTaskDelay(pdMS_TO_TICKS(1000)); // Delay to recover
         }
-
-        vTaskDelay(pdMS_TO_TICKS(CPU_COOLDOWN_TIME));
     }
 }
 
@@ -123,6 +124,27 @@ void setup()
     // Test direct logging to verify it works
     LOG_DEBUG("Setup started.");
 
+    // Definitions flashed to the udsdefs partition replace the built-in tables without a firmware rebuild
+    UdsTables imageTables;
+    if (loadUdsImage(UDS_IMAGE_PARTITION, imageTables))
+    {
+        activeUdsTables = imageTables;
+        LOG_INFO("Using UDS image: %u signals in %u DIDs", (unsigned)imageTables.definition_count,
+                 (unsigned)imageTables.did_count);
+    }
+
+    // Derived signals resolve their inputs against whichever tables are now active
+    derivedSignals.initialize();
+
+    // Signals an ISF broadcast also delivers are published outside their DID's store group
+    IsfBroadcast::separateSignals();
+
+    // Queue between the ISF receive path and the GT86 task for frames forwarded without decoding
+    if (!passthroughBridge.begin())
+    {
+        LOG_ERROR("Passthrough queue could not be created, ISF frames are not forwarded");
+    }
+
     // Create Tasks with increased stack size - each on a different core
     xTaskCreatePinnedToCore(isfTask, "ISF Task", ISF_TASK_STACK_SIZE, NULL, 1, &isfTaskHandle, 0);
     xTaskCreatePinnedToCore(gt86Task, "GT86 Task", GT86_TASK_STACK_SIZE, NULL, 1, &gt86TaskHandle, 1);
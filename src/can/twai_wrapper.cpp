@@ -61,11 +61,11 @@ bool TwaiWrapper::sendMessage(uint32_t id, uint8_t *data, uint8_t len)
     return (result == ESP_OK);
 }
 
-bool TwaiWrapper::receiveMessage(uint32_t &id, uint8_t *data, uint8_t &len)
+bool TwaiWrapper::receiveMessage(uint32_t &id, uint8_t *data, uint8_t &len, TickType_t wait)
 {
     twai_message_t twai_msg;
 
-    if (twai_receive(&twai_msg, pdMS_TO_TICKS(5)) == ESP_OK) {
+    if (twai_receive(&twai_msg, wait) == ESP_OK) {
         id = twai_msg.identifier;
         len = twai_msg.data_length_code;
         memcpy(data, twai_msg.data, len);
@@ -71,9 +71,10 @@ public:
      * @param id Reference to the ID of the received message
      * @param data Buffer to the data of the received message
      * @param len Reference to the length of the data of the received message
+     * @param wait How long to block for a message if the receive queue is empty
      * @return true if a message was received
      */
-    bool receiveMessage(uint32_t &id, uint8_t *data, uint8_t &len);
+    bool receiveMessage(uint32_t &id, uint8_t *data, uint8_t &len, TickType_t wait = pdMS_TO_TICKS(5));
 };
 
 #endif
\ No newline at end of file
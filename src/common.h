@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstdint>
+#include <cstring>
 #include <string>
 
 struct CANMessage
@@ -136,6 +137,7 @@ namespace GT86CAN
   // Vehicle Dynamics
   constexpr uint32_t VEHICLE_SPEED = 0xD1;
   constexpr uint32_t WHEEL_SPEEDS = 0xD4;
+  constexpr uint32_t TEMPERATURES = 0x360;
 
   // Vehicle Systems
   constexpr uint32_t HVAC_STATUS = 0x220;
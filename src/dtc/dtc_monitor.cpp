@@ -0,0 +1,191 @@
+#include "dtc_monitor.h"
+#include "../logger/logger.h"
+#include "../obd/obd_pids.h"
+#include "../signals/signal_registry.h"
+
+void formatDtc(uint16_t code, char *out)
+{
+    static const char SYSTEM_LETTERS[] = {'P', 'C', 'B', 'U'};
+    static const char HEX_DIGITS[] = "0123456789ABCDEF";
+
+    out[0] = SYSTEM_LETTERS[(code >> 14) & 0x03];
+    out[1] = HEX_DIGITS[(code >> 12) & 0x03];
+    out[2] = HEX_DIGITS[(code >> 8) & 0x0F];
+    out[3] = HEX_DIGITS[(code >> 4) & 0x0F];
+    out[4] = HEX_DIGITS[code & 0x0F];
+    out[5] = '\0';
+}
+
+DtcMonitor::DtcMonitor(IsoTp *isotp) : isotp(isotp)
+{
+    for (int i = 0; i < DTC_ECU_COUNT; i++)
+    {
+        // Read every ECU once at start-up to establish the baseline
+        readPending[i] = true;
+        lastAttempt[i] = 0;
+    }
+}
+
+void DtcMonitor::initialize()
+{
+    signalRegistry.subscribe(SignalConsumer::DtcMonitor, obdSignalId(0x01));
+}
+
+void DtcMonitor::onMonitorStatus(uint32_t monitor_status_raw)
+{
+    bool mil = obdMilOn(monitor_status_raw);
+    uint8_t count = obdDtcCount(monitor_status_raw);
+
+    if (hasMonitorStatus && mil == milOn && count == dtcCount)
+    {
+        return;
+    }
+
+    if (hasMonitorStatus)
+    {
+        LOG_INFO("DTC check changed: MIL %s -> %s, count %u -> %u", milOn ? "ON" : "OFF", mil ? "ON" : "OFF", dtcCount,
+                 count);
+
+        // The engine check is the only cheap indicator we have, so re-read all ECUs
+        for (int i = 0; i < DTC_ECU_COUNT; i++)
+        {
+            readPending[i] = true;
+        }
+    }
+
+    hasMonitorStatus = true;
+    milOn = mil;
+    dtcCount = count;
+}
+
+bool DtcMonitor::poll(unsigned long now)
+{
+    for (int i = 0; i < DTC_ECU_COUNT; i++)
+    {
+        bool expired = snapshots[i].valid && now - snapshots[i].read_time >= MAX_READ_AGE;
+        if (!readPending[i] && !expired)
+        {
+            continue;
+        }
+
+        // Do not hammer an ECU that did not answer (e.g. ABS asleep with ignition in ACC)
+        if (lastAttempt[i] != 0 && now - lastAttempt[i] < RETRY_INTERVAL)
+        {
+            continue;
+        }
+
+        lastAttempt[i] = now;
+        if (readEcu(i, now))
+        {
+            readPending[i] = false;
+        }
+        return true;
+    }
+
+    return false;
+}
+
+bool DtcMonitor::readEcu(int ecu, unsigned long now)
+{
+    const DtcEcuDefinition &definition = dtc_ecus[ecu];
+
+    Message_t msg;
+    msg.tx_id = definition.tx_id;
+    msg.rx_id = definition.rx_id;
+    msg.service_id = definition.request[1];
+    msg.length = definition.request_length;
+    memcpy(msg.Buffer, definition.request, sizeof(definition.request));
+
+    if (!isotp->send(&msg) || !isotp->receive(&msg, definition.name))
+    {
+        return false;
+    }
+
+    if (msg.Buffer[0] != definition.response_sid)
+    {
+        LOG_WARN("%s DTC read: unexpected response SID 0x%02X", definition.name, msg.Buffer[0]);
+        return false;
+    }
+
+    DtcEntry entries[MAX_DTCS_PER_ECU];
+    size_t count = parseResponse(definition, msg, entries);
+    updateSnapshot(ecu, entries, (uint8_t)count, now);
+    return true;
+}
+
+size_t DtcMonitor::parseResponse(const DtcEcuDefinition &ecu, const Message_t &msg, DtcEntry *entries)
+{
+    // Byte 1 is the number of reported codes for both OBD mode 03 on CAN and KWP 0x18
+    size_t reported = msg.length > 1 ? msg.Buffer[1] : 0;
+    size_t available = msg.length > 2 ? (msg.length - 2) / ecu.entry_size : 0;
+    size_t count = reported < available ? reported : available;
+    if (count > MAX_DTCS_PER_ECU)
+    {
+        count = MAX_DTCS_PER_ECU;
+    }
+
+    for (size_t i = 0; i < count; i++)
+    {
+        const uint8_t *entry = &msg.Buffer[2 + i * ecu.entry_size];
+        entries[i].code = (uint16_t)((entry[0] << 8) | entry[1]);
+        entries[i].status = (ecu.entry_size > 2) ? entry[2] : DTC_STATUS_CONFIRMED;
+    }
+
+    return count;
+}
+
+static const DtcEntry *findCode(const DtcEntry *entries, uint8_t count, uint16_t code)
+{
+    for (uint8_t i = 0; i < count; i++)
+    {
+        if (entries[i].code == code)
+        {
+            return &entries[i];
+        }
+    }
+    return nullptr;
+}
+
+void DtcMonitor::updateSnapshot(int ecu, const DtcEntry *entries, uint8_t count, unsigned long now)
+{
+    DtcSnapshot &previous = snapshots[ecu];
+    DtcDiff &diff = diffs[ecu];
+    char text[6];
+
+    diff.added_count = 0;
+    diff.cleared_count = 0;
+    diff.changed_count = 0;
+
+    for (uint8_t i = 0; i < count; i++)
+    {
+        const DtcEntry *known = findCode(previous.entries, previous.count, entries[i].code);
+        if (known == nullptr)
+        {
+            diff.added[diff.added_count++] = entries[i];
+            formatDtc(entries[i].code, text);
+            LOG_WARN("%s DTC set: %s status 0x%02X", dtc_ecus[ecu].name, text, entries[i].status);
+        }
+        else if (known->status != entries[i].status)
+        {
+            diff.changed[diff.changed_count++] = DtcStatusChange{entries[i].code, known->status, entries[i].status};
+            formatDtc(entries[i].code, text);
+            LOG_WARN("%s DTC status: %s 0x%02X -> 0x%02X", dtc_ecus[ecu].name, text, known->status,
+                     entries[i].status);
+        }
+    }
+
+    for (uint8_t i = 0; i < previous.count; i++)
+    {
+        if (findCode(entries, count, previous.entries[i].code) == nullptr)
+        {
+            diff.cleared[diff.cleared_count++] = previous.entries[i];
+            formatDtc(previous.entries[i].code, text);
+            LOG_INFO("%s DTC cleared: %s", dtc_ecus[ecu].name, text);
+        }
+    }
+
+    memcpy(previous.entries, entries, count * sizeof(DtcEntry));
+    previous.count = count;
+    previous.valid = true;
+    previous.read_time = now;
+}
@@ -0,0 +1,142 @@
+#ifndef _DTC_MONITOR_H
+#define _DTC_MONITOR_H
+
+#include <Arduino.h>
+#include <cstdint>
+#include "../common.h"
+#include "../isotp/iso_tp.h"
+
+#define MAX_DTCS_PER_ECU 16
+
+/**
+ * @brief A diagnostic trouble code in SAE J2012 two-byte form plus its status byte.
+ *
+ * Bits 15-14 select the system letter (P, C, B, U), the remaining 14 bits are the
+ * four code digits, e.g. 0x0341 -> P0341.
+ */
+struct DtcEntry
+{
+    uint16_t code;
+    uint8_t status;
+};
+
+struct DtcSnapshot
+{
+    DtcEntry entries[MAX_DTCS_PER_ECU];
+    uint8_t count = 0;
+    bool valid = false;             // At least one full read succeeded
+    unsigned long read_time = 0;
+};
+
+/**
+ * @brief A code present in two consecutive reads whose status byte changed, e.g. pending -> confirmed.
+ */
+struct DtcStatusChange
+{
+    uint16_t code;
+    uint8_t previous_status;
+    uint8_t status;
+};
+
+/**
+ * @brief Codes that appeared, disappeared or changed status between two full reads of one ECU.
+ */
+struct DtcDiff
+{
+    DtcEntry added[MAX_DTCS_PER_ECU];
+    uint8_t added_count = 0;
+    DtcEntry cleared[MAX_DTCS_PER_ECU];
+    uint8_t cleared_count = 0;
+    DtcStatusChange changed[MAX_DTCS_PER_ECU];
+    uint8_t changed_count = 0;
+};
+
+/**
+ * @brief How to read the full DTC list of one ECU.
+ */
+struct DtcEcuDefinition
+{
+    const char *name;
+    uint32_t tx_id;
+    uint32_t rx_id;
+    uint8_t request[8];       // Single frame including PCI
+    uint8_t request_length;
+    uint8_t response_sid;
+    uint8_t entry_size;       // 2 = code only (OBD mode 03), 3 = code + status (KWP 0x18)
+};
+
+// Status byte reported for OBD mode 03 entries, which only ever lists confirmed codes
+constexpr uint8_t DTC_STATUS_CONFIRMED = 0x08;
+
+const DtcEcuDefinition dtc_ecus[] = {
+    // OBD-II mode 03: 43 <count> [hi lo]...
+    { "Engine", 0x7E0, 0x7E8, {0x01, OBD_MODE_READ_DTC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, 2, 0x43, 2 },
+    // KWP2000 ReadDTCByStatus, all groups: 58 <count> [hi lo status]...
+    { "ABS",    0x7B0, 0x7B8, {0x04, 0x18, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00}, 5, 0x58, 3 },
+};
+
+const int DTC_ECU_COUNT = sizeof(dtc_ecus) / sizeof(dtc_ecus[0]);
+
+/**
+ * @brief Formats a J2012 code as text, e.g. "P0341".
+ *
+ * @param code  Two-byte DTC
+ * @param out   Output buffer of at least 6 characters
+ */
+void formatDtc(uint16_t code, char *out);
+
+/**
+ * @brief Change-triggered DTC reader for the engine and ABS ECUs.
+ *
+ * The cheap check is the MIL/DTC count of OBD PID 0x01, which arrives with the
+ * regular multi-PID poll. Full DTC lists are only read when that check changes,
+ * or when MAX_READ_AGE has passed so faults that do not light the engine MIL
+ * (ABS) are still caught within a bounded time. Each full read is diffed against
+ * the previous one so consumers only see new and cleared codes and codes whose
+ * status changed; every difference is also logged.
+ */
+class DtcMonitor
+{
+public:
+    explicit DtcMonitor(IsoTp *isotp);
+
+    /**
+     * @brief Subscribes the cheap check signal so the OBD poll keeps requesting it.
+     */
+    void initialize();
+
+    /**
+     * @brief Feeds the raw value of OBD PID 0x01 from the regular poll.
+     */
+    void onMonitorStatus(uint32_t monitor_status_raw);
+
+    /**
+     * @brief Performs at most one pending full ECU read.
+     *
+     * @return true if an ECU was read
+     */
+    bool poll(unsigned long now);
+
+    const DtcSnapshot &snapshot(int ecu) const { return snapshots[ecu]; }
+    const DtcDiff &lastDiff(int ecu) const { return diffs[ecu]; }
+
+private:
+    bool readEcu(int ecu, unsigned long now);
+    size_t parseResponse(const DtcEcuDefinition &ecu, const Message_t &msg, DtcEntry *entries);
+    void updateSnapshot(int ecu, const DtcEntry *entries, uint8_t count, unsigned long now);
+
+    static constexpr unsigned long MAX_READ_AGE = 60000;
+    static constexpr unsigned long RETRY_INTERVAL = 5000;
+
+    IsoTp *isotp;
+    DtcSnapshot snapshots[DTC_ECU_COUNT];
+    DtcDiff diffs[DTC_ECU_COUNT];
+    bool readPending[DTC_ECU_COUNT];
+    unsigned long lastAttempt[DTC_ECU_COUNT];
+
+    bool hasMonitorStatus = false;
+    bool milOn = false;
+    uint8_t dtcCount = 0;
+};
+
+#endif // _DTC_MONITOR_H
@@ -10,6 +10,12 @@ IsoTp::IsoTp(TwaiWrapper *bus)
   _twaiWrapper = bus;
 }
 
+void IsoTp::setUnsolicitedHandler(FrameHandler handler, void *context)
+{
+  _unsolicitedHandler = handler;
+  _unsolicitedContext = context;
+}
+
 
 // Convert UDS error code to string representation
 const char* getUdsErrorString(uint8_t errorCode) {
@@ -129,11 +135,12 @@ bool IsoTp::send(Message_t *msg)
       LOG_DEBUG("Sending UDS message: tx_id: 0x%lX, rx_id: 0x%lX, service_id: 0x%02X, length: %d", msg->tx_id, msg->rx_id, msg->service_id, msg->length);
     #endif
 
-    if (msg->length > 7) 
+    // length includes the PCI byte, so a full single frame (e.g. a six PID OBD request) is 8
+    if (msg->length > CAN_MAX_DLEN) 
     {
       msg->tp_state = ISOTP_ERROR;
       #ifdef ISO_TP_DEBUG
-        LOG_ERROR("Message too long for single frame: tx_id: 0x%lX, rx_id: 0x%lX, length: %d (max: 7), state: %s", msg->tx_id, msg->rx_id, msg->length, msg->getStateStr().c_str());
+        LOG_ERROR("Message too long for single frame: tx_id: 0x%lX, rx_id: 0x%lX, length: %d (max: 8), state: %s", msg->tx_id, msg->rx_id, msg->length, msg->getStateStr().c_str());
       #endif
       return false; // Error, too much data for single frame
     }
@@ -226,6 +233,9 @@ bool IsoTp::receive(Message_t *msg, const char* param_name)
   while (_twaiWrapper->receiveMessage(rxId, rxBuffer, rxLen) && (millis() - startTime) < UDS_TIMEOUT)
   {
       if (!isSupportedDiagnosticId(rxId)) {
+        if (_unsolicitedHandler != nullptr) {
+          _unsolicitedHandler(_unsolicitedContext, rxId, rxBuffer, rxLen > 8 ? 8 : rxLen);
+        }
         continue;
       }
 
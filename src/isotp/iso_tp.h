@@ -106,12 +106,18 @@
 class IsoTp
 {
 public:
+    // Receives frames outside the diagnostic ID range that arrive while a response is awaited
+    using FrameHandler = void (*)(void *context, uint32_t id, const uint8_t *data, uint8_t len);
+
     IsoTp(TwaiWrapper *bus);
     bool send(Message_t *msg);
     bool receive(Message_t *msg, const char* param_name);
+    void setUnsolicitedHandler(FrameHandler handler, void *context);
   
 private:  
     TwaiWrapper *_twaiWrapper;
+    FrameHandler _unsolicitedHandler = nullptr;
+    void *_unsolicitedContext = nullptr;
       
     bool isSupportedDiagnosticId(uint32_t rxId);
     bool is_next_consecutive_frame(Message_t *msg, uint8_t actual_seq_num);
@@ -470,6 +470,47 @@ void MCP_CAN::mcp2515_read_canMsg(const byte buffer_sidh_addr) // read can msg
     mcp2515_readRegisterS(mcp_addr + 5, &(dta[0]), dta_len);
 }
 
+/*********************************************************************************************************
+** Function name:           mcp2515_read_rxBuffer
+** Descriptions:            read id, dlc and data of one rx buffer with the READ RX BUFFER instruction,
+**                          which also clears the buffer's RXnIF when CS is released
+*********************************************************************************************************/
+void MCP_CAN::mcp2515_read_rxBuffer(const byte instruction, unsigned long *id, byte *len, byte *buf)
+{
+    byte header[5];
+    byte i;
+#ifdef SPI_HAS_TRANSACTION
+    SPI_BEGIN();
+#endif
+    MCP2515_SELECT();
+    spi_readwrite(instruction);
+    for (i = 0; i < 5; i++)
+    {
+        header[i] = spi_read();
+    }
+    *len = header[MCP_DLC] & MCP_DLC_MASK;
+    if (*len > MAX_CHAR_IN_MESSAGE)
+    {
+        *len = MAX_CHAR_IN_MESSAGE;
+    }
+    for (i = 0; i < *len; i++)
+    {
+        buf[i] = spi_read();
+    }
+    MCP2515_UNSELECT();
+#ifdef SPI_HAS_TRANSACTION
+    SPI_END();
+#endif
+
+    *id = (header[MCP_SIDH] << 3) + (header[MCP_SIDL] >> 5);
+    if ((header[MCP_SIDL] & MCP_TXB_EXIDE_M) == MCP_TXB_EXIDE_M)
+    {
+        *id = (*id << 2) + (header[MCP_SIDL] & 0x03);
+        *id = (*id << 8) + header[MCP_EID8];
+        *id = (*id << 8) + header[MCP_EID0];
+    }
+}
+
 /*********************************************************************************************************
 ** Function name:           mcp2515_start_transmit
 ** Descriptions:            start transmit
@@ -934,6 +975,52 @@ byte MCP_CAN::checkReceive(void)
     return ((res & MCP_STAT_RXIF_MASK) ? CAN_MSGAVAIL : CAN_NOMSG);
 }
 
+/*********************************************************************************************************
+** Function name:           readMsgBurst
+** Descriptions:            read every full rx buffer after a single status read, RXB0 first as it holds
+**                          the older frame when rollover put the next one in RXB1; returns the frame count
+*********************************************************************************************************/
+byte MCP_CAN::readMsgBurst(unsigned long *ID, byte *len, byte buf[][MAX_CHAR_IN_MESSAGE])
+{
+    byte count = 0;
+    byte status = mcp2515_readStatus();
+
+    if (status & MCP_STAT_RX0IF)
+    {
+        mcp2515_read_rxBuffer(MCP_READ_RX0, &ID[count], &len[count], buf[count]);
+        count++;
+    }
+    if (status & MCP_STAT_RX1IF)
+    {
+        mcp2515_read_rxBuffer(MCP_READ_RX1, &ID[count], &len[count], buf[count]);
+        count++;
+    }
+    return count;
+}
+
+/*********************************************************************************************************
+** Function name:           checkRxOverflow
+** Descriptions:            return the RX0OVR/RX1OVR flags and clear them, so each overrun is seen once
+*********************************************************************************************************/
+byte MCP_CAN::checkRxOverflow(void)
+{
+    byte overflow = mcp2515_readRegister(MCP_EFLG) & (MCP_EFLG_RX0OVR | MCP_EFLG_RX1OVR);
+    if (overflow)
+    {
+        mcp2515_modifyRegister(MCP_EFLG, overflow, 0);
+    }
+    return overflow;
+}
+
+/*********************************************************************************************************
+** Function name:           isRolloverEnabled
+** Descriptions:            check that a frame arriving while RXB0 is full goes to RXB1 instead of being lost
+*********************************************************************************************************/
+byte MCP_CAN::isRolloverEnabled(void)
+{
+    return (mcp2515_readRegister(MCP_RXB0CTRL) & MCP_RXB_BUKT_MASK) ? 1 : 0;
+}
+
 /*********************************************************************************************************
 ** Function name:           checkError
 ** Descriptions:            if something error
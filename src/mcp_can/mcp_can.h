@@ -62,6 +62,8 @@ private:
 
     void mcp2515_write_canMsg(const byte buffer_sidh_addr, int rtrBit); // write can msg
     void mcp2515_read_canMsg(const byte buffer_sidh_addr);              // read can msg
+    void mcp2515_read_rxBuffer(const byte instruction,                  // read a whole rx buffer in one transfer
+                               unsigned long *id, byte *len, byte *buf);
     void mcp2515_start_transmit(const byte mcp_addr);                   // start transmit
     byte mcp2515_getNextFreeTXBuf(byte *txbuf_n);                       // get Next free txbuf
 
@@ -93,6 +95,9 @@ public:
     byte isRemoteRequest(void);                                                 // get RR flag when receive
     byte isExtendedFrame(void);                                                 // did we recieve 29bit frame?
     byte peekMsgId(unsigned long *ID, byte *ext);
+    byte readMsgBurst(unsigned long *ID, byte *len, byte buf[][MAX_CHAR_IN_MESSAGE]); // drain both rx buffers
+    byte checkRxOverflow(void);                                                 // read and clear RXnOVR
+    byte isRolloverEnabled(void);                                               // RXB0 rolls over into RXB1
 };
 
 #endif
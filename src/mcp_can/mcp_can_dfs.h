@@ -15,6 +15,7 @@
 #define MCP_SIDL        1
 #define MCP_EID8        2
 #define MCP_EID0        3
+#define MCP_DLC         4
 
 #define MCP_TXB_EXIDE_M     0x08                                        // In TXBnSIDL
 #define MCP_DLC_MASK        0x0F                                        // 4 LSBits
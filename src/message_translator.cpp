@@ -0,0 +1,241 @@
+#include "message_translator.h"
+#include "logger/logger.h"
+#include "signals/change_notifier.h"
+#include "signals/derived_signals.h"
+#include <Arduino.h>
+#include <cmath>
+
+static_assert(GT86_FIELD_ROUTE_COUNT <= 255, "Route indices are stored as uint8_t");
+
+size_t MessageTranslator::initialize(SignalConsumer consumer)
+{
+    resolvedCount = 0;
+    for (size_t i = 0; i < GT86_FIELD_ROUTE_COUNT; i++)
+    {
+        const Gt86FieldRoute &route = GT86_FIELD_ROUTES[i];
+        sourceIds[i] = route.source_ecu == 0 ? derivedSignals.find(route.source_name)
+                                             : findSignalId(route.source_ecu, route.source_name);
+        hasRaw[i] = false;
+        stale[i] = true;
+
+        if (sourceIds[i] == SIGNAL_NONE)
+        {
+            LOG_ERROR("GT86 route 0x%03lX bit %u: no signal %s", (unsigned long)route.frame_id, route.start_bit,
+                      route.source_name);
+            continue;
+        }
+
+        // Every change is reported; translate() drops the ones that do not move a packed field
+        changeNotifier.subscribe(consumer, sourceIds[i], Deadband{});
+
+        // Insertion sort keeps the routes of a signal adjacent and in table order
+        size_t k = resolvedCount++;
+        while (k > 0 && sourceIds[order[k - 1]] > sourceIds[i])
+        {
+            order[k] = order[k - 1];
+            k--;
+        }
+        order[k] = (uint8_t)i;
+    }
+
+    return resolvedCount;
+}
+
+uint32_t MessageTranslator::toRaw(const Gt86FieldRoute &route, float value)
+{
+    const float max = (float)((1ULL << route.bit_length) - 1);
+    float raw = value * route.scale + route.offset;
+
+    // Negative and NaN values both fail this test and pack as 0
+    if (!(raw > 0.0f))
+    {
+        return 0;
+    }
+    return raw >= max ? (uint32_t)max : (uint32_t)lroundf(raw);
+}
+
+void MessageTranslator::emit(uint8_t index, uint32_t raw, Gt86FieldUpdate *updates, size_t &count)
+{
+    // lastRaw mirrors what the frame holds, so an unchanged field is not reported again
+    if (hasRaw[index] && lastRaw[index] == raw)
+    {
+        return;
+    }
+
+    lastRaw[index] = raw;
+    hasRaw[index] = true;
+    updates[count++] = Gt86FieldUpdate{index, raw};
+}
+
+size_t MessageTranslator::translate(SignalId id, float value, Gt86FieldUpdate *updates)
+{
+    // Lower bound of id among the sorted routes
+    size_t low = 0;
+    size_t high = resolvedCount;
+    while (low < high)
+    {
+        size_t mid = (low + high) / 2;
+        if (sourceIds[order[mid]] < id)
+        {
+            low = mid + 1;
+        }
+        else
+        {
+            high = mid;
+        }
+    }
+
+    size_t count = 0;
+    for (size_t k = low; k < resolvedCount && sourceIds[order[k]] == id; k++)
+    {
+        uint8_t index = order[k];
+
+        // A value that just changed was just decoded, so it is fresh
+        if (stale[index])
+        {
+            stale[index] = false;
+            freshTransitions++;
+        }
+        emit(index, toRaw(GT86_FIELD_ROUTES[index], value), updates, count);
+    }
+    return count;
+}
+
+size_t MessageTranslator::refresh(uint32_t now, Gt86FieldUpdate *updates)
+{
+    size_t count = 0;
+    SignalSample sample;
+    SignalId loaded = SIGNAL_NONE;
+    bool valid = false;
+
+    for (size_t k = 0; k < resolvedCount; k++)
+    {
+        uint8_t index = order[k];
+        const Gt86FieldRoute &route = GT86_FIELD_ROUTES[index];
+
+        // Routes are sorted by source, so each signal is read once
+        if (sourceIds[index] != loaded)
+        {
+            loaded = sourceIds[index];
+            valid = signalStore.read(loaded, sample) && sample.quality == SignalQuality::Valid;
+        }
+
+        // Signed, as the ISF task may have stamped a sample after now was taken
+        bool fresh = valid && (int32_t)(now - sample.timestamp) <= (int32_t)route.stale_after_ms;
+        if (fresh)
+        {
+            sourceTimestamp[index] = sample.timestamp;
+        }
+        if (fresh != stale[index])
+        {
+            continue;
+        }
+
+        stale[index] = !fresh;
+        if (fresh)
+        {
+            freshTransitions++;
+            emit(index, toRaw(route, sample.value), updates, count);
+        }
+        else
+        {
+            staleTransitions++;
+            if (route.stale_policy == Gt86StalePolicy::Default)
+            {
+                emit(index, defaultRaw[index], updates, count);
+            }
+        }
+    }
+    return count;
+}
+
+void MessageTranslator::recordTransmit(uint32_t frame_id, uint32_t now)
+{
+    bool routed = false;
+    uint32_t age = 0;
+    for (size_t k = 0; k < resolvedCount; k++)
+    {
+        uint8_t index = order[k];
+        if (GT86_FIELD_ROUTES[index].frame_id != frame_id || stale[index])
+        {
+            continue;
+        }
+
+        uint32_t field_age = (int32_t)(now - sourceTimestamp[index]) > 0 ? now - sourceTimestamp[index] : 0;
+        age = field_age > age ? field_age : age;
+        routed = true;
+    }
+    if (!routed)
+    {
+        return;
+    }
+
+    size_t bucket = 0;
+    while (bucket < AGE_BUCKETS - 1 && age > AGE_BUCKET_LIMITS[bucket])
+    {
+        bucket++;
+    }
+    ageHistogram[bucket]++;
+}
+
+void MessageTranslator::logMetrics()
+{
+    static_assert(AGE_BUCKETS == 8, "Update the histogram log line");
+
+    unsigned staleFields = 0;
+    for (size_t k = 0; k < resolvedCount; k++)
+    {
+        staleFields += stale[order[k]];
+    }
+
+    LOG_INFO("GT86 fields: %u/%u stale, %lu stale transitions, %lu recoveries", staleFields, (unsigned)resolvedCount,
+             (unsigned long)staleTransitions, (unsigned long)freshTransitions);
+    LOG_INFO("GT86 data age at transmit (ms): <=10:%lu <=20:%lu <=50:%lu <=100:%lu <=200:%lu <=500:%lu <=1000:%lu >1000:%lu",
+             (unsigned long)ageHistogram[0], (unsigned long)ageHistogram[1], (unsigned long)ageHistogram[2],
+             (unsigned long)ageHistogram[3], (unsigned long)ageHistogram[4], (unsigned long)ageHistogram[5],
+             (unsigned long)ageHistogram[6], (unsigned long)ageHistogram[7]);
+
+    for (uint32_t &bucket : ageHistogram)
+    {
+        bucket = 0;
+    }
+}
+
+void MessageTranslator::benchmark()
+{
+    static constexpr int ROUNDS = 1000;
+
+    if (resolvedCount == 0)
+    {
+        return;
+    }
+
+    Gt86FieldUpdate updates[GT86_FIELD_ROUTE_COUNT];
+    uint8_t data[8] = {};
+    size_t fields = 0;
+
+    unsigned long start = micros();
+    for (int round = 0; round < ROUNDS; round++)
+    {
+        // Alternate values so every route reports a change and gets packed
+        SignalId id = sourceIds[order[round % resolvedCount]];
+        size_t count = translate(id, (float)(round & 0x3F), updates);
+        for (size_t i = 0; i < count; i++)
+        {
+            packGt86Field(data, GT86_FIELD_ROUTES[updates[i].route], updates[i].raw);
+        }
+        fields += count;
+    }
+    unsigned long elapsed = micros() - start;
+
+    // Forget the benchmark values so the first real sample is always sent
+    for (size_t i = 0; i < GT86_FIELD_ROUTE_COUNT; i++)
+    {
+        hasRaw[i] = false;
+        stale[i] = true;
+    }
+    freshTransitions = 0;
+
+    LOG_INFO("GT86 translation: %u routes, %lu translations/s, %u fields packed", (unsigned)resolvedCount,
+             elapsed > 0 ? (unsigned long)(ROUNDS * 1000000ULL / elapsed) : 0UL, (unsigned)fields);
+}
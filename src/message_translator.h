@@ -1,154 +1,232 @@
-#pragma once
-
-#include <vector>
-#include <cstdint>
-#include "common.h"
-#include "logger/logger.h"
-#include "uds/uds_mapper.h"
-
-class MessageTranslator
-{
-public:
-  /**
-   * Translates ISF CAN messages to GT86 format
-   *
-   * @param isfId The CAN ID of the ISF message
-   * @param isfData Pointer to the ISF message data
-   * @param dataLen Length of the data
-   * @return Vector of translated GT86 messages
-   */
-  static std::vector<CANMessage> translateIsfToGt86(uint32_t isfId, uint8_t *isfData, uint8_t dataLen)
-  {
-    std::vector<CANMessage> translatedMessages;
-
-    // Check message ID and apply appropriate translation
-    switch (isfId)
-    {
-    case ISFCAN::RPM: // RPM message
-      translatedMessages.push_back(translateRPM(isfData, dataLen));
-      break;
-
-    case ISFCAN::VEHICLE_SPEED: // Speed message
-      translatedMessages.push_back(translateSpeed(isfData, dataLen));
-      break;
-
-    case ISFCAN::ENGINE_TEMP: // Temperature message
-      translatedMessages.push_back(translateTemperature(isfData, dataLen));
-      break;
-    }
-
-    return translatedMessages;
-  }
-
-  static CANMessage translateRPM(uint8_t *isfData, uint8_t dataLen)
-  {
-    // Check for valid data length
-    if (dataLen < 2)
-    {
-      return createEmptyMessage(GT86CAN::ENGINE_DATA);
-    }
-
-    // Example: Extract RPM from ISF data and format for GT86
-    uint16_t rpm = (isfData[0] << 8) | isfData[1];
-
-    // Create GT86 format message with RPM data
-    return createRPMMessage(rpm);
-  }
-
-  static CANMessage createRPMMessage(uint16_t rpm)
-  {
-    CANMessage gt86Msg;
-    gt86Msg.id = GT86CAN::ENGINE_DATA; // GT86 RPM message ID
-    gt86Msg.len = 8;
-
-    // Initialize data array
-    memset(gt86Msg.data, 0, 8);
-
-    // Set the RPM in GT86 format (adjust scaling as needed)
-    gt86Msg.data[0] = rpm & 0xFF;
-    gt86Msg.data[1] = (rpm >> 8) & 0xFF;
-
-    // Log the translation
-    LOG_DEBUG("Translated RPM: %u", rpm);
-
-    return gt86Msg;
-  }
-
-  static CANMessage translateSpeed(uint8_t *isfData, uint8_t dataLen)
-  {
-    // Check for valid data length
-    if (dataLen < 1)
-    {
-      return createEmptyMessage(GT86CAN::VEHICLE_SPEED);
-    }
-
-    // Extract speed from ISF data
-    uint8_t speed = isfData[0];
-
-    // Create GT86 speed message
-    return createSpeedMessage(speed);
-  }
-
-  static CANMessage createSpeedMessage(uint8_t speed)
-  {
-    CANMessage gt86Msg;
-    gt86Msg.id = GT86CAN::VEHICLE_SPEED; // GT86 Speed message ID
-    gt86Msg.len = 8;
-
-    // Initialize data array
-    memset(gt86Msg.data, 0, 8);
-
-    // Set the speed in GT86 format
-    gt86Msg.data[0] = speed;
-
-    // Additional data might be needed for a complete GT86 message
-    // For example, brake signal, etc.
-
-    // Log the translation
-    LOG_DEBUG("Translated Speed: %u km/h", speed);
-
-    return gt86Msg;
-  }
-
-  static CANMessage translateTemperature(uint8_t *isfData, uint8_t dataLen)
-  {
-    // Check for valid data length
-    if (dataLen < 1)
-    {
-      return createEmptyMessage(GT86CAN::ENGINE_TEMP);
-    }
-
-    // Extract temperature from ISF data
-    // Example: temperature in Celsius + 40 (common CAN protocol offset)
-    int8_t temp = isfData[0] - 40;
-
-    return createTemperatureMessage(temp);
-  }
-
-  static CANMessage createTemperatureMessage(int8_t temp)
-  {
-    CANMessage gt86Msg;
-    gt86Msg.id = GT86CAN::ENGINE_TEMP; // GT86 Temperature message ID
-    gt86Msg.len = 8;
-
-    // Initialize data array
-    memset(gt86Msg.data, 0, 8);
-
-    // Set the temperature in GT86 format
-    gt86Msg.data[0] = temp + 40; // Adding offset back for GT86 format
-
-    // Log the translation
-    LOG_DEBUG("Translated Temperature: %d°C", temp);
-
-    return gt86Msg;
-  }
-
-  static CANMessage createEmptyMessage(uint32_t id)
-  {
-    CANMessage emptyMsg;
-    emptyMsg.id = id;
-    emptyMsg.len = 8;
-    memset(emptyMsg.data, 0, 8);
-    return emptyMsg;
-  }
-};
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include "common.h"
+#include "uds/bit_extract.h"
+#include "signals/signal_registry.h"
+#include "signals/signal_store.h"
+
+/**
+ * @brief What a field shows once its source signal stops updating.
+ */
+enum class Gt86StalePolicy : uint8_t
+{
+    Default,    // The bits of the frame's GT86_PID_MESSAGES payload
+    HoldLast    // The last value translated from fresh data
+};
+
+/**
+ * @brief One GT86 frame field fed by one ISF signal.
+ *
+ * raw = value * scale + offset, clamped to the field width, then packed at
+ * start_bit. For Intel fields start_bit counts from bit 0 of byte 0 of the
+ * little-endian 64-bit payload; for Motorola from the least significant bit of
+ * the big-endian payload (bit 0 of byte 7). A signal may feed any number of
+ * fields, in the same or different frames. A field is stale when its signal
+ * was last decoded more than stale_after_ms ago. event_delta only matters for
+ * frames listed in GT86_EVENT_FRAMES.
+ */
+struct Gt86FieldRoute
+{
+    uint16_t source_ecu;      // ECU tx id of the UDS signal, 0 for a derived signal
+    const char *source_name;
+    uint32_t frame_id;
+    uint8_t start_bit;
+    uint8_t bit_length;
+    ByteOrder byte_order;
+    float scale;
+    float offset;
+    uint16_t stale_after_ms;
+    Gt86StalePolicy stale_policy;
+    uint16_t event_delta;       // Raw change from the last transmitted value that sends an event frame early, 0 for none
+};
+
+// GT86 wheel and vehicle speeds count 1/63.72 km/h per bit
+inline constexpr float GT86_SPEED_SCALE = 63.72f;
+
+// Just over the slowest poll interval allowed for speed and RPM (pollRateLimits), so only a lost ECU trips it
+inline constexpr uint16_t GT86_FAST_STALE_MS = 600;
+// Temperatures may be polled every 5 s and barely move, so they hold their last value instead
+inline constexpr uint16_t GT86_SLOW_STALE_MS = 6000;
+
+// Changes that move the needle visibly: 50 rpm and about 0.5 km/h
+inline constexpr uint16_t GT86_RPM_EVENT_DELTA = 50;
+inline constexpr uint16_t GT86_SPEED_EVENT_DELTA = 32;
+
+// Readme "Minimum ISF Messages for Translation": speed -> 209, wheel speeds -> 212; RPM -> 320, 321; temperatures -> 864.
+// 0xD4 carries the wheels as FL, FR, RL, RR; the skid control ECU (0x7B0 DID 0x03) reports each one separately
+inline constexpr Gt86FieldRoute GT86_FIELD_ROUTES[] = {
+    {0x7E0, "Vehicle Speed", GT86CAN::VEHICLE_SPEED, 0, 16, ByteOrder::Intel, GT86_SPEED_SCALE, 0.0f, GT86_FAST_STALE_MS, Gt86StalePolicy::Default, GT86_SPEED_EVENT_DELTA},
+    {0x7B0, "FL Wheel Speed", GT86CAN::WHEEL_SPEEDS, 0, 16, ByteOrder::Intel, GT86_SPEED_SCALE, 0.0f, GT86_FAST_STALE_MS, Gt86StalePolicy::Default, GT86_SPEED_EVENT_DELTA},
+    {0x7B0, "FR Wheel Speed", GT86CAN::WHEEL_SPEEDS, 16, 16, ByteOrder::Intel, GT86_SPEED_SCALE, 0.0f, GT86_FAST_STALE_MS, Gt86StalePolicy::Default, GT86_SPEED_EVENT_DELTA},
+    {0x7B0, "RL Wheel Speed", GT86CAN::WHEEL_SPEEDS, 32, 16, ByteOrder::Intel, GT86_SPEED_SCALE, 0.0f, GT86_FAST_STALE_MS, Gt86StalePolicy::Default, GT86_SPEED_EVENT_DELTA},
+    {0x7B0, "RR Wheel Speed", GT86CAN::WHEEL_SPEEDS, 48, 16, ByteOrder::Intel, GT86_SPEED_SCALE, 0.0f, GT86_FAST_STALE_MS, Gt86StalePolicy::Default, GT86_SPEED_EVENT_DELTA},
+    {0x7E0, "Engine Speed", GT86CAN::ENGINE_DATA, 16, 14, ByteOrder::Intel, 1.0f, 0.0f, GT86_FAST_STALE_MS, Gt86StalePolicy::Default, GT86_RPM_EVENT_DELTA},
+    {0x7E0, "Engine Speed", GT86CAN::ENGINE_TEMP, 32, 14, ByteOrder::Intel, 1.0f, 0.0f, GT86_FAST_STALE_MS, Gt86StalePolicy::Default, GT86_RPM_EVENT_DELTA},
+    {0x7E0, "Accelerator Position", GT86CAN::ENGINE_DATA, 0, 8, ByteOrder::Intel, 2.55f, 0.0f, GT86_FAST_STALE_MS, Gt86StalePolicy::Default, 0},
+    {0, "Oil Temperature", GT86CAN::TEMPERATURES, 16, 8, ByteOrder::Intel, 1.0f, 40.0f, GT86_SLOW_STALE_MS, Gt86StalePolicy::HoldLast, 0},
+    {0x7E0, "Coolant Temp", GT86CAN::TEMPERATURES, 24, 8, ByteOrder::Intel, 1.0f, 40.0f, GT86_SLOW_STALE_MS, Gt86StalePolicy::HoldLast, 0},
+};
+
+inline constexpr size_t GT86_FIELD_ROUTE_COUNT = sizeof(GT86_FIELD_ROUTES) / sizeof(GT86_FIELD_ROUTES[0]);
+
+constexpr bool sameText(const char *a, const char *b)
+{
+    while (*a != '\0' && *a == *b)
+    {
+        a++;
+        b++;
+    }
+    return *a == *b;
+}
+
+constexpr bool routesTo(const char *source_name, uint32_t frame_id)
+{
+    for (const Gt86FieldRoute &route : GT86_FIELD_ROUTES)
+    {
+        if (sameText(route.source_name, source_name) && route.frame_id == frame_id)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+constexpr bool fieldsFit()
+{
+    for (const Gt86FieldRoute &route : GT86_FIELD_ROUTES)
+    {
+        if (route.bit_length == 0 || route.bit_length > 32 || route.start_bit + route.bit_length > 64)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+static_assert(fieldsFit(), "Every GT86 field must lie inside an 8-byte payload");
+static_assert(routesTo("Vehicle Speed", 209), "Speed must feed GT86 209");
+static_assert(routesTo("FL Wheel Speed", 212) && routesTo("FR Wheel Speed", 212) && routesTo("RL Wheel Speed", 212) && routesTo("RR Wheel Speed", 212),
+              "Every wheel speed must feed GT86 212");
+static_assert(routesTo("Engine Speed", 320) && routesTo("Engine Speed", 321), "RPM must feed GT86 320 and 321");
+static_assert(routesTo("Oil Temperature", 864) && routesTo("Coolant Temp", 864), "Temperatures must feed GT86 864");
+
+/**
+ * @brief A field whose packed raw value changed.
+ */
+struct Gt86FieldUpdate
+{
+    uint8_t route;      // Index into GT86_FIELD_ROUTES
+    uint32_t raw;
+};
+
+/**
+ * @brief Writes raw into one field of an 8-byte payload, leaving the other bits alone.
+ */
+inline void packGt86Field(uint8_t *data, const Gt86FieldRoute &route, uint32_t raw)
+{
+    uint64_t word = 0;
+    for (int i = 0; i < 8; i++)
+    {
+        word |= (uint64_t)data[route.byte_order == ByteOrder::Intel ? i : 7 - i] << (8 * i);
+    }
+
+    uint64_t mask = ((1ULL << route.bit_length) - 1) << route.start_bit;
+    word = (word & ~mask) | (((uint64_t)raw << route.start_bit) & mask);
+
+    for (int i = 0; i < 8; i++)
+    {
+        data[route.byte_order == ByteOrder::Intel ? i : 7 - i] = (uint8_t)(word >> (8 * i));
+    }
+}
+
+/**
+ * @brief Reads one field of an 8-byte payload.
+ */
+inline uint32_t unpackGt86Field(const uint8_t *data, const Gt86FieldRoute &route)
+{
+    uint64_t word = 0;
+    for (int i = 0; i < 8; i++)
+    {
+        word |= (uint64_t)data[route.byte_order == ByteOrder::Intel ? i : 7 - i] << (8 * i);
+    }
+    return (uint32_t)((word >> route.start_bit) & ((1ULL << route.bit_length) - 1));
+}
+
+/**
+ * @brief Table-driven ISF signal to GT86 field translation.
+ *
+ * initialize() resolves every route's source to a SignalId and sorts the route
+ * indices by it, so translate() finds a signal's routes with a binary search and
+ * walks them in place. Each route remembers its last raw value and only fields
+ * whose packed value changed are reported. Nothing is allocated after
+ * initialize().
+ *
+ * Change events only arrive when a value moves, so freshness is judged by
+ * refresh() from the decode timestamps in signalStore: a field whose signal is
+ * older than its stale_after_ms reverts to its policy's value, and returns to
+ * the translated value as soon as a newer sample is decoded.
+ */
+class MessageTranslator
+{
+public:
+    /**
+     * @brief Resolves the routes and subscribes their sources for change events.
+     *
+     * Every field starts out stale, showing its default.
+     *
+     * @return Number of routes whose source signal exists
+     */
+    size_t initialize(SignalConsumer consumer);
+
+    // Raw value a Gt86StalePolicy::Default field reverts to
+    void setDefault(size_t route, uint32_t raw) { defaultRaw[route] = raw; }
+
+    /**
+     * @brief Translates one signal value into the fields it feeds.
+     *
+     * @param updates  Output, at least GT86_FIELD_ROUTE_COUNT entries
+     * @return Number of changed fields written to updates
+     */
+    size_t translate(SignalId id, float value, Gt86FieldUpdate *updates);
+
+    /**
+     * @brief Applies staleness deadlines at time now.
+     *
+     * @param updates  Output, at least GT86_FIELD_ROUTE_COUNT entries
+     * @return Number of fields that went stale or recovered, written to updates
+     */
+    size_t refresh(uint32_t now, Gt86FieldUpdate *updates);
+
+    // Records the age of the oldest fresh field of a frame as it is transmitted
+    void recordTransmit(uint32_t frame_id, uint32_t now);
+
+    // Logs stale transitions and the transmit age histogram, then clears the histogram
+    void logMetrics();
+
+    // Logs translations per second for the routed signals
+    void benchmark();
+
+private:
+    // Upper bounds in ms of the transmit age buckets; the last bucket takes everything older
+    static constexpr uint16_t AGE_BUCKET_LIMITS[] = {10, 20, 50, 100, 200, 500, 1000};
+    static constexpr size_t AGE_BUCKETS = sizeof(AGE_BUCKET_LIMITS) / sizeof(AGE_BUCKET_LIMITS[0]) + 1;
+
+    static uint32_t toRaw(const Gt86FieldRoute &route, float value);
+    void emit(uint8_t index, uint32_t raw, Gt86FieldUpdate *updates, size_t &count);
+
+    SignalId sourceIds[GT86_FIELD_ROUTE_COUNT];
+    uint8_t order[GT86_FIELD_ROUTE_COUNT];      // Route indices sorted by source SignalId
+    uint8_t resolvedCount = 0;
+    uint32_t lastRaw[GT86_FIELD_ROUTE_COUNT] = {};
+    bool hasRaw[GT86_FIELD_ROUTE_COUNT] = {};
+
+    uint32_t defaultRaw[GT86_FIELD_ROUTE_COUNT] = {};
+    uint32_t sourceTimestamp[GT86_FIELD_ROUTE_COUNT] = {};  // Decode time of the last fresh sample
+    bool stale[GT86_FIELD_ROUTE_COUNT] = {};
+    uint32_t staleTransitions = 0;
+    uint32_t freshTransitions = 0;
+    uint32_t ageHistogram[AGE_BUCKETS] = {};
+};
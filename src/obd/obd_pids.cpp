@@ -0,0 +1,51 @@
+#include "obd_pids.h"
+#include "../isotp/iso_tp.h"
+#include <cstring>
+
+uint8_t buildObdMode01Request(const uint8_t *pids, uint8_t count, uint8_t *frame)
+{
+    if (count > OBD_MAX_PIDS_PER_REQUEST)
+    {
+        count = OBD_MAX_PIDS_PER_REQUEST;
+    }
+
+    memset(frame, 0, CAN_MAX_DLEN);
+    frame[0] = 1 + count; // single-frame PCI: mode byte plus PIDs
+    frame[1] = OBD_MODE_SHOW_CURRENT_DATA;
+    memcpy(&frame[2], pids, count);
+
+    return 2 + count;
+}
+
+size_t decodeObdMode01Response(const uint8_t *payload, size_t length, ObdPidValue *values, size_t max_values)
+{
+    if (length < 1 || payload[0] != UDS_POSITIVE_RESPONSE(OBD_MODE_SHOW_CURRENT_DATA))
+    {
+        return 0;
+    }
+
+    size_t decoded = 0;
+    size_t pos = 1;
+
+    while (pos < length && decoded < max_values)
+    {
+        const ObdPidDefinition *definition = findObdPid(payload[pos]);
+        if (definition == nullptr || pos + 1 + definition->data_bytes > length)
+        {
+            break;
+        }
+
+        uint32_t raw = 0;
+        for (uint8_t i = 0; i < definition->data_bytes; i++)
+        {
+            raw = (raw << 8) | payload[pos + 1 + i];
+        }
+
+        values[decoded] = { definition->pid, raw, (float)raw * definition->scale + definition->offset, definition };
+
+        decoded++;
+        pos += 1 + definition->data_bytes;
+    }
+
+    return decoded;
+}
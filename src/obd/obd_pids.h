@@ -0,0 +1,124 @@
+#ifndef _OBD_PIDS_H
+#define _OBD_PIDS_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief SAE J1979 mode 01 PID definition.
+ *
+ * Every supported formula is linear over the big-endian raw value
+ * (A, 256A+B, ...), so value = raw * scale + offset. Bit-field PIDs
+ * (0x00/0x20/0x40 support masks, 0x01 monitor status) use scale 1 and
+ * are interpreted by their own helpers.
+ */
+struct ObdPidDefinition
+{
+    uint8_t pid;
+    uint8_t data_bytes;
+    float scale;
+    float offset;
+    const char *name;
+    const char *unit;
+};
+
+inline constexpr ObdPidDefinition OBD_PID_TABLE[] = {
+    { 0x00, 4, 1.0f,            0.0f,    "OBD PIDs Supported 01-20",   "" },
+    { 0x01, 4, 1.0f,            0.0f,    "OBD Monitor Status",         "" },
+    { 0x04, 1, 100.0f / 255.0f, 0.0f,    "OBD Calculated Load",        "%" },
+    { 0x05, 1, 1.0f,            -40.0f,  "OBD Coolant Temperature",    "C" },
+    { 0x06, 1, 100.0f / 128.0f, -100.0f, "OBD Short Term Fuel Trim B1", "%" },
+    { 0x07, 1, 100.0f / 128.0f, -100.0f, "OBD Long Term Fuel Trim B1", "%" },
+    { 0x08, 1, 100.0f / 128.0f, -100.0f, "OBD Short Term Fuel Trim B2", "%" },
+    { 0x09, 1, 100.0f / 128.0f, -100.0f, "OBD Long Term Fuel Trim B2", "%" },
+    { 0x0A, 1, 3.0f,            0.0f,    "OBD Fuel Pressure",          "kPa" },
+    { 0x0B, 1, 1.0f,            0.0f,    "OBD Intake Manifold Pressure", "kPa" },
+    { 0x0C, 2, 0.25f,           0.0f,    "OBD Engine RPM",             "rpm" },
+    { 0x0D, 1, 1.0f,            0.0f,    "OBD Vehicle Speed",          "km/h" },
+    { 0x0E, 1, 0.5f,            -64.0f,  "OBD Timing Advance",         "deg" },
+    { 0x0F, 1, 1.0f,            -40.0f,  "OBD Intake Air Temperature", "C" },
+    { 0x10, 2, 0.01f,           0.0f,    "OBD MAF Air Flow",           "g/s" },
+    { 0x11, 1, 100.0f / 255.0f, 0.0f,    "OBD Throttle Position",      "%" },
+    { 0x1F, 2, 1.0f,            0.0f,    "OBD Run Time Since Start",   "s" },
+    { 0x20, 4, 1.0f,            0.0f,    "OBD PIDs Supported 21-40",   "" },
+    { 0x21, 2, 1.0f,            0.0f,    "OBD Distance With MIL On",   "km" },
+    { 0x2F, 1, 100.0f / 255.0f, 0.0f,    "OBD Fuel Tank Level",        "%" },
+    { 0x33, 1, 1.0f,            0.0f,    "OBD Barometric Pressure",    "kPa" },
+    { 0x40, 4, 1.0f,            0.0f,    "OBD PIDs Supported 41-60",   "" },
+    { 0x42, 2, 0.001f,          0.0f,    "OBD Control Module Voltage", "V" },
+    { 0x46, 1, 1.0f,            -40.0f,  "OBD Ambient Air Temperature", "C" },
+    { 0x5C, 1, 1.0f,            -40.0f,  "OBD Engine Oil Temperature", "C" },
+};
+
+inline constexpr size_t OBD_PID_COUNT = sizeof(OBD_PID_TABLE) / sizeof(OBD_PID_TABLE[0]);
+inline constexpr uint8_t OBD_PID_NONE = 0xFF;
+
+// J1979 allows up to six PIDs in one mode 01 request (PCI + mode + 6 PIDs = one CAN frame)
+inline constexpr uint8_t OBD_MAX_PIDS_PER_REQUEST = 6;
+
+constexpr std::array<uint8_t, 256> buildObdPidIndex()
+{
+    std::array<uint8_t, 256> index{};
+    for (size_t i = 0; i < index.size(); i++)
+    {
+        index[i] = OBD_PID_NONE;
+    }
+    for (size_t i = 0; i < OBD_PID_COUNT; i++)
+    {
+        index[OBD_PID_TABLE[i].pid] = (uint8_t)i;
+    }
+    return index;
+}
+
+// PID -> table row, resolved at compile time so decoding a response never searches
+inline constexpr std::array<uint8_t, 256> OBD_PID_INDEX = buildObdPidIndex();
+
+static_assert(OBD_PID_COUNT < OBD_PID_NONE, "OBD PID table too large for an 8-bit index");
+
+constexpr const ObdPidDefinition *findObdPid(uint8_t pid)
+{
+    return OBD_PID_INDEX[pid] == OBD_PID_NONE ? nullptr : &OBD_PID_TABLE[OBD_PID_INDEX[pid]];
+}
+
+static_assert(findObdPid(0x0C) != nullptr && findObdPid(0x0C)->data_bytes == 2, "RPM must be a two byte PID");
+static_assert(findObdPid(0x02) == nullptr, "Freeze frame DTC is not a mode 01 data PID");
+
+/**
+ * @brief One decoded PID from a mode 01 response.
+ */
+struct ObdPidValue
+{
+    uint8_t pid;
+    uint32_t raw;
+    float value;
+    const ObdPidDefinition *definition;
+};
+
+// PID 0x01 byte A: bit 7 = MIL, bits 0-6 = number of confirmed emission DTCs
+constexpr bool obdMilOn(uint32_t monitor_status_raw) { return (monitor_status_raw >> 31) & 0x01; }
+constexpr uint8_t obdDtcCount(uint32_t monitor_status_raw) { return (monitor_status_raw >> 24) & 0x7F; }
+
+/**
+ * @brief Builds a single-frame mode 01 request for up to six PIDs.
+ *
+ * @param pids   PIDs to request
+ * @param count  Number of PIDs, clamped to OBD_MAX_PIDS_PER_REQUEST
+ * @param frame  8-byte output frame (PCI, mode, PIDs, zero padding)
+ * @return Number of meaningful bytes including the PCI byte
+ */
+uint8_t buildObdMode01Request(const uint8_t *pids, uint8_t count, uint8_t *frame);
+
+/**
+ * @brief Decodes a (possibly multi-frame) mode 01 response.
+ *
+ * @param payload    Reassembled response starting at the 0x41 service byte
+ * @param length     Number of valid bytes in payload
+ * @param values     Output array
+ * @param max_values Capacity of values
+ * @return Number of PIDs decoded; decoding stops at the first PID not in OBD_PID_TABLE
+ *         because its data length, and therefore the next PID's position, is unknown
+ */
+size_t decodeObdMode01Response(const uint8_t *payload, size_t length, ObdPidValue *values, size_t max_values);
+
+#endif // _OBD_PIDS_H
@@ -0,0 +1,171 @@
+#include "gt86_diag_responder.h"
+#include "../logger/logger.h"
+#include "../signals/derived_signals.h"
+#include "../signals/signal_registry.h"
+#include <cmath>
+
+static_assert(Gt86DiagResponder::BUCKET_COUNT == 8, "logMetrics() prints eight buckets");
+
+void Gt86DiagResponder::initialize()
+{
+    for (size_t i = 0; i < GT86_DIAG_RESPONSE_COUNT; i++)
+    {
+        const Gt86DiagResponse &response = GT86_DIAG_RESPONSES[i];
+        if (response.source_ecu == ISFCAN::OBD_ECU_REQUEST_ID)
+        {
+            sourceIds[i] = findObdSignalId(response.source_name);
+        }
+        else
+        {
+            sourceIds[i] = response.source_ecu == 0 ? derivedSignals.find(response.source_name)
+                                                    : findSignalId(response.source_ecu, response.source_name);
+        }
+
+        if (sourceIds[i] == SIGNAL_NONE)
+        {
+            LOG_ERROR("GT86 diagnostic response 0x%03lX/0x%02X: no signal %s", (unsigned long)response.response_id,
+                      response.local_id, response.source_name);
+        }
+        else if (isDerivedSignal(sourceIds[i]))
+        {
+            derivedSignals.require(sourceIds[i]);
+        }
+        else
+        {
+            signalRegistry.subscribe(SignalConsumer::DiagResponder, sourceIds[i]);
+        }
+
+        build(i, response.default_raw);
+    }
+}
+
+void Gt86DiagResponder::build(size_t index, uint32_t raw)
+{
+    const Gt86DiagResponse &response = GT86_DIAG_RESPONSES[index];
+    uint8_t *frame = frames[index];
+
+    memset(frame, 0, 8);
+    frame[0] = 2 + response.data_bytes;
+    frame[1] = response.service_id + 0x40;
+    frame[2] = response.local_id;
+    for (uint8_t b = 0; b < response.data_bytes; b++)
+    {
+        frame[3 + b] = (uint8_t)(raw >> (8 * (response.data_bytes - 1 - b)));
+    }
+    raws[index] = raw;
+}
+
+void Gt86DiagResponder::refresh()
+{
+    SignalSample sample;
+    for (size_t i = 0; i < GT86_DIAG_RESPONSE_COUNT; i++)
+    {
+        if (sourceIds[i] == SIGNAL_NONE || !signalStore.read(sourceIds[i], sample) ||
+            sample.quality != SignalQuality::Valid)
+        {
+            continue;
+        }
+
+        const Gt86DiagResponse &response = GT86_DIAG_RESPONSES[i];
+        float max_raw = response.data_bytes >= 4 ? 4294967295.0f : (float)((1UL << (8 * response.data_bytes)) - 1);
+        float scaled = roundf(sample.value * response.scale + response.offset);
+        uint32_t raw = (uint32_t)fminf(fmaxf(scaled, 0.0f), max_raw);
+        if (raw != raws[i])
+        {
+            build(i, raw);
+        }
+    }
+}
+
+const uint8_t *Gt86DiagResponder::respond(uint32_t id, const uint8_t *data, uint8_t len, uint32_t &response_id)
+{
+    // Only single frames [len, sid, ...] are requests
+    if (len < 2 || (data[0] & 0xF0) != 0 || data[0] == 0)
+    {
+        return nullptr;
+    }
+
+    const uint8_t service_id = data[1];
+    const uint8_t local_id = data[0] >= 2 && len >= 3 ? data[2] : 0;
+    bool known_request_id = false;
+    for (size_t i = 0; i < GT86_DIAG_RESPONSE_COUNT; i++)
+    {
+        const Gt86DiagResponse &response = GT86_DIAG_RESPONSES[i];
+        if (response.request_id != id)
+        {
+            continue;
+        }
+        known_request_id = true;
+        response_id = response.response_id;
+
+        if (response.service_id == service_id && response.local_id == local_id)
+        {
+            requests++;
+            return frames[i];
+        }
+    }
+    if (!known_request_id)
+    {
+        return nullptr;
+    }
+
+    requests++;
+    memset(scratch, 0, sizeof(scratch));
+    if (service_id == SID_TESTER_PRESENT)
+    {
+        // suppressPosRspMsgIndicationBit: the tester asked for no positive response
+        if (local_id & SUPPRESS_POSITIVE_RESPONSE)
+        {
+            return nullptr;
+        }
+        scratch[0] = 2;
+        scratch[1] = SID_TESTER_PRESENT + 0x40;
+        return scratch;
+    }
+
+    // The service exists on this ECU, just not the local ID
+    bool service_known = false;
+    for (const Gt86DiagResponse &response : GT86_DIAG_RESPONSES)
+    {
+        service_known = service_known || (response.request_id == id && response.service_id == service_id);
+    }
+
+    negative++;
+    scratch[0] = 3;
+    scratch[1] = 0x7F;
+    scratch[2] = service_id;
+    scratch[3] = service_known ? NRC_REQUEST_OUT_OF_RANGE : NRC_SERVICE_NOT_SUPPORTED;
+    return scratch;
+}
+
+void Gt86DiagResponder::recordResponse(int64_t received_us, int64_t sent_us)
+{
+    uint32_t elapsed = (uint32_t)(sent_us - received_us);
+    size_t bucket = 0;
+    while (bucket < BUCKET_COUNT - 1 && elapsed > BUCKET_LIMITS_US[bucket])
+    {
+        bucket++;
+    }
+    buckets[bucket]++;
+    maxResponseUs = elapsed > maxResponseUs ? elapsed : maxResponseUs;
+}
+
+void Gt86DiagResponder::logMetrics()
+{
+    if (requests == 0)
+    {
+        return;
+    }
+
+    LOG_INFO("diag responses: %lu requests (%lu negative), max %lu us, <=0.25/0.5/1/2/5/10/20/>20 ms: "
+             "%lu/%lu/%lu/%lu/%lu/%lu/%lu/%lu",
+             (unsigned long)requests, (unsigned long)negative, (unsigned long)maxResponseUs,
+             (unsigned long)buckets[0], (unsigned long)buckets[1], (unsigned long)buckets[2],
+             (unsigned long)buckets[3], (unsigned long)buckets[4], (unsigned long)buckets[5],
+             (unsigned long)buckets[6], (unsigned long)buckets[7]);
+
+    requests = 0;
+    negative = 0;
+    maxResponseUs = 0;
+    memset(buckets, 0, sizeof(buckets));
+}
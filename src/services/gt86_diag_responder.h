@@ -0,0 +1,115 @@
+#ifndef _GT86_DIAG_RESPONDER_H
+#define _GT86_DIAG_RESPONDER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include "../common.h"
+#include "../signals/signal_store.h"
+
+/**
+ * @brief One diagnostic value the GT86 cluster reads from an ECU the gateway stands in for.
+ *
+ * A single-frame request [len, service_id, local_id] on request_id is answered
+ * on response_id with [len, service_id + 0x40, local_id, raw...], raw being
+ * value * scale + offset, big-endian over data_bytes. source_ecu is the UDS ECU
+ * of the source signal, 0 for a derived signal or ISFCAN::OBD_ECU_REQUEST_ID
+ * for an OBD-II PID. default_raw is answered until the signal has a value.
+ */
+struct Gt86DiagResponse
+{
+    uint32_t request_id;
+    uint32_t response_id;
+    uint8_t service_id;
+    uint8_t local_id;
+    uint8_t data_bytes;
+    uint16_t source_ecu;
+    const char *source_name;
+    float scale;
+    float offset;
+    uint32_t default_raw;
+};
+
+// Fuel level in half litres of the 50 l GT86 tank, so the OBD percentage maps one to one; 0x5A is 45 l
+inline constexpr Gt86DiagResponse GT86_DIAG_RESPONSES[] = {
+    {0x7C0, 0x7C8, 0x21, 0x29, 1, ISFCAN::OBD_ECU_REQUEST_ID, "OBD Fuel Tank Level", 1.0f, 0.0f, 0x5A},
+};
+
+inline constexpr size_t GT86_DIAG_RESPONSE_COUNT = sizeof(GT86_DIAG_RESPONSES) / sizeof(GT86_DIAG_RESPONSES[0]);
+
+constexpr bool diagResponsesFit()
+{
+    for (const Gt86DiagResponse &response : GT86_DIAG_RESPONSES)
+    {
+        // A positive response must fit one single frame
+        if (response.data_bytes == 0 || response.data_bytes > 4)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+static_assert(diagResponsesFit(), "Diagnostic responses must carry 1 to 4 data bytes");
+
+/**
+ * @brief Answers the GT86 cluster's diagnostic requests from precomputed frames.
+ *
+ * Every response frame is built ahead of time and rebuilt by refresh() only
+ * when its source value changes, so answering is a lookup and a copy. Known
+ * request IDs also get a TesterPresent reply, unless the request sets the
+ * suppress-positive-response bit, and a request for a service or local ID the
+ * table does not hold gets a negative response instead of silence, so the
+ * cluster does not wait out its timeout. The time from a request being read
+ * off the bus to the end of the response write is kept as a histogram.
+ *
+ * Single task: every call must come from the GT86 task.
+ */
+class Gt86DiagResponder
+{
+public:
+    // Resolves the source signals and subscribes them so the ISF side polls them
+    void initialize();
+
+    // Rebuilds the responses whose source value changed
+    void refresh();
+
+    /**
+     * @brief Response to a received frame.
+     *
+     * @param response_id  Output, CAN ID to send the response on
+     * @return The 8-byte response, or nullptr if the frame is not a request the responder answers
+     */
+    const uint8_t *respond(uint32_t id, const uint8_t *data, uint8_t len, uint32_t &response_id);
+
+    // Records a response written at sent_us for a request read at received_us
+    void recordResponse(int64_t received_us, int64_t sent_us);
+
+    // Logs and resets the response time histogram
+    void logMetrics();
+
+    // Upper bounds of the response time buckets in microseconds; the last bucket is open
+    static constexpr uint32_t BUCKET_LIMITS_US[] = {250, 500, 1000, 2000, 5000, 10000, 20000};
+    static constexpr size_t BUCKET_COUNT = sizeof(BUCKET_LIMITS_US) / sizeof(BUCKET_LIMITS_US[0]) + 1;
+
+private:
+    static constexpr uint8_t NRC_SERVICE_NOT_SUPPORTED = 0x11;
+    static constexpr uint8_t NRC_REQUEST_OUT_OF_RANGE = 0x31;
+    static constexpr uint8_t SID_TESTER_PRESENT = 0x3E;
+    static constexpr uint8_t SUPPRESS_POSITIVE_RESPONSE = 0x80;     // Sub-function bit 7
+
+    void build(size_t index, uint32_t raw);
+
+    SignalId sourceIds[GT86_DIAG_RESPONSE_COUNT];
+    uint32_t raws[GT86_DIAG_RESPONSE_COUNT];
+    uint8_t frames[GT86_DIAG_RESPONSE_COUNT][8];
+    uint8_t scratch[8];     // Tester present and negative responses
+
+    // Current metrics window
+    uint32_t requests = 0;
+    uint32_t negative = 0;
+    uint32_t buckets[BUCKET_COUNT] = {};
+    uint32_t maxResponseUs = 0;
+};
+
+#endif // _GT86_DIAG_RESPONDER_H
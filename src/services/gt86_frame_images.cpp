@@ -0,0 +1,74 @@
+#include "gt86_frame_images.h"
+#include <cstring>
+
+void Gt86FrameImages::initialize(const CANMessage *messages, size_t count)
+{
+    frameCount = count < MAX_FRAMES ? count : MAX_FRAMES;
+    for (size_t i = 0; i < frameCount; i++)
+    {
+        memcpy(images[i].staging, messages[i].data, sizeof(images[i].staging));
+        publish(images[i]);
+    }
+}
+
+uint8_t *Gt86FrameImages::edit(size_t frame)
+{
+    images[frame].edited = true;
+    return images[frame].staging;
+}
+
+void Gt86FrameImages::commit()
+{
+    for (size_t i = 0; i < frameCount; i++)
+    {
+        if (images[i].edited)
+        {
+            publish(images[i]);
+        }
+    }
+}
+
+void Gt86FrameImages::publish(Image &image)
+{
+    uint32_t words[2];
+    memcpy(words, image.staging, sizeof(words));
+    image.edited = false;
+
+    image.sequence.store(image.sequence.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    image.words[0].store(words[0], std::memory_order_relaxed);
+    image.words[1].store(words[1], std::memory_order_relaxed);
+    image.sequence.store(image.sequence.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+}
+
+bool Gt86FrameImages::read(size_t frame, uint8_t *data) const
+{
+    if (frame >= frameCount)
+    {
+        return false;
+    }
+
+    const Image &image = images[frame];
+    for (int attempt = 0; attempt < MAX_READ_ATTEMPTS; attempt++)
+    {
+        uint32_t before = image.sequence.load(std::memory_order_acquire);
+        if (before & 1)
+        {
+            continue;
+        }
+
+        uint32_t words[2] = {
+            image.words[0].load(std::memory_order_relaxed),
+            image.words[1].load(std::memory_order_relaxed),
+        };
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (image.sequence.load(std::memory_order_relaxed) == before)
+        {
+            memcpy(data, words, sizeof(words));
+            return true;
+        }
+    }
+
+    return false;
+}
@@ -0,0 +1,67 @@
+#ifndef _GT86_FRAME_IMAGES_H
+#define _GT86_FRAME_IMAGES_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include "../common.h"
+
+/**
+ * @brief Live payloads of the periodic GT86 frames, one seqlocked image per frame.
+ *
+ * The translator edits a private staging copy of a frame field by field and
+ * then commits it, which makes the sequence odd, stores the 8 bytes and makes
+ * it even again. The transmit side reads an image with the same retry loop as
+ * SignalStore, so it never waits on the writer and never sees a payload with
+ * only some of a batch's fields applied. Single writer: edit() and commit()
+ * must be called from one task only; read() is safe from any task or timer.
+ */
+class Gt86FrameImages
+{
+public:
+    static constexpr size_t MAX_FRAMES = 32;
+
+    /**
+     * @brief Loads the default payloads; call before any reader starts.
+     */
+    void initialize(const CANMessage *messages, size_t count);
+
+    /**
+     * @brief Staging payload of a frame; changes become visible at the next commit().
+     */
+    uint8_t *edit(size_t frame);
+
+    // Publishes every frame edited since the last commit
+    void commit();
+
+    /**
+     * @brief Copies a frame's latest committed payload.
+     *
+     * @return false if the writer kept republishing the frame; data is then unspecified
+     */
+    bool read(size_t frame, uint8_t *data) const;
+
+    size_t count() const { return frameCount; }
+
+private:
+    // Committing a frame is two stores, so a short spin suffices
+    static constexpr int MAX_READ_ATTEMPTS = 64;
+
+    struct Image
+    {
+        std::atomic<uint32_t> sequence{0};
+        std::atomic<uint32_t> words[2] = {};
+
+        // Owned by the writer
+        uint8_t staging[8] = {};
+        bool edited = false;
+    };
+
+    void publish(Image &image);
+
+    Image images[MAX_FRAMES];
+    size_t frameCount = 0;
+};
+
+#endif // _GT86_FRAME_IMAGES_H
@@ -0,0 +1,108 @@
+#include "gt86_phase_planner.h"
+#include <vector>
+
+static uint32_t gcd(uint32_t a, uint32_t b)
+{
+    while (b != 0)
+    {
+        uint32_t t = a % b;
+        a = b;
+        b = t;
+    }
+    return a;
+}
+
+bool planPhaseOffsets(const CANMessage *messages, size_t count, uint32_t *offsets_ms, PhasePlan &plan)
+{
+    plan = PhasePlan{};
+    const float bits_per_ms = GT86_CAN_BITRATE / 1000.0f;
+
+    uint64_t hyperperiod = 1;
+    uint32_t burst_bits = 0;
+    float bits_per_second = 0.0f;
+    for (size_t i = 0; i < count; i++)
+    {
+        offsets_ms[i] = 0;
+        uint32_t period = messages[i].interval;
+        if (period == 0)
+        {
+            continue;
+        }
+
+        uint32_t bits = canFrameBits(messages[i].len, false);
+        burst_bits += bits;
+        bits_per_second += bits * 1000.0f / period;
+        if (hyperperiod <= MAX_PLAN_HYPERPERIOD_MS)
+        {
+            hyperperiod = hyperperiod / gcd((uint32_t)hyperperiod, period) * period;
+        }
+    }
+
+    plan.average_load = bits_per_second / GT86_CAN_BITRATE;
+    plan.unplanned_peak_load = burst_bits / bits_per_ms;
+    if (hyperperiod > MAX_PLAN_HYPERPERIOD_MS)
+    {
+        plan.peak_load = plan.unplanned_peak_load;
+        return false;
+    }
+    plan.hyperperiod_ms = (uint32_t)hyperperiod;
+
+    // Shortest period first: frequent frames have the fewest free phases left once others are placed
+    std::vector<uint8_t> order;
+    for (size_t i = 0; i < count; i++)
+    {
+        if (messages[i].interval == 0)
+        {
+            continue;
+        }
+        size_t k = order.size();
+        order.push_back((uint8_t)i);
+        while (k > 0 && messages[order[k - 1]].interval > messages[i].interval)
+        {
+            order[k] = order[k - 1];
+            k--;
+        }
+        order[k] = (uint8_t)i;
+    }
+
+    std::vector<uint32_t> load(plan.hyperperiod_ms, 0);
+    for (uint8_t i : order)
+    {
+        const uint32_t period = messages[i].interval;
+        uint32_t best_offset = 0;
+        uint32_t best_peak = UINT32_MAX;
+        uint64_t best_total = UINT64_MAX;
+
+        for (uint32_t offset = 0; offset < period; offset++)
+        {
+            uint32_t peak = 0;
+            uint64_t total = 0;
+            for (uint32_t slot = offset; slot < plan.hyperperiod_ms; slot += period)
+            {
+                peak = load[slot] > peak ? load[slot] : peak;
+                total += load[slot];
+            }
+            if (peak < best_peak || (peak == best_peak && total < best_total))
+            {
+                best_offset = offset;
+                best_peak = peak;
+                best_total = total;
+            }
+        }
+
+        const uint32_t bits = canFrameBits(messages[i].len, false);
+        for (uint32_t slot = best_offset; slot < plan.hyperperiod_ms; slot += period)
+        {
+            load[slot] += bits;
+        }
+        offsets_ms[i] = best_offset;
+    }
+
+    uint32_t peak_bits = 0;
+    for (uint32_t bits : load)
+    {
+        peak_bits = bits > peak_bits ? bits : peak_bits;
+    }
+    plan.peak_load = peak_bits / bits_per_ms;
+    return true;
+}
@@ -0,0 +1,53 @@
+#ifndef _GT86_PHASE_PLANNER_H
+#define _GT86_PHASE_PLANNER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include "../common.h"
+
+// The MCP2515 is initialised for 500 kbit/s (MCP_CAN::begin)
+inline constexpr uint32_t GT86_CAN_BITRATE = 500000;
+
+/**
+ * @brief Worst-case length in bits of a data frame, including bit stuffing and interframe space.
+ *
+ * 34 (standard) or 54 (extended) stuffable header and CRC bits plus the data,
+ * one stuff bit per four after the first, and 13 fixed bits for the CRC
+ * delimiter, ACK, end of frame and interframe space.
+ */
+constexpr uint32_t canFrameBits(uint8_t dlc, bool extended)
+{
+    const uint32_t stuffable = (extended ? 54u : 34u) + 8u * dlc;
+    return stuffable + 13u + (stuffable - 1u) / 4u;
+}
+
+static_assert(canFrameBits(8, false) == 135 && canFrameBits(0, false) == 55, "Standard frame worst case");
+static_assert(canFrameBits(8, true) == 160, "Extended frame worst case");
+
+// Bounds the planner's per-millisecond load table (4 bytes per ms)
+inline constexpr uint32_t MAX_PLAN_HYPERPERIOD_MS = 60000;
+
+struct PhasePlan
+{
+    uint32_t hyperperiod_ms = 0;
+    float average_load = 0.0f;          // Fraction of the bus used over a hyperperiod
+    float peak_load = 0.0f;             // Worst 1 ms slot with the planned offsets, may exceed 1
+    float unplanned_peak_load = 0.0f;   // Worst 1 ms slot with every frame released together
+};
+
+/**
+ * @brief Assigns each periodic message a release offset within its period so no 1 ms slot is crowded.
+ *
+ * Works on the per-millisecond bus load over the hyperperiod (the LCM of the
+ * periods). Messages are placed shortest period first, each at the offset whose
+ * busiest slot is least loaded, ties going to the least total load and then the
+ * earliest offset. Frame lengths are worst-case stuffed standard frames, as
+ * Gt86Service sends every ID as standard. Runs once at boot.
+ *
+ * @param offsets_ms  Output, one entry per message; 0 for messages without a period
+ * @return false if the hyperperiod exceeds MAX_PLAN_HYPERPERIOD_MS; offsets are then all 0
+ */
+bool planPhaseOffsets(const CANMessage *messages, size_t count, uint32_t *offsets_ms, PhasePlan &plan);
+
+#endif // _GT86_PHASE_PLANNER_H
@@ -0,0 +1,79 @@
+#include "gt86_rx_queue.h"
+#include "gt86_diag_responder.h"
+#include "../logger/logger.h"
+
+constexpr bool answeredRequestsKept()
+{
+    for (const Gt86DiagResponse &response : GT86_DIAG_RESPONSES)
+    {
+        for (uint16_t id : GT86_RX_LOW_PRIORITY_IDS)
+        {
+            if (response.request_id == id)
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+static_assert(answeredRequestsKept(), "A request the diagnostic responder answers must never be shed");
+
+Gt86RxQueue::Gt86RxQueue()
+{
+    for (uint16_t id : GT86_RX_LOW_PRIORITY_IDS)
+    {
+        lowPriority[id >> 3] |= (uint8_t)(1u << (id & 7));
+    }
+}
+
+bool Gt86RxQueue::push(const Gt86RxFrame &frame)
+{
+    received++;
+    if (count >= CAPACITY)
+    {
+        overflows++;
+        return false;
+    }
+    if (count >= SHED_DEPTH && isLowPriority(frame.id))
+    {
+        shed++;
+        return false;
+    }
+
+    frames[(head + count) % CAPACITY] = frame;
+    count++;
+    maxDepth = count > maxDepth ? count : maxDepth;
+    return true;
+}
+
+bool Gt86RxQueue::pop(Gt86RxFrame &frame)
+{
+    if (count == 0)
+    {
+        return false;
+    }
+
+    frame = frames[head];
+    head = (head + 1) % CAPACITY;
+    count--;
+    return true;
+}
+
+void Gt86RxQueue::logMetrics()
+{
+    if (received == 0 && hardwareOverflows == 0)
+    {
+        return;
+    }
+
+    LOG_INFO("gt86 rx: %lu frames, max depth %u/%u, %lu shed, %lu queue full, %lu controller overruns",
+             (unsigned long)received, (unsigned)maxDepth, (unsigned)CAPACITY, (unsigned long)shed,
+             (unsigned long)overflows, (unsigned long)hardwareOverflows);
+
+    received = 0;
+    shed = 0;
+    overflows = 0;
+    hardwareOverflows = 0;
+    maxDepth = 0;
+}
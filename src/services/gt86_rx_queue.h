@@ -0,0 +1,80 @@
+#ifndef _GT86_RX_QUEUE_H
+#define _GT86_RX_QUEUE_H
+
+#include <cstddef>
+#include <cstdint>
+#include "../common.h"
+
+// Broadcasts other GT86 nodes put on the bus, which the gateway receives but never answers; under load
+// they are shed before any other frame. The Readme's combination meter IDs are decimal frames the gateway
+// sends itself, so they never arrive here.
+inline constexpr uint16_t GT86_RX_LOW_PRIORITY_IDS[] = {
+    GT86CAN::HVAC_STATUS, GT86CAN::LIGHT_STATUS,
+    // Body ECU (Readme "GT86-Side ECUs")
+    0x2F0, 0x2F1, 0x2F2, 0x2F3, 0x2F4, 0x2F5, 0x2F6, 0x2F7,
+    0x2F8, 0x2F9, 0x2FA, 0x2FB, 0x2FC, 0x2FD, 0x2FE, 0x2FF,
+};
+
+/**
+ * @brief A frame read off the MCP2515, waiting to be handled by the GT86 task.
+ */
+struct Gt86RxFrame
+{
+    uint32_t id;
+    uint8_t len;
+    uint8_t data[8];
+    int64_t received_us;    // esp_timer_get_time() of the interrupt that announced it
+};
+
+/**
+ * @brief Bounded FIFO between draining the MCP2515 receive buffers and handling the frames.
+ *
+ * The two hardware buffers hold one frame each, so the driver side only copies
+ * frames out and handling waits until the burst is drained. Once SHED_DEPTH
+ * frames are waiting, frames from GT86_RX_LOW_PRIORITY_IDS are dropped on
+ * arrival so the remaining room goes to frames that need an answer; a full
+ * queue drops anything. Shed, full-queue drops and hardware overruns are
+ * counted separately, so the log shows which stage fell behind.
+ *
+ * Single task: every call must come from the GT86 task.
+ */
+class Gt86RxQueue
+{
+public:
+    static constexpr size_t CAPACITY = 32;
+    static constexpr size_t SHED_DEPTH = CAPACITY * 3 / 4;
+
+    Gt86RxQueue();
+
+    /**
+     * @return false if the frame was shed or the queue was full
+     */
+    bool push(const Gt86RxFrame &frame);
+
+    bool pop(Gt86RxFrame &frame);
+
+    size_t size() const { return count; }
+
+    // Counts RXB0/RXB1 overruns reported by the controller
+    void recordHardwareOverflow(uint8_t buffers) { hardwareOverflows += buffers; }
+
+    // Logs and resets the counters of the current metrics window
+    void logMetrics();
+
+private:
+    bool isLowPriority(uint32_t id) const { return id < 0x800 && (lowPriority[id >> 3] & (1u << (id & 7))) != 0; }
+
+    uint8_t lowPriority[0x800 / 8] = {};
+    Gt86RxFrame frames[CAPACITY];
+    size_t head = 0;
+    size_t count = 0;
+
+    // Current metrics window
+    uint32_t received = 0;
+    uint32_t shed = 0;
+    uint32_t overflows = 0;
+    uint32_t hardwareOverflows = 0;
+    size_t maxDepth = 0;
+};
+
+#endif // _GT86_RX_QUEUE_H
@@ -1,21 +1,23 @@
 #include "gt86_service.h"
 #include "../logger/logger.h"
-#include "../message_translator.h"
+#include "../signals/change_notifier.h"
+#include "gt86_phase_planner.h"
 #include <freertos/FreeRTOS.h>
 #include <freertos/semphr.h>
 
 
 Gt86Service::Gt86Service()
 {
-    mcp = new MCP_CAN(10); // Initialize MCP_CAN with CS pin 10
-    lastMessageTime = new unsigned long[GT86_CAN_MESSAGES_COUNT](); // initialize all elements to 0
+    mcp = new MCP_CAN(MCP_CS_PIN);
+    frameImages.initialize(GT86_PID_MESSAGES, GT86_CAN_MESSAGES_COUNT);
 }
 
 Gt86Service::~Gt86Service()
 {
+    detachInterrupt(digitalPinToInterrupt(MCP_INT_PIN));
+
     // Clean up dynamically allocated objects
     delete mcp;
-    delete[] lastMessageTime;
 }
 
 bool Gt86Service::initialize()
@@ -25,68 +27,408 @@ bool Gt86Service::initialize()
         LOG_INFO("MCP_CAN initialized with result: %d", res);
     #endif
     vTaskDelay(pdMS_TO_TICKS(10));
+
+    // A frame arriving while RXB0 is still full must roll over into RXB1 instead of overrunning it
+    if (!mcp->isRolloverEnabled())
+    {
+        LOG_ERROR("MCP2515 receive rollover is not enabled");
+    }
+
+    // Subscribing the routed signals also makes the ISF side poll and decode them
+    translator.initialize(SignalConsumer::Gt86Translator);
+    translator.benchmark();
+
+    for (const Gt86PredictedSignal &predicted : GT86_PREDICTED_SIGNALS)
+    {
+        if (!predictor.track(findSignalId(predicted.source_ecu, predicted.source_name), predicted.config))
+        {
+            LOG_ERROR("Cannot predict %s", predicted.source_name);
+        }
+    }
+
+    for (size_t r = 0; r < GT86_FIELD_ROUTE_COUNT; r++)
+    {
+        routeFrame[r] = -1;
+        for (int i = 0; i < GT86_CAN_MESSAGES_COUNT; i++)
+        {
+            if (GT86_PID_MESSAGES[i].id == GT86_FIELD_ROUTES[r].frame_id)
+            {
+                routeFrame[r] = (int8_t)i;
+                break;
+            }
+        }
+        if (routeFrame[r] < 0)
+        {
+            LOG_ERROR("GT86 route to 0x%03lX: frame is not sent", (unsigned long)GT86_FIELD_ROUTES[r].frame_id);
+            continue;
+        }
+        sentRaw[r] = unpackGt86Field(GT86_PID_MESSAGES[routeFrame[r]].data, GT86_FIELD_ROUTES[r]);
+        translator.setDefault(r, sentRaw[r]);
+    }
+
+    // Spread the releases over each period so the hyperperiod boundary is not one burst
+    uint32_t offsets[GT86_CAN_MESSAGES_COUNT];
+    PhasePlan plan;
+    if (!planPhaseOffsets(GT86_PID_MESSAGES, GT86_CAN_MESSAGES_COUNT, offsets, plan))
+    {
+        LOG_ERROR("GT86 hyperperiod too long to plan phases, releasing all frames together");
+    }
+    LOG_INFO("GT86 bus load: %.1f%% average, %.0f%% peak per ms (%.0f%% unplanned), hyperperiod %lu ms",
+             plan.average_load * 100.0f, plan.peak_load * 100.0f, plan.unplanned_peak_load * 100.0f,
+             (unsigned long)plan.hyperperiod_ms);
+
+    // Armed last: the first releases follow the planned offsets from here
+    if (!txScheduler.initialize(GT86_PID_MESSAGES, GT86_CAN_MESSAGES_COUNT, offsets))
+    {
+        return false;
+    }
+
+    for (const Gt86EventFrame &event : GT86_EVENT_FRAMES)
+    {
+        for (int i = 0; i < GT86_CAN_MESSAGES_COUNT; i++)
+        {
+            if (GT86_PID_MESSAGES[i].id == event.id)
+            {
+                eventFrame[i] = true;
+                txScheduler.setMinGap(i, event.min_gap_ms);
+            }
+        }
+    }
+
+    passthroughBridge.benchmark();
+
+    diagResponder.initialize();
+
+    // Wake on signal changes and forwarded frames as well as on releases, so neither waits for a heartbeat
+    changeNotifier.setWakeTask(SignalConsumer::Gt86Translator, xTaskGetCurrentTaskHandle());
+    passthroughBridge.setWakeTask(xTaskGetCurrentTaskHandle());
+
+    // Received frames wake the task too, so both receive buffers are emptied before the next one arrives
+    task = xTaskGetCurrentTaskHandle();
+    pinMode(MCP_INT_PIN, INPUT_PULLUP);
+    attachInterruptArg(digitalPinToInterrupt(MCP_INT_PIN), &Gt86Service::onRxInterrupt, this, FALLING);
+
     return res == CAN_OK;
 }
 
 void Gt86Service::listen()
 {
     sendPidRequests();
-    
-    vTaskDelay(pdMS_TO_TICKS(5));
 
     handleIncomingMessages();
+
+    logMetrics(millis());
 }
 
 bool Gt86Service::sendPidRequests()
 {
-    unsigned long currentTime = millis();
-    bool success = true;
+    // Returns on a release or a signal change
+    uint8_t due[Gt86TxScheduler::MAX_FRAMES];
+    size_t count = txScheduler.waitDue(due, rxInterruptSeen.load(std::memory_order_relaxed) ? MAX_TX_WAIT : RX_POLL_WAIT);
+
+    // Forwarded frames need no translation, so they go out first
+    forwardPassthrough();
+
+    // Translate right before sending so the frames carry the newest values; may trigger event frames
+    applySignalChanges();
+    if (count == 0)
+    {
+        return true;
+    }
 
-    for (int i = 0; i < GT86_CAN_MESSAGES_COUNT; i++) // Iterate through all messages
+    bool success = true;
+    for (size_t k = 0; k < count; k++)
     {
-        CANMessage msg = GT86_PID_MESSAGES[i];
-        
-        if (currentTime - lastMessageTime[i] >= msg.interval)
+        const CANMessage &msg = GT86_PID_MESSAGES[due[k]];
+
+        if (heldByPassthrough(due[k], esp_timer_get_time()))
         {
-            
-            if (mcp->sendMsgBuf(msg.id, 0, 8, reinterpret_cast<byte *>(msg.data)) != CAN_OK)
-            {
-                #ifdef DEBUG_GT86_SERVICE
-                    LOG_ERROR("Failed to send message ID: 0x%X, %s", msg.id, msg.param_name.c_str());
-                #endif
-                success = false;
-            }
-            else
-            {
-                #ifdef DEBUG_GT86_SERVICE
-                    LOG_INFO("Sent message ID: 0x%X, %s", msg.id, msg.param_name.c_str());
-                #endif
-                lastMessageTime[i] = currentTime;
-            }
+            txScheduler.skipped(due[k]);
+            continue;
+        }
 
-            // Only introduce a delay after a certain number of messages to avoid unnecessary delays
-            if ((i + 1) % 2 == 0) // Introduce a delay after sending 2 messages
-            {
-                vTaskDelay(pdMS_TO_TICKS(10)); // You can adjust this delay if needed
-            }
+        // Only while the writer is mid-commit for the whole retry budget; the frame waits for its next release
+        uint8_t data[8];
+        if (!frameImages.read(due[k], data))
+        {
+            continue;
+        }
+
+        // sendMsgBuf waits for a free MCP2515 transmit buffer, so frames released together need no spacing
+        int64_t start = esp_timer_get_time();
+        if (mcp->sendMsgBuf(msg.id, 0, 8, data) != CAN_OK)
+        {
+            #ifdef DEBUG_GT86_SERVICE
+                LOG_ERROR("Failed to send message ID: 0x%X, %s", msg.id, msg.param_name.c_str());
+            #endif
+            success = false;
+        }
+        else
+        {
+            #ifdef DEBUG_GT86_SERVICE
+                LOG_INFO("Sent message ID: 0x%X, %s", msg.id, msg.param_name.c_str());
+            #endif
+            recordSent(due[k], data, start);
+            txScheduler.sent(due[k], start);
+            translator.recordTransmit(msg.id, millis());
         }
+
+        // A burst arriving during a long release must not overrun the two receive buffers
+        drainRx();
     }
 
     return success;
 }
 
+void Gt86Service::forwardPassthrough()
+{
+    PassthroughFrame frame;
+    while (passthroughBridge.next(frame))
+    {
+        if (mcp->sendMsgBuf(frame.id, 0, frame.len, frame.data) != CAN_OK)
+        {
+            #ifdef DEBUG_GT86_SERVICE
+                LOG_ERROR("Failed to forward message ID: 0x%X", frame.id);
+            #endif
+            continue;
+        }
+
+        passthroughBridge.sent(frame, esp_timer_get_time());
+    }
+}
+
+/**
+ * @brief Whether a periodic frame is replaced by ISF frames forwarded to its ID
+ *
+ * While an ISF frame keeps being forwarded there, the periodic default is not
+ * sent (Readme requirement 4).
+ */
+bool Gt86Service::heldByPassthrough(size_t frame, int64_t now) const
+{
+    return passthroughBridge.holds(GT86_PID_MESSAGES[frame].id, GT86_PID_MESSAGES[frame].interval, now);
+}
+
+void Gt86Service::applyUpdates(const Gt86FieldUpdate *updates, size_t count, const SignalSample *sample)
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        const uint8_t r = updates[i].route;
+        const Gt86FieldRoute &route = GT86_FIELD_ROUTES[r];
+        int8_t frame = routeFrame[r];
+        if (frame < 0)
+        {
+            continue;
+        }
+        packGt86Field(frameImages.edit(frame), route, updates[i].raw);
+
+        // Latency is measured for decoded changes, not for stale fallbacks
+        if (sample != nullptr && !changePending[r])
+        {
+            changePending[r] = true;
+            changedAt[r] = sample->timestamp;
+        }
+
+        // The frame is committed before this pass ends, so the early release sends the new value
+        uint32_t delta = updates[i].raw > sentRaw[r] ? updates[i].raw - sentRaw[r] : sentRaw[r] - updates[i].raw;
+        if (eventFrame[frame] && route.event_delta != 0 && delta >= route.event_delta)
+        {
+            txScheduler.trigger(frame);
+        }
+    }
+}
+
+void Gt86Service::recordSent(size_t frame, const uint8_t *data, int64_t start)
+{
+    uint32_t now = millis();
+    for (size_t r = 0; r < GT86_FIELD_ROUTE_COUNT; r++)
+    {
+        if (routeFrame[r] != (int8_t)frame)
+        {
+            continue;
+        }
+
+        sentRaw[r] = unpackGt86Field(data, GT86_FIELD_ROUTES[r]);
+        if (!changePending[r])
+        {
+            continue;
+        }
+        changePending[r] = false;
+
+        // Had the frame only been periodic, the change would have waited for the next heartbeat
+        uint32_t waited = (int32_t)(now - changedAt[r]) > 0 ? now - changedAt[r] : 0;
+        uint32_t heartbeat_wait = txScheduler.isEventSend(frame)
+                                      ? (uint32_t)((txScheduler.nextRelease(frame) - start) / 1000)
+                                      : 0;
+
+        ChangeLatency &stats = latency[frame];
+        stats.changes++;
+        stats.sum_ms += waited;
+        stats.max_ms = waited > stats.max_ms ? waited : stats.max_ms;
+        stats.periodic_sum_ms += waited + heartbeat_wait;
+    }
+}
+
+void Gt86Service::applySignalChanges()
+{
+    Gt86FieldUpdate updates[GT86_FIELD_ROUTE_COUNT];
+    ChangeEvent event;
+    SignalSample sample;
+
+    while (changeNotifier.receive(SignalConsumer::Gt86Translator, event))
+    {
+        // Predicted signals are picked up from the store below
+        if (predictor.tracks(event.id) || !signalStore.read(event.id, sample) ||
+            sample.quality != SignalQuality::Valid)
+        {
+            continue;
+        }
+
+        applyUpdates(updates, translator.translate(event.id, sample.value, updates), &sample);
+    }
+
+    // Runs every pass, so predicted fields move at the task's tick rather than the poll rate
+    uint32_t now = millis();
+    for (size_t i = 0; i < predictor.count(); i++)
+    {
+        sample.quality = SignalQuality::Valid;
+        if (predictor.predict(i, now, sample.value, sample.timestamp))
+        {
+            applyUpdates(updates, translator.translate(predictor.id(i), sample.value, updates), &sample);
+        }
+    }
+
+    // Stale fields fall back to their default, and recover even if the fresh value did not change
+    applyUpdates(updates, translator.refresh(now, updates), nullptr);
+
+    // One commit per drain, so fields changed by the same batch of responses go out together
+    frameImages.commit();
+
+    diagResponder.refresh();
+}
+
+/**
+ * @brief Logs field freshness, transmit data age, per-ID transmit timing and event frame change
+ * latency once per metrics window
+ */
+void Gt86Service::logMetrics(unsigned long now)
+{
+    if (now - lastMetricsTime < METRICS_INTERVAL)
+    {
+        return;
+    }
+
+    translator.logMetrics();
+    predictor.logMetrics();
+    txScheduler.logMetrics();
+    passthroughBridge.logMetrics();
+    diagResponder.logMetrics();
+    rxQueue.logMetrics();
+    if (polledBursts != 0)
+    {
+        LOG_WARN("MCP2515 INT on GPIO %u has not fired, %lu receive bursts found by polling every %lu ms",
+                 (unsigned)MCP_INT_PIN, (unsigned long)polledBursts, (unsigned long)RX_POLL_MS);
+        polledBursts = 0;
+    }
+
+    for (int i = 0; i < GT86_CAN_MESSAGES_COUNT; i++)
+    {
+        ChangeLatency &stats = latency[i];
+        if (!eventFrame[i] || stats.changes == 0)
+        {
+            continue;
+        }
+
+        LOG_INFO("change latency 0x%03lX: avg %lu max %lu ms over %lu changes, periodic only avg %lu ms",
+                 (unsigned long)GT86_PID_MESSAGES[i].id, (unsigned long)(stats.sum_ms / stats.changes),
+                 (unsigned long)stats.max_ms, (unsigned long)stats.changes,
+                 (unsigned long)(stats.periodic_sum_ms / stats.changes));
+        stats = ChangeLatency{};
+    }
+    lastMetricsTime = now;
+}
+
+void IRAM_ATTR Gt86Service::onRxInterrupt(void *arg)
+{
+    Gt86Service *service = static_cast<Gt86Service *>(arg);
+    service->rxInterruptUs.store((uint32_t)esp_timer_get_time(), std::memory_order_relaxed);
+    service->rxInterruptSeen.store(true, std::memory_order_relaxed);
+
+    BaseType_t woken = pdFALSE;
+    vTaskNotifyGiveFromISR(service->task, &woken);
+    portYIELD_FROM_ISR(woken);
+}
+
+/**
+ * @brief Moves every frame in the MCP2515 receive buffers into rxQueue
+ *
+ * Each burst reads both buffers after one status read. Frames are stamped with
+ * the interrupt that announced them, or with the drain time if they were found
+ * by polling.
+ */
+void Gt86Service::drainRx()
+{
+    unsigned long ids[2];
+    uint8_t lens[2];
+    uint8_t data[2][MAX_CHAR_IN_MESSAGE];
+
+    bool received = false;
+    for (size_t burst = 0; burst < Gt86RxQueue::CAPACITY; burst++)
+    {
+        uint8_t count = mcp->readMsgBurst(ids, lens, data);
+        if (count == 0)
+        {
+            break;
+        }
+        received = true;
+
+        int64_t now = esp_timer_get_time();
+        uint32_t since_interrupt = (uint32_t)now - rxInterruptUs.load(std::memory_order_relaxed);
+        int64_t stamp = since_interrupt < RX_INTERRUPT_STAMP_US ? now - since_interrupt : now;
+        for (uint8_t i = 0; i < count; i++)
+        {
+            Gt86RxFrame frame;
+            frame.id = ids[i];
+            frame.len = lens[i];
+            memcpy(frame.data, data[i], sizeof(frame.data));
+            frame.received_us = stamp;
+            rxQueue.push(frame);
+        }
+    }
+
+    if (received)
+    {
+        rxQueue.recordHardwareOverflow(__builtin_popcount(mcp->checkRxOverflow()));
+        if (!rxInterruptSeen.load(std::memory_order_relaxed))
+        {
+            polledBursts++;
+        }
+    }
+}
+
 bool Gt86Service::handleIncomingMessages()
 {
     bool success = true;
-    // uint32_t id;
-    // uint8_t data[8];
-    // uint8_t len;
-    // bool extended;
-    int messagesProcessed = 0;
+    Gt86RxFrame frame;
 
-    while (mcp->checkReceive() == CAN_MSGAVAIL && messagesProcessed < 5)
+    drainRx();
+    while (rxQueue.pop(frame))
     {
-        messagesProcessed++;
+        uint32_t response_id;
+        const uint8_t *response = diagResponder.respond(frame.id, frame.data, frame.len, response_id);
+        if (response == nullptr)
+        {
+            continue;
+        }
+
+        if (mcp->sendMsgBuf(response_id, 0, 8, const_cast<uint8_t *>(response)) != CAN_OK)
+        {
+            success = false;
+            continue;
+        }
+        diagResponder.recordResponse(frame.received_us, esp_timer_get_time());
+
+        // Frames that arrived while the response was written
+        drainRx();
     }
     return success;
 }
\ No newline at end of file
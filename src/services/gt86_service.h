@@ -1,86 +1,136 @@
-#pragma once
-
-#include "../mcp_can/mcp_can.h"
-#include "../common.h"
-
-
-//#define DEBUG_GT86_SERVICE        0
-
-// GT86 CAN messages to be sent periodically
-const CANMessage GT86_PID_MESSAGES[] = {
-    // CAN ID: 0xD1 (209) - Vehicle Speed & Brake Data
-    {0xD1, {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, 8, false, 500, "Speed, brake Pedal"}, // 500ms / 50Hz - Speed, Brake Pedal
-
-    // CAN ID: 0xD3 (211) - Light Status Data
-    {0xD3, {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, 8, false, 500, "VSC, TCS, SCS Lights"}, // 500ms / 50Hz - VSC, TCS, SCS Lights
-
-    // CAN ID: 0x140 (320) - Engine Data 1
-    {0x140, {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, 8, true, 100, "Engine RPM, Throttle, Accelerator"}, // 100ms / 100Hz - Engine RPM, Throttle, Accelerator
-
-    // CAN ID: 0x141 (321) - Engine Data 2
-    {0x141, {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, 8, true, 0, "Engine Load, Gear Position"}, // 100ms / 100Hz - Engine Load, Gear Position
-
-    // CAN ID: 0x142 (322) - Engine Misc Data
-    {0x142, {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, 8, false, 100, "Unknown"}, // 100ms / 100Hz - Unknown
-
-    // CAN ID: 0x361 (865) - Warning & Gear Data
-    {0x361, {0x00, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, 8, false, 200 , "Warning Light, Gear"}, // 200ms / 5Hz - Warning Light, Gear
-
-    // CAN ID: 0x370 (880) - Steering & EPS Status
-    {0x370, {0x00, 0x00, 0x01, 0x01, 0x00, 0x03, 0x00, 0x00}, 8, false, 200, "EPS, Steering Torque"}, // 200ms / 5Hz - EPS, Steering Torque
-
-    // CAN ID: 0x368 (872) - Misc Data
-    {0x368, {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, 8, false, 100, "Unknown"}, // 100ms / 10Hz - Unknown
-
-    // CAN ID: 0x4C6 (1222) - Diagnostic Response
-    {0x4C6, {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, 8, false, 10000, "Diagnostic Response"}, // 10000ms / 0.1Hz - Diagnostic Response
-
-    // CAN ID: 0x4C8 (1224) - Diagnostic Response 2
-    {0x4C8, {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, 8, false, 10000, "Diagnostic Response"}, // 10000ms / 0.1Hz - Diagnostic Response
-
-    // CAN ID: 0x4DC (1244) - Unknown Diagnostic
-    {0x4DC, {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, 8, false, 10000, "Unknown Diagnostic"}, // 10000ms / 0.1Hz - Unknown Diagnostic
-
-    // CAN ID: 0x4DD (1245) - Unknown Diagnostic
-    {0x4DD, {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, 8, false, 10000, "Unknown Diagnostic"}, // 10000ms / 0.1Hz - Unknown Diagnostic
-
-    // CAN ID: 0x63B (1595) - ABS Sensor Data
-    {0x63B, {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, 8, false, 2000, "ABS Sensors"}, // 2000ms / 0.5Hz - ABS Sensors
-
-    // CAN ID: 0x6E1 (1761) - EPS Diagnostic Data
-    {0x6E1, {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, 8, false, 10000, "EPS Diagnostic"}, // 10000ms / 0.1Hz - EPS Diagnostic
-
-    // CAN ID: 0x6E2 (1762) - EPS Diagnostic Data 2
-    {0x6E2, {0xA2, 0x00, 0xCC, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE}, 8, false, 10000, "EPS Diagnostic"}, // 10000ms / 0.1Hz - EPS Diagnostic
-
-    // CAN ID: 0x7C8 (1992) - Fuel Level
-    {0x7C8, {0x03, 0x61, 0x29, 0x5A, 0x00, 0x00, 0x00, 0x00}, 8, false, 1000, "Fuel Level"} // Fuel Level: 45 liters (0x5A = 45 * 2)
-};
-
-// Calculate the size of the array
-const int GT86_CAN_MESSAGES_COUNT = sizeof(GT86_PID_MESSAGES) / sizeof(GT86_PID_MESSAGES[0]);
-
-// #define DEBUG_GT86 // Enable debug mode for GT86
-
-class Gt86Service
-{
-private:
-    MCP_CAN *mcp; // Using MCP_CAN library for CAN communication
-
-
-    unsigned long *lastMessageTime;
-
-    // For monitoring stack usage
-    unsigned long lastStackCheck = 0;
-    static constexpr unsigned long STACK_CHECK_INTERVAL = 5000; // Check stack every 5 seconds
-
-    // Private methods
-    bool sendPidRequests();
-    bool handleIncomingMessages();
-
-public:
-    Gt86Service();
-    ~Gt86Service();
-    bool initialize(); // Initialize MCP_CAN controller
-    void listen(); // Periodically send PID requests and process incoming messages
-};
+#pragma once
+
+#include "../mcp_can/mcp_can.h"
+#include "../common.h"
+#include "../message_translator.h"
+#include "gt86_messages.h"
+#include "gt86_frame_images.h"
+#include "gt86_tx_scheduler.h"
+#include "passthrough_bridge.h"
+#include "gt86_diag_responder.h"
+#include "gt86_rx_queue.h"
+#include <atomic>
+#include "../signals/signal_predictor.h"
+
+
+//#define DEBUG_GT86_SERVICE        0
+
+static_assert(GT86_CAN_MESSAGES_COUNT <= (int)Gt86FrameImages::MAX_FRAMES, "Raise Gt86FrameImages::MAX_FRAMES");
+static_assert(GT86_CAN_MESSAGES_COUNT <= (int)Gt86TxScheduler::MAX_FRAMES, "Raise Gt86TxScheduler::MAX_FRAMES");
+
+/**
+ * @brief A GT86 frame that is also sent early when one of its fields moves by its route's event_delta.
+ *
+ * The periodic transmission stays as a heartbeat; min_gap_ms bounds how often the frame can go out.
+ */
+struct Gt86EventFrame
+{
+    uint32_t id;
+    uint16_t min_gap_ms;
+};
+
+// Tachometer and speedometer; a 20 ms gap caps a fast sweep at 50 frames/s per ID
+inline constexpr Gt86EventFrame GT86_EVENT_FRAMES[] = {
+    {GT86CAN::ENGINE_DATA, 20},
+    {GT86CAN::ENGINE_TEMP, 20},
+    {GT86CAN::VEHICLE_SPEED, 20},
+    {GT86CAN::WHEEL_SPEEDS, 20},
+};
+
+/**
+ * @brief An ISF signal whose GT86 fields are fed from a SignalPredictor instead of the raw samples.
+ */
+struct Gt86PredictedSignal
+{
+    uint16_t source_ecu;
+    const char *source_name;
+    PredictorConfig config;
+};
+
+// Polled at a few Hz but shown on needles. Decoded samples are barely noisy, so the gains favour
+// tracking over smoothing (critically damped at alpha 0.85)
+inline constexpr Gt86PredictedSignal GT86_PREDICTED_SIGNALS[] = {
+    {0x7E0, "Engine Speed", {0.85f, 0.63f, 250, 1500.0f}},
+    {0x7E0, "Vehicle Speed", {0.85f, 0.63f, 250, 20.0f}},
+};
+
+// #define DEBUG_GT86 // Enable debug mode for GT86
+
+class Gt86Service
+{
+private:
+    MCP_CAN *mcp; // Using MCP_CAN library for CAN communication
+
+    // Releases each GT86_PID_MESSAGES entry on its own fixed period
+    Gt86TxScheduler txScheduler;
+
+    // Longest the task sleeps without a release; also the rate predicted signals are re-evaluated at
+    static constexpr TickType_t MAX_TX_WAIT = pdMS_TO_TICKS(20);
+
+    // Extrapolates GT86_PREDICTED_SIGNALS between their polls
+    SignalPredictor predictor;
+
+    // Payloads as sent: GT86_PID_MESSAGES defaults with the translated fields packed in
+    Gt86FrameImages frameImages;
+    MessageTranslator translator;
+    int8_t routeFrame[GT86_FIELD_ROUTE_COUNT];      // GT86_PID_MESSAGES index of each route, -1 if not sent
+
+    // Event-triggered transmission and the latency from decoding a change to sending it
+    struct ChangeLatency
+    {
+        uint32_t changes = 0;
+        uint32_t sum_ms = 0;
+        uint32_t max_ms = 0;
+        uint32_t periodic_sum_ms = 0;   // What the same changes would have waited for the heartbeat
+    };
+
+    bool eventFrame[GT86_CAN_MESSAGES_COUNT] = {};
+    uint32_t sentRaw[GT86_FIELD_ROUTE_COUNT] = {};      // Field value in the last transmitted frame
+    uint32_t changedAt[GT86_FIELD_ROUTE_COUNT] = {};    // Decode time of the oldest change not yet transmitted
+    bool changePending[GT86_FIELD_ROUTE_COUNT] = {};
+    ChangeLatency latency[GT86_CAN_MESSAGES_COUNT];
+
+    // Answers the cluster's diagnostic requests
+    Gt86DiagResponder diagResponder;
+
+    // ESP32-CAN-X2 wiring of its MCP2515 (CAN2); CAN1 is the TWAI on TwaiWrapper::TWAI_TX/TWAI_RX.
+    // INT is active low while a receive buffer is full.
+    static constexpr uint8_t MCP_CS_PIN = 10;
+    static constexpr uint8_t MCP_INT_PIN = 3;
+
+    // Until the first interrupt proves INT is wired, the receive buffers are polled every RX_POLL_WAIT
+    // instead of every MAX_TX_WAIT, so a board wired differently still receives without overruns
+    static constexpr uint32_t RX_POLL_MS = 2;
+    static constexpr TickType_t RX_POLL_WAIT = pdMS_TO_TICKS(RX_POLL_MS);
+    TaskHandle_t task = nullptr;
+    std::atomic<uint32_t> rxInterruptUs{0};     // Low 32 bits of esp_timer_get_time() at the last interrupt
+    std::atomic<bool> rxInterruptSeen{false};
+    uint32_t polledBursts = 0;                  // Bursts found by polling before any interrupt, per metrics window
+    static constexpr uint32_t RX_INTERRUPT_STAMP_US = 20000;   // Older interrupts did not announce the frames being read
+    Gt86RxQueue rxQueue;
+
+    // For monitoring stack usage
+    unsigned long lastStackCheck = 0;
+    static constexpr unsigned long STACK_CHECK_INTERVAL = 5000; // Check stack every 5 seconds
+
+    static constexpr unsigned long METRICS_INTERVAL = 5000;
+    unsigned long lastMetricsTime = 0;
+
+    // Private methods
+    bool sendPidRequests();
+    void forwardPassthrough();
+    bool heldByPassthrough(size_t frame, int64_t now) const;
+    void drainRx();
+    static void onRxInterrupt(void *arg);
+    bool handleIncomingMessages();
+    void applySignalChanges(); // Packs changed and stale ISF signals into frameImages
+    void applyUpdates(const Gt86FieldUpdate *updates, size_t count, const SignalSample *sample);
+    void recordSent(size_t frame, const uint8_t *data, int64_t start);
+    void logMetrics(unsigned long now);
+
+public:
+    Gt86Service();
+    ~Gt86Service();
+    bool initialize(); // Initialize MCP_CAN controller
+    void listen(); // Periodically send PID requests and process incoming messages
+};
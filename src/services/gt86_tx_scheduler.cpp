@@ -0,0 +1,209 @@
+#include "gt86_tx_scheduler.h"
+#include "../logger/logger.h"
+
+Gt86TxScheduler::~Gt86TxScheduler()
+{
+    if (timer != nullptr)
+    {
+        esp_timer_stop(timer);
+        esp_timer_delete(timer);
+    }
+}
+
+bool Gt86TxScheduler::initialize(const CANMessage *messages, size_t count, const uint32_t *offsets_ms)
+{
+    task = xTaskGetCurrentTaskHandle();
+    slotCount = count < MAX_FRAMES ? count : MAX_FRAMES;
+
+    int64_t now = esp_timer_get_time();
+    for (size_t i = 0; i < slotCount; i++)
+    {
+        slots[i] = Slot{};
+        slots[i].id = messages[i].id;
+        slots[i].period_us = (int64_t)messages[i].interval * 1000;
+        slots[i].release_us = now + (offsets_ms != nullptr ? (int64_t)offsets_ms[i] * 1000 : 0);
+    }
+
+    const esp_timer_create_args_t args = {
+        .callback = &Gt86TxScheduler::onTimer,
+        .arg = this,
+        .dispatch_method = ESP_TIMER_TASK,
+        .name = "gt86_tx",
+        .skip_unhandled_events = true,
+    };
+    if (esp_timer_create(&args, &timer) != ESP_OK)
+    {
+        LOG_ERROR("Failed to create GT86 transmit timer");
+        timer = nullptr;
+        return false;
+    }
+
+    arm(now);
+    return true;
+}
+
+void Gt86TxScheduler::onTimer(void *arg)
+{
+    xTaskNotifyGive(static_cast<Gt86TxScheduler *>(arg)->task);
+}
+
+void Gt86TxScheduler::arm(int64_t now)
+{
+    int64_t next = INT64_MAX;
+    for (size_t i = 0; i < slotCount; i++)
+    {
+        if (slots[i].period_us > 0 && slots[i].release_us < next)
+        {
+            next = slots[i].release_us;
+        }
+        if (slots[i].event_release_us < next)
+        {
+            next = slots[i].event_release_us;
+        }
+    }
+    if (timer == nullptr || next == INT64_MAX)
+    {
+        return;
+    }
+
+    // Stopping an expired one-shot timer fails harmlessly
+    esp_timer_stop(timer);
+    esp_timer_start_once(timer, next > now ? (uint64_t)(next - now) : 0);
+}
+
+size_t Gt86TxScheduler::waitDue(uint8_t *due, TickType_t wait)
+{
+    ulTaskNotifyTake(pdTRUE, wait);
+
+    int64_t now = esp_timer_get_time();
+    size_t count = 0;
+    for (size_t i = 0; i < slotCount; i++)
+    {
+        Slot &slot = slots[i];
+        bool periodic = slot.period_us > 0 && now >= slot.release_us;
+        bool event = now >= slot.event_release_us;
+        if (!periodic && !event)
+        {
+            continue;
+        }
+
+        if (periodic)
+        {
+            slot.due_release_us = slot.release_us;
+            slot.release_us += slot.period_us;
+
+            // Skip whole missed periods instead of catching up with a burst
+            if (slot.release_us <= now)
+            {
+                int64_t missed = (now - slot.release_us) / slot.period_us + 1;
+                slot.release_us += missed * slot.period_us;
+                slot.overruns += (uint32_t)missed;
+            }
+
+            // The frame went out as an event less than a gap ago, so this heartbeat adds nothing
+            if (!event && slot.event_sends_since_heartbeat && now - slot.last_sent_us < slot.min_gap_us)
+            {
+                slot.last_heartbeat_us = 0;
+                continue;
+            }
+        }
+        else
+        {
+            slot.due_release_us = slot.event_release_us;
+        }
+
+        // A heartbeat also carries whatever the pending event would have sent
+        slot.event_send = !periodic;
+        slot.event_release_us = INT64_MAX;
+
+        // Shortest period first, so the fastest frames see the least lateness
+        size_t k = count++;
+        while (k > 0 && slots[due[k - 1]].period_us > slot.period_us)
+        {
+            due[k] = due[k - 1];
+            k--;
+        }
+        due[k] = (uint8_t)i;
+    }
+
+    arm(now);
+    return count;
+}
+
+void Gt86TxScheduler::sent(size_t frame, int64_t now_us)
+{
+    Slot &slot = slots[frame];
+
+    uint32_t lateness = (uint32_t)(now_us - slot.due_release_us);
+    slot.max_lateness_us = lateness > slot.max_lateness_us ? lateness : slot.max_lateness_us;
+
+    if (slot.event_send)
+    {
+        slot.event_sends++;
+        slot.event_sends_since_heartbeat = true;
+    }
+    else
+    {
+        if (slot.last_heartbeat_us != 0)
+        {
+            int64_t deviation = now_us - slot.last_heartbeat_us - slot.period_us;
+            uint32_t jitter = (uint32_t)(deviation < 0 ? -deviation : deviation);
+            slot.jitter_samples++;
+            slot.jitter_sum_us += jitter;
+            slot.max_jitter_us = jitter > slot.max_jitter_us ? jitter : slot.max_jitter_us;
+        }
+        slot.last_heartbeat_us = now_us;
+        slot.event_sends_since_heartbeat = false;
+    }
+    slot.last_sent_us = now_us;
+    slot.sends++;
+
+    // Whatever a pending trigger wanted to send has just gone out
+    slot.event_release_us = INT64_MAX;
+}
+
+void Gt86TxScheduler::trigger(size_t frame)
+{
+    Slot &slot = slots[frame];
+    if (slot.min_gap_us == 0)
+    {
+        return;
+    }
+
+    int64_t now = esp_timer_get_time();
+    int64_t release = slot.last_sent_us != 0 && slot.last_sent_us + slot.min_gap_us > now
+                          ? slot.last_sent_us + slot.min_gap_us
+                          : now;
+    if (release < slot.event_release_us)
+    {
+        slot.event_release_us = release;
+        arm(now);
+    }
+}
+
+void Gt86TxScheduler::logMetrics()
+{
+    for (size_t i = 0; i < slotCount; i++)
+    {
+        Slot &slot = slots[i];
+        if (slot.period_us == 0)
+        {
+            continue;
+        }
+
+        LOG_INFO("tx 0x%03lX period=%lu ms sent=%lu (%lu events) jitter avg=%lu max=%lu us late max=%lu us overruns=%lu",
+                 (unsigned long)slot.id, (unsigned long)(slot.period_us / 1000), (unsigned long)slot.sends,
+                 (unsigned long)slot.event_sends,
+                 slot.jitter_samples ? (unsigned long)(slot.jitter_sum_us / slot.jitter_samples) : 0UL,
+                 (unsigned long)slot.max_jitter_us, (unsigned long)slot.max_lateness_us,
+                 (unsigned long)slot.overruns);
+
+        slot.sends = 0;
+        slot.event_sends = 0;
+        slot.overruns = 0;
+        slot.jitter_samples = 0;
+        slot.jitter_sum_us = 0;
+        slot.max_jitter_us = 0;
+        slot.max_lateness_us = 0;
+    }
+}
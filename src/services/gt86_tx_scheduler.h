@@ -0,0 +1,117 @@
+#ifndef _GT86_TX_SCHEDULER_H
+#define _GT86_TX_SCHEDULER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "../common.h"
+
+/**
+ * @brief Cyclic release of the periodic GT86 frames from an esp_timer.
+ *
+ * Every frame has an absolute release time in esp_timer microseconds that
+ * advances by exactly its period, so when a frame goes out has no effect on
+ * when the next one is due and periods cannot drift. A one-shot timer is armed
+ * for the earliest release and wakes the owning task with a task notification;
+ * the SPI transfers to the MCP2515 stay on that task instead of running in the
+ * esp_timer task. A release missed by a whole period is skipped and counted as
+ * an overrun rather than sent late in a burst.
+ *
+ * A frame with a minimum gap can also be released early by trigger(), as soon
+ * as the gap since its last transmission allows. Its periodic releases carry on
+ * as a heartbeat, except that one falling inside the gap after an event send is
+ * skipped, since that frame has only just gone out.
+ *
+ * Per frame it records the deviation of each heartbeat-to-heartbeat interval
+ * from the period (jitter) and how long after its release a frame actually
+ * went out.
+ */
+class Gt86TxScheduler
+{
+public:
+    static constexpr size_t MAX_FRAMES = 32;
+
+    ~Gt86TxScheduler();
+
+    /**
+     * @brief Schedules every message with a non-zero interval.
+     *
+     * Must be called from the task that will call waitDue().
+     *
+     * @param offsets_ms  First release of each message relative to now (see planPhaseOffsets),
+     *                    or nullptr to release all of them now
+     * @return false if the timer could not be created
+     */
+    bool initialize(const CANMessage *messages, size_t count, const uint32_t *offsets_ms = nullptr);
+
+    /**
+     * @brief Blocks until at least one frame is released or wait expires.
+     *
+     * @param due  Output, at least MAX_FRAMES entries; filled with message indices,
+     *             shortest period first
+     * @return Number of released frames
+     */
+    size_t waitDue(uint8_t *due, TickType_t wait);
+
+    // Records that a released frame started transmitting at now_us (esp_timer_get_time())
+    void sent(size_t frame, int64_t now_us);
+
+    // Records that a released frame was not sent because another source carried it, so the gap is not jitter
+    void skipped(size_t frame) { slots[frame].last_heartbeat_us = 0; }
+
+    // Enables trigger() for a frame; 0 makes it purely periodic again
+    void setMinGap(size_t frame, uint32_t min_gap_ms) { slots[frame].min_gap_us = (int64_t)min_gap_ms * 1000; }
+
+    /**
+     * @brief Releases a frame with a minimum gap early: now, or when the gap since its last send ends.
+     *
+     * Ignored for purely periodic frames. Call from the task that calls waitDue().
+     */
+    void trigger(size_t frame);
+
+    // True if the frame being sent was released by trigger() rather than by its period
+    bool isEventSend(size_t frame) const { return slots[frame].event_send; }
+
+    // Next periodic release of a frame, in esp_timer microseconds
+    int64_t nextRelease(size_t frame) const { return slots[frame].release_us; }
+
+    // Logs and resets the per-frame timing of the current metrics window
+    void logMetrics();
+
+private:
+    struct Slot
+    {
+        uint32_t id = 0;
+        int64_t period_us = 0;          // 0 for messages that are not cyclic
+        int64_t release_us = 0;         // Next release
+        int64_t due_release_us = 0;     // Release the frame is currently being sent for
+        int64_t last_sent_us = 0;
+        int64_t last_heartbeat_us = 0;
+        int64_t min_gap_us = 0;         // 0 for frames that are only sent periodically
+        int64_t event_release_us = INT64_MAX;
+        bool event_send = false;                    // Reason for the current release
+        bool event_sends_since_heartbeat = false;
+
+        // Current metrics window
+        uint32_t sends = 0;
+        uint32_t overruns = 0;
+        uint32_t event_sends = 0;
+        uint32_t jitter_samples = 0;
+        uint64_t jitter_sum_us = 0;
+        uint32_t max_jitter_us = 0;
+        uint32_t max_lateness_us = 0;
+    };
+
+    static void onTimer(void *arg);
+    void arm(int64_t now);
+
+    esp_timer_handle_t timer = nullptr;
+    TaskHandle_t task = nullptr;
+    Slot slots[MAX_FRAMES];
+    size_t slotCount = 0;
+};
+
+#endif // _GT86_TX_SCHEDULER_H
@@ -0,0 +1,182 @@
+#include "isf_broadcast.h"
+#include "../logger/logger.h"
+#include "../signals/change_notifier.h"
+#include "../signals/derived_signals.h"
+#include <Arduino.h>
+
+static_assert(ISF_BROADCAST_FIELD_COUNT <= SignalStore::MAX_SEPARATE_SIGNALS, "Raise MAX_SEPARATE_SIGNALS");
+
+void IsfBroadcast::separateSignals()
+{
+    for (const IsfBroadcastField &definition : ISF_BROADCAST_FIELDS)
+    {
+        SignalId id = findSignalId(definition.target_ecu, definition.target_name);
+        if (id != SIGNAL_NONE && !signalStore.separate(id))
+        {
+            LOG_ERROR("ISF broadcast: cannot separate %s in the signal store", definition.target_name);
+        }
+    }
+}
+
+size_t IsfBroadcast::initialize()
+{
+    memset(frameIndex, NO_FRAME, sizeof(frameIndex));
+    frameCount = 0;
+
+    size_t resolved = 0;
+    for (size_t i = 0; i < ISF_BROADCAST_FIELD_COUNT; i++)
+    {
+        const IsfBroadcastField &definition = ISF_BROADCAST_FIELDS[i];
+        fields[i] = Field{};
+        fields[i].id = findSignalId(definition.target_ecu, definition.target_name);
+        if (fields[i].id == SIGNAL_NONE)
+        {
+            LOG_ERROR("ISF broadcast 0x%03lX byte %u: no signal %s", (unsigned long)definition.frame_id,
+                      definition.byte, definition.target_name);
+        }
+        else
+        {
+            resolved++;
+        }
+
+        uint8_t &slot = frameIndex[definition.frame_id];
+        if (slot == NO_FRAME)
+        {
+            slot = frameCount++;
+            frames[slot] = Frame{};
+            frames[slot].id = definition.frame_id;
+            frames[slot].first = (uint8_t)i;
+        }
+        frames[slot].count++;
+    }
+
+    LOG_INFO("ISF broadcast: %u frames, %u of %u signals resolved", frameCount, (unsigned)resolved,
+             (unsigned)ISF_BROADCAST_FIELD_COUNT);
+    return resolved;
+}
+
+bool IsfBroadcast::onFrame(uint32_t id, const uint8_t *data, uint8_t len)
+{
+    if (id >= sizeof(frameIndex) || frameIndex[id] == NO_FRAME)
+    {
+        return false;
+    }
+
+    Frame &frame = frames[frameIndex[id]];
+    frame.received++;
+    uint32_t timestamp = millis();
+
+    // Each target signal has a store group of its own (separateSignals()), so it is published alone
+    bool published = false;
+    for (uint8_t i = frame.first; i < frame.first + frame.count; i++)
+    {
+        const IsfBroadcastField &definition = ISF_BROADCAST_FIELDS[i];
+        Field &field = fields[i];
+        if (field.id == SIGNAL_NONE)
+        {
+            continue;
+        }
+        if (definition.byte + fieldBytes(definition.bit_offset, definition.bit_length) > len)
+        {
+            frame.short_frames++;
+            continue;
+        }
+
+        uint32_t raw = extractBits(&data[definition.byte], definition.bit_offset, definition.bit_length,
+                                   definition.byte_order, false);
+        float value = raw * definition.scale + definition.offset;
+
+        signalStore.beginPublish(field.id);
+        signalStore.publish(field.id, value, timestamp);
+        signalStore.endPublish(field.id);
+
+        changeNotifier.update(field.id, value, timestamp);
+        derivedSignals.onPublished(field.id, value, timestamp);
+
+        field.broadcast.record(timestamp, 0);
+        field.last_ms = timestamp;
+        field.received = true;
+        published = true;
+    }
+
+    if (published)
+    {
+        derivedSignals.evaluateDirty(timestamp);
+    }
+    return true;
+}
+
+bool IsfBroadcast::owns(SignalId id, uint32_t now) const
+{
+    for (const Field &field : fields)
+    {
+        if (field.id == id && field.received && now - field.last_ms < FRESH_MS)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+void IsfBroadcast::recordUds(SignalId id, uint32_t now, uint32_t response_ms)
+{
+    for (Field &field : fields)
+    {
+        if (field.id == id)
+        {
+            field.uds.record(now, response_ms);
+        }
+    }
+}
+
+void IsfBroadcast::PathStats::record(uint32_t now, uint32_t transport_ms)
+{
+    if (last_ms != 0)
+    {
+        uint32_t interval = now - last_ms;
+        updates++;
+        interval_sum_ms += interval;
+        max_interval_ms = interval > max_interval_ms ? interval : max_interval_ms;
+        transport_sum_ms += transport_ms;
+    }
+    last_ms = now;
+}
+
+void IsfBroadcast::logMetrics()
+{
+    for (uint8_t f = 0; f < frameCount; f++)
+    {
+        Frame &frame = frames[f];
+        if (frame.short_frames != 0)
+        {
+            LOG_WARN("ISF broadcast 0x%03lX: %lu of %lu frames too short", (unsigned long)frame.id,
+                     (unsigned long)frame.short_frames, (unsigned long)frame.received);
+        }
+        frame.received = 0;
+        frame.short_frames = 0;
+    }
+
+    // A consumer sees data up to one interval plus the transport time old
+    for (size_t i = 0; i < ISF_BROADCAST_FIELD_COUNT; i++)
+    {
+        Field &field = fields[i];
+        if (field.id == SIGNAL_NONE || (field.broadcast.updates == 0 && field.uds.updates == 0))
+        {
+            continue;
+        }
+
+        PathStats &broadcast = field.broadcast;
+        PathStats &uds = field.uds;
+        LOG_INFO("%s: broadcast %lu updates, interval avg %lu max %lu ms | uds %lu updates, interval avg %lu max %lu "
+                 "ms, response avg %lu ms",
+                 ISF_BROADCAST_FIELDS[i].target_name, (unsigned long)broadcast.updates,
+                 broadcast.updates ? (unsigned long)(broadcast.interval_sum_ms / broadcast.updates) : 0UL,
+                 (unsigned long)broadcast.max_interval_ms, (unsigned long)uds.updates,
+                 uds.updates ? (unsigned long)(uds.interval_sum_ms / uds.updates) : 0UL,
+                 (unsigned long)uds.max_interval_ms,
+                 uds.updates ? (unsigned long)(uds.transport_sum_ms / uds.updates) : 0UL);
+
+        broadcast = PathStats{broadcast.last_ms};
+        uds = PathStats{uds.last_ms};
+    }
+}
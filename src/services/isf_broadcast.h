@@ -0,0 +1,161 @@
+#ifndef _ISF_BROADCAST_H
+#define _ISF_BROADCAST_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include "../common.h"
+#include "../uds/bit_extract.h"
+#include "../signals/signal_store.h"
+
+/**
+ * @brief One signal carried by a periodic ISF broadcast frame.
+ *
+ * The field is read like a DID field: bit_offset and bit_length within the
+ * bytes starting at byte, value = raw * scale + offset. It is published under
+ * the ID of the UDS signal target_name of ECU target_ecu, so consumers and the
+ * GT86 routes see one signal whichever path delivered it.
+ */
+struct IsfBroadcastField
+{
+    uint32_t frame_id;
+    uint8_t byte;
+    uint8_t bit_offset;
+    uint8_t bit_length;
+    ByteOrder byte_order;
+    float scale;
+    float offset;
+    uint16_t target_ecu;
+    const char *target_name;
+};
+
+// Toyota powertrain broadcast layouts; temperatures follow the Readme 864 mapping (C - 40, D - 40)
+inline constexpr IsfBroadcastField ISF_BROADCAST_FIELDS[] = {
+    {ISFCAN::RPM, 0, 0, 16, ByteOrder::Motorola, 1.0f, 0.0f, 0x7E0, "Engine Speed"},
+    {ISFCAN::VEHICLE_SPEED, 5, 0, 16, ByteOrder::Motorola, 0.01f, 0.0f, 0x7E0, "Vehicle Speed"},
+    {ISFCAN::ENGINE_TEMP, 2, 0, 8, ByteOrder::Motorola, 1.0f, -40.0f, 0x7E0, "Engine Oil Temperature"},
+    {ISFCAN::ENGINE_TEMP, 3, 0, 8, ByteOrder::Motorola, 1.0f, -40.0f, 0x7E0, "Coolant Temp"},
+};
+
+inline constexpr size_t ISF_BROADCAST_FIELD_COUNT = sizeof(ISF_BROADCAST_FIELDS) / sizeof(ISF_BROADCAST_FIELDS[0]);
+
+constexpr bool broadcastFieldsGrouped()
+{
+    for (size_t i = 0; i < ISF_BROADCAST_FIELD_COUNT; i++)
+    {
+        const IsfBroadcastField &field = ISF_BROADCAST_FIELDS[i];
+        if (field.frame_id > 0x7FF || field.bit_length == 0 || field.bit_offset + field.bit_length > 32 ||
+            field.byte + fieldBytes(field.bit_offset, field.bit_length) > 8)
+        {
+            return false;
+        }
+        // The fields of a frame must be adjacent so one index entry covers them
+        for (size_t j = i + 2; j < ISF_BROADCAST_FIELD_COUNT; j++)
+        {
+            if (ISF_BROADCAST_FIELDS[j].frame_id == field.frame_id &&
+                ISF_BROADCAST_FIELDS[j - 1].frame_id != field.frame_id)
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+static_assert(broadcastFieldsGrouped(), "Broadcast fields must be standard IDs, fit 8 bytes and be grouped by frame");
+
+/**
+ * @brief Decodes ISF broadcast frames as they are received and publishes their signals.
+ *
+ * Frames are dispatched through a table indexed by the 11-bit CAN ID, so a
+ * frame nobody decodes costs one byte load. A broadcast signal is the primary
+ * source while frames keep arriving: owns() tells the UDS path to leave the
+ * signal alone until the broadcast has been silent for FRESH_MS, after which
+ * polling takes over again. Both paths record how often each signal was
+ * refreshed, logged side by side by logMetrics().
+ *
+ * Single task: every call must come from the ISF task, the signalStore writer.
+ */
+class IsfBroadcast
+{
+public:
+    // Several times the slowest broadcast period, so only a silent ECU or a filtered bus hands over to UDS
+    static constexpr uint32_t FRESH_MS = 500;
+
+    /**
+     * @brief Gives every broadcast target signal a store group of its own.
+     *
+     * A broadcast value is published alone, so it must not share the sequence of
+     * the DID whose response also carries it. Call from setup(), before the tasks start.
+     */
+    static void separateSignals();
+
+    /**
+     * @brief Resolves the target signals and builds the ID index.
+     *
+     * @return Number of fields with a target signal
+     */
+    size_t initialize();
+
+    /**
+     * @brief Decodes a received frame if its ID is in the table.
+     *
+     * @return false if the ID is not a decoded broadcast
+     */
+    bool onFrame(uint32_t id, const uint8_t *data, uint8_t len);
+
+    // True while a broadcast delivered the signal within FRESH_MS
+    bool owns(SignalId id, uint32_t now) const;
+
+    /**
+     * @brief Records a UDS response carrying a signal that is also broadcast.
+     *
+     * @param response_ms  Time from sending the request to decoding the response
+     */
+    void recordUds(SignalId id, uint32_t now, uint32_t response_ms);
+
+    // Logs and resets the per-signal update intervals of both paths
+    void logMetrics();
+
+private:
+    static constexpr uint8_t NO_FRAME = 0xFF;
+
+    struct Frame
+    {
+        uint32_t id = 0;
+        uint8_t first = 0;      // Index into ISF_BROADCAST_FIELDS
+        uint8_t count = 0;
+        uint32_t received = 0;
+        uint32_t short_frames = 0;
+    };
+
+    // Refresh intervals of one signal through one path, over the current metrics window
+    struct PathStats
+    {
+        uint32_t last_ms = 0;
+        uint32_t updates = 0;
+        uint32_t interval_sum_ms = 0;
+        uint32_t max_interval_ms = 0;
+        uint32_t transport_sum_ms = 0;
+
+        void record(uint32_t now, uint32_t transport_ms);
+    };
+
+    struct Field
+    {
+        SignalId id = SIGNAL_NONE;
+        uint32_t last_ms = 0;
+        bool received = false;
+        PathStats broadcast;
+        PathStats uds;
+    };
+
+    static_assert(ISF_BROADCAST_FIELD_COUNT < NO_FRAME, "Frame and field indices are stored as uint8_t");
+
+    uint8_t frameIndex[0x800];
+    Frame frames[ISF_BROADCAST_FIELD_COUNT];
+    uint8_t frameCount = 0;
+    Field fields[ISF_BROADCAST_FIELD_COUNT];
+};
+
+#endif // _ISF_BROADCAST_H
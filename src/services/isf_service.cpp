@@ -3,60 +3,28 @@
 #include "../logger/logger.h"
 #include "../uds/uds_mapper.h"
 #include "../isotp/iso_tp.h"
+#include "../signals/signal_registry.h"
+#include "../signals/signal_store.h"
+#include "../signals/change_notifier.h"
+#include "../signals/derived_signals.h"
+#include "../dtc/dtc_monitor.h"
+#include "passthrough_bridge.h"
 #include <algorithm>
 #include <cstdint> // <-- NEW
 #include <string>
 #include <unordered_map>
 #include <tuple>
 #include <optional>
-#include <set>
 
-/**
- * @brief Represents a decoded signal value from a CAN message
- *
- * Contains all the metadata about the signal as well as the decoded value
- * and formatted display value if available.
- */
-struct SignalValue
+IsfService::IsfService() : decoders(ISF_UDS_REQUESTS_SIZE)
 {
-    std::uint16_t obd2_request_id_hex;
-    std::uint16_t parameter_id_hex;
-    std::uint16_t uds_data_identifier_hex;
-    std::string parameter_name;
-    double value;
-    std::optional<std::string> display_value;
-    std::optional<const char *> unit_name;
-
-    // Constructor for signal values
-    SignalValue(
-        std::uint16_t obd2_id,
-        std::uint16_t param_id,
-        std::uint16_t data_id,
-        std::string name,
-        double val,
-        std::optional<std::string> display,
-        std::optional<const char *> unit) : obd2_request_id_hex(obd2_id),
-                                            parameter_id_hex(param_id),
-                                            uds_data_identifier_hex(data_id),
-                                            parameter_name(std::move(name)),
-                                            value(val),
-                                            display_value(display),
-                                            unit_name(unit)
-    {
-    }
-};
-
-IsfService::IsfService()
-{
-    // Initialize the array with the correct size
-    lastUdsRequestTime = new unsigned long[ISF_UDS_REQUESTS_SIZE]();
 }
 
 IsfService::~IsfService()
 {
+    delete dtcMonitor;
     delete isotp;
     delete twai;
-    delete[] lastUdsRequestTime; // Clean up the array
 }
 
 /**
@@ -69,8 +37,13 @@ IsfService::~IsfService()
  */
 bool IsfService::initialize()
 {
-    // Initialize UDS response mappings
-    init_udsDefinitions();
+    // Polling bounds are derived from the units of the signals in each DID
+    pollScheduler.initialize();
+
+    // Baseline decode throughput of the largest engine local IDs, before any bus traffic
+    benchmarkDecode(0x7E0, 0x01);
+    benchmarkDecode(0x7E0, 0xC1);
+    derivedSignals.benchmark();
 
     // Create TwaiWrapper instance
     twai = new TwaiWrapper();
@@ -108,6 +81,14 @@ bool IsfService::initialize()
         LOG_INFO("IsoTp instance created successfully.");
     }
 
+    // DTC reads share the ISO-TP channel, so they are interleaved with the regular polls
+    dtcMonitor = new DtcMonitor(isotp);
+    dtcMonitor->initialize();
+
+    // Frames that arrive while a response is awaited are handled from IsoTp's receive loop
+    broadcast.initialize();
+    isotp->setUnsolicitedHandler(&IsfService::onUnsolicitedFrame, this);
+
     // ISO-TP already initialized
 
 #ifdef DEBUG_ISF
@@ -167,236 +148,344 @@ void IsfService::listen()
         }
     }
 
-    //send_obd2_requests(isf_pid_requests, PID_REQUESTS_SIZE);
+    refreshSubscriptions();
+
+    pollObdPids(current_time);
+
+    // Full DTC reads are rare and only happen when no other request is in flight
+    if (!is_session_active && dtcMonitor->poll(current_time))
+    {
+        udsRequestCount++;
+    }
 
     beginSend();
 
-    vTaskDelay(pdMS_TO_TICKS(5));
+    logMetrics(millis());
+
+    drainReceiveQueue(5);
 }
 
-bool IsfService::beginSend()
+/**
+ * @brief Handles non-diagnostic frames received while no request is in flight
+ *
+ * Takes the place of an idle delay: blocks on the receive queue for up to
+ * budget_ms, handling each frame as it arrives instead of letting the queue
+ * fill between polls. Diagnostic frames arriving here answer no pending
+ * request and are dropped.
+ */
+void IsfService::drainReceiveQueue(unsigned long budget_ms)
 {
-    if (is_session_active)
+    uint32_t id;
+    uint8_t data[8];
+    uint8_t len = 0;
+
+    unsigned long start = millis();
+    unsigned long elapsed = 0;
+    while (elapsed < budget_ms && twai->receiveMessage(id, data, len, pdMS_TO_TICKS(budget_ms - elapsed)))
     {
-        return false;
+        handleUnsolicitedFrame(id, data, len > 8 ? 8 : len);
+        elapsed = millis() - start;
     }
+}
 
-    is_session_active = true; // Set session active for the entire batch
+/**
+ * @brief Forwards or decodes one frame outside the diagnostic ID range
+ *
+ * Passthrough goes first: it only copies the frame onto the GT86 queue, so
+ * decoding a broadcast never adds to the forwarding latency.
+ */
+void IsfService::handleUnsolicitedFrame(uint32_t id, const uint8_t *data, uint8_t len)
+{
+    if (!passthroughBridge.forward(id, data, len))
+    {
+        broadcast.onFrame(id, data, len);
+    }
+}
 
-    for (int i = 0; i < ISF_UDS_REQUESTS_SIZE; i++)
+void IsfService::onUnsolicitedFrame(void *context, uint32_t id, const uint8_t *data, uint8_t len)
+{
+    static_cast<IsfService *>(context)->handleUnsolicitedFrame(id, data, len);
+}
+
+/**
+ * @brief Re-resolves which definitions of each polled DID have a live consumer
+ *
+ * Runs only when the signal registry generation changed. For every request the
+ * subscribed definitions are handed to the DID's decoder, which decodes
+ * identical fields once and publishes the duplicates as aliases, and DIDs left
+ * without any subscribed signal are removed from the poll schedule. The poll
+ * interval bounds of the others follow the signals that are still subscribed.
+ */
+void IsfService::refreshSubscriptions()
+{
+    uint32_t generation = signalRegistry.generation();
+    if (subscriptionsResolved && generation == resolvedGeneration)
     {
-        const UDSRequest &request = isf_uds_requests[i];
+        return;
+    }
 
-        Message_t msg_to_send;
-        msg_to_send.tx_id = request.tx_id;
-        msg_to_send.rx_id = request.rx_id;
-        msg_to_send.service_id = request.service_id;
-        msg_to_send.data_id = request.did;
-        msg_to_send.length = request.length;
+    int active_requests = 0;
+    size_t active_signals = 0;
+
+    for (int i = 0; i < ISF_UDS_REQUESTS_SIZE; i++)
+    {
+        DidDecoder &decoder = decoders[i];
+        decoder.clear();
 
-        memcpy(msg_to_send.Buffer, request.payload, request.length);
+        for (const UdsDefinition &def : findUdsDefinitions(isf_uds_requests[i].tx_id, isf_uds_requests[i].did))
+        {
+            if (signalRegistry.subscribers(udsSignalId(def)) != 0)
+            {
+                decoder.add(def);
+            }
+        }
 
-        sendUdsRequest(msg_to_send, request);
+        pollScheduler.setEnabled(i, !decoder.empty());
+        pollScheduler.updateBounds(i, decoder);
+        if (!decoder.empty())
+        {
+            active_requests++;
+            active_signals += decoder.size();
+        }
+    }
 
-        vTaskDelay(pdMS_TO_TICKS(100));
+    activeObdPidCount = 0;
+    for (int i = 0; i < OBD_PIDS_SIZE; i++)
+    {
+        if (signalRegistry.subscribers(obdSignalId(isf_obd_pids[i])) != 0)
+        {
+            activeObdPids[activeObdPidCount++] = isf_obd_pids[i];
+            active_signals++;
+        }
     }
 
-    is_session_active = false; // Clear session active after all requests
-    return true;
+    resolvedGeneration = generation;
+    subscriptionsResolved = true;
+
+    LOG_INFO("Subscriptions resolved: %d of %d DIDs polled, %u signals decoded", active_requests, ISF_UDS_REQUESTS_SIZE,
+             (unsigned)active_signals);
 }
 
-bool IsfService::sendUdsRequest(Message_t &msg, const UDSRequest &request)
+/**
+ * @brief Times the decode of every signal of one DID on a synthetic full-length response
+ *
+ * Logs decoded signals per microsecond and CPU cycles per response for extraction
+ * plus the batch scaling stage, the figures the per-window ns/signal metric can be
+ * compared against.
+ */
+void IsfService::benchmarkDecode(uint16_t request_id, uint16_t did)
 {
-    if (!isotp->send(&msg))
+    DidDecoder decoder;
+    for (const UdsDefinition &def : findUdsDefinitions(request_id, did))
     {
-        msg.reset();
-        return false;
+        decoder.add(def);
+    }
+    if (decoder.empty())
+    {
+        return;
     }
 
-    if (!isotp->receive(&msg, request.param_name))
+    uint8_t payload[MAX_MSGBUF];
+    for (size_t i = 0; i < sizeof(payload); i++)
     {
-        msg.reset();
-        return false;
+        payload[i] = (uint8_t)(i * 37 + 11);
     }
 
-    processUdsResponse(msg, request);
+    float change_fraction = 0.0f;
+    size_t decoded = 0;
+    unsigned long start = micros();
+    for (int round = 0; round < DECODE_BENCHMARK_ROUNDS; round++)
+    {
+        decoded += decoder.decode(payload, sizeof(payload), change_fraction);
+    }
+    unsigned long elapsed = micros() - start;
 
-    msg.reset();
-    return true;
+    LOG_INFO("decode benchmark 0x%03X/0x%02X: %u signals, %.2f signals/us, %lu cycles/response", request_id, did,
+             (unsigned)decoder.size(), elapsed ? (float)decoded / elapsed : 0.0f,
+             (unsigned long)((uint64_t)elapsed * getCpuFrequencyMhz() / DECODE_BENCHMARK_ROUNDS));
 }
 
-bool IsfService::processUdsResponse(Message_t &msg, const UDSRequest &request)
+/**
+ * @brief Logs decode and bus request rates followed by the per-DID poll metrics
+ */
+void IsfService::logMetrics(unsigned long now)
 {
-    // For now we only support Read Data By Local ID and Read Data By ID
-    switch (request.service_id)
+    unsigned long elapsed = now - lastMetricsTime;
+    if (elapsed < METRICS_INTERVAL)
     {
-    case UDS_SID_READ_DATA_BY_LOCAL_ID: // Local Identifier (Techstream)
-    case UDS_SID_READ_DATA_BY_ID:
-        return transformResponse(msg, request);
-    default:
-        LOG_ERROR("Unsupported response SID: %02X", request.service_id);
-        return false;
+        return;
     }
+
+    LOG_INFO("decode: %.1f signals/s, %.1f requests/s, %lu ns/signal", decodedSignalCount * 1000.0f / elapsed,
+             udsRequestCount * 1000.0f / elapsed,
+             decodeTimedSignals ? (unsigned long)(decodeTimeMicros * 1000ULL / decodeTimedSignals) : 0UL);
+
+    pollScheduler.logMetrics(now);
+    broadcast.logMetrics();
+
+    decodedSignalCount = 0;
+    udsRequestCount = 0;
+    decodeTimeMicros = 0;
+    decodeTimedSignals = 0;
+    lastMetricsTime = now;
 }
 
 /**
- * @brief Safely extracts raw data bits from a CAN data buffer.
+ * @brief Requests the subscribed standard OBD-II PIDs and decodes the responses
  *
- * Ensures bit boundaries are valid before extracting.
+ * The PIDs are packed up to OBD_MAX_PIDS_PER_REQUEST per mode 01 request, so
+ * the standard engine data arrives in one round-trip instead of one per PID.
  *
- * @param data            Raw data buffer (must be non-null)
- * @param byte_pos        Starting byte position to extract from
- * @param bit_offset      Bit offset within starting byte
- * @param bit_length      Total number of bits to extract
- * @param data_len        Length of the data buffer
- * @param raw_value       Output parameter - extracted raw value
- * @return true if extraction was successful, false on error
+ * @return true if every request was answered and decoded
  */
-bool get_raw_value(
-    const uint8_t *data,
-    int8_t byte_pos,
-    int8_t bit_pos,
-    int8_t bit_length,
-    int8_t data_len,
-    uint32_t &raw_value)
+bool IsfService::pollObdPids(unsigned long now)
 {
-    const int MAX_BIT_LENGTH = 32; 
-        
-    // Validate bit length range
-    if (bit_length <= 0 || bit_length > MAX_BIT_LENGTH)
+    if (activeObdPidCount == 0 || is_session_active || now - lastObdPollTime < OBD_POLL_INTERVAL)
     {
-        LOG_ERROR("Invalid bit length: %d", bit_length);
         return false;
     }
 
-    // Validate starting byte position
-    if (byte_pos < 0 || byte_pos >= data_len)
+    lastObdPollTime = now;
+    is_session_active = true;
+
+    bool success = true;
+    for (uint8_t first = 0; first < activeObdPidCount; first += OBD_MAX_PIDS_PER_REQUEST)
     {
-        LOG_ERROR("Invalid byte position: %d", byte_pos);
-        return false;
-    }
+        uint8_t count = activeObdPidCount - first;
+        if (count > OBD_MAX_PIDS_PER_REQUEST)
+        {
+            count = OBD_MAX_PIDS_PER_REQUEST;
+        }
 
-    // Calculate how many bytes are needed
-    int8_t total_bit_offset = bit_pos + bit_length;
-    int8_t required_bytes = (total_bit_offset + 7) / 8;
-    int8_t end_byte = byte_pos + required_bytes;
+        Message_t msg;
+        msg.tx_id = ISF_OBD_TX_ID;
+        msg.rx_id = ISF_OBD_RX_ID;
+        msg.service_id = OBD_MODE_SHOW_CURRENT_DATA;
+        msg.length = buildObdMode01Request(&activeObdPids[first], count, msg.Buffer);
 
-    if (end_byte > data_len)
-    {
-        LOG_ERROR("Invalid end byte: %d", end_byte);
-        return false;
-    }
+        udsRequestCount++;
 
-    // Copy exactly the bytes needed for this bitfield
-    uint32_t raw = 0;
-    memcpy(&raw, &data[byte_pos], required_bytes); // No more than needed
+        if (!isotp->send(&msg) || !isotp->receive(&msg, "OBD mode 01"))
+        {
+            success = false;
+            continue;
+        }
 
-    raw >>= bit_pos;
+        ObdPidValue values[OBD_MAX_PIDS_PER_REQUEST];
+        size_t decoded = decodeObdMode01Response(msg.Buffer, msg.length, values, OBD_MAX_PIDS_PER_REQUEST);
+        uint32_t timestamp = millis();
+        for (size_t i = 0; i < decoded; i++)
+        {
+            LOG_DEBUG("%s raw: %lu value: %f", values[i].definition->name, (unsigned long)values[i].raw, values[i].value);
 
-    uint32_t mask = (bit_length == MAX_BIT_LENGTH) ? 0xFFFFFFFF : ((1U << bit_length) - 1);
-    raw_value = raw & mask;
-    
-    return true;
+            if (values[i].pid == 0x01)
+            {
+                dtcMonitor->onMonitorStatus(values[i].raw);
+            }
+
+            // Every PID is its own store group, so consumers see each as soon as it is decoded
+            SignalId id = obdSignalId(values[i].pid);
+            signalStore.beginPublish(id);
+            signalStore.publish(id, values[i].value, timestamp);
+            signalStore.endPublish(id);
+            changeNotifier.update(id, values[i].value, timestamp);
+            derivedSignals.onPublished(id, values[i].value, timestamp);
+        }
+        derivedSignals.evaluateDirty(timestamp);
+
+        decodedSignalCount += decoded;
+        success = success && decoded == count;
+    }
+
+    is_session_active = false;
+    return success;
 }
 
 /**
- * @brief Safely extracts a single bit from a CAN data buffer.
+ * @brief Sends the most overdue UDS request, if any is due
  *
- * This function is optimized for single-bit extraction (like MIL status, warning flags, etc.)
- * and always extracts exactly 1 bit.
+ * Only one request is issued per call so that the bus time of DIDs whose
+ * signals change slowly goes to the ones that change quickly instead of
+ * every DID being polled back-to-back at the same rate.
  *
- * @param data            Raw data buffer (must be non-null)
- * @param byte_pos        Starting byte position to extract from
- * @param bit_offset      Bit offset within starting byte (0-7)
- * @param data_len        Length of the data buffer
- * @param bit_value       Output parameter - extracted bit value (0 or 1)
- * @param param_name      Optional parameter name for logging context
- * @return true if extraction was successful, false on error
+ * @return true if a request was sent, false if nothing was due or a session is active
  */
-bool get_single_bit(
-    const uint8_t *data,
-    int8_t byte_pos,
-    int8_t bit_pos,
-    int8_t data_len,
-    uint8_t &bit_value,
-    const char *param_name)
+bool IsfService::beginSend()
 {
-    // Validate starting byte position
-    if (byte_pos < 0 || byte_pos >= data_len)
+    if (is_session_active)
     {
-        LOG_ERROR("Invalid byte position: %d (param: %s)", byte_pos, (param_name ? param_name : ""));
         return false;
     }
 
-    // Validate bit position within byte
-    if (bit_pos < 0 || bit_pos > 7)
+    int index = pollScheduler.nextDue(millis());
+    if (index < 0)
     {
-        LOG_ERROR("Invalid bit position: %d (param: %s)", bit_pos, (param_name ? param_name : ""));
         return false;
     }
 
-    // Extract the single bit
-    uint8_t byte_value = data[byte_pos];
-    bit_value = (byte_value >> bit_pos) & 0x01;
-    
+    is_session_active = true;
+
+    const UDSRequest &request = isf_uds_requests[index];
+
+    Message_t msg_to_send;
+    msg_to_send.tx_id = request.tx_id;
+    msg_to_send.rx_id = request.rx_id;
+    msg_to_send.service_id = request.service_id;
+    msg_to_send.data_id = request.did;
+    msg_to_send.length = request.length;
+
+    memcpy(msg_to_send.Buffer, request.payload, request.length);
+
+    requestStartTime = millis();
+    pollScheduler.markRequested(index, requestStartTime);
+    udsRequestCount++;
+
+    float change_fraction = 0.0f;
+    if (sendUdsRequest(msg_to_send, index, change_fraction))
+    {
+        pollScheduler.reportResponse(index, change_fraction, millis());
+    }
+
+    is_session_active = false;
     return true;
 }
 
-/**
- * @brief Finds UnitTypeInfo by unit ID
- *
- * Searches through the unitTypeInfos array to find the entry with matching unit ID.
- * This is necessary because unit IDs are not consecutive and cannot be used as direct array indices.
- *
- * @param unit_id The unit ID to search for
- * @return Pointer to UnitTypeInfo if found, nullptr if not found
- */
-const UnitTypeInfo* findUnitTypeInfo(uint8_t unit_id)
+bool IsfService::sendUdsRequest(Message_t &msg, int index, float &change_fraction)
 {
-    for (const auto &info : unitTypeInfos) {
-        if (info.id == unit_id) {
-            return &info;
-        }
+    const UDSRequest &request = isf_uds_requests[index];
+
+    if (!isotp->send(&msg))
+    {
+        msg.reset();
+        return false;
     }
-    return nullptr;
+
+    if (!isotp->receive(&msg, request.param_name))
+    {
+        msg.reset();
+        return false;
+    }
+
+    bool decoded = processUdsResponse(msg, index, change_fraction);
+
+    msg.reset();
+    return decoded;
 }
 
-/**
- * @brief Retrieves the matching enum definition for a given raw value from UDS definitions.
- *
- * Searches through the UDS map for matching enum definitions that correspond to
- * the given raw value and returns the complete matching UdsDefinition.
- *
- * @param tx_id           CAN transmit ID
- * @param data_id         UDS data identifier
- * @param def             UDS definition containing position and name info
- * @param raw_value       Raw extracted value to match against enum definitions
- * @return Optional UdsDefinition containing the matching enum definition, or nullopt if not found
- */
-std::optional<UdsDefinition> get_enum_value(
-    uint32_t tx_id,
-    uint16_t data_id,
-    const UdsDefinition &def,
-    uint32_t raw_value)
+bool IsfService::processUdsResponse(Message_t &msg, int index, float &change_fraction)
 {
-    auto enumRange = udsMap.equal_range(uds_key{tx_id, data_id});
-                     
-    for (auto enumIt = enumRange.first; enumIt != enumRange.second; ++enumIt)
+    const UDSRequest &request = isf_uds_requests[index];
+
+    // For now we only support Read Data By Local ID and Read Data By ID
+    switch (request.service_id)
     {
-        const UdsDefinition &enumDef = enumIt->second;
-        
-        if (enumDef.name == def.name &&
-            enumDef.byte_position == def.byte_position &&
-            enumDef.bit_offset_position == def.bit_offset_position &&
-            enumDef.value.has_value() &&
-            enumDef.value.value() == raw_value &&
-            enumDef.display_value.has_value())
-        {
-            return enumDef;
-        }
+    case UDS_SID_READ_DATA_BY_LOCAL_ID: // Local Identifier (Techstream)
+    case UDS_SID_READ_DATA_BY_ID:
+        return transformResponse(msg, index, change_fraction);
+    default:
+        LOG_ERROR("Unsupported response SID: %02X", request.service_id);
+        return false;
     }
-    
-    return std::nullopt;
 }
 
 void logBufferHex(int byte_pos, int bit_pos, const uint8_t* buffer, size_t buffer_length) {
@@ -424,118 +513,110 @@ void logBufferHex(int byte_pos, int bit_pos, const uint8_t* buffer, size_t buffe
  *
  * This method processes raw diagnostic response data from vehicle ECUs by:
  *
- * 1. Finding all signal definitions that match the request parameters
- *    - Uses (tx_id, pid, did) tuple as the lookup key in udsMap
- *    - Each definition specifies where (byte/bit position) a signal exists in the data
- *
- * 2. Grouping definitions by their physical location in the message
- *    - Groups by (data_id, byte_position, bit_offset_position)
- *    - Each group represents one physical signal that may have multiple interpretations
+ * 1. Running the request's DidDecoder over the payload
+ *    - Built by refreshSubscriptions() from the generated UDS tables and the signal registry
+ *    - Holds only subscribed signals, one per (byte, bit) position, with their
+ *      unit metadata already resolved, so decoding is one linear pass
  *    - For example: same field could be engine temperature AND a warning level
  *
- * 3. Extracting values for each signal group
+ * 2. Extracting values for each signal
  *    - Decodes raw bytes according to position, length, scaling factors
  *    - Handles signals even if response is shorter than expected (partial response)
  *    - Some ECUs may respond with only a subset of values
  *
- * 4. Logging results for diagnostics and debugging
+ * 3. Logging results for diagnostics and debugging
  *    - Logs both raw data and decoded signals
  *    - Provides units and display values where available
  *
+ * 4. Measuring how far the signals moved since the previous response
+ *    - Reported as a fraction of each signal's unit range so the poll
+ *      scheduler can adapt the polling rate of the DID
+ *
  * This implementation is resilient to partial responses, allowing extraction
  * of signals that fit within the available data, even if some expected signals
  * are missing from the response.
  *
+ * @param change_fraction Output - largest change of any signal as a fraction of its range
  * @return true     if at least one signal was successfully extracted and processed
  * @return false    if no signals could be extracted
  */
-bool IsfService::transformResponse(Message_t &msg, const UDSRequest &request)
+bool IsfService::transformResponse(Message_t &msg, int index, float &change_fraction)
 {
-    auto matchingDefinitions = udsMap.equal_range(std::make_tuple(msg.tx_id, msg.data_id));
-    bool at_least_one_success = false;
-    
-    // Track processed (byte_position, bit_offset_position) pairs to avoid duplicates
-    std::set<std::pair<int8_t, int8_t>> processedPositions;
-    
-    for (auto it = matchingDefinitions.first; it != matchingDefinitions.second; ++it)
+    DidDecoder &decoder = decoders[index];
+    change_fraction = 0.0f;
+    if (decoder.empty())
     {
-        const UdsDefinition &def = it->second;
-        const uint8_t* payload = &msg.Buffer[2]; //Skip UDS Header, SID and DID
-                
-        //logBufferHex(def.byte_position, def.bit_offset_position, payload, msg.length);
-
-        // Check if this byte/bit position has already been processed
-        std::pair<int8_t, int8_t> position = {def.byte_position, def.bit_offset_position};
-        if (processedPositions.find(position) != processedPositions.end())
-        {
-            continue; // Skip this definition as we've already processed this position
-        }
-        
-        // Mark this position as processed
-        processedPositions.insert(position);
+        return false;
+    }
 
-        const UnitTypeInfo* unit_info = findUnitTypeInfo(def.unit);
-        if(unit_info == nullptr)
+    // Skip SID and DID
+    const uint8_t *payload = &msg.Buffer[2];
+    size_t payload_length = msg.length > 2 ? msg.length - 2 : 0;
+
+    //logBufferHex(0, 0, payload, payload_length);
+
+    unsigned long start = micros();
+    size_t decoded = decoder.decode(payload, payload_length, change_fraction);
+    decodeTimeMicros += micros() - start;
+    decodeTimedSignals += decoded;
+    decodedSignalCount += decoded;
+
+    // Publish the whole response under one store sequence so readers see its signals together.
+    // Signals a broadcast is currently delivering are left to it: the response is older and updates less often.
+    // Broadcast targets have store groups of their own and are published on their own below.
+    uint32_t timestamp = millis();
+    SignalId did_signal = udsSignalId(decoder.definition(0));
+    signalStore.beginDidPublish(did_signal);
+    decoder.forEachDecoded([&](const UdsDefinition &def, float value)
+                           {
+                               SignalId id = udsSignalId(def);
+                               broadcast.recordUds(id, timestamp, timestamp - requestStartTime);
+                               if (!broadcast.owns(id, timestamp) && !signalStore.isSeparate(id))
+                               {
+                                   signalStore.publish(id, value, timestamp);
+                               }
+                           });
+    signalStore.endDidPublish(did_signal);
+
+    // Deadband checks and derived signals run after the store is consistent, so woken consumers read the new values
+    decoder.forEachDecoded([&](const UdsDefinition &def, float value)
+                           {
+                               SignalId id = udsSignalId(def);
+                               if (!broadcast.owns(id, timestamp))
+                               {
+                                   if (signalStore.isSeparate(id))
+                                   {
+                                       signalStore.beginPublish(id);
+                                       signalStore.publish(id, value, timestamp);
+                                       signalStore.endPublish(id);
+                                   }
+                                   changeNotifier.update(id, value, timestamp);
+                                   derivedSignals.onPublished(id, value, timestamp);
+                               }
+                           });
+    derivedSignals.evaluateDirty(timestamp);
+
+    for (size_t i = 0; i < decoder.size(); i++)
+    {
+        if (!decoder.decoded(i))
         {
-            LOG_ERROR("Unit type not found for unit %d", def.unit);
             continue;
         }
 
-        switch (unit_info->valueType)
+        const UdsDefinition &def = decoder.definition(i);
+        if (decoder.isBoolean(i))
         {
-            case ValueType::UInt16:
-            case ValueType::UInt32:
-            case ValueType::Float:
-            {
-                uint32_t raw_value;
-                if (!get_raw_value(payload, def.byte_position, def.bit_offset_position,4, msg.length, raw_value))
-                {
-                    continue; // Skip this definition if extraction failed
-                }
-                // Has decimals
-
-                float calculated_value = (float)raw_value * def.scaling_factor + def.offset_value;
-
-                if (unit_info->minValue.has_value() && calculated_value < unit_info->minValue.value())
-                {
-                    calculated_value = unit_info->minValue.value();
-                }
-                if (unit_info->maxValue.has_value() && calculated_value > unit_info->maxValue.value())
-                {
-                    calculated_value = unit_info->maxValue.value();
-                }
-
-                LOG_DEBUG("%s raw: %u value: %f", def.name.c_str(), raw_value, calculated_value);
-
-                at_least_one_success = true;
-                break;
-            }
-            case ValueType::Boolean:
+            const char *display_value = udsEnumDisplay(def, decoder.rawValue(i));
+            if (display_value != nullptr)
             {
-                uint8_t bit_value;
-                if (!get_single_bit(payload, def.byte_position, def.bit_offset_position, msg.length, bit_value, request.param_name))
-                {
-                    continue; // Skip this definition if bit extraction failed
-                }
-
-                auto udsDefinitionValue = get_enum_value(msg.tx_id, msg.data_id, def, bit_value);
-
-                if (udsDefinitionValue.has_value())
-                {
-                     LOG_DEBUG("%s raw: %u value: %s", def.name.c_str(), bit_value, udsDefinitionValue.value().display_value.value().c_str());
-                }
-                
-                at_least_one_success = true;
-                break;
-            }
-            default:
-            {
-                LOG_ERROR("%s Unknown value type: %d", def.name.c_str(), unit_info->valueType);
-                break;
+                LOG_DEBUG("%s raw: %lu value: %s", udsName(def), (unsigned long)decoder.rawValue(i), display_value);
             }
         }
-
+        else
+        {
+            LOG_DEBUG("%s raw: %lu value: %f", udsName(def), (unsigned long)decoder.rawValue(i), decoder.value(i));
+        }
     }
 
-    return at_least_one_success;
+    return decoded > 0;
 }
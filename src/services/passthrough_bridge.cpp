@@ -0,0 +1,149 @@
+#include "passthrough_bridge.h"
+#include "../logger/logger.h"
+#include <esp_timer.h>
+#include <cstring>
+
+PassthroughBridge::PassthroughBridge(const PassthroughRoute *routes, size_t count)
+    : routes(routes), routeCount(count < MAX_ROUTES ? count : MAX_ROUTES)
+{
+    memset(routeIndex, NO_ROUTE, sizeof(routeIndex));
+    for (size_t i = 0; i < routeCount; i++)
+    {
+        sentAt[i] = NEVER_SENT;
+        if (routes[i].enabled && routes[i].source_id < sizeof(routeIndex))
+        {
+            routeIndex[routes[i].source_id] = (uint8_t)i;
+        }
+    }
+}
+
+bool PassthroughBridge::begin()
+{
+    if (queue == nullptr)
+    {
+        queue = xQueueCreate(QUEUE_DEPTH, sizeof(PassthroughFrame));
+    }
+    return queue != nullptr;
+}
+
+bool PassthroughBridge::forward(uint32_t id, const uint8_t *data, uint8_t len)
+{
+    if (id >= sizeof(routeIndex) || routeIndex[id] == NO_ROUTE || queue == nullptr)
+    {
+        return false;
+    }
+
+    PassthroughFrame frame;
+    remap(routes[routeIndex[id]], data, len, frame);
+    frame.route = routeIndex[id];
+
+    if (xQueueSend(queue, &frame, 0) != pdTRUE)
+    {
+        droppedFrames.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    forwardedFrames.fetch_add(1, std::memory_order_relaxed);
+
+    TaskHandle_t task = wakeTask.load(std::memory_order_acquire);
+    if (task != nullptr)
+    {
+        xTaskNotifyGive(task);
+    }
+    return true;
+}
+
+void PassthroughBridge::remap(const PassthroughRoute &route, const uint8_t *data, uint8_t len, PassthroughFrame &frame)
+{
+    // Xtensa is little-endian, so byte 0 lands in the low byte of the word the masks are written for
+    uint64_t word = 0;
+    len = len > 8 ? 8 : len;
+    memcpy(&word, data, len);
+    word = (word & route.keep_mask) | route.set_bits;
+
+    frame.id = route.target_id;
+    frame.len = len < 8 && (route.set_bits >> (8 * len)) != 0 ? 8 : len;
+    memcpy(frame.data, &word, sizeof(frame.data));
+    frame.received_us = esp_timer_get_time();
+}
+
+bool PassthroughBridge::next(PassthroughFrame &frame)
+{
+    return queue != nullptr && xQueueReceive(queue, &frame, 0) == pdTRUE;
+}
+
+void PassthroughBridge::sent(const PassthroughFrame &frame, int64_t now_us)
+{
+    uint32_t latency = (uint32_t)(now_us - frame.received_us);
+    sentFrames++;
+    latencySumUs += latency;
+    maxLatencyUs = latency > maxLatencyUs ? latency : maxLatencyUs;
+    if (frame.route < routeCount)
+    {
+        sentAt[frame.route] = now_us;
+    }
+}
+
+bool PassthroughBridge::holds(uint32_t target_id, uint32_t interval_ms, int64_t now_us) const
+{
+    const int64_t hold_us = 2 * (int64_t)interval_ms * 1000;
+    for (size_t r = 0; r < routeCount; r++)
+    {
+        if (routes[r].target_id == target_id && sentAt[r] != NEVER_SENT && now_us - sentAt[r] < hold_us)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+void PassthroughBridge::benchmark()
+{
+    const uint8_t data[8] = {0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88};
+
+    if (routeCount == 0)
+    {
+        return;
+    }
+
+    // The ISF task may already be forwarding, so the synthetic frames must never share the live queue
+    QueueHandle_t scratch = xQueueCreate(QUEUE_DEPTH, sizeof(PassthroughFrame));
+    if (scratch == nullptr)
+    {
+        return;
+    }
+
+    PassthroughFrame frame;
+    int rounds = 0;
+    int64_t start = esp_timer_get_time();
+    for (int i = 0; i < BENCHMARK_ROUNDS; i++)
+    {
+        remap(routes[0], data, sizeof(data), frame);
+        if (xQueueSend(scratch, &frame, 0) == pdTRUE && xQueueReceive(scratch, &frame, 0) == pdTRUE)
+        {
+            rounds++;
+        }
+    }
+    int64_t elapsed = esp_timer_get_time() - start;
+    vQueueDelete(scratch);
+
+    LOG_INFO("passthrough benchmark: %d frames, %.2f us per remap and queue round trip", rounds,
+             rounds ? (float)elapsed / rounds : 0.0f);
+}
+
+void PassthroughBridge::logMetrics()
+{
+    uint32_t forwarded = forwardedFrames.exchange(0, std::memory_order_relaxed);
+    uint32_t dropped = droppedFrames.exchange(0, std::memory_order_relaxed);
+    if (forwarded == 0 && dropped == 0)
+    {
+        return;
+    }
+
+    LOG_INFO("passthrough: %lu forwarded, %lu dropped, %lu sent, latency avg %lu max %lu us",
+             (unsigned long)forwarded, (unsigned long)dropped, (unsigned long)sentFrames,
+             sentFrames ? (unsigned long)(latencySumUs / sentFrames) : 0UL, (unsigned long)maxLatencyUs);
+
+    sentFrames = 0;
+    latencySumUs = 0;
+    maxLatencyUs = 0;
+}
@@ -0,0 +1,177 @@
+#ifndef _PASSTHROUGH_BRIDGE_H
+#define _PASSTHROUGH_BRIDGE_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "freertos/task.h"
+
+/**
+ * @brief An ISF frame copied onto the GT86 bus under target_id without being decoded.
+ *
+ * The payload becomes (data & keep_mask) | set_bits, with byte 0 of the frame
+ * in the least significant byte of both masks. Bytes the GT86 receiver reads
+ * differently from the ISF are cleared by keep_mask and, if it needs a fixed
+ * value there, filled in by set_bits.
+ */
+struct PassthroughRoute
+{
+    uint16_t source_id;
+    uint16_t target_id;
+    uint64_t keep_mask;
+    uint64_t set_bits;
+    const char *name;
+    bool enabled;       // Forwarded only once the layout is confirmed against a bus capture cited with the row
+};
+
+inline constexpr uint64_t PASSTHROUGH_KEEP_ALL = ~0ULL;
+
+// ABS status: the light flags in bytes 0-1 carry over, the rest is the Readme 211 baseline (00 06 C0 0F 00 00 32 00).
+// Disabled: this drives the cluster's VSC/TCS warning lamps and replaces the 0xD3 default, and no bus capture
+// has confirmed yet that the ISF 0x284 flags sit where the GT86 cluster reads them. Enable it only with the
+// capture that shows the layout cited here.
+inline constexpr PassthroughRoute PASSTHROUGH_ROUTES[] = {
+    {0x284, 0xD3, 0x000000000000FFFFULL, 0x003200000FC00000ULL, "VSC, TCS lights", false},
+};
+
+inline constexpr size_t PASSTHROUGH_ROUTE_COUNT = sizeof(PASSTHROUGH_ROUTES) / sizeof(PASSTHROUGH_ROUTES[0]);
+
+constexpr bool passthroughRoutesValid()
+{
+    for (size_t i = 0; i < PASSTHROUGH_ROUTE_COUNT; i++)
+    {
+        if (PASSTHROUGH_ROUTES[i].source_id > 0x7FF || PASSTHROUGH_ROUTES[i].target_id > 0x7FF)
+        {
+            return false;
+        }
+        // Diagnostic IDs belong to IsoTp, which never hands them on
+        if (PASSTHROUGH_ROUTES[i].source_id >= 0x700)
+        {
+            return false;
+        }
+        for (size_t j = 0; j < i; j++)
+        {
+            if (PASSTHROUGH_ROUTES[j].source_id == PASSTHROUGH_ROUTES[i].source_id)
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+static_assert(passthroughRoutesValid(), "Passthrough sources must be unique, non-diagnostic standard IDs");
+
+/**
+ * @brief A remapped frame on its way from the ISF receive path to the MCP2515.
+ */
+struct PassthroughFrame
+{
+    uint16_t id;
+    uint8_t len;
+    uint8_t data[8];
+    uint8_t route;          // Index into the bridge's route table
+    int64_t received_us;    // esp_timer_get_time() when the ISF frame was handed over
+};
+
+/**
+ * @brief Forwards ISF frames that need no translation straight to the GT86 task.
+ *
+ * The ISF task calls forward() for every non-diagnostic frame it receives: a
+ * 2 KB table indexed by the 11-bit CAN ID finds the enabled route, the payload is
+ * remapped with two 64-bit mask operations and the frame is put on a FreeRTOS
+ * queue, after which the GT86 task is notified so it wakes and sends it ahead
+ * of any periodic frame. When the queue is full the frame is dropped and
+ * counted; the ISF bus repeats it on its own period. The latency from
+ * forward() to the end of the MCP2515 write is tracked per metrics window,
+ * and holds() tells the GT86 task which periodic defaults the forwarded
+ * frames currently replace.
+ */
+class PassthroughBridge
+{
+public:
+    static constexpr UBaseType_t QUEUE_DEPTH = 16;
+    static constexpr size_t MAX_ROUTES = 16;
+
+    /**
+     * @param routes  Route table, PASSTHROUGH_ROUTES on the gateway; only its first MAX_ROUTES rows are used
+     */
+    PassthroughBridge(const PassthroughRoute *routes = PASSTHROUGH_ROUTES, size_t count = PASSTHROUGH_ROUTE_COUNT);
+
+    /**
+     * @brief Creates the forwarding queue. Call from setup(), before the ISF and GT86 tasks start.
+     *
+     * Until then forward() and next() do nothing.
+     *
+     * @return false if the queue could not be allocated
+     */
+    bool begin();
+
+    // Gives task a notification for every forwarded frame; nullptr stops it
+    void setWakeTask(TaskHandle_t task) { wakeTask.store(task, std::memory_order_release); }
+
+    /**
+     * @brief Remaps and queues a received ISF frame if it has a route. ISF task only.
+     *
+     * @return false if the ID has no route or the queue is full
+     */
+    bool forward(uint32_t id, const uint8_t *data, uint8_t len);
+
+    /**
+     * @brief Next queued frame. GT86 task only.
+     *
+     * @return false if the queue is empty
+     */
+    bool next(PassthroughFrame &frame);
+
+    // GT86 task only: records the forwarding latency of a frame written to the MCP2515
+    void sent(const PassthroughFrame &frame, int64_t now_us);
+
+    /**
+     * @brief Whether frames forwarded to target_id replace its periodic default at now_us. GT86 task only.
+     *
+     * Only IDs a route was actually sent to are held, and two missed ISF frames
+     * (two periods of the default) hand the ID back to its default.
+     */
+    bool holds(uint32_t target_id, uint32_t interval_ms, int64_t now_us) const;
+
+    // Times the remap and a round trip through a private queue of the same depth, without the bus
+    void benchmark();
+
+    // GT86 task only: logs and resets the forwarding metrics
+    void logMetrics();
+
+private:
+    static constexpr uint8_t NO_ROUTE = 0xFF;
+    static constexpr int BENCHMARK_ROUNDS = 1000;
+    static constexpr int64_t NEVER_SENT = -1;
+
+    static_assert(PASSTHROUGH_ROUTE_COUNT <= MAX_ROUTES, "Raise PassthroughBridge::MAX_ROUTES");
+    static_assert(MAX_ROUTES < NO_ROUTE, "Route indices are stored as uint8_t");
+
+    static void remap(const PassthroughRoute &route, const uint8_t *data, uint8_t len, PassthroughFrame &frame);
+
+    const PassthroughRoute *routes;
+    size_t routeCount;
+    uint8_t routeIndex[0x800];
+    QueueHandle_t queue = nullptr;
+    std::atomic<TaskHandle_t> wakeTask{nullptr};
+
+    // Written by the ISF task
+    std::atomic<uint32_t> forwardedFrames{0};
+    std::atomic<uint32_t> droppedFrames{0};
+
+    // GT86 task
+    int64_t sentAt[MAX_ROUTES];     // esp_timer_get_time() of each route's last frame written to the bus
+
+    // Current metrics window, GT86 task
+    uint32_t sentFrames = 0;
+    uint64_t latencySumUs = 0;
+    uint32_t maxLatencyUs = 0;
+};
+
+inline PassthroughBridge passthroughBridge;
+
+#endif // _PASSTHROUGH_BRIDGE_H
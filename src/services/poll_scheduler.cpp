@@ -0,0 +1,193 @@
+#include "poll_scheduler.h"
+#include "../logger/logger.h"
+#include "../uds/uds_mapper.h"
+#include <climits>
+
+PollScheduler::PollScheduler(const UDSRequest *requests, int count) : requests(requests), count(count)
+{
+    slots = new PollSlot[count]();
+}
+
+PollScheduler::~PollScheduler()
+{
+    delete[] slots;
+}
+
+const PollRateLimit &PollScheduler::findRateLimit(int8_t unit)
+{
+    for (const auto &limit : pollRateLimits)
+    {
+        if (limit.unit == unit)
+        {
+            return limit;
+        }
+    }
+    return DEFAULT_POLL_RATE_LIMIT;
+}
+
+void PollScheduler::tightenBounds(PollSlot &slot, int8_t unit)
+{
+    // The most demanding signal of a DID sets both bounds, otherwise a slow
+    // temperature sharing a response with RPM would drag RPM down with it.
+    const PollRateLimit &limit = findRateLimit(unit);
+    if (slot.min_interval_ms == 0 || limit.min_interval_ms < slot.min_interval_ms)
+    {
+        slot.min_interval_ms = limit.min_interval_ms;
+    }
+    if (slot.max_interval_ms == 0 || limit.max_interval_ms < slot.max_interval_ms)
+    {
+        slot.max_interval_ms = limit.max_interval_ms;
+    }
+}
+
+void PollScheduler::completeBounds(PollSlot &slot)
+{
+    if (slot.min_interval_ms == 0)
+    {
+        slot.min_interval_ms = DEFAULT_POLL_RATE_LIMIT.min_interval_ms;
+        slot.max_interval_ms = DEFAULT_POLL_RATE_LIMIT.max_interval_ms;
+    }
+    if (slot.max_interval_ms < slot.min_interval_ms)
+    {
+        slot.max_interval_ms = slot.min_interval_ms;
+    }
+}
+
+void PollScheduler::initialize()
+{
+    for (int i = 0; i < count; i++)
+    {
+        PollSlot &slot = slots[i];
+        slot.min_interval_ms = 0;
+        slot.max_interval_ms = 0;
+
+        for (const UdsDefinition &def : findUdsDefinitions(requests[i].tx_id, requests[i].did))
+        {
+            tightenBounds(slot, def.unit);
+        }
+        completeBounds(slot);
+
+        // Start at the configured request interval until the first changes are observed
+        unsigned long initial = requests[i].interval;
+        slot.interval_ms = constrain(initial, slot.min_interval_ms, slot.max_interval_ms);
+    }
+}
+
+void PollScheduler::updateBounds(int index, const DidDecoder &decoder)
+{
+    if (decoder.empty())
+    {
+        return;
+    }
+
+    PollSlot &slot = slots[index];
+    slot.min_interval_ms = 0;
+    slot.max_interval_ms = 0;
+
+    // Aliases share the unit of the signal they repeat, so the decoded signals cover them
+    for (size_t i = 0; i < decoder.size(); i++)
+    {
+        tightenBounds(slot, decoder.definition(i).unit);
+    }
+    completeBounds(slot);
+
+    slot.interval_ms = constrain(slot.interval_ms, slot.min_interval_ms, slot.max_interval_ms);
+}
+
+int PollScheduler::nextDue(unsigned long now) const
+{
+    int best = -1;
+    unsigned long bestOverdue = 0;
+
+    for (int i = 0; i < count; i++)
+    {
+        const PollSlot &slot = slots[i];
+        unsigned long elapsed = now - slot.last_request_ms;
+
+        if (!slot.enabled || (slot.requests != 0 && elapsed < slot.interval_ms))
+        {
+            continue;
+        }
+
+        // Lateness relative to the interval, so a 50 ms DID that is 50 ms late wins over
+        // a 5 s DID that is 50 ms late.
+        unsigned long overdue = (slot.requests == 0) ? ULONG_MAX : (elapsed * 1000UL) / slot.interval_ms;
+        if (best < 0 || overdue > bestOverdue)
+        {
+            best = i;
+            bestOverdue = overdue;
+        }
+    }
+
+    return best;
+}
+
+void PollScheduler::markRequested(int index, unsigned long now)
+{
+    slots[index].last_request_ms = now;
+    slots[index].requests++;
+}
+
+void PollScheduler::reportResponse(int index, float change_fraction, unsigned long now)
+{
+    PollSlot &slot = slots[index];
+    bool has_baseline = slot.responses != 0;
+    unsigned long elapsed = now - slot.last_response_ms;
+
+    slot.responses++;
+    slot.last_response_ms = now;
+
+    if (!has_baseline)
+    {
+        return;
+    }
+
+    if (elapsed > slot.max_age_ms)
+    {
+        slot.max_age_ms = elapsed;
+    }
+
+    unsigned long target = slot.max_interval_ms;
+    if (change_fraction > 0.0f && elapsed > 0)
+    {
+        float fraction_per_ms = change_fraction / (float)elapsed;
+        float ideal = TARGET_STEP_FRACTION / fraction_per_ms;
+        if (ideal < (float)slot.max_interval_ms)
+        {
+            target = (unsigned long)ideal;
+        }
+    }
+    target = constrain(target, slot.min_interval_ms, slot.max_interval_ms);
+
+    // Speed up immediately, slow down gradually so a single quiet sample does not
+    // starve a signal that is about to move again.
+    if (target < slot.interval_ms)
+    {
+        slot.interval_ms = target;
+    }
+    else
+    {
+        slot.interval_ms = (slot.interval_ms * 3 + target) / 4;
+    }
+}
+
+void PollScheduler::logMetrics(unsigned long now)
+{
+    for (int i = 0; i < count; i++)
+    {
+        PollSlot &slot = slots[i];
+        if (!slot.enabled)
+        {
+            continue;
+        }
+
+        unsigned long age = slot.responses ? now - slot.last_response_ms : 0;
+
+        LOG_INFO("poll 0x%03lX/0x%02X interval=%lu ms [%lu..%lu] age=%lu ms max_age=%lu ms req=%lu rsp=%lu",
+                 (unsigned long)requests[i].tx_id, requests[i].did, slot.interval_ms, slot.min_interval_ms,
+                 slot.max_interval_ms, age, slot.max_age_ms, (unsigned long)slot.requests,
+                 (unsigned long)slot.responses);
+
+        slot.max_age_ms = 0;
+    }
+}
@@ -0,0 +1,124 @@
+#ifndef _POLL_SCHEDULER_H
+#define _POLL_SCHEDULER_H
+
+#include <Arduino.h>
+#include <cstdint>
+#include "../common.h"
+#include "../uds/did_decoder.h"
+
+/**
+ * @brief Polling interval bounds for all signals of one unit type.
+ *
+ * Slow physical quantities (temperatures, learned values) never need to be read
+ * faster than min_interval_ms, while fast ones (RPM, load, MAP) must never be read
+ * slower than max_interval_ms regardless of how quiet they currently are.
+ */
+struct PollRateLimit
+{
+    int8_t unit;
+    uint16_t min_interval_ms;
+    uint16_t max_interval_ms;
+};
+
+// Unit ids match unitTypeInfos in uds/unit_types.h; units not listed use DEFAULT_POLL_RATE_LIMIT.
+inline constexpr PollRateLimit pollRateLimits[] = {
+    { 0,  500, 5000 },  // GENERAL - status bits and identifiers
+    { 5,   50,  500 },  // IGNITION_FEEDBACK
+    { 13, 1000, 10000 }, // DISTANCE
+    { 33,  50, 1000 },  // LOAD_FUEL_TRIM
+    { 34,  50, 1000 },  // MAP_TIRE_PRESSURE
+    { 39,  50,  500 },  // ENGINE_RPM
+    { 42,  50,  500 },  // SPEED_SENSOR
+    { 48,  200, 2000 }, // VOLTAGE_SENSOR
+    { 57,  500, 5000 }, // TEMPERATURE_SENSOR
+    { 66, 1000, 10000 }, // AMBIENT_TEMP
+};
+
+inline constexpr PollRateLimit DEFAULT_POLL_RATE_LIMIT = { -1, 100, 2000 };
+
+/**
+ * @brief Runtime polling state of a single UDS request (one ECU/DID pair).
+ */
+struct PollSlot
+{
+    unsigned long interval_ms = 0;       // Interval currently chosen by the adaptation
+    unsigned long min_interval_ms = 0;   // Fastest rate any signal of the DID may need
+    unsigned long max_interval_ms = 0;   // Slowest rate the most dynamic signal of the DID tolerates
+    unsigned long last_request_ms = 0;
+    unsigned long last_response_ms = 0;
+    unsigned long max_age_ms = 0;        // Worst data age seen at refresh in the current metrics window
+    bool enabled = true;                 // Cleared while none of the DID's signals has a subscriber
+    uint32_t requests = 0;
+    uint32_t responses = 0;
+};
+
+/**
+ * @brief Change-rate adaptive scheduler for the ISF UDS polling list.
+ *
+ * Each UDS request gets its own interval which is pulled towards the time it takes
+ * its fastest-moving signal to change by TARGET_STEP_FRACTION of its unit range.
+ * Only one request is released per call to nextDue(), so every slot not spent on a
+ * quiet DID is immediately available to the more dynamic ones.
+ */
+class PollScheduler
+{
+public:
+    PollScheduler(const UDSRequest *requests, int count);
+    ~PollScheduler();
+
+    /**
+     * @brief Derives per-DID interval bounds from the units of all of the DID's signal definitions.
+     */
+    void initialize();
+
+    /**
+     * @brief Narrows the interval bounds of a request to the signals its decoder still decodes.
+     *
+     * Called whenever the subscriptions are re-resolved, so a DID whose fast signal
+     * lost its last consumer is no longer polled at that signal's rate. An empty
+     * decoder leaves the bounds alone since the request is disabled anyway.
+     */
+    void updateBounds(int index, const DidDecoder &decoder);
+
+    /**
+     * @brief Returns the index of the most overdue request or -1 if nothing is due.
+     */
+    int nextDue(unsigned long now) const;
+
+    void markRequested(int index, unsigned long now);
+
+    void setEnabled(int index, bool enabled) { slots[index].enabled = enabled; }
+
+    /**
+     * @brief Adapts the interval of a request from the change observed in its response.
+     *
+     * @param index            Request index into the polling list
+     * @param change_fraction  Largest change of any decoded signal since the previous
+     *                         response, as a fraction of that signal's unit range
+     * @param now              Time the response was decoded
+     */
+    void reportResponse(int index, float change_fraction, unsigned long now);
+
+    /**
+     * @brief Logs the chosen interval and data freshness of every enabled request
+     *
+     * Resets the per-window worst age, so call it once per metrics window.
+     */
+    void logMetrics(unsigned long now);
+
+    const PollSlot &slot(int index) const { return slots[index]; }
+
+private:
+    static const PollRateLimit &findRateLimit(int8_t unit);
+    static void tightenBounds(PollSlot &slot, int8_t unit);
+    static void completeBounds(PollSlot &slot);
+
+    // Fraction of a unit's range a signal may move between two consecutive reads
+    static constexpr float TARGET_STEP_FRACTION = 0.02f;
+
+    const UDSRequest *requests;
+    int count;
+    PollSlot *slots = nullptr;
+};
+
+#endif // _POLL_SCHEDULER_H
@@ -0,0 +1,146 @@
+#include "change_notifier.h"
+#include "derived_signals.h"
+#include <cmath>
+#include <cstring>
+
+ChangeNotifier::ChangeNotifier()
+{
+    mutex = xSemaphoreCreateMutex();
+    for (std::atomic<uint8_t> &head : heads)
+    {
+        head.store(NO_SUBSCRIPTION, std::memory_order_relaxed);
+    }
+}
+
+bool ChangeNotifier::subscribe(SignalConsumer consumer, SignalId id, Deadband deadband)
+{
+    if (!isValidSignal(id) || (size_t)consumer >= CONSUMER_COUNT)
+    {
+        return false;
+    }
+
+    if (xSemaphoreTake(mutex, portMAX_DELAY) != pdTRUE)
+    {
+        return false;
+    }
+
+    uint32_t threshold_bits;
+    memcpy(&threshold_bits, &deadband.threshold, sizeof(threshold_bits));
+
+    bool subscribed = true;
+    uint8_t slot = heads[id].load(std::memory_order_relaxed);
+    while (slot != NO_SUBSCRIPTION && subscriptions[slot].consumer != consumer)
+    {
+        slot = subscriptions[slot].next;
+    }
+
+    if (slot != NO_SUBSCRIPTION)
+    {
+        subscriptions[slot].threshold_bits.store(threshold_bits, std::memory_order_relaxed);
+        subscriptions[slot].kind.store((uint8_t)deadband.kind, std::memory_order_relaxed);
+    }
+    else if (subscriptionCount >= MAX_SUBSCRIPTIONS)
+    {
+        subscribed = false;
+    }
+    else
+    {
+        if (queues[(size_t)consumer].load(std::memory_order_relaxed) == nullptr)
+        {
+            queues[(size_t)consumer].store(xQueueCreate(QUEUE_DEPTH, sizeof(ChangeEvent)), std::memory_order_release);
+        }
+
+        Subscription &subscription = subscriptions[subscriptionCount];
+        subscription.id = id;
+        subscription.consumer = consumer;
+        subscription.threshold_bits.store(threshold_bits, std::memory_order_relaxed);
+        subscription.kind.store((uint8_t)deadband.kind, std::memory_order_relaxed);
+        subscription.next = heads[id].load(std::memory_order_relaxed);
+
+        // The ISF task may be walking this signal's list right now; it sees the new entry only once complete
+        heads[id].store((uint8_t)subscriptionCount, std::memory_order_release);
+        subscriptionCount++;
+    }
+
+    xSemaphoreGive(mutex);
+
+    if (subscribed && isDerivedSignal(id))
+    {
+        derivedSignals.require(id);
+    }
+    else if (subscribed)
+    {
+        signalRegistry.subscribe(consumer, id);
+    }
+    return subscribed;
+}
+
+bool ChangeNotifier::receive(SignalConsumer consumer, ChangeEvent &event, TickType_t wait)
+{
+    if ((size_t)consumer >= CONSUMER_COUNT)
+    {
+        return false;
+    }
+
+    QueueHandle_t queue = queues[(size_t)consumer].load(std::memory_order_acquire);
+    return queue != nullptr && xQueueReceive(queue, &event, wait) == pdTRUE;
+}
+
+uint32_t ChangeNotifier::dropped(SignalConsumer consumer) const
+{
+    return (size_t)consumer < CONSUMER_COUNT ? droppedEvents[(size_t)consumer].load(std::memory_order_relaxed) : 0;
+}
+
+bool ChangeNotifier::exceeds(const Subscription &subscription, float value)
+{
+    if (!subscription.has_reference)
+    {
+        return true;
+    }
+
+    float threshold;
+    uint32_t threshold_bits = subscription.threshold_bits.load(std::memory_order_relaxed);
+    memcpy(&threshold, &threshold_bits, sizeof(threshold));
+
+    float delta = fabsf(value - subscription.reference);
+    if ((DeadbandKind)subscription.kind.load(std::memory_order_relaxed) == DeadbandKind::Relative)
+    {
+        threshold *= fabsf(subscription.reference);
+    }
+    return threshold > 0.0f ? delta > threshold : delta != 0.0f;
+}
+
+void ChangeNotifier::update(SignalId id, float value, uint32_t timestamp)
+{
+    if (!isValidSignal(id))
+    {
+        return;
+    }
+
+    for (uint8_t slot = heads[id].load(std::memory_order_acquire); slot != NO_SUBSCRIPTION;
+         slot = subscriptions[slot].next)
+    {
+        Subscription &subscription = subscriptions[slot];
+        if (!exceeds(subscription, value))
+        {
+            continue;
+        }
+
+        QueueHandle_t queue = queues[(size_t)subscription.consumer].load(std::memory_order_acquire);
+        ChangeEvent event{id, timestamp};
+        if (queue == nullptr || xQueueSend(queue, &event, 0) != pdTRUE)
+        {
+            droppedEvents[(size_t)subscription.consumer].fetch_add(1, std::memory_order_relaxed);
+            continue;
+        }
+
+        subscription.reference = value;
+        subscription.has_reference = true;
+
+        TaskHandle_t task = wakeTasks[(size_t)subscription.consumer].load(std::memory_order_acquire);
+        if (task != nullptr)
+        {
+            xTaskNotifyGive(task);
+        }
+    }
+}
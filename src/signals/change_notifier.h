@@ -0,0 +1,119 @@
+#ifndef _CHANGE_NOTIFIER_H
+#define _CHANGE_NOTIFIER_H
+
+#include <Arduino.h>
+#include <atomic>
+#include <cstdint>
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+#include "signal_registry.h"
+#include "signal_store.h"
+
+enum class DeadbandKind : uint8_t
+{
+    Absolute,   // Report when |value - last reported| > threshold
+    Relative    // Report when |value - last reported| > threshold * |last reported|
+};
+
+struct Deadband
+{
+    DeadbandKind kind = DeadbandKind::Absolute;
+    float threshold = 0.0f;     // 0 reports every change of value
+};
+
+/**
+ * @brief A signal moved beyond a consumer's deadband.
+ *
+ * Events only name the signal; the value is read from signalStore, so one
+ * decoded value fans out to any number of consumers without being copied.
+ */
+struct ChangeEvent
+{
+    SignalId id;
+    uint32_t timestamp;     // millis() of the response that crossed the deadband
+};
+
+/**
+ * @brief Per-consumer, deadband-filtered change notifications for decoded signals.
+ *
+ * Consumers subscribe a signal with a deadband and drain a bounded FreeRTOS
+ * queue of ChangeEvents, so their work scales with the number of changes
+ * rather than the number of samples. The ISF task calls update() for every
+ * value it publishes; that path takes no lock: subscriptions live in a fixed
+ * pool linked per signal and are only ever prepended under the subscriber
+ * mutex, then released with an atomic store. When a consumer's queue is full
+ * the event is dropped and counted, and the deadband reference is left alone so
+ * the change is reported again on the next sample.
+ */
+class ChangeNotifier
+{
+public:
+    ChangeNotifier();
+
+    /**
+     * @brief Subscribes a consumer to a signal; also registers the signal, or a derived signal's
+     * inputs, so the ISF side decodes it.
+     *
+     * Subscribing the same signal again replaces the deadband.
+     *
+     * @return false if the subscription pool is full or the signal ID is invalid
+     */
+    bool subscribe(SignalConsumer consumer, SignalId id, Deadband deadband);
+
+    /**
+     * @brief Next change event of a consumer.
+     *
+     * @return false if no event arrived within wait
+     */
+    bool receive(SignalConsumer consumer, ChangeEvent &event, TickType_t wait = 0);
+
+    // Events lost to a full queue since start-up
+    uint32_t dropped(SignalConsumer consumer) const;
+
+    /**
+     * @brief Also gives task a notification for every event queued for consumer, so it can
+     * block on ulTaskNotifyTake() together with other wake-ups; nullptr stops it.
+     */
+    void setWakeTask(SignalConsumer consumer, TaskHandle_t task)
+    {
+        wakeTasks[(size_t)consumer].store(task, std::memory_order_release);
+    }
+
+    // ISF task only
+    void update(SignalId id, float value, uint32_t timestamp);
+
+private:
+    static constexpr size_t MAX_SUBSCRIPTIONS = 64;
+    static constexpr size_t CONSUMER_COUNT = 8;     // Bits in a ConsumerMask
+    static constexpr UBaseType_t QUEUE_DEPTH = 32;
+    static constexpr uint8_t NO_SUBSCRIPTION = 0xFF;
+
+    struct Subscription
+    {
+        SignalId id = SIGNAL_NONE;
+        SignalConsumer consumer = SignalConsumer::Gt86Translator;
+        std::atomic<uint32_t> threshold_bits{0};
+        std::atomic<uint8_t> kind{0};
+        uint8_t next = NO_SUBSCRIPTION;
+
+        // Owned by the ISF task
+        float reference = 0.0f;
+        bool has_reference = false;
+    };
+
+    static bool exceeds(const Subscription &subscription, float value);
+
+    SemaphoreHandle_t mutex = nullptr;
+    Subscription subscriptions[MAX_SUBSCRIPTIONS];
+    size_t subscriptionCount = 0;
+    std::atomic<uint8_t> heads[SIGNAL_ID_CAPACITY];
+    std::atomic<QueueHandle_t> queues[CONSUMER_COUNT] = {};
+    std::atomic<uint32_t> droppedEvents[CONSUMER_COUNT] = {};
+    std::atomic<TaskHandle_t> wakeTasks[CONSUMER_COUNT] = {};
+};
+
+inline ChangeNotifier changeNotifier;
+
+#endif // _CHANGE_NOTIFIER_H
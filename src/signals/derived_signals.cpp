@@ -0,0 +1,493 @@
+#include "derived_signals.h"
+#include "change_notifier.h"
+#include "signal_registry.h"
+#include "../logger/logger.h"
+#include <Arduino.h>
+#include <cctype>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+
+/**
+ * @brief Recursive-descent compiler from expression text to a Program.
+ *
+ * expression := term (('+' | '-') term)*
+ * term       := factor (('*' | '/') factor)*
+ * factor     := number | '{' hex ':' name '}' | function '(' args ')' | '(' expression ')' | '-' factor
+ */
+class DerivedSignals::Compiler
+{
+public:
+    Compiler(const char *text, Program &program) : text(text), cursor(text), program(program) {}
+
+    bool compile()
+    {
+        if (!expression())
+        {
+            return false;
+        }
+        skipSpaces();
+        return *cursor == '\0' || fail("unexpected text");
+    }
+
+    const char *error = nullptr;
+    size_t position() const { return cursor - text; }
+
+private:
+    bool fail(const char *message)
+    {
+        if (error == nullptr)
+        {
+            error = message;
+        }
+        return false;
+    }
+
+    void skipSpaces()
+    {
+        while (*cursor == ' ')
+        {
+            cursor++;
+        }
+    }
+
+    bool accept(char c)
+    {
+        skipSpaces();
+        if (*cursor != c)
+        {
+            return false;
+        }
+        cursor++;
+        return true;
+    }
+
+    bool emit(Op op, uint8_t arg = 0)
+    {
+        if (program.code_size >= MAX_CODE)
+        {
+            return fail("expression too long");
+        }
+
+        if (op == Op::Input || op == Op::Constant)
+        {
+            if (++depth > (int)MAX_STACK)
+            {
+                return fail("expression nested too deeply");
+            }
+        }
+        else if (op != Op::Negate)
+        {
+            depth--;
+        }
+
+        program.code[program.code_size++] = Instruction{op, arg};
+        return true;
+    }
+
+    bool constant(float value)
+    {
+        if (program.constant_count >= MAX_CONSTANTS)
+        {
+            return fail("too many constants");
+        }
+        program.constants[program.constant_count] = value;
+        return emit(Op::Constant, program.constant_count++);
+    }
+
+    bool reference()
+    {
+        char *end = nullptr;
+        unsigned long ecu = strtoul(cursor, &end, 16);
+        if (end == cursor || *end != ':')
+        {
+            return fail("expected {ECU:Signal Name}");
+        }
+
+        const char *name = end + 1;
+        const char *close = strchr(name, '}');
+        if (close == nullptr || close - name >= 64)
+        {
+            return fail("unterminated signal reference");
+        }
+
+        char buffer[64];
+        memcpy(buffer, name, close - name);
+        buffer[close - name] = '\0';
+        cursor = close + 1;
+
+        SignalId id = findSignalId((uint16_t)ecu, buffer);
+        if (id == SIGNAL_NONE)
+        {
+            return fail("unknown signal");
+        }
+
+        for (uint8_t i = 0; i < program.input_count; i++)
+        {
+            if (program.inputs[i] == id)
+            {
+                return emit(Op::Input, i);
+            }
+        }
+        if (program.input_count >= MAX_INPUTS)
+        {
+            return fail("too many inputs");
+        }
+        program.inputs[program.input_count] = id;
+        return emit(Op::Input, program.input_count++);
+    }
+
+    bool function()
+    {
+        const char *start = cursor;
+        while (isalpha((unsigned char)*cursor))
+        {
+            cursor++;
+        }
+        size_t length = cursor - start;
+
+        if (!accept('('))
+        {
+            return fail("expected '(' after function name");
+        }
+
+        int args = 0;
+        do
+        {
+            if (!expression())
+            {
+                return false;
+            }
+            // avg() keeps a running sum so it needs no extra stack per argument
+            if (++args > 1 && length == 3 && strncmp(start, "avg", 3) == 0 && !emit(Op::Add))
+            {
+                return false;
+            }
+        } while (accept(','));
+
+        if (!accept(')'))
+        {
+            return fail("expected ')'");
+        }
+
+        if (length == 3 && strncmp(start, "avg", 3) == 0)
+        {
+            return args == 1 || (constant((float)args) && emit(Op::Divide));
+        }
+        if (args != 2)
+        {
+            return fail("function takes two arguments");
+        }
+        if (length == 3 && strncmp(start, "min", 3) == 0)
+        {
+            return emit(Op::Min);
+        }
+        if (length == 3 && strncmp(start, "max", 3) == 0)
+        {
+            return emit(Op::Max);
+        }
+        if (length == 8 && strncmp(start, "fallback", 8) == 0)
+        {
+            return emit(Op::Fallback);
+        }
+        return fail("unknown function");
+    }
+
+    bool factor()
+    {
+        skipSpaces();
+        if (accept('-'))
+        {
+            return factor() && emit(Op::Negate);
+        }
+        if (accept('('))
+        {
+            return expression() && (accept(')') || fail("expected ')'"));
+        }
+        if (accept('{'))
+        {
+            return reference();
+        }
+        if (isalpha((unsigned char)*cursor))
+        {
+            return function();
+        }
+
+        char *end = nullptr;
+        float value = strtof(cursor, &end);
+        if (end == cursor)
+        {
+            return fail("expected a number, signal or function");
+        }
+        cursor = end;
+        return constant(value);
+    }
+
+    bool term()
+    {
+        if (!factor())
+        {
+            return false;
+        }
+        for (;;)
+        {
+            if (accept('*'))
+            {
+                if (!factor() || !emit(Op::Multiply))
+                {
+                    return false;
+                }
+            }
+            else if (accept('/'))
+            {
+                if (!factor() || !emit(Op::Divide))
+                {
+                    return false;
+                }
+            }
+            else
+            {
+                return true;
+            }
+        }
+    }
+
+    bool expression()
+    {
+        if (!term())
+        {
+            return false;
+        }
+        for (;;)
+        {
+            if (accept('+'))
+            {
+                if (!term() || !emit(Op::Add))
+                {
+                    return false;
+                }
+            }
+            else if (accept('-'))
+            {
+                if (!term() || !emit(Op::Subtract))
+                {
+                    return false;
+                }
+            }
+            else
+            {
+                return true;
+            }
+        }
+    }
+
+    const char *text;
+    const char *cursor;
+    Program &program;
+    int depth = 0;
+};
+
+void DerivedSignals::initialize()
+{
+    for (size_t i = 0; i < DERIVED_SIGNAL_COUNT; i++)
+    {
+        Program &program = programs[i];
+        program = Program{};
+
+        Compiler compiler(DERIVED_SIGNAL_DEFINITIONS[i].expression, program);
+        program.compiled = compiler.compile();
+        if (!program.compiled)
+        {
+            LOG_ERROR("Derived signal %s: %s at column %u", DERIVED_SIGNAL_DEFINITIONS[i].name, compiler.error,
+                      (unsigned)compiler.position());
+            continue;
+        }
+
+        // Inputs without data read as NaN until their first sample
+        for (uint8_t k = 0; k < program.input_count; k++)
+        {
+            program.input_values[k] = NAN;
+            program.input_times[k] = 0;
+        }
+    }
+}
+
+void DerivedSignals::require(SignalId id)
+{
+    if (!isDerivedSignal(id) || (size_t)(id - DERIVED_SIGNAL_BASE) >= DERIVED_SIGNAL_COUNT)
+    {
+        return;
+    }
+
+    const Program &program = programs[id - DERIVED_SIGNAL_BASE];
+    for (uint8_t k = 0; k < program.input_count; k++)
+    {
+        signalRegistry.subscribe(SignalConsumer::DerivedSignals, program.inputs[k]);
+    }
+}
+
+SignalId DerivedSignals::find(const char *name) const
+{
+    for (size_t i = 0; i < DERIVED_SIGNAL_COUNT; i++)
+    {
+        if (programs[i].compiled && strcmp(DERIVED_SIGNAL_DEFINITIONS[i].name, name) == 0)
+        {
+            return (SignalId)(DERIVED_SIGNAL_BASE + i);
+        }
+    }
+    return SIGNAL_NONE;
+}
+
+void DerivedSignals::onPublished(SignalId id, float value, uint32_t timestamp)
+{
+    for (Program &program : programs)
+    {
+        bool input = false;
+        for (uint8_t k = 0; k < program.input_count; k++)
+        {
+            if (program.inputs[k] != id)
+            {
+                continue;
+            }
+            input = true;
+            program.input_times[k] = timestamp;
+
+            // Compare bit patterns so a first sample replaces the NaN placeholder
+            if (memcmp(&program.input_values[k], &value, sizeof(value)) != 0)
+            {
+                program.input_values[k] = value;
+                program.dirty = true;
+            }
+        }
+
+        // A live input also re-evaluates the signal when another input went stale or came back
+        if (input && staleInputs(program, timestamp) != program.stale_inputs)
+        {
+            program.dirty = true;
+        }
+    }
+}
+
+uint8_t DerivedSignals::staleInputs(const Program &program, uint32_t now)
+{
+    uint8_t stale = 0;
+    for (uint8_t k = 0; k < program.input_count; k++)
+    {
+        if (!std::isnan(program.input_values[k]) && now - program.input_times[k] > DERIVED_INPUT_STALE_MS)
+        {
+            stale |= (uint8_t)(1u << k);
+        }
+    }
+    return stale;
+}
+
+float DerivedSignals::evaluate(const Program &program) const
+{
+    float stack[MAX_STACK];
+    int top = -1;
+
+    for (uint8_t pc = 0; pc < program.code_size; pc++)
+    {
+        const Instruction &instruction = program.code[pc];
+        switch (instruction.op)
+        {
+        case Op::Input:
+            stack[++top] = (program.stale_inputs >> instruction.arg) & 1 ? NAN : program.input_values[instruction.arg];
+            break;
+        case Op::Constant:
+            stack[++top] = program.constants[instruction.arg];
+            break;
+        case Op::Add:
+            top--;
+            stack[top] += stack[top + 1];
+            break;
+        case Op::Subtract:
+            top--;
+            stack[top] -= stack[top + 1];
+            break;
+        case Op::Multiply:
+            top--;
+            stack[top] *= stack[top + 1];
+            break;
+        case Op::Divide:
+            top--;
+            stack[top] /= stack[top + 1];
+            break;
+        // fminf/fmaxf return the other operand for NaN, which would hide an input without data
+        case Op::Min:
+            top--;
+            stack[top] = std::isnan(stack[top]) || std::isnan(stack[top + 1]) ? NAN : fminf(stack[top], stack[top + 1]);
+            break;
+        case Op::Max:
+            top--;
+            stack[top] = std::isnan(stack[top]) || std::isnan(stack[top + 1]) ? NAN : fmaxf(stack[top], stack[top + 1]);
+            break;
+        case Op::Negate:
+            stack[top] = -stack[top];
+            break;
+        case Op::Fallback:
+            top--;
+            stack[top] = std::isnan(stack[top]) ? stack[top + 1] : stack[top];
+            break;
+        }
+    }
+
+    return stack[0];
+}
+
+void DerivedSignals::evaluateDirty(uint32_t timestamp)
+{
+    for (size_t i = 0; i < DERIVED_SIGNAL_COUNT; i++)
+    {
+        Program &program = programs[i];
+        if (!program.dirty)
+        {
+            continue;
+        }
+        program.dirty = false;
+        program.stale_inputs = staleInputs(program, timestamp);
+
+        // NaN means an input has no data, so there is nothing to publish
+        float value = evaluate(program);
+        if (std::isnan(value))
+        {
+            continue;
+        }
+
+        SignalId id = (SignalId)(DERIVED_SIGNAL_BASE + i);
+        signalStore.beginPublish(id);
+        signalStore.publish(id, value, timestamp);
+        signalStore.endPublish(id);
+        changeNotifier.update(id, value, timestamp);
+    }
+}
+
+void DerivedSignals::benchmark()
+{
+    static constexpr int ROUNDS = 1000;
+
+    for (size_t i = 0; i < DERIVED_SIGNAL_COUNT; i++)
+    {
+        Program program = programs[i];
+        if (!program.compiled)
+        {
+            continue;
+        }
+        for (uint8_t k = 0; k < program.input_count; k++)
+        {
+            program.input_values[k] = 10.0f + k;
+        }
+        program.stale_inputs = 0;
+
+        volatile float sink = 0.0f;
+        unsigned long start = micros();
+        for (int round = 0; round < ROUNDS; round++)
+        {
+            sink = sink + evaluate(program);
+        }
+        unsigned long elapsed = micros() - start;
+
+        LOG_INFO("derived %s: %u instructions, %lu ns/evaluation", DERIVED_SIGNAL_DEFINITIONS[i].name,
+                 program.code_size, (unsigned long)(elapsed * 1000ULL / ROUNDS));
+    }
+}
@@ -0,0 +1,118 @@
+#ifndef _DERIVED_SIGNALS_H
+#define _DERIVED_SIGNALS_H
+
+#include <cstddef>
+#include <cstdint>
+#include "signal_store.h"
+
+/**
+ * @brief A signal computed from decoded ones.
+ *
+ * Expressions use + - * / and parentheses over numbers and signal references
+ * written {ECU:Signal Name} with the ECU tx id in hex, plus the functions
+ * min(a, b), max(a, b), avg(a, ...) and fallback(a, b), which is a unless a
+ * has no data. An input has no data until its first sample and again once it
+ * has not been published for DERIVED_INPUT_STALE_MS.
+ */
+struct DerivedSignalDefinition
+{
+    const char *name;
+    const char *expression;
+};
+
+inline constexpr DerivedSignalDefinition DERIVED_SIGNAL_DEFINITIONS[] = {
+    {"Average Wheel Speed", "avg({7B0:FR Wheel Speed}, {7B0:FL Wheel Speed}, {7B0:RR Wheel Speed}, {7B0:RL Wheel Speed})"},
+    // Engine revolutions per wheel revolution, with the 2.07 m circumference of the 255/35R19 rear tyres
+    {"Overall Gear Ratio", "{7E0:Engine Speed} * 0.1242 / max({7E0:Vehicle Speed}, 1)"},
+    {"Oil Temperature", "fallback({7E0:Engine Oil Temperature}, {7E0:Coolant Temp})"},
+};
+
+// Twice the slowest temperature poll (pollRateLimits), so a quiet input that is still polled never reads as stale
+inline constexpr uint32_t DERIVED_INPUT_STALE_MS = 10000;
+
+inline constexpr size_t DERIVED_SIGNAL_COUNT = sizeof(DERIVED_SIGNAL_DEFINITIONS) / sizeof(DERIVED_SIGNAL_DEFINITIONS[0]);
+static_assert(DERIVED_SIGNAL_COUNT <= MAX_DERIVED_SIGNALS, "Raise MAX_DERIVED_SIGNALS");
+
+/**
+ * @brief Compiles DERIVED_SIGNAL_DEFINITIONS to stack bytecode and re-evaluates them as inputs change.
+ *
+ * Expressions are parsed once in initialize(); signal references are resolved
+ * to SignalIds and constants to a per-signal pool, so evaluating is a short loop
+ * over two-byte instructions with no parsing, lookup or allocation. The ISF task
+ * reports every published value through onPublished(), which only marks the
+ * derived signals whose input actually changed; evaluateDirty() then
+ * recomputes those and publishes them to signalStore under their own IDs.
+ */
+class DerivedSignals
+{
+public:
+    void initialize();
+
+    /**
+     * @brief Subscribes the inputs of a derived signal so the ISF side polls them.
+     */
+    void require(SignalId id);
+
+    SignalId find(const char *name) const;
+
+    // ISF task only; timestamp is the millis() the value was published with
+    void onPublished(SignalId id, float value, uint32_t timestamp);
+    void evaluateDirty(uint32_t timestamp);
+
+    // Logs the evaluation cost of each compiled signal
+    void benchmark();
+
+private:
+    enum class Op : uint8_t
+    {
+        Input,      // Push inputs[arg], NaN while it is stale
+        Constant,   // Push constants[arg]
+        Add,
+        Subtract,
+        Multiply,
+        Divide,
+        Min,        // NaN if either operand is
+        Max,        // NaN if either operand is
+        Negate,
+        Fallback    // b, a -> a unless a is NaN
+    };
+
+    struct Instruction
+    {
+        Op op;
+        uint8_t arg;
+    };
+
+    static constexpr size_t MAX_CODE = 32;
+    static constexpr size_t MAX_INPUTS = 8;
+    static constexpr size_t MAX_CONSTANTS = 8;
+    static constexpr size_t MAX_STACK = 8;
+
+    struct Program
+    {
+        Instruction code[MAX_CODE];
+        uint8_t code_size = 0;
+        SignalId inputs[MAX_INPUTS];
+        float input_values[MAX_INPUTS];
+        uint32_t input_times[MAX_INPUTS];
+        uint8_t input_count = 0;
+        uint8_t stale_inputs = 0;   // Bit k: inputs[k] was stale at the last evaluation
+        float constants[MAX_CONSTANTS];
+        uint8_t constant_count = 0;
+        bool compiled = false;
+        bool dirty = false;
+    };
+
+    class Compiler;
+
+    static_assert(MAX_INPUTS <= 8, "stale_inputs holds one bit per input");
+
+    static uint8_t staleInputs(const Program &program, uint32_t now);
+    float evaluate(const Program &program) const;
+
+    Program programs[DERIVED_SIGNAL_COUNT];
+};
+
+inline DerivedSignals derivedSignals;
+
+#endif // _DERIVED_SIGNALS_H
@@ -0,0 +1,116 @@
+#include "signal_predictor.h"
+#include "derived_signals.h"
+#include "../logger/logger.h"
+#include <cmath>
+
+bool SignalPredictor::track(SignalId id, const PredictorConfig &config)
+{
+    if (!isValidSignal(id) || trackCount >= MAX_TRACKED)
+    {
+        return false;
+    }
+
+    tracked[trackCount] = Track{};
+    tracked[trackCount].id = id;
+    tracked[trackCount].config = config;
+    trackCount++;
+    return true;
+}
+
+bool SignalPredictor::tracks(SignalId id) const
+{
+    for (size_t i = 0; i < trackCount; i++)
+    {
+        if (tracked[i].id == id)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+void SignalPredictor::observe(Track &track, float sample, uint32_t timestamp)
+{
+    int32_t elapsed_ms = (int32_t)(timestamp - track.timestamp);
+
+    // Restart from the sample after a gap the rate says nothing about
+    if (!track.initialized || elapsed_ms > 4 * (int32_t)track.config.max_extrapolation_ms)
+    {
+        track.value = sample;
+        track.rate = 0.0f;
+        track.timestamp = timestamp;
+        track.initialized = true;
+        return;
+    }
+    if (elapsed_ms <= 0)
+    {
+        return;
+    }
+
+    float dt = elapsed_ms / 1000.0f;
+    float predicted = track.value + track.rate * dt;
+    float residual = sample - predicted;
+
+    track.value = predicted + track.config.alpha * residual;
+    track.rate += track.config.beta * residual / dt;
+    track.timestamp = timestamp;
+
+    track.samples++;
+    track.squared_error_sum += residual * residual;
+    track.max_error = fmaxf(track.max_error, fabsf(residual));
+}
+
+bool SignalPredictor::predict(size_t index, uint32_t now, float &value, uint32_t &sampled)
+{
+    Track &track = tracked[index];
+
+    SignalSample sample;
+    if (signalStore.read(track.id, sample) && sample.quality == SignalQuality::Valid &&
+        (!track.initialized || sample.timestamp != track.timestamp))
+    {
+        observe(track, sample.value, sample.timestamp);
+    }
+    if (!track.initialized)
+    {
+        return false;
+    }
+
+    int32_t ahead_ms = (int32_t)(now - track.timestamp);
+    ahead_ms = ahead_ms < 0 ? 0 : ahead_ms;
+    ahead_ms = ahead_ms > (int32_t)track.config.max_extrapolation_ms ? track.config.max_extrapolation_ms : ahead_ms;
+
+    float delta = track.rate * (ahead_ms / 1000.0f);
+    delta = fmaxf(-track.config.max_delta, fminf(track.config.max_delta, delta));
+    float estimate = track.value + delta;
+
+    sampled = track.timestamp;
+    if (track.has_output && estimate == track.output)
+    {
+        return false;
+    }
+    track.output = estimate;
+    track.has_output = true;
+    value = estimate;
+    return true;
+}
+
+void SignalPredictor::logMetrics()
+{
+    for (size_t i = 0; i < trackCount; i++)
+    {
+        Track &track = tracked[i];
+        if (track.samples == 0)
+        {
+            continue;
+        }
+
+        const char *name = isDerivedSignal(track.id) ? DERIVED_SIGNAL_DEFINITIONS[track.id - DERIVED_SIGNAL_BASE].name
+                                                     : udsName(udsTables().definitions[track.id]);
+        LOG_INFO("predict %s: %lu samples, residual rms %.2f max %.2f, rate %.1f/s", name, (unsigned long)track.samples,
+                 sqrtf(track.squared_error_sum / track.samples), track.max_error, track.rate);
+
+        track.samples = 0;
+        track.squared_error_sum = 0.0f;
+        track.max_error = 0.0f;
+    }
+}
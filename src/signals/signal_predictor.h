@@ -0,0 +1,85 @@
+#ifndef _SIGNAL_PREDICTOR_H
+#define _SIGNAL_PREDICTOR_H
+
+#include <cstddef>
+#include <cstdint>
+#include "signal_store.h"
+
+/**
+ * @brief Alpha-beta filter gains and extrapolation limits of one predicted signal.
+ *
+ * alpha weighs a new sample against the predicted value, beta corrects the
+ * rate; beta = alpha^2 / (2 - alpha) gives a critically damped response.
+ */
+struct PredictorConfig
+{
+    float alpha;
+    float beta;
+    uint16_t max_extrapolation_ms;  // Estimates stop moving this long after the last sample
+    float max_delta;                // Largest extrapolated change from the filtered value, in signal units
+};
+
+/**
+ * @brief Up-samples slowly polled signals by alpha-beta extrapolation.
+ *
+ * Each tracked signal keeps a filtered value and rate, corrected whenever
+ * signalStore holds a sample with a newer timestamp. predict() then
+ * extrapolates to the requested time, so a consumer ticking faster than the
+ * poll rate sees a ramp instead of steps. The cost per tick is a store read and
+ * a few float operations per tracked signal. Each correction also records the
+ * residual, the difference between the sample and what the filter had
+ * predicted for that instant, which is the error the consumer saw.
+ *
+ * Single task: every call must come from the consumer's task.
+ */
+class SignalPredictor
+{
+public:
+    static constexpr size_t MAX_TRACKED = 8;
+
+    /**
+     * @return false if the signal is invalid or MAX_TRACKED signals are already tracked
+     */
+    bool track(SignalId id, const PredictorConfig &config);
+
+    bool tracks(SignalId id) const;
+
+    size_t count() const { return trackCount; }
+    SignalId id(size_t index) const { return tracked[index].id; }
+
+    /**
+     * @brief Feeds any new sample of a tracked signal and estimates it at now.
+     *
+     * @param sampled  Decode time of the newest sample behind the estimate
+     * @return false if there is no data yet or the estimate has not moved since the last call
+     */
+    bool predict(size_t index, uint32_t now, float &value, uint32_t &sampled);
+
+    // Logs and resets the residuals of the current metrics window
+    void logMetrics();
+
+private:
+    struct Track
+    {
+        SignalId id = SIGNAL_NONE;
+        PredictorConfig config{};
+        float value = 0.0f;         // Filtered value at timestamp
+        float rate = 0.0f;          // Units per second
+        uint32_t timestamp = 0;
+        bool initialized = false;
+        float output = 0.0f;
+        bool has_output = false;
+
+        // Current metrics window
+        uint32_t samples = 0;
+        float squared_error_sum = 0.0f;
+        float max_error = 0.0f;
+    };
+
+    static void observe(Track &track, float sample, uint32_t timestamp);
+
+    Track tracked[MAX_TRACKED];
+    size_t trackCount = 0;
+};
+
+#endif // _SIGNAL_PREDICTOR_H
@@ -0,0 +1,29 @@
+#include "signal_registry.h"
+
+void SignalRegistry::subscribe(SignalConsumer consumer, SignalId id)
+{
+    if (id >= SIGNAL_ID_CAPACITY)
+    {
+        return;
+    }
+
+    ConsumerMask previous = masks[id].fetch_or(maskOf(consumer), std::memory_order_relaxed);
+    if ((previous & maskOf(consumer)) == 0)
+    {
+        generationCount.fetch_add(1, std::memory_order_release);
+    }
+}
+
+void SignalRegistry::unsubscribe(SignalConsumer consumer, SignalId id)
+{
+    if (id >= SIGNAL_ID_CAPACITY)
+    {
+        return;
+    }
+
+    ConsumerMask previous = masks[id].fetch_and((ConsumerMask)~maskOf(consumer), std::memory_order_relaxed);
+    if ((previous & maskOf(consumer)) != 0)
+    {
+        generationCount.fetch_add(1, std::memory_order_release);
+    }
+}
@@ -0,0 +1,60 @@
+#ifndef _SIGNAL_REGISTRY_H
+#define _SIGNAL_REGISTRY_H
+
+#include <atomic>
+#include <cstdint>
+#include "signal_store.h"
+
+/**
+ * @brief Consumers of decoded ISF signals.
+ *
+ * Each consumer owns one bit of a ConsumerMask, so a signal stays subscribed
+ * until the last consumer that asked for it lets go.
+ */
+enum class SignalConsumer : uint8_t
+{
+    Gt86Translator = 0,
+    HostStream = 1,
+    DtcMonitor = 2,
+    DerivedSignals = 3,
+    DiagResponder = 4
+};
+
+using ConsumerMask = uint8_t;
+
+/**
+ * @brief Registry of the signals that have at least one live consumer.
+ *
+ * Consumers on either core declare the signals they need by SignalId, so a
+ * name that several ECUs or DIDs share is only polled where it was asked for.
+ * The ISF service only polls DIDs and decodes positions that resolve to a
+ * subscribed signal. Every change bumps generation() so readers can cache
+ * their resolved view and only rebuild it when the subscriptions actually
+ * change.
+ */
+class SignalRegistry
+{
+public:
+    void subscribe(SignalConsumer consumer, SignalId id);
+    void unsubscribe(SignalConsumer consumer, SignalId id);
+
+    /**
+     * @brief Returns the mask of consumers subscribed to a signal, 0 if none.
+     */
+    ConsumerMask subscribers(SignalId id) const
+    {
+        return id < SIGNAL_ID_CAPACITY ? masks[id].load(std::memory_order_relaxed) : 0;
+    }
+
+    uint32_t generation() const { return generationCount.load(std::memory_order_acquire); }
+
+private:
+    static ConsumerMask maskOf(SignalConsumer consumer) { return (ConsumerMask)(1u << (uint8_t)consumer); }
+
+    std::atomic<ConsumerMask> masks[SIGNAL_ID_CAPACITY] = {};
+    std::atomic<uint32_t> generationCount{0};
+};
+
+inline SignalRegistry signalRegistry;
+
+#endif // _SIGNAL_REGISTRY_H
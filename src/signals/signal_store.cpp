@@ -0,0 +1,210 @@
+#include "signal_store.h"
+#include <cstring>
+
+SignalId findSignalId(uint16_t request_id, const char *name)
+{
+    const UdsTables &tables = udsTables();
+    for (size_t i = 0; i < tables.definition_count; i++)
+    {
+        const UdsDefinition &def = tables.definitions[i];
+        if (def.request_id == request_id && strcmp(udsName(def), name) == 0)
+        {
+            return udsSignalId(def);
+        }
+    }
+    return SIGNAL_NONE;
+}
+
+SignalId findObdSignalId(const char *name)
+{
+    for (size_t i = 0; i < OBD_PID_COUNT; i++)
+    {
+        if (strcmp(OBD_PID_TABLE[i].name, name) == 0)
+        {
+            return (SignalId)(OBD_SIGNAL_BASE + i);
+        }
+    }
+    return SIGNAL_NONE;
+}
+
+bool SignalStore::separate(SignalId id)
+{
+    if (id >= udsTables().definition_count)
+    {
+        return false;
+    }
+    if (isSeparate(id))
+    {
+        return true;
+    }
+    if (separateCount == MAX_SEPARATE_SIGNALS)
+    {
+        return false;
+    }
+    separateIds[separateCount++] = id;
+    return true;
+}
+
+bool SignalStore::isSeparate(SignalId id) const
+{
+    for (size_t i = 0; i < separateCount; i++)
+    {
+        if (separateIds[i] == id)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+size_t SignalStore::groupOf(SignalId id) const
+{
+    for (size_t i = 0; i < separateCount; i++)
+    {
+        if (separateIds[i] == id)
+        {
+            return SEPARATE_GROUP_BASE + i;
+        }
+    }
+    if (isDerivedSignal(id))
+    {
+        return UDS_MAX_DIDS + (id - DERIVED_SIGNAL_BASE);
+    }
+    if (isObdSignal(id))
+    {
+        return UDS_MAX_DIDS + MAX_DERIVED_SIGNALS + (id - OBD_SIGNAL_BASE);
+    }
+    return didGroupOf(id);
+}
+
+size_t SignalStore::didGroupOf(SignalId id)
+{
+    // DID blocks are contiguous and ascending, so the group is the last block starting at or before id
+    const UdsTables &tables = udsTables();
+    size_t low = 0;
+    size_t high = tables.did_count;
+    while (high - low > 1)
+    {
+        size_t mid = low + (high - low) / 2;
+        if (tables.dids[mid].first <= id)
+        {
+            low = mid;
+        }
+        else
+        {
+            high = mid;
+        }
+    }
+    return low;
+}
+
+void SignalStore::beginGroup(size_t group)
+{
+    std::atomic<uint32_t> &sequence = sequences[group];
+    sequence.store(sequence.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+}
+
+void SignalStore::endGroup(size_t group)
+{
+    std::atomic<uint32_t> &sequence = sequences[group];
+    sequence.store(sequence.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+}
+
+void SignalStore::beginPublish(SignalId group_signal)
+{
+    beginGroup(groupOf(group_signal));
+}
+
+void SignalStore::beginDidPublish(SignalId did_signal)
+{
+    beginGroup(didGroupOf(did_signal));
+}
+
+void SignalStore::publish(SignalId id, float value, uint32_t timestamp)
+{
+    if (!isValidSignal(id))
+    {
+        return;
+    }
+
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+
+    Entry &entry = entries[id];
+    entry.value_bits.store(bits, std::memory_order_relaxed);
+    entry.timestamp.store(timestamp, std::memory_order_relaxed);
+    entry.quality.store((uint8_t)SignalQuality::Valid, std::memory_order_relaxed);
+}
+
+void SignalStore::endPublish(SignalId group_signal)
+{
+    endGroup(groupOf(group_signal));
+}
+
+void SignalStore::endDidPublish(SignalId did_signal)
+{
+    endGroup(didGroupOf(did_signal));
+}
+
+void SignalStore::load(SignalId id, SignalSample &sample) const
+{
+    const Entry &entry = entries[id];
+    uint32_t bits = entry.value_bits.load(std::memory_order_relaxed);
+    memcpy(&sample.value, &bits, sizeof(bits));
+    sample.timestamp = entry.timestamp.load(std::memory_order_relaxed);
+    sample.quality = (SignalQuality)entry.quality.load(std::memory_order_relaxed);
+}
+
+bool SignalStore::read(SignalId id, SignalSample &sample) const
+{
+    return snapshot(&id, &sample, 1);
+}
+
+bool SignalStore::snapshot(const SignalId *ids, SignalSample *samples, size_t count) const
+{
+    if (count == 0)
+    {
+        return true;
+    }
+
+    for (size_t i = 0; i < count; i++)
+    {
+        if (!isValidSignal(ids[i]))
+        {
+            return false;
+        }
+    }
+
+    size_t group = groupOf(ids[0]);
+    for (size_t i = 1; i < count; i++)
+    {
+        if (groupOf(ids[i]) != group)
+        {
+            return false;
+        }
+    }
+
+    const std::atomic<uint32_t> &sequence = sequences[group];
+    for (int attempt = 0; attempt < MAX_READ_ATTEMPTS; attempt++)
+    {
+        uint32_t before = sequence.load(std::memory_order_acquire);
+        if (before & 1)
+        {
+            continue;
+        }
+
+        for (size_t i = 0; i < count; i++)
+        {
+            load(ids[i], samples[i]);
+        }
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (sequence.load(std::memory_order_relaxed) == before)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
@@ -0,0 +1,156 @@
+#ifndef _SIGNAL_STORE_H
+#define _SIGNAL_STORE_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include "../uds/uds_mapper.h"
+#include "../obd/obd_pids.h"
+
+// Signal IDs below DERIVED_SIGNAL_BASE are indices into the active definition table, so they are
+// stable for a given table; derived signals (derived_signals.h) follow from DERIVED_SIGNAL_BASE and
+// the OBD-II mode 01 PIDs, one per OBD_PID_TABLE row, from OBD_SIGNAL_BASE
+using SignalId = uint16_t;
+constexpr SignalId SIGNAL_NONE = 0xFFFF;
+constexpr size_t MAX_DERIVED_SIGNALS = 16;
+constexpr SignalId DERIVED_SIGNAL_BASE = UDS_MAX_DEFINITIONS;
+constexpr SignalId OBD_SIGNAL_BASE = DERIVED_SIGNAL_BASE + MAX_DERIVED_SIGNALS;
+constexpr size_t SIGNAL_ID_CAPACITY = UDS_MAX_DEFINITIONS + MAX_DERIVED_SIGNALS + OBD_PID_COUNT;
+
+enum class SignalQuality : uint8_t
+{
+    NoData = 0,     // Never published
+    Valid = 1       // Decoded from the latest response that contained it, or computed from valid inputs
+};
+
+struct SignalSample
+{
+    float value = 0.0f;
+    uint32_t timestamp = 0;     // millis() when the response was decoded
+    SignalQuality quality = SignalQuality::NoData;
+};
+
+inline SignalId udsSignalId(const UdsDefinition &def)
+{
+    return (SignalId)(&def - udsTables().definitions);
+}
+
+constexpr bool isDerivedSignal(SignalId id)
+{
+    return id >= DERIVED_SIGNAL_BASE && id < DERIVED_SIGNAL_BASE + MAX_DERIVED_SIGNALS;
+}
+
+constexpr bool isObdSignal(SignalId id)
+{
+    return id >= OBD_SIGNAL_BASE && id < OBD_SIGNAL_BASE + OBD_PID_COUNT;
+}
+
+constexpr SignalId obdSignalId(uint8_t pid)
+{
+    return OBD_PID_INDEX[pid] == OBD_PID_NONE ? SIGNAL_NONE : (SignalId)(OBD_SIGNAL_BASE + OBD_PID_INDEX[pid]);
+}
+
+inline bool isValidSignal(SignalId id)
+{
+    return id < udsTables().definition_count || isDerivedSignal(id) || isObdSignal(id);
+}
+
+/**
+ * @brief Looks up the first signal with the given name on one ECU.
+ *
+ * A linear scan of the generated table; resolve IDs once at startup, not per read.
+ */
+SignalId findSignalId(uint16_t request_id, const char *name);
+
+// Signal of the OBD_PID_TABLE row with the given name, SIGNAL_NONE if there is none
+SignalId findObdSignalId(const char *name);
+
+/**
+ * @brief Latest decoded value of every UDS signal, shared between the cores without locks.
+ *
+ * Entries are grouped by the DID that carries them and each group is published
+ * under its own sequence counter (a seqlock): the ISF task on core 0 makes the
+ * counter odd, stores the group's values and makes it even again, while readers
+ * on any core retry if the counter was odd or moved during their read. Neither
+ * side ever blocks, so a reader can never hold up the writer and there is no
+ * priority inversion. Because a counter covers a whole DID, every signal read
+ * in one snapshot() call comes from the same response. Each derived signal and
+ * each OBD PID is a group of its own, and so is every UDS signal given to
+ * separate(): such a signal is also fed by a second source (an ISF broadcast),
+ * so it is published on its own, never inside its DID's group.
+ *
+ * There must be exactly one writer, the ISF task.
+ */
+class SignalStore
+{
+public:
+    static constexpr size_t MAX_SEPARATE_SIGNALS = 8;
+
+    /**
+     * @brief Moves a UDS signal out of its DID's group into a group of its own.
+     *
+     * Call before the ISF and GT86 tasks start; groups are not looked up under a lock.
+     *
+     * @return false if the ID is not a UDS signal or MAX_SEPARATE_SIGNALS are already separate
+     */
+    bool separate(SignalId id);
+
+    bool isSeparate(SignalId id) const;
+
+    // Writer, ISF task only: beginPublish(), any number of publish(), endPublish()
+    void beginPublish(SignalId group_signal);
+    void publish(SignalId id, float value, uint32_t timestamp);
+    void endPublish(SignalId group_signal);
+
+    /**
+     * @brief Like beginPublish()/endPublish(), but always for the group of the DID carrying did_signal.
+     *
+     * A separated signal has a group of its own, so naming one in beginPublish()
+     * would leave the rest of its DID unprotected; a DID response is published
+     * under these whichever of its signals comes first.
+     */
+    void beginDidPublish(SignalId did_signal);
+    void endDidPublish(SignalId did_signal);
+
+    /**
+     * @brief Reads one signal.
+     *
+     * @return false if no consistent copy could be taken while the writer kept republishing the DID
+     */
+    bool read(SignalId id, SignalSample &sample) const;
+
+    /**
+     * @brief Reads several signals of one DID as a single consistent set.
+     *
+     * @return false if the IDs belong to different groups or the writer kept republishing the group
+     */
+    bool snapshot(const SignalId *ids, SignalSample *samples, size_t count) const;
+
+private:
+    struct Entry
+    {
+        std::atomic<uint32_t> value_bits{0};
+        std::atomic<uint32_t> timestamp{0};
+        std::atomic<uint8_t> quality{(uint8_t)SignalQuality::NoData};
+    };
+
+    // Publishing a DID takes microseconds and repeats at most every few milliseconds, so a short spin suffices
+    static constexpr int MAX_READ_ATTEMPTS = 64;
+
+    size_t groupOf(SignalId id) const;
+    static size_t didGroupOf(SignalId id);
+    void beginGroup(size_t group);
+    void endGroup(size_t group);
+    void load(SignalId id, SignalSample &sample) const;
+
+    static constexpr size_t SEPARATE_GROUP_BASE = UDS_MAX_DIDS + MAX_DERIVED_SIGNALS + OBD_PID_COUNT;
+
+    Entry entries[SIGNAL_ID_CAPACITY];
+    std::atomic<uint32_t> sequences[SEPARATE_GROUP_BASE + MAX_SEPARATE_SIGNALS] = {};
+    SignalId separateIds[MAX_SEPARATE_SIGNALS];
+    size_t separateCount = 0;
+};
+
+inline SignalStore signalStore;
+
+#endif // _SIGNAL_STORE_H
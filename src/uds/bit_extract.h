@@ -0,0 +1,146 @@
+#ifndef _BIT_EXTRACT_H
+#define _BIT_EXTRACT_H
+
+#include <cstddef>
+#include <cstdint>
+
+enum class ByteOrder : uint8_t
+{
+    Intel,      // Little-endian, least significant byte first
+    Motorola    // Big-endian, most significant byte first (Toyota local IDs)
+};
+
+/**
+ * @brief Reads a raw field value starting at its first byte.
+ *
+ * Bounds are not checked: the caller guarantees the field's bytes are present.
+ */
+using RawExtractor = uint32_t (*)(const uint8_t *field);
+
+constexpr uint8_t fieldBytes(uint8_t bit_offset, uint8_t bit_length)
+{
+    return (bit_offset + bit_length + 7) / 8;
+}
+
+constexpr uint32_t signExtend(uint32_t raw, uint8_t bit_length)
+{
+    uint32_t sign = 1U << (bit_length - 1);
+    return bit_length >= 32 ? raw : (raw ^ sign) - sign;
+}
+
+/**
+ * @brief Runtime path for any layout of up to 32 bits spread over at most four bytes.
+ *
+ * For both byte orders bit_offset counts from the least significant bit of the
+ * assembled word, so a flag in bit 6 of a byte is (offset 6, length 1) either way.
+ */
+constexpr uint32_t extractBits(const uint8_t *field, uint8_t bit_offset, uint8_t bit_length, ByteOrder order,
+                               bool is_signed)
+{
+    uint8_t bytes = fieldBytes(bit_offset, bit_length);
+    uint32_t word = 0;
+
+    for (uint8_t i = 0; i < bytes; i++)
+    {
+        if (order == ByteOrder::Motorola)
+        {
+            word = (word << 8) | field[i];
+        }
+        else
+        {
+            word |= (uint32_t)field[i] << (8 * i);
+        }
+    }
+
+    uint32_t mask = bit_length >= 32 ? 0xFFFFFFFF : ((1U << bit_length) - 1);
+    uint32_t raw = (word >> bit_offset) & mask;
+    return is_signed ? signExtend(raw, bit_length) : raw;
+}
+
+/**
+ * @brief Layout fixed at compile time, so the loop, shifts and mask fold into a few instructions.
+ */
+template <uint8_t BitOffset, uint8_t BitLength, ByteOrder Order, bool Signed>
+struct BitField
+{
+    static_assert(BitLength > 0 && BitOffset + BitLength <= 32, "Field must fit a 32-bit word");
+
+    static constexpr uint8_t BYTES = fieldBytes(BitOffset, BitLength);
+    static constexpr uint32_t MASK = BitLength >= 32 ? 0xFFFFFFFF : ((1U << BitLength) - 1);
+
+    static constexpr uint32_t extract(const uint8_t *field)
+    {
+        uint32_t word = 0;
+        if constexpr (BYTES == 1)
+        {
+            word = field[0];
+        }
+        else if constexpr (Order == ByteOrder::Motorola && BYTES == 2)
+        {
+            word = ((uint32_t)field[0] << 8) | field[1];
+        }
+        else if constexpr (Order == ByteOrder::Intel && BYTES == 2)
+        {
+            word = ((uint32_t)field[1] << 8) | field[0];
+        }
+        else
+        {
+            return extractBits(field, BitOffset, BitLength, Order, Signed);
+        }
+
+        uint32_t raw = (word >> BitOffset) & MASK;
+        if constexpr (Signed)
+        {
+            raw = signExtend(raw, BitLength);
+        }
+        return raw;
+    }
+};
+
+template <uint8_t BitOffset>
+using FlagField = BitField<BitOffset, 1, ByteOrder::Motorola, false>;
+
+/**
+ * @brief Picks the specialised kernel for the layouts that make up nearly every
+ * Toyota signal: flags in any bit, whole bytes and 16-bit big-endian words.
+ *
+ * @return The kernel, or nullptr if the layout needs the extractBits() runtime path
+ */
+constexpr RawExtractor selectExtractor(uint8_t bit_offset, uint8_t bit_length, ByteOrder order, bool is_signed)
+{
+    if (bit_length == 1 && !is_signed)
+    {
+        switch (bit_offset)
+        {
+        case 0: return &FlagField<0>::extract;
+        case 1: return &FlagField<1>::extract;
+        case 2: return &FlagField<2>::extract;
+        case 3: return &FlagField<3>::extract;
+        case 4: return &FlagField<4>::extract;
+        case 5: return &FlagField<5>::extract;
+        case 6: return &FlagField<6>::extract;
+        case 7: return &FlagField<7>::extract;
+        default: return nullptr;
+        }
+    }
+
+    if (bit_offset != 0 || order != ByteOrder::Motorola)
+    {
+        return nullptr;
+    }
+
+    if (bit_length == 8)
+    {
+        return is_signed ? &BitField<0, 8, ByteOrder::Motorola, true>::extract
+                         : &BitField<0, 8, ByteOrder::Motorola, false>::extract;
+    }
+    if (bit_length == 16)
+    {
+        return is_signed ? &BitField<0, 16, ByteOrder::Motorola, true>::extract
+                         : &BitField<0, 16, ByteOrder::Motorola, false>::extract;
+    }
+
+    return nullptr;
+}
+
+#endif // _BIT_EXTRACT_H
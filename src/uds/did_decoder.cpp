@@ -0,0 +1,172 @@
+#include "did_decoder.h"
+#include "uds_mapper.h"
+#include "scale_stage.h"
+#include "../logger/logger.h"
+#include <cmath>
+
+// Every generated layout must fit the 32-bit extraction word and its kernel must agree with the runtime path.
+// test/uds_extraction_test.cpp checks each row against an independent reference and the old get_raw_value().
+constexpr bool verifyUdsLayouts()
+{
+    constexpr uint8_t PATTERN[4] = {0xA5, 0x3C, 0x96, 0xE1};
+
+    for (const UdsDefinition &def : UDS_DEFINITIONS)
+    {
+        if (def.bit_length == 0 || def.bit_offset_position > 7 || def.bit_offset_position + def.bit_length > 32)
+        {
+            return false;
+        }
+
+        RawExtractor extractor = selectExtractor(def.bit_offset_position, def.bit_length, def.byte_order, def.is_signed);
+        uint32_t expected = extractBits(PATTERN, def.bit_offset_position, def.bit_length, def.byte_order, def.is_signed);
+        if (extractor != nullptr && extractor(PATTERN) != expected)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+static_assert(verifyUdsLayouts(), "Generated UDS layouts must be extractable");
+constexpr uint8_t ENGINE_SPEED_SAMPLE[2] = {0x12, 0x34};
+static_assert(BitField<0, 16, ByteOrder::Motorola, false>::extract(ENGINE_SPEED_SAMPLE) == 0x1234,
+              "Motorola words are big-endian");
+
+void DidDecoder::clear()
+{
+    definitions.clear();
+    byte_positions.clear();
+    bit_offsets.clear();
+    bit_lengths.clear();
+    byte_orders.clear();
+    signed_flags.clear();
+    extractors.clear();
+    end_bytes.clear();
+    value_types.clear();
+    scales.clear();
+    offsets.clear();
+    min_values.clear();
+    max_values.clear();
+    spans.clear();
+    alias_definitions.clear();
+    alias_targets.clear();
+    decoded_flags.clear();
+    raw_values.clear();
+    values.clear();
+    has_values.clear();
+    raw_inputs.clear();
+    scaled_values.clear();
+}
+
+bool DidDecoder::add(const UdsDefinition &def)
+{
+    for (size_t i = 0; i < definitions.size(); i++)
+    {
+        const UdsDefinition &other = *definitions[i];
+        if (other.byte_position == def.byte_position && other.bit_offset_position == def.bit_offset_position &&
+            other.bit_length == def.bit_length && other.byte_order == def.byte_order &&
+            other.is_signed == def.is_signed && other.unit == def.unit &&
+            other.scaling_factor == def.scaling_factor && other.offset_value == def.offset_value)
+        {
+            alias_definitions.push_back(&def);
+            alias_targets.push_back((uint16_t)i);
+            return false;
+        }
+    }
+
+    const UnitTypeInfo *unit_info = findUnitTypeInfo(def.unit);
+    if (unit_info == nullptr)
+    {
+        LOG_ERROR("Unit type not found for unit %d (%s)", def.unit, udsName(def));
+        return false;
+    }
+
+    bool boolean = unit_info->valueType == ValueType::Boolean;
+    // The field is assembled into one 32-bit word, so it may not span more than four bytes
+    if (def.bit_length == 0 || def.bit_offset_position > 7 || def.bit_offset_position + def.bit_length > 32)
+    {
+        LOG_ERROR("Invalid layout for %s: bit %d, length %d", udsName(def), def.bit_offset_position, def.bit_length);
+        return false;
+    }
+
+    float span = 1.0f;
+    if (!boolean && unit_info->minValue.has_value() && unit_info->maxValue.has_value())
+    {
+        span = unit_info->maxValue.value() - unit_info->minValue.value();
+    }
+
+    definitions.push_back(&def);
+    byte_positions.push_back(def.byte_position);
+    bit_offsets.push_back(def.bit_offset_position);
+    bit_lengths.push_back(def.bit_length);
+    byte_orders.push_back(def.byte_order);
+    signed_flags.push_back(def.is_signed);
+    extractors.push_back(selectExtractor(def.bit_offset_position, def.bit_length, def.byte_order, def.is_signed));
+    end_bytes.push_back(def.byte_position + fieldBytes(def.bit_offset_position, def.bit_length));
+    value_types.push_back(unit_info->valueType);
+    scales.push_back(boolean ? 1.0f : def.scaling_factor);
+    offsets.push_back(boolean ? 0.0f : def.offset_value);
+    min_values.push_back(!boolean && unit_info->minValue.has_value() ? unit_info->minValue.value() : -INFINITY);
+    max_values.push_back(!boolean && unit_info->maxValue.has_value() ? unit_info->maxValue.value() : INFINITY);
+    spans.push_back(span > 0.0f ? span : 1.0f);
+    decoded_flags.push_back(0);
+    raw_values.push_back(0);
+    values.push_back(0.0f);
+    has_values.push_back(0);
+    raw_inputs.push_back(0.0f);
+    scaled_values.push_back(0.0f);
+
+    return true;
+}
+
+size_t DidDecoder::decode(const uint8_t *payload, size_t length, float &change_fraction)
+{
+    size_t decoded = 0;
+    const size_t count = definitions.size();
+
+    // Extract every raw value first so the scaling below runs over the whole DID at once
+    for (size_t i = 0; i < count; i++)
+    {
+        if (end_bytes[i] > length)
+        {
+            decoded_flags[i] = 0;
+            raw_inputs[i] = 0.0f;
+            continue;
+        }
+
+        const uint8_t *field = &payload[byte_positions[i]];
+        uint32_t raw = extractors[i] != nullptr
+                           ? extractors[i](field)
+                           : extractBits(field, bit_offsets[i], bit_lengths[i], byte_orders[i], signed_flags[i]);
+
+        raw_values[i] = raw;
+        raw_inputs[i] = signed_flags[i] ? (float)(int32_t)raw : (float)raw;
+        decoded_flags[i] = 1;
+    }
+
+    scaleAndClamp(raw_inputs.data(), scales.data(), offsets.data(), min_values.data(), max_values.data(),
+                  scaled_values.data(), count);
+
+    for (size_t i = 0; i < count; i++)
+    {
+        if (!decoded_flags[i])
+        {
+            continue;
+        }
+
+        float value = scaled_values[i];
+
+        // A toggled status bit counts as a full-range change so DIDs carrying switches stay responsive
+        if (has_values[i])
+        {
+            float fraction = fabsf(value - values[i]) / spans[i];
+            change_fraction = fraction > change_fraction ? fraction : change_fraction;
+        }
+
+        values[i] = value;
+        has_values[i] = 1;
+        decoded++;
+    }
+
+    return decoded;
+}
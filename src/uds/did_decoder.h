@@ -0,0 +1,113 @@
+#ifndef _DID_DECODER_H
+#define _DID_DECODER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "uds_definition.h"
+#include "unit_types.h"
+
+/**
+ * @brief Decoder for the subscribed signals of one DID.
+ *
+ * Signals are stored as a structure of arrays with everything a response needs
+ * resolved when the subscriptions change: a definition with the same layout,
+ * unit and scaling as an earlier one is decoded once and published as an alias
+ * of it, the unit's value type, clamp range and change span are copied out of
+ * unitTypeInfos, the last byte each signal touches is precomputed and each
+ * layout is bound to a specialised extraction kernel from bit_extract.h.
+ * Decoding a response extracts every raw value, then scales, offsets and clamps
+ * the whole DID in one branch-free batch (scale_stage.h), with no allocation,
+ * hashing or unit lookup.
+ */
+class DidDecoder
+{
+public:
+    void clear();
+
+    /**
+     * @brief Adds a signal unless its unit is unknown or an identical field is already decoded.
+     *
+     * Several names often describe the same field, e.g. a value and its warning
+     * level. A definition with the same layout, scaling and unit as a signal
+     * already added becomes an alias of it instead of being decoded twice.
+     *
+     * @return true if the signal was added
+     */
+    bool add(const UdsDefinition &def);
+
+    size_t size() const { return definitions.size(); }
+    bool empty() const { return definitions.empty(); }
+
+    /**
+     * @brief Decodes every signal that fits in the response.
+     *
+     * Signals beyond the end of a partial response are skipped and keep their
+     * previous value.
+     *
+     * @param payload         Response data after the SID and DID
+     * @param length          Number of valid payload bytes
+     * @param change_fraction Output - largest change of any signal as a fraction of its unit range
+     * @return Number of signals decoded
+     */
+    size_t decode(const uint8_t *payload, size_t length, float &change_fraction);
+
+    const UdsDefinition &definition(size_t i) const { return *definitions[i]; }
+    bool isBoolean(size_t i) const { return value_types[i] == ValueType::Boolean; }
+    bool decoded(size_t i) const { return decoded_flags[i] != 0; }
+    uint32_t rawValue(size_t i) const { return raw_values[i]; }
+    float value(size_t i) const { return values[i]; }
+
+    /**
+     * @brief Calls visit(definition, value) for every signal and alias decoded by the last decode().
+     */
+    template <typename Visitor>
+    void forEachDecoded(Visitor visit) const
+    {
+        for (size_t i = 0; i < definitions.size(); i++)
+        {
+            if (decoded_flags[i])
+            {
+                visit(*definitions[i], values[i]);
+            }
+        }
+        for (size_t k = 0; k < alias_definitions.size(); k++)
+        {
+            if (decoded_flags[alias_targets[k]])
+            {
+                visit(*alias_definitions[k], values[alias_targets[k]]);
+            }
+        }
+    }
+
+private:
+    // Layout, resolved in add()
+    std::vector<const UdsDefinition *> definitions;
+    std::vector<uint8_t> byte_positions;
+    std::vector<uint8_t> bit_offsets;
+    std::vector<uint8_t> bit_lengths;
+    std::vector<ByteOrder> byte_orders;
+    std::vector<uint8_t> signed_flags;
+    std::vector<RawExtractor> extractors;   // nullptr selects the extractBits() runtime path
+    std::vector<uint8_t> end_bytes;
+    std::vector<ValueType> value_types;
+    std::vector<float> scales;
+    std::vector<float> offsets;
+    std::vector<float> min_values;
+    std::vector<float> max_values;
+    std::vector<float> spans;
+    std::vector<const UdsDefinition *> alias_definitions;
+    std::vector<uint16_t> alias_targets;
+
+    // Results of the last decode()
+    std::vector<uint8_t> decoded_flags;
+    std::vector<uint32_t> raw_values;
+    std::vector<float> values;
+    std::vector<uint8_t> has_values;
+
+    // Per-decode scratch of the batch scaling stage, sized with the signals so decode() never allocates
+    std::vector<float> raw_inputs;
+    std::vector<float> scaled_values;
+};
+
+#endif // _DID_DECODER_H
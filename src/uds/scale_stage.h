@@ -0,0 +1,47 @@
+#ifndef _SCALE_STAGE_H
+#define _SCALE_STAGE_H
+
+#include <cstddef>
+
+#if defined(ESP_PLATFORM) && __has_include(<dsps_mul.h>) && __has_include(<dsps_add.h>)
+#include <dsps_mul.h>
+#include <dsps_add.h>
+#define UDS_SCALE_USE_ESP_DSP 1
+#endif
+
+/**
+ * @brief Converts a whole DID's raw values to engineering units in one pass.
+ *
+ * out[i] = clamp(raw[i] * scale[i] + offset[i], min[i], max[i])
+ *
+ * Every signal takes the same path: unclamped signals carry -INFINITY/INFINITY
+ * limits and flags carry scale 1 and offset 0, so the loop has no per-signal
+ * branches. With esp-dsp available the multiply and add run through its
+ * ESP32-S3 optimised kernels; otherwise the restrict-qualified loop is left to
+ * the compiler's vectoriser. The clamp compiles to conditional moves either way.
+ */
+inline void scaleAndClamp(const float *__restrict raw, const float *__restrict scale, const float *__restrict offset,
+                          const float *__restrict min_value, const float *__restrict max_value, float *__restrict out,
+                          size_t count)
+{
+#ifdef UDS_SCALE_USE_ESP_DSP
+    dsps_mul_f32(raw, scale, out, (int)count, 1, 1, 1);
+    dsps_add_f32(out, offset, out, (int)count, 1, 1, 1);
+
+    for (size_t i = 0; i < count; i++)
+    {
+        float value = out[i];
+        value = value < min_value[i] ? min_value[i] : value;
+        out[i] = value > max_value[i] ? max_value[i] : value;
+    }
+#else
+    for (size_t i = 0; i < count; i++)
+    {
+        float value = raw[i] * scale[i] + offset[i];
+        value = value < min_value[i] ? min_value[i] : value;
+        out[i] = value > max_value[i] ? max_value[i] : value;
+    }
+#endif
+}
+
+#endif // _SCALE_STAGE_H
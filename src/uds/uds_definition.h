@@ -0,0 +1,46 @@
+#ifndef _UDS_DEFINITION_H
+#define _UDS_DEFINITION_H
+
+#include <cstdint>
+#include "bit_extract.h"
+
+/**
+ * @brief One signal inside a KWP/UDS local identifier response.
+ *
+ * Instances only exist in the flash-resident tables of uds_tables.h. Text is
+ * referenced by a 16-bit offset into UDS_STRING_POOL so identical names and
+ * display values are stored once.
+ */
+struct UdsDefinition
+{
+    uint16_t request_id;          // ECU tx id
+    uint16_t did;                 // Local identifier
+    uint8_t  unit;                // unitTypeInfos id
+    uint8_t  byte_position;       // Offset after SID and DID
+    uint8_t  bit_offset_position;
+    uint8_t  bit_length;          // Inferred by the generator when the CSV only has its placeholder
+    ByteOrder byte_order;
+    bool     is_signed;
+    bool     is_calculated;       // Value is raw * scaling_factor + offset_value; false for enum signals
+    float    scaling_factor;      // Single precision, the only kind the ESP32-S3 FPU computes
+    float    offset_value;
+    uint16_t name_id;             // Offset into UDS_STRING_POOL
+    uint16_t enum_first;          // Display table in UDS_ENUM_DISPLAY, indexed by raw value
+    uint16_t enum_size;           // Raw values covered by the table, 0 for numeric signals
+};
+
+// UDS_ENUM_DISPLAY entry of a raw value that has no display text
+constexpr uint16_t UDS_STRING_NONE = 0xFFFF;
+
+/**
+ * @brief The contiguous block of UDS_DEFINITIONS belonging to one (ECU, DID).
+ */
+struct UdsDidEntry
+{
+    uint16_t request_id;
+    uint16_t did;
+    uint16_t first;
+    uint16_t count;
+};
+
+#endif // _UDS_DEFINITION_H
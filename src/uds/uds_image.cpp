@@ -0,0 +1,214 @@
+#include "uds_image.h"
+#include <cstddef>
+#include <cstring>
+
+#ifdef ESP_PLATFORM
+#include "../logger/logger.h"
+#include "esp_partition.h"
+#else
+#include <cstdio>
+#include <cstdlib>
+
+// The logger needs Arduino.h, so a host build reports rejected images on stderr
+#define LOG_ERROR(format, ...) fprintf(stderr, "%s: " format "\n", __FUNCTION__, ##__VA_ARGS__)
+#endif
+
+// Images store the structs byte for byte, so their layout is part of the format
+static_assert(sizeof(UdsImageHeader) == 48, "UdsImageHeader layout is part of the image format");
+static_assert(sizeof(UdsDefinition) == 28 && offsetof(UdsDefinition, byte_order) == 8 &&
+                  offsetof(UdsDefinition, is_calculated) == 10 && offsetof(UdsDefinition, scaling_factor) == 12 && offsetof(UdsDefinition, name_id) == 20,
+              "UdsDefinition layout is part of the image format");
+static_assert(sizeof(UdsDidEntry) == 8, "UdsDidEntry layout is part of the image format");
+static_assert(sizeof(ByteOrder) == 1 && (uint8_t)ByteOrder::Motorola == 1, "ByteOrder is stored as one byte");
+
+static uint32_t crc32(const uint8_t *data, size_t length)
+{
+    // Nibble table: 64 bytes of flash and fast enough for a one-off check at boot
+    static constexpr uint32_t TABLE[16] = {
+        0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC, 0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C,
+        0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C, 0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C,
+    };
+
+    uint32_t crc = 0xFFFFFFFF;
+    for (size_t i = 0; i < length; i++)
+    {
+        crc = TABLE[(crc ^ data[i]) & 0x0F] ^ (crc >> 4);
+        crc = TABLE[(crc ^ (data[i] >> 4)) & 0x0F] ^ (crc >> 4);
+    }
+    return ~crc;
+}
+
+static bool sectionFits(uint32_t offset, uint32_t count, size_t element_size, uint32_t image_size)
+{
+    return offset % 4 == 0 && offset <= image_size && count <= (image_size - offset) / element_size;
+}
+
+static bool validDefinition(const UdsDefinition &def, const UdsImageHeader &header)
+{
+    // A bool holding anything but 0 or 1 is undefined behaviour, so check the stored bytes
+    uint8_t is_signed;
+    uint8_t is_calculated;
+    memcpy(&is_signed, &def.is_signed, sizeof(is_signed));
+    memcpy(&is_calculated, &def.is_calculated, sizeof(is_calculated));
+
+    return is_signed <= 1 && is_calculated <= 1 && def.bit_length > 0 && def.bit_offset_position <= 7 &&
+           def.bit_offset_position + def.bit_length <= 32 && (uint8_t)def.byte_order <= (uint8_t)ByteOrder::Motorola && def.name_id < header.string_pool_size &&
+           (uint32_t)def.enum_first + def.enum_size <= header.enum_display_count;
+}
+
+bool parseUdsImage(const uint8_t *data, size_t size, UdsTables &tables)
+{
+    UdsImageHeader header;
+    if (size < sizeof(header))
+    {
+        LOG_ERROR("UDS image too small: %u bytes", (unsigned)size);
+        return false;
+    }
+    memcpy(&header, data, sizeof(header));
+
+    if (header.magic != UDS_IMAGE_MAGIC || header.version != UDS_IMAGE_VERSION || header.header_size < sizeof(header) ||
+        header.image_size > size || header.image_size < header.header_size)
+    {
+        LOG_ERROR("UDS image header invalid (magic 0x%08lX, version %u)", (unsigned long)header.magic, header.version);
+        return false;
+    }
+
+    const size_t crc_start = offsetof(UdsImageHeader, image_size);
+    if (crc32(data + crc_start, header.image_size - crc_start) != header.crc32)
+    {
+        LOG_ERROR("UDS image CRC mismatch");
+        return false;
+    }
+
+    if (!sectionFits(header.definitions_offset, header.definition_count, sizeof(UdsDefinition), header.image_size) ||
+        !sectionFits(header.dids_offset, header.did_count, sizeof(UdsDidEntry), header.image_size) ||
+        !sectionFits(header.enum_display_offset, header.enum_display_count, sizeof(uint16_t), header.image_size) ||
+        !sectionFits(header.strings_offset, header.string_pool_size, 1, header.image_size) ||
+        header.definition_count > UDS_MAX_DEFINITIONS || header.did_count > UDS_MAX_DIDS ||
+        header.string_pool_size == 0 || header.string_pool_size >= UDS_STRING_NONE)
+    {
+        LOG_ERROR("UDS image sections out of bounds or over capacity");
+        return false;
+    }
+
+    const UdsDefinition *definitions = reinterpret_cast<const UdsDefinition *>(data + header.definitions_offset);
+    const UdsDidEntry *dids = reinterpret_cast<const UdsDidEntry *>(data + header.dids_offset);
+    const uint16_t *enum_display = reinterpret_cast<const uint16_t *>(data + header.enum_display_offset);
+    const char *strings = reinterpret_cast<const char *>(data + header.strings_offset);
+
+    if (strings[header.string_pool_size - 1] != '\0')
+    {
+        LOG_ERROR("UDS image string pool is not terminated");
+        return false;
+    }
+
+    for (uint32_t i = 0; i < header.definition_count; i++)
+    {
+        if (!validDefinition(definitions[i], header))
+        {
+            LOG_ERROR("UDS image definition %lu invalid", (unsigned long)i);
+            return false;
+        }
+    }
+
+    for (uint32_t i = 0; i < header.enum_display_count; i++)
+    {
+        if (enum_display[i] != UDS_STRING_NONE && enum_display[i] >= header.string_pool_size)
+        {
+            LOG_ERROR("UDS image enum entry %lu invalid", (unsigned long)i);
+            return false;
+        }
+    }
+
+    // The DID blocks must tile the definitions in (ECU, DID) order for binary search and signal grouping
+    uint32_t next_first = 0;
+    for (uint32_t i = 0; i < header.did_count; i++)
+    {
+        bool ordered = i == 0 || ((uint32_t)dids[i - 1].request_id << 16 | dids[i - 1].did) <
+                                     ((uint32_t)dids[i].request_id << 16 | dids[i].did);
+        if (!ordered || dids[i].first != next_first || dids[i].count == 0)
+        {
+            LOG_ERROR("UDS image DID index invalid at %lu", (unsigned long)i);
+            return false;
+        }
+        for (uint32_t j = next_first; j < next_first + dids[i].count && j < header.definition_count; j++)
+        {
+            if (definitions[j].request_id != dids[i].request_id || definitions[j].did != dids[i].did)
+            {
+                LOG_ERROR("UDS image definition %lu outside its DID block", (unsigned long)j);
+                return false;
+            }
+        }
+        next_first += dids[i].count;
+    }
+    if (next_first != header.definition_count)
+    {
+        LOG_ERROR("UDS image DID index does not cover all definitions");
+        return false;
+    }
+
+    tables = UdsTables{
+        definitions, header.definition_count,
+        dids, header.did_count,
+        enum_display, header.enum_display_count,
+        strings, header.string_pool_size,
+    };
+    return true;
+}
+
+#ifdef ESP_PLATFORM
+
+bool loadUdsImage(const char *source, UdsTables &tables)
+{
+    const esp_partition_t *partition =
+        esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, source);
+    if (partition == nullptr)
+    {
+        LOG_INFO("No %s partition, using built-in UDS tables", source);
+        return false;
+    }
+
+    // The mapping is never released: the tables are read from it for as long as the firmware runs
+    const void *mapped = nullptr;
+    esp_partition_mmap_handle_t handle;
+    if (esp_partition_mmap(partition, 0, partition->size, ESP_PARTITION_MMAP_DATA, &mapped, &handle) != ESP_OK)
+    {
+        LOG_ERROR("Failed to map %s partition", source);
+        return false;
+    }
+
+    if (!parseUdsImage(static_cast<const uint8_t *>(mapped), partition->size, tables))
+    {
+        esp_partition_munmap(handle);
+        return false;
+    }
+    return true;
+}
+
+#else
+
+bool loadUdsImage(const char *source, UdsTables &tables)
+{
+    FILE *file = fopen(source, "rb");
+    if (file == nullptr)
+    {
+        return false;
+    }
+
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+
+    // malloc alignment satisfies every section; the buffer backs the tables until exit
+    uint8_t *data = size > 0 ? static_cast<uint8_t *>(malloc(size)) : nullptr;
+    bool loaded = data != nullptr && fread(data, 1, size, file) == (size_t)size && parseUdsImage(data, size, tables);
+    fclose(file);
+
+    if (!loaded)
+    {
+        free(data);
+    }
+    return loaded;
+}
+
+#endif
@@ -0,0 +1,61 @@
+#ifndef _UDS_IMAGE_H
+#define _UDS_IMAGE_H
+
+#include <cstddef>
+#include <cstdint>
+#include "uds_mapper.h"
+
+// Binary decoder image written by tools/generate_uds_tables.py --image
+inline constexpr uint32_t UDS_IMAGE_MAGIC = 0x49534455; // "UDSI" little-endian
+inline constexpr uint16_t UDS_IMAGE_VERSION = 2;
+inline constexpr const char *UDS_IMAGE_PARTITION = "udsdefs";
+
+/**
+ * @brief Fixed header at offset 0 of an image; all fields little-endian.
+ *
+ * The sections hold UdsDefinition, UdsDidEntry, uint16_t and char arrays in
+ * exactly their in-memory layout, each 4-byte aligned, so a mapped image is
+ * used in place. crc32 is the IEEE CRC-32 (as zlib.crc32) of bytes
+ * [offsetof(image_size), image_size).
+ */
+struct UdsImageHeader
+{
+    uint32_t magic;
+    uint16_t version;
+    uint16_t header_size;
+    uint32_t crc32;
+    uint32_t image_size;
+    uint32_t definitions_offset;
+    uint32_t definition_count;
+    uint32_t dids_offset;
+    uint32_t did_count;
+    uint32_t enum_display_offset;
+    uint32_t enum_display_count;
+    uint32_t strings_offset;
+    uint32_t string_pool_size;
+};
+
+/**
+ * @brief Validates an image and points tables into it without copying.
+ *
+ * Checks the header, version, CRC, section bounds and alignment, then every
+ * definition's layout and string/enum references and the DID index order, so
+ * a corrupt or stale image is rejected instead of decoded.
+ *
+ * @return false if the image is not usable; tables is left unchanged
+ */
+bool parseUdsImage(const uint8_t *data, size_t size, UdsTables &tables);
+
+/**
+ * @brief Loads the decoder image.
+ *
+ * On the ESP32 the UDS_IMAGE_PARTITION data partition is memory-mapped and
+ * stays mapped, so the tables are read from flash in place. On a host build
+ * source names a file, which is read into a buffer that lives for the rest of
+ * the program.
+ *
+ * @return false if no valid image was found; tables is left unchanged
+ */
+bool loadUdsImage(const char *source, UdsTables &tables);
+
+#endif // _UDS_IMAGE_H
@@ -1,204 +0,0 @@
-#include "uds_mapper.h"
-#include <unordered_map>
-#include <SPI.h>
-#include <Arduino.h>
-
-
-void init_udsDefinitions_ecu_07B0() {
-    udsMap.emplace(uds_key{ 0x7B0, 0x03 }, UdsDefinition{.request_id = 0x7B0,.did = 0x03,.unit = 42,.byte_position = 0,.bit_offset_position = 0,.scaling_factor = 1.28,.offset_value = 0.0,.is_calculated = true,.name = "FR Wheel Speed"});
-    udsMap.emplace(uds_key{ 0x7B0, 0x03 }, UdsDefinition{.request_id = 0x7B0,.did = 0x03,.unit = 42,.byte_position = 1,.bit_offset_position = 0,.scaling_factor = 1.28,.offset_value = 0.0,.is_calculated = true,.name = "FL Wheel Speed"});
-    udsMap.emplace(uds_key{ 0x7B0, 0x03 }, UdsDefinition{.request_id = 0x7B0,.did = 0x03,.unit = 42,.byte_position = 2,.bit_offset_position = 0,.scaling_factor = 1.28,.offset_value = 0.0,.is_calculated = true,.name = "RR Wheel Speed"});
-    udsMap.emplace(uds_key{ 0x7B0, 0x03 }, UdsDefinition{.request_id = 0x7B0,.did = 0x03,.unit = 42,.byte_position = 3,.bit_offset_position = 0,.scaling_factor = 1.28,.offset_value = 0.0,.is_calculated = true,.name = "RL Wheel Speed"});
-    udsMap.emplace(uds_key{ 0x7B0, 0x03 }, UdsDefinition{.request_id = 0x7B0,.did = 0x03,.unit = 0,.byte_position = 4,.bit_offset_position = 7,.name = "FR Wheel Direction",.value = 0,.display_value = "Forward"});
-    udsMap.emplace(uds_key{ 0x7B0, 0x03 }, UdsDefinition{.request_id = 0x7B0,.did = 0x03,.unit = 0,.byte_position = 4,.bit_offset_position = 7,.name = "FR Wheel Direction",.value = 1,.display_value = "Back"});
-    udsMap.emplace(uds_key{ 0x7B0, 0x03 }, UdsDefinition{.request_id = 0x7B0,.did = 0x03,.unit = 0,.byte_position = 4,.bit_offset_position = 6,.name = "FL Wheel Direction",.value = 0,.display_value = "Forward"});
-    udsMap.emplace(uds_key{ 0x7B0, 0x03 }, UdsDefinition{.request_id = 0x7B0,.did = 0x03,.unit = 0,.byte_position = 4,.bit_offset_position = 6,.name = "FL Wheel Direction",.value = 1,.display_value = "Back"});
-    udsMap.emplace(uds_key{ 0x7B0, 0x03 }, UdsDefinition{.request_id = 0x7B0,.did = 0x03,.unit = 0,.byte_position = 4,.bit_offset_position = 5,.name = "RR Wheel Direction",.value = 0,.display_value = "Forward"});
-    udsMap.emplace(uds_key{ 0x7B0, 0x03 }, UdsDefinition{.request_id = 0x7B0,.did = 0x03,.unit = 0,.byte_position = 4,.bit_offset_position = 5,.name = "RR Wheel Direction",.value = 1,.display_value = "Back"});
-    udsMap.emplace(uds_key{ 0x7B0, 0x03 }, UdsDefinition{.request_id = 0x7B0,.did = 0x03,.unit = 0,.byte_position = 4,.bit_offset_position = 4,.name = "RL Wheel Direction",.value = 0,.display_value = "Forward"});
-    udsMap.emplace(uds_key{ 0x7B0, 0x03 }, UdsDefinition{.request_id = 0x7B0,.did = 0x03,.unit = 0,.byte_position = 4,.bit_offset_position = 4,.name = "RL Wheel Direction",.value = 1,.display_value = "Back"});
-    udsMap.emplace(uds_key{ 0x7B0, 0x04 }, UdsDefinition{.request_id = 0x7B0,.did = 0x04,.unit = 48,.byte_position = 0,.bit_offset_position = 0,.scaling_factor = 0.0196078431372549,.offset_value = 0.0,.is_calculated = true,.name = "Master Cylinder Sensor"});
-    udsMap.emplace(uds_key{ 0x7B0, 0x04 }, UdsDefinition{.request_id = 0x7B0,.did = 0x04,.unit = 48,.byte_position = 1,.bit_offset_position = 0,.scaling_factor = 0.0196078431372549,.offset_value = 0.0,.is_calculated = true,.name = "Master Cylinder Sensor2"});
-    udsMap.emplace(uds_key{ 0x7B0, 0x04 }, UdsDefinition{.request_id = 0x7B0,.did = 0x04,.unit = 48,.byte_position = 2,.bit_offset_position = 0,.scaling_factor = 0.0196078431372549,.offset_value = 0.0,.is_calculated = true,.name = "Stroke Sensor"});
-    udsMap.emplace(uds_key{ 0x7B0, 0x04 }, UdsDefinition{.request_id = 0x7B0,.did = 0x04,.unit = 48,.byte_position = 3,.bit_offset_position = 0,.scaling_factor = 0.0196078431372549,.offset_value = 0.0,.is_calculated = true,.name = "Stroke Sensor2"});
-    udsMap.emplace(uds_key{ 0x7B0, 0x04 }, UdsDefinition{.request_id = 0x7B0,.did = 0x04,.unit = 48,.byte_position = 4,.bit_offset_position = 0,.scaling_factor = 0.0196078431372549,.offset_value = 0.0,.is_calculated = true,.name = "Accumulator Sensor"});
-    udsMap.emplace(uds_key{ 0x7B0, 0x04 }, UdsDefinition{.request_id = 0x7B0,.did = 0x04,.unit = 48,.byte_position = 5,.bit_offset_position = 0,.scaling_factor = 0.0196078431372549,.offset_value = 0.0,.is_calculated = true,.name = "Regulator Pressure Sensor Output"});
-    udsMap.emplace(uds_key{ 0x7B0, 0x04 }, UdsDefinition{.request_id = 0x7B0,.did = 0x04,.unit = 36,.byte_position = 6,.bit_offset_position = 0,.scaling_factor = 0.096,.offset_value = 0.0,.is_calculated = true,.name = "Reaction Force Pressure"});
-    udsMap.emplace(uds_key{ 0x7B0, 0x04 }, UdsDefinition{.request_id = 0x7B0,.did = 0x04,.unit = 36,.byte_position = 7,.bit_offset_position = 0,.scaling_factor = 0.096,.offset_value = 0.0,.is_calculated = true,.name = "Servo Pressure"});
-    udsMap.emplace(uds_key{ 0x7B0, 0x04 }, UdsDefinition{.request_id = 0x7B0,.did = 0x04,.unit = 36,.byte_position = 8,.bit_offset_position = 0,.scaling_factor = 0.096,.offset_value = 0.0,.is_calculated = true,.name = "Accumulator Pressure"});
-    udsMap.emplace(uds_key{ 0x7B0, 0x04 }, UdsDefinition{.request_id = 0x7B0,.did = 0x04,.unit = 36,.byte_position = 9,.bit_offset_position = 0,.scaling_factor = 0.096,.offset_value = 0.0,.is_calculated = true,.name = "Master Cylinder Pressure"});
-    udsMap.emplace(uds_key{ 0x7B0, 0x04 }, UdsDefinition{.request_id = 0x7B0,.did = 0x04,.unit = 57,.byte_position = 10,.bit_offset_position = 0,.scaling_factor = 1.0,.offset_value = -80.0,.is_calculated = true,.name = "Master Cylinder Sensor Temperature"});
-    udsMap.emplace(uds_key{ 0x7B0, 0x04 }, UdsDefinition{.request_id = 0x7B0,.did = 0x04,.unit = 34,.byte_position = 12,.bit_offset_position = 0,.scaling_factor = 0.5,.offset_value = 0.0,.is_calculated = true,.name = "Brake Booster Pressure"});
-    udsMap.emplace(uds_key{ 0x7B0, 0x04 }, UdsDefinition{.request_id = 0x7B0,.did = 0x04,.unit = 34,.byte_position = 13,.bit_offset_position = 0,.scaling_factor = 0.5,.offset_value = 0.0,.is_calculated = true,.name = "Atmospheric Pressure"});
-    udsMap.emplace(uds_key{ 0x7B0, 0x04 }, UdsDefinition{.request_id = 0x7B0,.did = 0x04,.unit = 57,.byte_position = 14,.bit_offset_position = 0,.scaling_factor = 1.0,.offset_value = -80.0,.is_calculated = true,.name = "Reaction Force Pressure Sensor Temperature"});
-    udsMap.emplace(uds_key{ 0x7B0, 0x04 }, UdsDefinition{.request_id = 0x7B0,.did = 0x04,.unit = 57,.byte_position = 16,.bit_offset_position = 0,.scaling_factor = 1.0,.offset_value = -80.0,.is_calculated = true,.name = "Servo Pressure Sensor Temperature"});
-    udsMap.emplace(uds_key{ 0x7B0, 0x04 }, UdsDefinition{.request_id = 0x7B0,.did = 0x04,.unit = 34,.byte_position = 20,.bit_offset_position = 0,.scaling_factor = 0.5,.offset_value = 0.0,.is_calculated = true,.name = "Brake Booster Pressure \"B\""});
-    udsMap.emplace(uds_key{ 0x7B0, 0x05 }, UdsDefinition{.request_id = 0x7B0,.did = 0x05,.unit = 1,.byte_position = 0,.bit_offset_position = 0,.scaling_factor = 0.14318,.offset_value = -18.327,.is_calculated = true,.name = "Deceleration Sensor"});
-    udsMap.emplace(uds_key{ 0x7B0, 0x05 }, UdsDefinition{.request_id = 0x7B0,.did = 0x05,.unit = 1,.byte_position = 1,.bit_offset_position = 0,.scaling_factor = 0.14318,.offset_value = -18.327,.is_calculated = true,.name = "Deceleration Sensor2"});
-    udsMap.emplace(uds_key{ 0x7B0, 0x05 }, UdsDefinition{.request_id = 0x7B0,.did = 0x05,.unit = 5,.byte_position = 6,.bit_offset_position = 0,.scaling_factor = 0.490196078431373,.offset_value = 0.0,.is_calculated = true,.name = "Throttle Opening Angle"});
-    udsMap.emplace(uds_key{ 0x7B0, 0x05 }, UdsDefinition{.request_id = 0x7B0,.did = 0x05,.unit = 33,.byte_position = 7,.bit_offset_position = 0,.scaling_factor = 0.490196078431373,.offset_value = 0.0,.is_calculated = true,.name = "Throttle Opening Angle %"});
-    udsMap.emplace(uds_key{ 0x7B0, 0x05 }, UdsDefinition{.request_id = 0x7B0,.did = 0x05,.unit = 5,.byte_position = 8,.bit_offset_position = 0,.scaling_factor = 0.490196078431373,.offset_value = 0.0,.is_calculated = true,.name = "Accelerator Opening Angle"});
-    udsMap.emplace(uds_key{ 0x7B0, 0x05 }, UdsDefinition{.request_id = 0x7B0,.did = 0x05,.unit = 33,.byte_position = 9,.bit_offset_position = 0,.scaling_factor = 0.5,.offset_value = 0.0,.is_calculated = true,.name = "Accelerator Opening Angle %"});
-    udsMap.emplace(uds_key{ 0x7B0, 0x05 }, UdsDefinition{.request_id = 0x7B0,.did = 0x05,.unit = 58,.byte_position = 10,.bit_offset_position = 0,.scaling_factor = 0.03125,.offset_value = 0.0,.is_calculated = true,.name = "Real Engine Torque"});
-    udsMap.emplace(uds_key{ 0x7B0, 0x06 }, UdsDefinition{.request_id = 0x7B0,.did = 0x06,.unit = 7,.byte_position = 0,.bit_offset_position = 0,.scaling_factor = 1.0,.offset_value = -128.0,.is_calculated = true,.name = "Yaw Rate Sensor"});
-    udsMap.emplace(uds_key{ 0x7B0, 0x06 }, UdsDefinition{.request_id = 0x7B0,.did = 0x06,.unit = 7,.byte_position = 1,.bit_offset_position = 0,.scaling_factor = 1.0,.offset_value = -128.0,.is_calculated = true,.name = "Yaw Rate Sensor2"});
-    udsMap.emplace(uds_key{ 0x7B0, 0x06 }, UdsDefinition{.request_id = 0x7B0,.did = 0x06,.unit = 5,.byte_position = 2,.bit_offset_position = 0,.scaling_factor = 0.1,.offset_value = -3276.8,.is_calculated = true,.name = "Steering Angle Sensor"});
-    udsMap.emplace(uds_key{ 0x7B0, 0x21 }, UdsDefinition{.request_id = 0x7B0,.did = 0x21,.unit = 42,.byte_position = 0,.bit_offset_position = 0,.scaling_factor = 1.28,.offset_value = 0.0,.is_calculated = true,.name = "Vehicle Speed"});
-    udsMap.emplace(uds_key{ 0x7B0, 0x3C }, UdsDefinition{.request_id = 0x7B0,.did = 0x3C,.unit = 0,.byte_position = 0,.bit_offset_position = 7,.name = "Stop Light Relay Output",.value = 0,.display_value = "OFF"});
-    udsMap.emplace(uds_key{ 0x7B0, 0x3C }, UdsDefinition{.request_id = 0x7B0,.did = 0x3C,.unit = 0,.byte_position = 0,.bit_offset_position = 7,.name = "Stop Light Relay Output",.value = 1,.display_value = "ON"});
-    udsMap.emplace(uds_key{ 0x7B0, 0x3C }, UdsDefinition{.request_id = 0x7B0,.did = 0x3C,.unit = 0,.byte_position = 0,.bit_offset_position = 6,.name = "EBS Relay",.value = 0,.display_value = "OFF"});
-    udsMap.emplace(uds_key{ 0x7B0, 0x3C }, UdsDefinition{.request_id = 0x7B0,.did = 0x3C,.unit = 0,.byte_position = 0,.bit_offset_position = 6,.name = "EBS Relay",.value = 1,.display_value = "ON"});
-    udsMap.emplace(uds_key{ 0x7B0, 0x41 }, UdsDefinition{.request_id = 0x7B0,.did = 0x41,.unit = 36,.byte_position = 0,.bit_offset_position = 0,.scaling_factor = 0.098,.offset_value = 0.0,.is_calculated = true,.name = "Zero Point of M/C"});
-    udsMap.emplace(uds_key{ 0x7B0, 0x41 }, UdsDefinition{.request_id = 0x7B0,.did = 0x41,.unit = 36,.byte_position = 3,.bit_offset_position = 0,.scaling_factor = 0.098,.offset_value = 0.0,.is_calculated = true,.name = "Zero Point of M/C2"});
-    udsMap.emplace(uds_key{ 0x7B0, 0x41 }, UdsDefinition{.request_id = 0x7B0,.did = 0x41,.unit = 48,.byte_position = 5,.bit_offset_position = 0,.scaling_factor = 0.0196078431372549,.offset_value = 0.0,.is_calculated = true,.name = "Voltage of M/C"});
-    udsMap.emplace(uds_key{ 0x7B0, 0x41 }, UdsDefinition{.request_id = 0x7B0,.did = 0x41,.unit = 48,.byte_position = 6,.bit_offset_position = 0,.scaling_factor = 0.0196078431372549,.offset_value = 0.0,.is_calculated = true,.name = "Voltage of M/C2"});
-    udsMap.emplace(uds_key{ 0x7B0, 0x41 }, UdsDefinition{.request_id = 0x7B0,.did = 0x41,.unit = 48,.byte_position = 7,.bit_offset_position = 0,.scaling_factor = 0.0196078431372549,.offset_value = 0.0,.is_calculated = true,.name = "Voltage of Stroke Sensor"});
-    udsMap.emplace(uds_key{ 0x7B0, 0x41 }, UdsDefinition{.request_id = 0x7B0,.did = 0x41,.unit = 48,.byte_position = 8,.bit_offset_position = 0,.scaling_factor = 0.0196078431372549,.offset_value = 0.0,.is_calculated = true,.name = "Voltage of Stroke Sensor2"});
-    udsMap.emplace(uds_key{ 0x7B0, 0x41 }, UdsDefinition{.request_id = 0x7B0,.did = 0x41,.unit = 36,.byte_position = 9,.bit_offset_position = 0,.scaling_factor = 0.098,.offset_value = -1.0,.is_calculated = true,.name = "Regulator Pressure Sensor Output After Filter"});
-    udsMap.emplace(uds_key{ 0x7B0, 0x41 }, UdsDefinition{.request_id = 0x7B0,.did = 0x41,.unit = 37,.byte_position = 10,.bit_offset_position = 0,.scaling_factor = 1.0,.offset_value = -30.0,.is_calculated = true,.name = "Regulator Pressure Sensor Variation"});
-    udsMap.emplace(uds_key{ 0x7B0, 0x41 }, UdsDefinition{.request_id = 0x7B0,.did = 0x41,.unit = 48,.byte_position = 11,.bit_offset_position = 0,.scaling_factor = 0.0196078431372549,.offset_value = 0.0,.is_calculated = true,.name = "Regulator Pressure Sensor Correction Voltage"});
-    udsMap.emplace(uds_key{ 0x7B0, 0x85 }, UdsDefinition{.request_id = 0x7B0,.did = 0x85,.unit = 42,.byte_position = 0,.bit_offset_position = 0,.scaling_factor = 0.1,.offset_value = 0.0,.is_calculated = true,.name = "FR Gap Wheel Speed"});
-    udsMap.emplace(uds_key{ 0x7B0, 0x85 }, UdsDefinition{.request_id = 0x7B0,.did = 0x85,.unit = 42,.byte_position = 1,.bit_offset_position = 0,.scaling_factor = 0.1,.offset_value = 0.0,.is_calculated = true,.name = "FL Gap Wheel Speed"});
-    udsMap.emplace(uds_key{ 0x7B0, 0x85 }, UdsDefinition{.request_id = 0x7B0,.did = 0x85,.unit = 42,.byte_position = 2,.bit_offset_position = 0,.scaling_factor = 0.1,.offset_value = 0.0,.is_calculated = true,.name = "RR Gap Wheel Speed"});
-    udsMap.emplace(uds_key{ 0x7B0, 0xE1 }, UdsDefinition{.request_id = 0x7B0,.did = 0xE1,.unit = 0,.byte_position = 0,.bit_offset_position = 0,.scaling_factor = 1.0,.offset_value = 0.0,.is_calculated = true,.name = "Number of DTC"});
-}
-void init_udsDefinitions_ecu_07E0() {
-    udsMap.emplace(uds_key{ 0x7E0, 0x01 }, UdsDefinition{.request_id = 0x7E0,.did = 0x01,.unit = 33,.byte_position = 0,.bit_offset_position = 0,.scaling_factor = 0.392156862745098,.offset_value = 0.0,.is_calculated = true,.name = "Calculate Load"});
-    udsMap.emplace(uds_key{ 0x7E0, 0x01 }, UdsDefinition{.request_id = 0x7E0,.did = 0x01,.unit = 33,.byte_position = 1,.bit_offset_position = 0,.scaling_factor = 0.392156862745098,.offset_value = 0.0,.is_calculated = true,.name = "Vehicle Load"});
-    udsMap.emplace(uds_key{ 0x7E0, 0x01 }, UdsDefinition{.request_id = 0x7E0,.did = 0x01,.unit = 57,.byte_position = 9,.bit_offset_position = 0,.scaling_factor = 1.0,.offset_value = -40.0,.is_calculated = true,.name = "Coolant Temp"});
-    udsMap.emplace(uds_key{ 0x7E0, 0x01 }, UdsDefinition{.request_id = 0x7E0,.did = 0x01,.unit = 39,.byte_position = 10,.bit_offset_position = 0,.scaling_factor = 0.25,.offset_value = 0.0,.is_calculated = true,.name = "Engine Speed"});
-    udsMap.emplace(uds_key{ 0x7E0, 0x01 }, UdsDefinition{.request_id = 0x7E0,.did = 0x01,.unit = 42,.byte_position = 12,.bit_offset_position = 0,.scaling_factor = 1.0,.offset_value = 0.0,.is_calculated = true,.name = "Vehicle Speed"});
-    udsMap.emplace(uds_key{ 0x7E0, 0x01 }, UdsDefinition{.request_id = 0x7E0,.did = 0x01,.unit = 33,.byte_position = 15,.bit_offset_position = 0,.scaling_factor = 0.392156862745098,.offset_value = 0.0,.is_calculated = true,.name = "Throttle Sensor Position"});
-    udsMap.emplace(uds_key{ 0x7E0, 0x01 }, UdsDefinition{.request_id = 0x7E0,.did = 0x01,.unit = 33,.byte_position = 16,.bit_offset_position = 0,.scaling_factor = 0.392156862745098,.offset_value = 0.0,.is_calculated = true,.name = "Throttle Sensor Volt %"});
-    udsMap.emplace(uds_key{ 0x7E0, 0x01 }, UdsDefinition{.request_id = 0x7E0,.did = 0x01,.unit = 48,.byte_position = 26,.bit_offset_position = 0,.scaling_factor = 0.001,.offset_value = 0.0,.is_calculated = true,.name = "Battery Voltage"});
-    udsMap.emplace(uds_key{ 0x7E0, 0x04 }, UdsDefinition{.request_id = 0x7E0,.did = 0x04,.unit = 0,.byte_position = 0,.bit_offset_position = 0,.scaling_factor = 3.05e-05,.offset_value = 0.0,.is_calculated = true,.name = "Target Air-Fuel Ratio"});
-    udsMap.emplace(uds_key{ 0x7E0, 0x06 }, UdsDefinition{.request_id = 0x7E0,.did = 0x06,.unit = 0,.byte_position = 0,.bit_offset_position = 7,.bit_length = 1,.name = "MIL",.value = 0,.display_value = "OFF"});
-    udsMap.emplace(uds_key{ 0x7E0, 0x06 }, UdsDefinition{.request_id = 0x7E0,.did = 0x06,.unit = 0,.byte_position = 0,.bit_offset_position = 7,.bit_length = 1,.name = "MIL",.value = 1,.display_value = "ON"});
-    udsMap.emplace(uds_key{ 0x7E0, 0x25 }, UdsDefinition{.request_id = 0x7E0,.did = 0x25,.unit = 0,.byte_position = 0,.bit_offset_position = 7,.name = "Idle Up SW",.value = 0,.display_value = "OFF"});
-    udsMap.emplace(uds_key{ 0x7E0, 0x25 }, UdsDefinition{.request_id = 0x7E0,.did = 0x25,.unit = 0,.byte_position = 0,.bit_offset_position = 7,.name = "Idle Up SW",.value = 1,.display_value = "ON"});
-    udsMap.emplace(uds_key{ 0x7E0, 0x25 }, UdsDefinition{.request_id = 0x7E0,.did = 0x25,.unit = 0,.byte_position = 0,.bit_offset_position = 6,.name = "Engine Oil Pressure SW",.value = 0,.display_value = "OFF"});
-    udsMap.emplace(uds_key{ 0x7E0, 0x25 }, UdsDefinition{.request_id = 0x7E0,.did = 0x25,.unit = 0,.byte_position = 0,.bit_offset_position = 6,.name = "Engine Oil Pressure SW",.value = 1,.display_value = "ON"});
-    udsMap.emplace(uds_key{ 0x7E0, 0x25 }, UdsDefinition{.request_id = 0x7E0,.did = 0x25,.unit = 0,.byte_position = 0,.bit_offset_position = 2,.name = "Stop Light Switch",.value = 0,.display_value = "OFF"});
-    udsMap.emplace(uds_key{ 0x7E0, 0x25 }, UdsDefinition{.request_id = 0x7E0,.did = 0x25,.unit = 0,.byte_position = 0,.bit_offset_position = 2,.name = "Stop Light Switch",.value = 1,.display_value = "ON"});
-    udsMap.emplace(uds_key{ 0x7E0, 0x25 }, UdsDefinition{.request_id = 0x7E0,.did = 0x25,.unit = 0,.byte_position = 4,.bit_offset_position = 7,.name = "Shift SW Status (P Range)",.value = 0,.display_value = "OFF"});
-    udsMap.emplace(uds_key{ 0x7E0, 0x25 }, UdsDefinition{.request_id = 0x7E0,.did = 0x25,.unit = 0,.byte_position = 4,.bit_offset_position = 7,.name = "Shift SW Status (P Range)",.value = 1,.display_value = "ON"});
-    udsMap.emplace(uds_key{ 0x7E0, 0x25 }, UdsDefinition{.request_id = 0x7E0,.did = 0x25,.unit = 0,.byte_position = 4,.bit_offset_position = 6,.name = "Shift SW Status (R Range)",.value = 0,.display_value = "OFF"});
-    udsMap.emplace(uds_key{ 0x7E0, 0x25 }, UdsDefinition{.request_id = 0x7E0,.did = 0x25,.unit = 0,.byte_position = 4,.bit_offset_position = 6,.name = "Shift SW Status (R Range)",.value = 1,.display_value = "ON"});
-    udsMap.emplace(uds_key{ 0x7E0, 0x25 }, UdsDefinition{.request_id = 0x7E0,.did = 0x25,.unit = 0,.byte_position = 4,.bit_offset_position = 5,.name = "Shift SW Status (N Range)",.value = 0,.display_value = "OFF"});
-    udsMap.emplace(uds_key{ 0x7E0, 0x25 }, UdsDefinition{.request_id = 0x7E0,.did = 0x25,.unit = 0,.byte_position = 4,.bit_offset_position = 5,.name = "Shift SW Status (N Range)",.value = 1,.display_value = "ON"});
-    udsMap.emplace(uds_key{ 0x7E0, 0x25 }, UdsDefinition{.request_id = 0x7E0,.did = 0x25,.unit = 0,.byte_position = 4,.bit_offset_position = 4,.name = "Shift SW Status (D Range)",.value = 0,.display_value = "OFF"});
-    udsMap.emplace(uds_key{ 0x7E0, 0x25 }, UdsDefinition{.request_id = 0x7E0,.did = 0x25,.unit = 0,.byte_position = 4,.bit_offset_position = 4,.name = "Shift SW Status (D Range)",.value = 1,.display_value = "ON"});
-    udsMap.emplace(uds_key{ 0x7E0, 0x25 }, UdsDefinition{.request_id = 0x7E0,.did = 0x25,.unit = 0,.byte_position = 4,.bit_offset_position = 3,.name = "Shift SW Status (4 Range)",.value = 0,.display_value = "OFF"});
-    udsMap.emplace(uds_key{ 0x7E0, 0x25 }, UdsDefinition{.request_id = 0x7E0,.did = 0x25,.unit = 0,.byte_position = 4,.bit_offset_position = 3,.name = "Shift SW Status (4 Range)",.value = 1,.display_value = "ON"});
-    udsMap.emplace(uds_key{ 0x7E0, 0x25 }, UdsDefinition{.request_id = 0x7E0,.did = 0x25,.unit = 0,.byte_position = 4,.bit_offset_position = 2,.name = "Shift SW Status (3 Range)",.value = 0,.display_value = "OFF"});
-    udsMap.emplace(uds_key{ 0x7E0, 0x25 }, UdsDefinition{.request_id = 0x7E0,.did = 0x25,.unit = 0,.byte_position = 4,.bit_offset_position = 2,.name = "Shift SW Status (3 Range)",.value = 1,.display_value = "ON"});
-    udsMap.emplace(uds_key{ 0x7E0, 0x25 }, UdsDefinition{.request_id = 0x7E0,.did = 0x25,.unit = 0,.byte_position = 4,.bit_offset_position = 1,.name = "Shift SW Status (2 Range)",.value = 0,.display_value = "OFF"});
-    udsMap.emplace(uds_key{ 0x7E0, 0x25 }, UdsDefinition{.request_id = 0x7E0,.did = 0x25,.unit = 0,.byte_position = 4,.bit_offset_position = 1,.name = "Shift SW Status (2 Range)",.value = 1,.display_value = "ON"});
-    udsMap.emplace(uds_key{ 0x7E0, 0x25 }, UdsDefinition{.request_id = 0x7E0,.did = 0x25,.unit = 0,.byte_position = 4,.bit_offset_position = 0,.name = "Shift SW Status (L Range)",.value = 0,.display_value = "OFF"});
-    udsMap.emplace(uds_key{ 0x7E0, 0x25 }, UdsDefinition{.request_id = 0x7E0,.did = 0x25,.unit = 0,.byte_position = 4,.bit_offset_position = 0,.name = "Shift SW Status (L Range)",.value = 1,.display_value = "ON"});
-    udsMap.emplace(uds_key{ 0x7E0, 0x25 }, UdsDefinition{.request_id = 0x7E0,.did = 0x25,.unit = 0,.byte_position = 5,.bit_offset_position = 7,.name = "Sports Mode Selection SW",.value = 0,.display_value = "OFF"});
-    udsMap.emplace(uds_key{ 0x7E0, 0x25 }, UdsDefinition{.request_id = 0x7E0,.did = 0x25,.unit = 0,.byte_position = 5,.bit_offset_position = 7,.name = "Sports Mode Selection SW",.value = 1,.display_value = "ON"});
-    udsMap.emplace(uds_key{ 0x7E0, 0x25 }, UdsDefinition{.request_id = 0x7E0,.did = 0x25,.unit = 0,.byte_position = 5,.bit_offset_position = 6,.name = "Sports Shift Up SW",.value = 0,.display_value = "OFF"});
-    udsMap.emplace(uds_key{ 0x7E0, 0x25 }, UdsDefinition{.request_id = 0x7E0,.did = 0x25,.unit = 0,.byte_position = 5,.bit_offset_position = 6,.name = "Sports Shift Up SW",.value = 1,.display_value = "ON"});
-    udsMap.emplace(uds_key{ 0x7E0, 0x25 }, UdsDefinition{.request_id = 0x7E0,.did = 0x25,.unit = 0,.byte_position = 5,.bit_offset_position = 5,.name = "Sports Shift Down SW",.value = 0,.display_value = "OFF"});
-    udsMap.emplace(uds_key{ 0x7E0, 0x25 }, UdsDefinition{.request_id = 0x7E0,.did = 0x25,.unit = 0,.byte_position = 5,.bit_offset_position = 5,.name = "Sports Shift Down SW",.value = 1,.display_value = "ON"});
-    udsMap.emplace(uds_key{ 0x7E0, 0x25 }, UdsDefinition{.request_id = 0x7E0,.did = 0x25,.unit = 0,.byte_position = 5,.bit_offset_position = 3,.name = "Shift SW Status (B Range)",.value = 0,.display_value = "OFF"});
-    udsMap.emplace(uds_key{ 0x7E0, 0x25 }, UdsDefinition{.request_id = 0x7E0,.did = 0x25,.unit = 0,.byte_position = 5,.bit_offset_position = 3,.name = "Shift SW Status (B Range)",.value = 1,.display_value = "ON"});
-    udsMap.emplace(uds_key{ 0x7E0, 0x25 }, UdsDefinition{.request_id = 0x7E0,.did = 0x25,.unit = 0,.byte_position = 5,.bit_offset_position = 2,.name = "Reverse Switch",.value = 0,.display_value = "OFF"});
-    udsMap.emplace(uds_key{ 0x7E0, 0x25 }, UdsDefinition{.request_id = 0x7E0,.did = 0x25,.unit = 0,.byte_position = 5,.bit_offset_position = 2,.name = "Reverse Switch",.value = 1,.display_value = "ON"});
-    udsMap.emplace(uds_key{ 0x7E0, 0x25 }, UdsDefinition{.request_id = 0x7E0,.did = 0x25,.unit = 0,.byte_position = 6,.bit_offset_position = 4,.name = "Snow or 2nd Start Mode",.value = 0,.display_value = "OFF"});
-    udsMap.emplace(uds_key{ 0x7E0, 0x25 }, UdsDefinition{.request_id = 0x7E0,.did = 0x25,.unit = 0,.byte_position = 6,.bit_offset_position = 4,.name = "Snow or 2nd Start Mode",.value = 1,.display_value = "ON"});
-    udsMap.emplace(uds_key{ 0x7E0, 0x25 }, UdsDefinition{.request_id = 0x7E0,.did = 0x25,.unit = 0,.byte_position = 6,.bit_offset_position = 3,.name = "Sports Drive Switch",.value = 0,.display_value = "OFF"});
-    udsMap.emplace(uds_key{ 0x7E0, 0x25 }, UdsDefinition{.request_id = 0x7E0,.did = 0x25,.unit = 0,.byte_position = 6,.bit_offset_position = 3,.name = "Sports Drive Switch",.value = 1,.display_value = "ON"});
-    udsMap.emplace(uds_key{ 0x7E0, 0x25 }, UdsDefinition{.request_id = 0x7E0,.did = 0x25,.unit = 0,.byte_position = 6,.bit_offset_position = 2,.name = "Snow Switch Status",.value = 0,.display_value = "OFF"});
-    udsMap.emplace(uds_key{ 0x7E0, 0x25 }, UdsDefinition{.request_id = 0x7E0,.did = 0x25,.unit = 0,.byte_position = 6,.bit_offset_position = 2,.name = "Snow Switch Status",.value = 1,.display_value = "ON"});
-    udsMap.emplace(uds_key{ 0x7E0, 0x25 }, UdsDefinition{.request_id = 0x7E0,.did = 0x25,.unit = 0,.byte_position = 8,.bit_offset_position = 7,.name = "Low Gear Switch",.value = 0,.display_value = "OFF"});
-    udsMap.emplace(uds_key{ 0x7E0, 0x25 }, UdsDefinition{.request_id = 0x7E0,.did = 0x25,.unit = 0,.byte_position = 8,.bit_offset_position = 7,.name = "Low Gear Switch",.value = 1,.display_value = "ON"});
-    udsMap.emplace(uds_key{ 0x7E0, 0x25 }, UdsDefinition{.request_id = 0x7E0,.did = 0x25,.unit = 0,.byte_position = 8,.bit_offset_position = 6,.name = "Transfer Neutral",.value = 0,.display_value = "OFF"});
-    udsMap.emplace(uds_key{ 0x7E0, 0x25 }, UdsDefinition{.request_id = 0x7E0,.did = 0x25,.unit = 0,.byte_position = 8,.bit_offset_position = 6,.name = "Transfer Neutral",.value = 1,.display_value = "ON"});
-    udsMap.emplace(uds_key{ 0x7E0, 0x25 }, UdsDefinition{.request_id = 0x7E0,.did = 0x25,.unit = 0,.byte_position = 8,.bit_offset_position = 4,.name = "Kick Down Switch Status",.value = 0,.display_value = "OFF"});
-    udsMap.emplace(uds_key{ 0x7E0, 0x25 }, UdsDefinition{.request_id = 0x7E0,.did = 0x25,.unit = 0,.byte_position = 8,.bit_offset_position = 4,.name = "Kick Down Switch Status",.value = 1,.display_value = "ON"});
-    udsMap.emplace(uds_key{ 0x7E0, 0x25 }, UdsDefinition{.request_id = 0x7E0,.did = 0x25,.unit = 0,.byte_position = 8,.bit_offset_position = 2,.name = "Neutral Position SW Signal",.value = 0,.display_value = "OFF"});
-    udsMap.emplace(uds_key{ 0x7E0, 0x25 }, UdsDefinition{.request_id = 0x7E0,.did = 0x25,.unit = 0,.byte_position = 8,.bit_offset_position = 2,.name = "Neutral Position SW Signal",.value = 1,.display_value = "ON"});
-    udsMap.emplace(uds_key{ 0x7E0, 0x25 }, UdsDefinition{.request_id = 0x7E0,.did = 0x25,.unit = 0,.byte_position = 8,.bit_offset_position = 1,.name = "Brake Switch",.value = 0,.display_value = "OFF"});
-    udsMap.emplace(uds_key{ 0x7E0, 0x25 }, UdsDefinition{.request_id = 0x7E0,.did = 0x25,.unit = 0,.byte_position = 8,.bit_offset_position = 1,.name = "Brake Switch",.value = 1,.display_value = "ON"});
-    udsMap.emplace(uds_key{ 0x7E0, 0x25 }, UdsDefinition{.request_id = 0x7E0,.did = 0x25,.unit = 0,.byte_position = 8,.bit_offset_position = 0,.name = "Brake Switch Status",.value = 0,.display_value = "Unable"});
-    udsMap.emplace(uds_key{ 0x7E0, 0x25 }, UdsDefinition{.request_id = 0x7E0,.did = 0x25,.unit = 0,.byte_position = 8,.bit_offset_position = 0,.name = "Brake Switch Status",.value = 1,.display_value = "Able"});
-    udsMap.emplace(uds_key{ 0x7E0, 0x25 }, UdsDefinition{.request_id = 0x7E0,.did = 0x25,.unit = 0,.byte_position = 10,.bit_offset_position = 7,.name = "Shift Indication Enable",.value = 0,.display_value = "OFF"});
-    udsMap.emplace(uds_key{ 0x7E0, 0x25 }, UdsDefinition{.request_id = 0x7E0,.did = 0x25,.unit = 0,.byte_position = 10,.bit_offset_position = 7,.name = "Shift Indication Enable",.value = 1,.display_value = "ON"});
-    udsMap.emplace(uds_key{ 0x7E0, 0x25 }, UdsDefinition{.request_id = 0x7E0,.did = 0x25,.unit = 0,.byte_position = 10,.bit_offset_position = 4,.name = "Cruise Cancel Signal",.value = 0,.display_value = "OFF"});
-    udsMap.emplace(uds_key{ 0x7E0, 0x25 }, UdsDefinition{.request_id = 0x7E0,.did = 0x25,.unit = 0,.byte_position = 10,.bit_offset_position = 4,.name = "Cruise Cancel Signal",.value = 1,.display_value = "ON"});
-    udsMap.emplace(uds_key{ 0x7E0, 0x25 }, UdsDefinition{.request_id = 0x7E0,.did = 0x25,.unit = 0,.byte_position = 11,.bit_offset_position = 7,.name = "A/C Signal",.value = 0,.display_value = "OFF"});
-    udsMap.emplace(uds_key{ 0x7E0, 0x25 }, UdsDefinition{.request_id = 0x7E0,.did = 0x25,.unit = 0,.byte_position = 11,.bit_offset_position = 7,.name = "A/C Signal",.value = 1,.display_value = "ON"});
-    udsMap.emplace(uds_key{ 0x7E0, 0x25 }, UdsDefinition{.request_id = 0x7E0,.did = 0x25,.unit = 0,.byte_position = 11,.bit_offset_position = 6,.name = "Idle Up Signal",.value = 0,.display_value = "OFF"});
-    udsMap.emplace(uds_key{ 0x7E0, 0x25 }, UdsDefinition{.request_id = 0x7E0,.did = 0x25,.unit = 0,.byte_position = 11,.bit_offset_position = 6,.name = "Idle Up Signal",.value = 1,.display_value = "ON"});
-    udsMap.emplace(uds_key{ 0x7E0, 0x25 }, UdsDefinition{.request_id = 0x7E0,.did = 0x25,.unit = 0,.byte_position = 11,.bit_offset_position = 1,.name = "Throttle Open Switch",.value = 0,.display_value = "OFF"});
-    udsMap.emplace(uds_key{ 0x7E0, 0x25 }, UdsDefinition{.request_id = 0x7E0,.did = 0x25,.unit = 0,.byte_position = 11,.bit_offset_position = 1,.name = "Throttle Open Switch",.value = 1,.display_value = "ON"});
-    udsMap.emplace(uds_key{ 0x7E0, 0x25 }, UdsDefinition{.request_id = 0x7E0,.did = 0x25,.unit = 0,.byte_position = 11,.bit_offset_position = 0,.name = "Cruise Main SW",.value = 0,.display_value = "OFF"});
-    udsMap.emplace(uds_key{ 0x7E0, 0x25 }, UdsDefinition{.request_id = 0x7E0,.did = 0x25,.unit = 0,.byte_position = 11,.bit_offset_position = 0,.name = "Cruise Main SW",.value = 1,.display_value = "ON"});
-    udsMap.emplace(uds_key{ 0x7E0, 0x37 }, UdsDefinition{.request_id = 0x7E0,.did = 0x37,.unit = 33,.byte_position = 8,.bit_offset_position = 0,.scaling_factor = 0.03125,.offset_value = -1024.0,.is_calculated = true,.name = "Knock Correct Learn Value"});
-    udsMap.emplace(uds_key{ 0x7E0, 0x37 }, UdsDefinition{.request_id = 0x7E0,.did = 0x37,.unit = 33,.byte_position = 10,.bit_offset_position = 0,.scaling_factor = 0.03125,.offset_value = -1024.0,.is_calculated = true,.name = "Knock Feedback Value"});
-    udsMap.emplace(uds_key{ 0x7E0, 0x37 }, UdsDefinition{.request_id = 0x7E0,.did = 0x37,.unit = 0,.byte_position = 21,.bit_offset_position = 4,.name = "Throttle Learning",.value = 0,.display_value = "NG"});
-    udsMap.emplace(uds_key{ 0x7E0, 0x37 }, UdsDefinition{.request_id = 0x7E0,.did = 0x37,.unit = 0,.byte_position = 21,.bit_offset_position = 4,.name = "Throttle Learning",.value = 1,.display_value = "OK"});
-    udsMap.emplace(uds_key{ 0x7E0, 0x37 }, UdsDefinition{.request_id = 0x7E0,.did = 0x37,.unit = 0,.byte_position = 21,.bit_offset_position = 2,.name = "Closed Throttle Position SW",.value = 0,.display_value = "OFF"});
-    udsMap.emplace(uds_key{ 0x7E0, 0x37 }, UdsDefinition{.request_id = 0x7E0,.did = 0x37,.unit = 0,.byte_position = 21,.bit_offset_position = 2,.name = "Closed Throttle Position SW",.value = 1,.display_value = "ON"});
-    udsMap.emplace(uds_key{ 0x7E0, 0x37 }, UdsDefinition{.request_id = 0x7E0,.did = 0x37,.unit = 0,.byte_position = 22,.bit_offset_position = 4,.name = "Brake Override System",.value = 0,.display_value = "OFF"});
-    udsMap.emplace(uds_key{ 0x7E0, 0x37 }, UdsDefinition{.request_id = 0x7E0,.did = 0x37,.unit = 0,.byte_position = 22,.bit_offset_position = 4,.name = "Brake Override System",.value = 1,.display_value = "ON"});
-    udsMap.emplace(uds_key{ 0x7E0, 0x39 }, UdsDefinition{.request_id = 0x7E0,.did = 0x39,.unit = 0,.byte_position = 1,.bit_offset_position = 0,.name = "Idle Up VSV",.value = 0,.display_value = "OFF"});
-    udsMap.emplace(uds_key{ 0x7E0, 0x39 }, UdsDefinition{.request_id = 0x7E0,.did = 0x39,.unit = 0,.byte_position = 1,.bit_offset_position = 0,.name = "Idle Up VSV",.value = 1,.display_value = "ON"});
-    udsMap.emplace(uds_key{ 0x7E0, 0x41 }, UdsDefinition{.request_id = 0x7E0,.did = 0x41,.unit = 33,.byte_position = 5,.bit_offset_position = 0,.scaling_factor = 0.006103515625,.offset_value = 0.0,.is_calculated = true,.name = "Accelerator Position"});
-    udsMap.emplace(uds_key{ 0x7E0, 0x41 }, UdsDefinition{.request_id = 0x7E0,.did = 0x41,.unit = 48,.byte_position = 14,.bit_offset_position = 0,.scaling_factor = 0.01953125,.offset_value = 0.0,.is_calculated = true,.name = "Throttle Fully Close Learn"});
-    udsMap.emplace(uds_key{ 0x7E0, 0x41 }, UdsDefinition{.request_id = 0x7E0,.did = 0x41,.unit = 0,.byte_position = 20,.bit_offset_position = 7,.name = "System Guard",.value = 0,.display_value = "OFF"});
-    udsMap.emplace(uds_key{ 0x7E0, 0x41 }, UdsDefinition{.request_id = 0x7E0,.did = 0x41,.unit = 0,.byte_position = 20,.bit_offset_position = 7,.name = "System Guard",.value = 1,.display_value = "ON"});
-    udsMap.emplace(uds_key{ 0x7E0, 0x41 }, UdsDefinition{.request_id = 0x7E0,.did = 0x41,.unit = 0,.byte_position = 20,.bit_offset_position = 4,.name = "ST1",.value = 0,.display_value = "OFF"});
-    udsMap.emplace(uds_key{ 0x7E0, 0x41 }, UdsDefinition{.request_id = 0x7E0,.did = 0x41,.unit = 0,.byte_position = 20,.bit_offset_position = 4,.name = "ST1",.value = 1,.display_value = "ON"});
-    udsMap.emplace(uds_key{ 0x7E0, 0x41 }, UdsDefinition{.request_id = 0x7E0,.did = 0x41,.unit = 0,.byte_position = 20,.bit_offset_position = 3,.name = "Accelerator Idle Position",.value = 0,.display_value = "OFF"});
-    udsMap.emplace(uds_key{ 0x7E0, 0x41 }, UdsDefinition{.request_id = 0x7E0,.did = 0x41,.unit = 0,.byte_position = 20,.bit_offset_position = 3,.name = "Accelerator Idle Position",.value = 1,.display_value = "ON"});
-    udsMap.emplace(uds_key{ 0x7E0, 0x51 }, UdsDefinition{.request_id = 0x7E0,.did = 0x51,.unit = 57,.byte_position = 9,.bit_offset_position = 0,.scaling_factor = 1.0,.offset_value = -40.0,.is_calculated = true,.name = "Engine Oil Temperature"});
-    udsMap.emplace(uds_key{ 0x7E0, 0x51 }, UdsDefinition{.request_id = 0x7E0,.did = 0x51,.unit = 5,.byte_position = 13,.bit_offset_position = 0,.scaling_factor = 0.00762939453125,.offset_value = 0.0,.is_calculated = true,.name = "Throttle Position"});
-    udsMap.emplace(uds_key{ 0x7E0, 0x51 }, UdsDefinition{.request_id = 0x7E0,.did = 0x51,.unit = 33,.byte_position = 25,.bit_offset_position = 0,.scaling_factor = 0.001220703125,.offset_value = -40.0,.is_calculated = true,.name = "Electric Load Feedback Val"});
-    udsMap.emplace(uds_key{ 0x7E0, 0x52 }, UdsDefinition{.request_id = 0x7E0,.did = 0x52,.unit = 39,.byte_position = 12,.bit_offset_position = 0,.scaling_factor = 0.78125,.offset_value = 0.0,.is_calculated = true,.name = "Minimum Engine Speed"});
-    udsMap.emplace(uds_key{ 0x7E0, 0x82 }, UdsDefinition{.request_id = 0x7E0,.did = 0x82,.unit = 57,.byte_position = 0,.bit_offset_position = 0,.scaling_factor = 0.00390625,.offset_value = -40.0,.is_calculated = true,.name = "A/T Oil Temperature 1"});
-    udsMap.emplace(uds_key{ 0x7E0, 0x83 }, UdsDefinition{.request_id = 0x7E0,.did = 0x83,.unit = 0,.byte_position = 0,.bit_offset_position = 6,.name = "CVT Oil Press Calibration",.value = 0,.display_value = "Incmp"});
-    udsMap.emplace(uds_key{ 0x7E0, 0x83 }, UdsDefinition{.request_id = 0x7E0,.did = 0x83,.unit = 0,.byte_position = 0,.bit_offset_position = 6,.name = "CVT Oil Press Calibration",.value = 1,.display_value = "Compl"});
-    udsMap.emplace(uds_key{ 0x7E0, 0x83 }, UdsDefinition{.request_id = 0x7E0,.did = 0x83,.unit = 0,.byte_position = 0,.bit_offset_position = 4,.name = "MT Up Shift Indication",.value = 0,.display_value = "OFF"});
-    udsMap.emplace(uds_key{ 0x7E0, 0x83 }, UdsDefinition{.request_id = 0x7E0,.did = 0x83,.unit = 0,.byte_position = 0,.bit_offset_position = 4,.name = "MT Up Shift Indication",.value = 1,.display_value = "ON"});
-    udsMap.emplace(uds_key{ 0x7E0, 0x83 }, UdsDefinition{.request_id = 0x7E0,.did = 0x83,.unit = 0,.byte_position = 0,.bit_offset_position = 3,.name = "MT Down Shift Indication",.value = 0,.display_value = "OFF"});
-    udsMap.emplace(uds_key{ 0x7E0, 0x83 }, UdsDefinition{.request_id = 0x7E0,.did = 0x83,.unit = 0,.byte_position = 0,.bit_offset_position = 3,.name = "MT Down Shift Indication",.value = 1,.display_value = "ON"});
-    udsMap.emplace(uds_key{ 0x7E0, 0x83 }, UdsDefinition{.request_id = 0x7E0,.did = 0x83,.unit = 0,.byte_position = 0,.bit_offset_position = 2,.name = "Shift Control Mode",.value = 0,.display_value = "S-mode"});
-    udsMap.emplace(uds_key{ 0x7E0, 0x83 }, UdsDefinition{.request_id = 0x7E0,.did = 0x83,.unit = 0,.byte_position = 0,.bit_offset_position = 2,.name = "Shift Control Mode",.value = 1,.display_value = "M-mode"});
-    udsMap.emplace(uds_key{ 0x7E0, 0x85 }, UdsDefinition{.request_id = 0x7E0,.did = 0x85,.unit = 0,.byte_position = 1,.bit_offset_position = 6,.name = "ST Solenoid Status",.value = 0,.display_value = "OFF"});
-    udsMap.emplace(uds_key{ 0x7E0, 0x85 }, UdsDefinition{.request_id = 0x7E0,.did = 0x85,.unit = 0,.byte_position = 1,.bit_offset_position = 6,.name = "ST Solenoid Status",.value = 1,.display_value = "ON"});
-    udsMap.emplace(uds_key{ 0x7E0, 0xE1 }, UdsDefinition{.request_id = 0x7E0,.did = 0xE1,.unit = 0,.byte_position = 0,.bit_offset_position = 0,.scaling_factor = 1.0,.offset_value = 0.0,.is_calculated = true,.name = "# Codes(Include History)"});
-    udsMap.emplace(uds_key{ 0x7E0, 0xE3 }, UdsDefinition{.request_id = 0x7E0,.did = 0xE3,.unit = 0,.byte_position = 0,.bit_offset_position = 7,.name = "Check Mode",.value = 0,.display_value = "OFF"});
-    udsMap.emplace(uds_key{ 0x7E0, 0xE3 }, UdsDefinition{.request_id = 0x7E0,.did = 0xE3,.unit = 0,.byte_position = 0,.bit_offset_position = 7,.name = "Check Mode",.value = 1,.display_value = "ON"});
-    udsMap.emplace(uds_key{ 0x7E0, 0xE3 }, UdsDefinition{.request_id = 0x7E0,.did = 0xE3,.unit = 0,.byte_position = 0,.bit_offset_position = 5,.name = "SPD Test Result",.value = 0,.display_value = "Compl"});
-    udsMap.emplace(uds_key{ 0x7E0, 0xE3 }, UdsDefinition{.request_id = 0x7E0,.did = 0xE3,.unit = 0,.byte_position = 0,.bit_offset_position = 5,.name = "SPD Test Result",.value = 1,.display_value = "Incmpl"});
-}
-void init_udsDefinitions_ecu_07E1() {
-    udsMap.emplace(uds_key{ 0x7E1, 0x01 }, UdsDefinition{.request_id = 0x7E1,.did = 0x01,.unit = 33,.byte_position = 0,.bit_offset_position = 0,.scaling_factor = 0.392156862745098,.offset_value = 0.0,.is_calculated = true,.name = "Calculate Load"});
-    udsMap.emplace(uds_key{ 0x7E1, 0x01 }, UdsDefinition{.request_id = 0x7E1,.did = 0x01,.unit = 57,.byte_position = 9,.bit_offset_position = 0,.scaling_factor = 1.0,.offset_value = -40.0,.is_calculated = true,.name = "Coolant Temp"});
-    udsMap.emplace(uds_key{ 0x7E1, 0x01 }, UdsDefinition{.request_id = 0x7E1,.did = 0x01,.unit = 42,.byte_position = 12,.bit_offset_position = 0,.scaling_factor = 1.0,.offset_value = 0.0,.is_calculated = true,.name = "Vehicle Speed"});
-    udsMap.emplace(uds_key{ 0x7E1, 0x06 }, UdsDefinition{.request_id = 0x7E1,.did = 0x06,.unit = 0,.byte_position = 0,.bit_offset_position = 7,.name = "MIL",.value = 0,.display_value = "OFF"});
-    udsMap.emplace(uds_key{ 0x7E1, 0x06 }, UdsDefinition{.request_id = 0x7E1,.did = 0x06,.unit = 0,.byte_position = 0,.bit_offset_position = 7,.name = "MIL",.value = 1,.display_value = "ON"});
-    udsMap.emplace(uds_key{ 0x7E1, 0x25 }, UdsDefinition{.request_id = 0x7E1,.did = 0x25,.unit = 0,.byte_position = 4,.bit_offset_position = 7,.name = "Shift SW Status (P Range)",.value = 0,.display_value = "OFF"});
-    udsMap.emplace(uds_key{ 0x7E1, 0x25 }, UdsDefinition{.request_id = 0x7E1,.did = 0x25,.unit = 0,.byte_position = 4,.bit_offset_position = 7,.name = "Shift SW Status (P Range)",.value = 1,.display_value = "ON"});
-    udsMap.emplace(uds_key{ 0x7E1, 0x25 }, UdsDefinition{.request_id = 0x7E1,.did = 0x25,.unit = 0,.byte_position = 4,.bit_offset_position = 6,.name = "Shift SW Status (R Range)",.value = 0,.display_value = "OFF"});
-    udsMap.emplace(uds_key{ 0x7E1, 0x25 }, UdsDefinition{.request_id = 0x7E1,.did = 0x25,.unit = 0,.byte_position = 4,.bit_offset_position = 6,.name = "Shift SW Status (R Range)",.value = 1,.display_value = "ON"});
-    udsMap.emplace(uds_key{ 0x7E1, 0x25 }, UdsDefinition{.request_id = 0x7E1,.did = 0x25,.unit = 0,.byte_position = 4,.bit_offset_position = 5,.name = "Shift SW Status (N Range)",.value = 0,.display_value = "OFF"});
-    udsMap.emplace(uds_key{ 0x7E1, 0x25 }, UdsDefinition{.request_id = 0x7E1,.did = 0x25,.unit = 0,.byte_position = 4,.bit_offset_position = 5,.name = "Shift SW Status (N Range)",.value = 1,.display_value = "ON"});
-    udsMap.emplace(uds_key{ 0x7E1, 0x25 }, UdsDefinition{.request_id = 0x7E1,.did = 0x25,.unit = 0,.byte_position = 4,.bit_offset_position = 4,.name = "Shift SW Status (D Range)",.value = 0,.display_value = "OFF"});
-    udsMap.emplace(uds_key{ 0x7E1, 0x25 }, UdsDefinition{.request_id = 0x7E1,.did = 0x25,.unit = 0,.byte_position = 4,.bit_offset_position = 4,.name = "Shift SW Status (D Range)",.value = 1,.display_value = "ON"});
-    udsMap.emplace(uds_key{ 0x7E1, 0x25 }, UdsDefinition{.request_id = 0x7E1,.did = 0x25,.unit = 0,.byte_position = 5,.bit_offset_position = 3,.name = "Shift SW Status (B Range)",.value = 0,.display_value = "OFF"});
-    udsMap.emplace(uds_key{ 0x7E1, 0x25 }, UdsDefinition{.request_id = 0x7E1,.did = 0x25,.unit = 0,.byte_position = 5,.bit_offset_position = 3,.name = "Shift SW Status (B Range)",.value = 1,.display_value = "ON"});
-    udsMap.emplace(uds_key{ 0x7E1, 0x82 }, UdsDefinition{.request_id = 0x7E1,.did = 0x82,.unit = 57,.byte_position = 0,.bit_offset_position = 0,.scaling_factor = 0.00390625,.offset_value = -40.0,.is_calculated = true,.name = "A/T Oil Temperature 1"});
-    udsMap.emplace(uds_key{ 0x7E1, 0x83 }, UdsDefinition{.request_id = 0x7E1,.did = 0x83,.unit = 0,.byte_position = 0,.bit_offset_position = 6,.name = "CVT Oil Press Calibration",.value = 0,.display_value = "Incmp"});
-    udsMap.emplace(uds_key{ 0x7E1, 0x83 }, UdsDefinition{.request_id = 0x7E1,.did = 0x83,.unit = 0,.byte_position = 0,.bit_offset_position = 6,.name = "CVT Oil Press Calibration",.value = 1,.display_value = "Compl"});
-    udsMap.emplace(uds_key{ 0x7E1, 0xE1 }, UdsDefinition{.request_id = 0x7E1,.did = 0xE1,.unit = 0,.byte_position = 0,.bit_offset_position = 0,.scaling_factor = 1.0,.offset_value = 0.0,.is_calculated = true,.name = "# Codes(Include History)"});
-}
-
-void init_udsDefinitions() {
-    //init_udsDefinitions_ecu_07B0();
-    init_udsDefinitions_ecu_07E0();
-    //init_udsDefinitions_ecu_07E1();
-}
\ No newline at end of file
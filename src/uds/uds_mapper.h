@@ -1,36 +1,135 @@
-#pragma once
-#include <cstdint>
-#include <string>
-#include <tuple>
-#include <unordered_map>
-#include <optional>
-
-struct UdsDefinition
-{
-    uint16_t                   request_id     = 0;
-    uint16_t                   did            = 0;
-    int8_t                     unit           = 0;
-    int8_t                     byte_position  = 0;
-    int8_t                     bit_offset_position = 0;
-    double                     scaling_factor  = 1.0;
-    double                     offset_value    = 0.0;
-    bool                       is_calculated   = false;
-    int8_t                     bit_length      = 0;
-    std::string                name;
-    std::optional<uint8_t>     value           = std::nullopt;
-    std::optional<std::string> display_value   = std::nullopt;
-};
-
-using uds_key = std::tuple<uint16_t, uint16_t>; // {tx_id, data_id}
-
-struct uds_key_hash {
-    size_t operator()(const uds_key& k) const noexcept {
-        auto h1 = std::hash<uint16_t>{}(std::get<0>(k));
-        auto h2 = std::hash<uint16_t>{}(std::get<1>(k));
-        return h1 ^ (h2 << 1);
-    }
-};
-
-inline std::unordered_multimap<uds_key, UdsDefinition, uds_key_hash> udsMap;
-
-void init_udsDefinitions();
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include "uds_definition.h"
+#include "uds_tables.h"
+
+// Signal definitions are generated from "ISF CAN UDS Message Definitions.csv" by
+// tools/generate_uds_tables.py and live in flash; nothing is built at boot. The
+// same generator can write them as a binary image for the "udsdefs" partition,
+// which replaces the built-in tables at boot without recompiling (uds_image.h).
+
+inline constexpr size_t UDS_DEFINITION_COUNT = sizeof(UDS_DEFINITIONS) / sizeof(UDS_DEFINITIONS[0]);
+inline constexpr size_t UDS_DID_COUNT = sizeof(UDS_DIDS) / sizeof(UDS_DIDS[0]);
+
+// Capacity of the per-signal state sized at compile time; a loaded image may not exceed it
+inline constexpr size_t UDS_MAX_DEFINITIONS = 2048;
+inline constexpr size_t UDS_MAX_DIDS = 256;
+
+/**
+ * @brief One complete set of decoder tables, either the built-in ones or a loaded image.
+ */
+struct UdsTables
+{
+    const UdsDefinition *definitions;
+    size_t definition_count;
+    const UdsDidEntry *dids;
+    size_t did_count;
+    const uint16_t *enum_display;
+    size_t enum_display_count;
+    const char *strings;
+    size_t string_pool_size;
+};
+
+inline constexpr UdsTables BUILTIN_UDS_TABLES = {
+    UDS_DEFINITIONS, UDS_DEFINITION_COUNT,
+    UDS_DIDS, UDS_DID_COUNT,
+    UDS_ENUM_DISPLAY, sizeof(UDS_ENUM_DISPLAY) / sizeof(UDS_ENUM_DISPLAY[0]),
+    UDS_STRING_POOL, sizeof(UDS_STRING_POOL),
+};
+
+// Replaced only in setup(), before the tasks start, when a valid image is found
+inline UdsTables activeUdsTables = BUILTIN_UDS_TABLES;
+
+inline const UdsTables &udsTables()
+{
+    return activeUdsTables;
+}
+
+/**
+ * @brief The signal definitions of one (ECU, DID), iterable with range-for.
+ */
+struct UdsDefinitionRange
+{
+    const UdsDefinition *first = nullptr;
+    const UdsDefinition *last = nullptr;
+
+    constexpr const UdsDefinition *begin() const { return first; }
+    constexpr const UdsDefinition *end() const { return last; }
+    constexpr size_t size() const { return last - first; }
+    constexpr bool empty() const { return first == last; }
+};
+
+/**
+ * @brief Binary search of the DID index, which the generator emits sorted by (ECU, DID).
+ *
+ * @return The signals of the DID, empty if the DID is not defined
+ */
+constexpr UdsDefinitionRange findUdsDefinitions(uint16_t request_id, uint16_t did, const UdsTables &tables)
+{
+    size_t low = 0;
+    size_t high = tables.did_count;
+    uint32_t key = ((uint32_t)request_id << 16) | did;
+
+    while (low < high)
+    {
+        size_t mid = low + (high - low) / 2;
+        uint32_t mid_key = ((uint32_t)tables.dids[mid].request_id << 16) | tables.dids[mid].did;
+
+        if (mid_key == key)
+        {
+            const UdsDefinition *first = &tables.definitions[tables.dids[mid].first];
+            return UdsDefinitionRange{first, first + tables.dids[mid].count};
+        }
+        if (mid_key < key)
+        {
+            low = mid + 1;
+        }
+        else
+        {
+            high = mid;
+        }
+    }
+
+    return UdsDefinitionRange{};
+}
+
+inline UdsDefinitionRange findUdsDefinitions(uint16_t request_id, uint16_t did)
+{
+    return findUdsDefinitions(request_id, did, udsTables());
+}
+
+inline const char *udsString(uint16_t string_id)
+{
+    return &udsTables().strings[string_id];
+}
+
+inline const char *udsName(const UdsDefinition &def)
+{
+    return udsString(def.name_id);
+}
+
+/**
+ * @brief Display text of an enumerated signal's raw value.
+ *
+ * The generator gives every enumerated signal a dense table indexed by raw
+ * value, so this is a bounds check and one array read.
+ *
+ * @return The text, or nullptr if the signal has no text for this value
+ */
+inline const char *udsEnumDisplay(const UdsDefinition &def, uint32_t raw_value)
+{
+    if (raw_value >= def.enum_size)
+    {
+        return nullptr;
+    }
+
+    uint16_t display_id = udsTables().enum_display[def.enum_first + raw_value];
+    return display_id == UDS_STRING_NONE ? nullptr : udsString(display_id);
+}
+
+static_assert(findUdsDefinitions(0x7E0, 0x01, BUILTIN_UDS_TABLES).size() > 0, "Engine ECU local ID 0x01 must be defined");
+static_assert(findUdsDefinitions(0x7E0, 0xFFFF, BUILTIN_UDS_TABLES).empty(), "Undefined DIDs must resolve to an empty range");
+static_assert(sizeof(UDS_STRING_POOL) < UDS_STRING_NONE, "String pool offsets must fit 16 bits below UDS_STRING_NONE");
+static_assert(UDS_DEFINITION_COUNT <= UDS_MAX_DEFINITIONS && UDS_DID_COUNT <= UDS_MAX_DIDS,
+              "Built-in tables must fit the per-signal state capacity");
@@ -0,0 +1,4832 @@
+// Generated by tools/generate_uds_tables.py from "ISF CAN UDS Message Definitions.csv".
+// Do not edit by hand: change the CSV and re-run the generator.
+#ifndef _UDS_TABLES_H
+#define _UDS_TABLES_H
+
+#include "uds_definition.h"
+
+// 1473 unique names and display values
+inline constexpr char UDS_STRING_POOL[] =
+    "without\0"
+    "with\0"
+    "Current Com Back-Up Battery\0"
+    "OFF\0"
+    "ON\0"
+    "Emergency Switch\0"
+    "VIN\0"
+    "MIN\0"
+    "MDN\0"
+    "SIMRAV ID High\0"
+    "MEID\0"
+    "SIMRAV ID Low\0"
+    "NOT Avail\0"
+    "Available\0"
+    "Remote Warning\0"
+    "Remote Detected DTC\0"
+    "Remote FFD\0"
+    "Remote Detect DTC\0"
+    "Remote Vehicle Status\0"
+    "Remote Precaution\0"
+    "Remote Monitoring\0"
+    "Remote DTC Recorder\0"
+    "Remote Alarm Detect\0"
+    "Remote Operation\0"
+    "Remote Immobiliser\0"
+    "Remote Vehicle Control History\0"
+    "Maintenance Message\0"
+    "Remote Vehicle Location\0"
+    "Remote Navigation Display\0"
+    "Remote Guest Driver Status\0"
+    "Remote A/C by Smart Key\0"
+    "eConnect State Notification\0"
+    "eConnect Event Notification\0"
+    "eConnect State Change Notification\0"
+    "eConnect Remote Operation\0"
+    "Driving Trip Data Notification\0"
+    "eConnect Remote Vehicle Location\0"
+    "Remote Service Function\0"
+    "Unsent Emergency Call Number\0"
+    "Normal\0"
+    "Replace\0"
+    "Backup Battery Status\0"
+    "Shipping (Disable)\0"
+    "Shipping (Enable)\0"
+    "Full Services\0"
+    "Full Services and F&I Service\0"
+    "eCall only\0"
+    "Activation Status\0"
+    "Remote Blocking State\0"
+    "Autonomous Blocking State\0"
+    "Low(0)\0"
+    "High(1)\0"
+    "DWIMIHI/DWIMIHI2 State\0"
+    "Remote Engine Starter Registration Status\0"
+    "Communication Remote Engine Starter\0"
+    "Number of Trouble Codes\0"
+    "FR Wheel Speed\0"
+    "FL Wheel Speed\0"
+    "RR Wheel Speed\0"
+    "RL Wheel Speed\0"
+    "Forward\0"
+    "Back\0"
+    "RL Wheel Direction\0"
+    "RR Wheel Direction\0"
+    "FL Wheel Direction\0"
+    "FR Wheel Direction\0"
+    "Master Cylinder Sensor\0"
+    "Master Cylinder Sensor2\0"
+    "Stroke Sensor\0"
+    "Stroke Sensor2\0"
+    "Accumulator Sensor\0"
+    "Regulator Pressure Sensor Output\0"
+    "Reaction Force Pressure\0"
+    "Servo Pressure\0"
+    "Accumulator Pressure\0"
+    "Master Cylinder Pressure\0"
+    "Master Cylinder Sensor Temperature\0"
+    "Brake Booster Pressure\0"
+    "Atmospheric Pressure\0"
+    "Reaction Force Pressure Sensor Temperature\0"
+    "Servo Pressure Sensor Temperature\0"
+    "Brake Booster Pressure \"B\"\0"
+    "Deceleration Sensor\0"
+    "Deceleration Sensor2\0"
+    "Throttle Opening Angle\0"
+    "Throttle Opening Angle %\0"
+    "Accelerator Opening Angle\0"
+    "Accelerator Opening Angle %\0"
+    "Real Engine Torque\0"
+    "Yaw Rate Sensor\0"
+    "Yaw Rate Sensor2\0"
+    "Steering Angle Sensor\0"
+    "Vehicle Speed\0"
+    "EBS Relay\0"
+    "Stop Light Relay Output\0"
+    "Zero Point of M/C\0"
+    "Zero Point of M/C2\0"
+    "Voltage of M/C\0"
+    "Voltage of M/C2\0"
+    "Voltage of Stroke Sensor\0"
+    "Voltage of Stroke Sensor2\0"
+    "Regulator Pressure Sensor Output After Filter\0"
+    "Regulator Pressure Sensor Variation\0"
+    "Regulator Pressure Sensor Correction Voltage\0"
+    "FR Gap Wheel Speed\0"
+    "FL Gap Wheel Speed\0"
+    "RR Gap Wheel Speed\0"
+    "Number of DTC\0"
+    "Calculate Load\0"
+    "Vehicle Load\0"
+    "MAF\0"
+    "MAP\0"
+    "Intake Air\0"
+    "Ambient Temperature\0"
+    "Atmosphere Pressure\0"
+    "Coolant Temp\0"
+    "Engine Speed\0"
+    "Engine Run Time\0"
+    "Throttle Sensor Position\0"
+    "Throttle Sensor Volt %\0"
+    "Throttle Sensor #2 Volt %\0"
+    "Accel Sens. No.1 Volt %\0"
+    "Accel Sens. No.2 Volt %\0"
+    "Throttle Motor DUTY\0"
+    "Warmup Cycle Cleared DTC\0"
+    "Distance from DTC Cleared\0"
+    "Time after DTC Cleared\0"
+    "Battery Voltage\0"
+    "Unsupp\0"
+    "Supp\0"
+    "MAF Sensor 1 Supported\0"
+    "MAF Sensor 2 Supported\0"
+    "MAF Sensor 1\0"
+    "MAF Sensor 2\0"
+    "Coolant Temp Sensor1 Supported\0"
+    "Coolant Temp Sensor2 Supported\0"
+    "Coolant Temperature1\0"
+    "Coolant Temperature2\0"
+    "Intake Air Temp B1S1 Supported\0"
+    "Intake Air Temp B1S2 Supported\0"
+    "Intake Air Temp B1S3 Supported\0"
+    "Intake Air Temp B2S1 Supported\0"
+    "Intake Air Temp B2S2 Supported\0"
+    "Intake Air Temp B2S3 Supported\0"
+    "Intake Air Temp B1S1\0"
+    "Intake Air Temp B1S2\0"
+    "Intake Air Temp B1S3\0"
+    "Intake Air Temp B2S1\0"
+    "Intake Air Temp B2S2\0"
+    "Intake Air Temp B2S3\0"
+    "Target Throttle Position #1 Supported\0"
+    "Throttle Sensor Position #1 Supported\0"
+    "Target Throttle Position #2 Supported\0"
+    "Throttle Sensor Position #2 Supported\0"
+    "Target Throttle Position #1\0"
+    "Throttle Sensor Position #1\0"
+    "Target Throttle Position #2\0"
+    "Throttle Sensor Position #2\0"
+    "Engine Oil Temperature Sensor\0"
+    "Main Injection Timing\0"
+    "Unused\0"
+    "OL\0"
+    "CL\0"
+    "OLDrive\0"
+    "OLFault\0"
+    "CLFault\0"
+    "Fuel System Status #1\0"
+    "Fuel System Status #2\0"
+    "Short FT B1S1\0"
+    "Long FT B1S1\0"
+    "Short FT B2S1\0"
+    "Long FT B2S1\0"
+    "IGN Advance\0"
+    "2nd Air System Status\0"
+    "Atmosphere Adoption (Secondary Air)\0"
+    "Air Pump\0"
+    "EVAP (Purge) VSV\0"
+    "Target EGR Position\0"
+    "Alcohol Density Estimate\0"
+    "Gasoline/petrol\0"
+    "Methanol\0"
+    "Ethanol\0"
+    "Diesel\0"
+    "Liquefied Petroleum Gas (LPG) LPG\0"
+    "Compressed Natural Gas (CNG) CNG\0"
+    "Propane\0"
+    "Battery/electric\0"
+    "Bi-fuel vehicle using gasoline\0"
+    "Bi-fuel vehicle using methanol\0"
+    "Bi-fuel vehicle using ethanol\0"
+    "Bi-fuel vehicle using LPG\0"
+    "Bi-fuel vehicle using CNG\0"
+    "Bi-fuel vehicle using propane\0"
+    "Bi-fuel vehicle using battery\0"
+    "Bi-fuel vehicle using battery and combustion engine\0"
+    "Hybrid vehicle using gasoline engine\0"
+    "Hybrid vehicle using gasoline engine on ethanol\0"
+    "Hybrid vehicle using diesel engine\0"
+    "Hybrid vehicle using battery\0"
+    "Hybrid vehicle using battery and combustion engine\0"
+    "Hybrid vehicle in regeneration mode\0"
+    "Bi-fuel vehicle using Natural Gas\0"
+    "Bi-fuel vehicle using diesel\0"
+    "Natural Gas (Compressed or Liquefied Natural Gas)\0"
+    "Dual Fuel - Diesel and CNG\0"
+    "Dual Fuel - Diesel and LNG\0"
+    "Fuel Cell Utilizing Hydrogen\0"
+    "Hydrogen Internal Combustion Engine\0"
+    "Current Fuel Type\0"
+    "Fuel Remaining Volume\0"
+    "Shift SW Status (N,P Range) Supported\0"
+    "Glow Indicator Supported\0"
+    "Shift SW Status (N,P Range)\0"
+    "Glow Indicator\0"
+    "Target EGR Valve Pos Supported\0"
+    "Actual EGR Valve Pos Supported\0"
+    "Target EGR Valve Pos #2 Supported\0"
+    "Actual EGR Valve Pos #2 Supported\0"
+    "Target EGR Valve Pos\0"
+    "Actual EGR Valve Pos\0"
+    "Target EGR Valve Pos #2\0"
+    "Actual EGR Valve Pos #2\0"
+    "Target Throttle Position Supported\0"
+    "Actual Throttle Position Supported\0"
+    "Actual Throttle Position #2 Supported\0"
+    "Target Throttle Position\0"
+    "Actual Throttle Position\0"
+    "Actual Throttle Position #2\0"
+    "Target Booster Pressure Supported\0"
+    "Target Booster Pressure\0"
+    "Target VN Turbo Position Supported\0"
+    "Actual VN Position Supported\0"
+    "Target VN Turbo Position #2 Supported\0"
+    "Actual VN Position #2 Supported\0"
+    "Target VN Turbo Position\0"
+    "Actual VN Turbo Position\0"
+    "Target VN Turbo Position #2\0"
+    "Actual VN Turbo Position #2\0"
+    "Short FT B1S2\0"
+    "Long FT B1S2\0"
+    "Short FT B2S2\0"
+    "Long FT B2S2\0"
+    "Target Air-Fuel Ratio\0"
+    "AF Lambda B1S1\0"
+    "AFS Voltage B1S1\0"
+    "AF Lambda B2S1\0"
+    "AFS Voltage B2S1\0"
+    "AFS Current B1S1\0"
+    "AFS Current B2S1\0"
+    "O2S B1S1\0"
+    "O2FT B1S1\0"
+    "O2S B1S2\0"
+    "O2S B2S1\0"
+    "O2FT B2S1\0"
+    "O2S B2S2\0"
+    "Particulate Filter Differential Pressure Supported\0"
+    "Particulate Filter Differential Pressure\0"
+    "Particulate Filter Differential Pressure #2 Supported\0"
+    "Particulate Filter Differential Pressure #2\0"
+    "AF Lambda B1S2\0"
+    "AFS Current B1S2\0"
+    "AFS Voltage B1S2\0"
+    "Fuel Press\0"
+    "EVAP Vapor Pressure (Wide)\0"
+    "Catalyst Temp B1S1\0"
+    "Catalyst Temp B2S1\0"
+    "Catalyst Temp B1S2\0"
+    "Catalyst Temp B2S2\0"
+    "Target Common Rail Pressure Supported\0"
+    "Common Rail Pressure Supported\0"
+    "Fuel Temperature Supported\0"
+    "Target Common Rail Pressure\0"
+    "Common Rail Pressure\0"
+    "Fuel Temperature\0"
+    "Intake Air Temp (Turbo) Supported\0"
+    "Intake Air Temp (Turbo)\0"
+    "Exhaust Temperature B1S1 Supported\0"
+    "Exhaust Temperature B1S2 Supported\0"
+    "Exhaust Temperature B1S3 Supported\0"
+    "Exhaust Temperature B1S4 Supported\0"
+    "Exhaust Temperature B1S1\0"
+    "Exhaust Temperature B1S2\0"
+    "Exhaust Temperature B1S3\0"
+    "Exhaust Temperature B1S4\0"
+    "Exhaust Temperature B2S1 Supported\0"
+    "Exhaust Temperature B2S2 Supported\0"
+    "Exhaust Temperature B2S3 Supported\0"
+    "Exhaust Temperature B2S1\0"
+    "Exhaust Temperature B2S2\0"
+    "Exhaust Temperature B2S3\0"
+    "Number of Emission DTC\0"
+    "MIL\0"
+    "Not Avl\0"
+    "Avail\0"
+    "Misfire Monitor\0"
+    "Fuel System Monitor\0"
+    "Complete Parts Monitor\0"
+    "Compl\0"
+    "Incmpl\0"
+    "Fuel System Monitor Result\0"
+    "Catalyst Monitor\0"
+    "Heated Catalyst Monitor\0"
+    "EVAP Monitor\0"
+    "2nd Air Monitor\0"
+    "A/C Monitor\0"
+    "O2S(A/FS) Monitor\0"
+    "O2S(A/FS) Heater Monitor\0"
+    "EGR/VVT Monitor\0"
+    "OBD II (California ARB)\0"
+    "OBD (US Federal EPA)\0"
+    "OBD and OBD II\0"
+    "OBD I\0"
+    "Not OBD compliant\0"
+    "EOBD (Euro OBD)\0"
+    "EOBD and OBD II\0"
+    "EOBD and OBD\0"
+    "\"EOBD\0"
+    "JOBD (Japan OBD)\0"
+    "JOBD and OBD II\0"
+    "JOBD and EOBD\0"
+    "\"JOBD\0"
+    "EURO 4\0"
+    "EURO 5\0"
+    "Engine Manufacturer Diagnostics (EMD)\0"
+    "Engine Manufacturer Diagnostics Enhanced (EMD+)\0"
+    "Heavy Duty On-Board Diagnostics (Child/Partial)\0"
+    "Heavy Duty On-Board Diagnostics\0"
+    "World Wide Harmonized OBD\0"
+    "Heavy Duty Euro OBD Stage I without NOx control\0"
+    "Heavy Duty Euro OBD Stage I with NOx control\0"
+    "Heavy Duty Euro OBD Stage II without NOx control\0"
+    "Heavy Duty Euro OBD Stage II with NOx control\0"
+    "Brazil OBD Phase 1\0"
+    "Brazil OBD Phase 2\0"
+    "Korean OBD\0"
+    "India OBD I\0"
+    "India OBD II\0"
+    "Heavy Duty Euro OBD Stage VI\0"
+    "\"OBD\0"
+    "Brazil OBD Phase 3\0"
+    "\"Motorcycle\0"
+    "China Nationwide Stage 6\0"
+    "Brazil OBD Diesel\0"
+    "OBD Requirements\0"
+    "MIL ON Run Distance\0"
+    "Unable\0"
+    "Enable\0"
+    "Misfire Monitor ENA\0"
+    "Fuel System Monitor ENA\0"
+    "Component Monitor ENA\0"
+    "Misfire Monitor CMPL\0"
+    "Fuel System Monitor CMPL\0"
+    "Component Monitor CMPL\0"
+    "Catalyst Monitor ENA\0"
+    "Heated Cat Monitor ENA\0"
+    "EVAP Monitor ENA\0"
+    "2nd Air Monitor ENA\0"
+    "A/C Monitor ENA\0"
+    "O2S(A/FS) Monitor ENA\0"
+    "Heater Monitor ENA\0"
+    "EGR/VVT Monitor ENA\0"
+    "Catalyst Monitor CMPL\0"
+    "Heated Cat Monitor CMPL\0"
+    "EVAP Monitor CMPL\0"
+    "2nd Air Monitor CMPL\0"
+    "A/C Monitor CMPL\0"
+    "O2S(A/FS) Monitor CMPL\0"
+    "Heater Monitor CMPL\0"
+    "EGR/VVT Monitor CMPL\0"
+    "Running Time from MIL ON\0"
+    "NOx Density B1S1 Supported\0"
+    "NOx Density B1S2 Supported\0"
+    "NOx Density B2S1 Supported\0"
+    "NOx Density B2S2 Supported\0"
+    "NOx Density B1S1\0"
+    "NOx Density B1S2\0"
+    "NOx Density B2S1\0"
+    "NOx Density B2S2\0"
+    "A/F (O2) Density B1S1 Supported\0"
+    "A/F (O2) Density B1S2 Supported\0"
+    "A/F (O2) Density B2S1 Supported\0"
+    "A/F (O2) Density B2S2 Supported\0"
+    "AF Lambda B1S1 Supported\0"
+    "AF Lambda B1S2 Supported\0"
+    "AF Lambda B2S1 Supported\0"
+    "AF Lambda B2S2 Supported\0"
+    "A/F (O2) Density B1S1\0"
+    "A/F (O2) Density B1S2\0"
+    "A/F (O2) Density B2S1\0"
+    "A/F (O2) Density B2S2\0"
+    "AF Lambda B2S2\0"
+    "NOx Corrected Density B1S1 Supported\0"
+    "NOx Corrected Density B1S2 Supported\0"
+    "NOx Corrected Density B2S1 Supported\0"
+    "NOx Corrected Density B2S2 Supported\0"
+    "NOx Corrected Density B1S1\0"
+    "NOx Corrected Density B1S2\0"
+    "NOx Corrected Density B2S1\0"
+    "NOx Corrected Density B2S2\0"
+    "Actual Engine Percent Torque\0"
+    "Engine Reference Torque (Fixed Value)\0"
+    "Engine Friction Percent Torque\0"
+    "Engine Fuel Rate\0"
+    "Vehicle Fuel Rate\0"
+    "Engine Exhaust Flow Rate\0"
+    "Cancel Switch\0"
+    "SET/COAST Switch\0"
+    "RES/ACC Switch\0"
+    "ASL Vehicle Speed\0"
+    "ASL Memory Vehicle Speed\0"
+    "ASL Shift Position Request\0"
+    "ASL Throttle Position\0"
+    "ASL Ready\0"
+    "ASL Main Switch\0"
+    "Engine Speed from EFI\0"
+    "Intake-Air Temp from EFI\0"
+    "Coolant Temp from EFI\0"
+    "Accel Position from EFI\0"
+    "Throttle Position from EFI\0"
+    "Injection Volume from EFI\0"
+    "Received MIL from ECT\0"
+    "A/T Oil Temp from ECT\0"
+    "1st\0"
+    "2nd\0"
+    "3rd\0"
+    "4th\0"
+    "5th\0"
+    "6th\0"
+    "7th\0"
+    "8th\0"
+    "Shift Position Sig from ECT\0"
+    "SPD (NO)\0"
+    "SPD (NT)\0"
+    "ECT Lock Up\0"
+    "SPD (NC)\0"
+    "SPD (SP2)\0"
+    "Stop Light Signal from EFI\0"
+    "Commo\0"
+    "Vacuum\0"
+    "CAN Com\0"
+    "DC\0"
+    "VN Turbo Type\0"
+    "No Comm\0"
+    "Comm\0"
+    "Comm with Reductant Control Module\0"
+    "Comm with VALVEMATIC\0"
+    "Comm with Air Conditioner\0"
+    "Communication with Brake\0"
+    "Comm with Driving Support Sys\0"
+    "Communication with HV\0"
+    "Comm with Power Manage\0"
+    "Communication with ECT\0"
+    "Stop Light Switch\0"
+    "Power Steering Signal\0"
+    "Cooler Box Switch\0"
+    "Beacon Light Signal\0"
+    "Engine Oil Pressure SW\0"
+    "Idle Up SW\0"
+    "Gasoline\0"
+    "CNG\0"
+    "Fuel Select Switch\0"
+    "Fuel Lid Switch\0"
+    "Close\0"
+    "Open\0"
+    "Fuel Lid\0"
+    "Starter Control\0"
+    "Starter Signal\0"
+    "Clutch Start SW\0"
+    "Catalyst Regeneration Switch\0"
+    "Clogged Fuel Filter Switch\0"
+    "Door Courtesy SW\0"
+    "Fuel Cooler SW\0"
+    "Electrical Load Signal 4\0"
+    "Electrical Load Signal 3\0"
+    "Electrical Load Signal 2\0"
+    "Electrical Load Signal 1\0"
+    "Shift SW Status (L Range)\0"
+    "Shift SW Status (2 Range)\0"
+    "Shift SW Status (3 Range)\0"
+    "Shift SW Status (4 Range)\0"
+    "Shift SW Status (D Range)\0"
+    "Shift SW Status (N Range)\0"
+    "Shift SW Status (R Range)\0"
+    "Shift SW Status (P Range)\0"
+    "Reverse Switch\0"
+    "Shift SW Status (B Range)\0"
+    "SD Switch\0"
+    "Sports Shift Down SW\0"
+    "Sports Shift Up SW\0"
+    "Sports Mode Selection SW\0"
+    "Normal Mode Switch\0"
+    "ECO Switch\0"
+    "Snow Switch Status\0"
+    "Sports Drive Switch\0"
+    "Snow or 2nd Start Mode\0"
+    "Pattern Switch (PWR/M)\0"
+    "Overdrive Cut Switch #2\0"
+    "Overdrive Cut Switch #1\0"
+    "TPS 6 Switch\0"
+    "TPS 5 Switch\0"
+    "TPS 4 Switch\0"
+    "TPS 3 Switch\0"
+    "TPS 2 Switch\0"
+    "TPS 1 Switch\0"
+    "Able\0"
+    "Brake Switch Status\0"
+    "Brake Switch\0"
+    "Neutral Position SW Signal\0"
+    "Transfer L4\0"
+    "Kick Down Switch Status\0"
+    "4WD SW\0"
+    "Transfer Neutral\0"
+    "Low Gear Switch\0"
+    "Launch Control Switch\0"
+    "iMT Switch\0"
+    "EV City Mode Switch\0"
+    "NA\0"
+    "Sports Mode Switch\0"
+    "ASL Switch\0"
+    "A/C Pressure Abnormal SW\0"
+    "A/C Pressure Normal SW\0"
+    "Cruise Cancel Signal\0"
+    "Clutch Switch\0"
+    "Shift Indication Enable\0"
+    "Cruise Main SW\0"
+    "Throttle Open Switch\0"
+    "TC Terminal\0"
+    "Key Unlock Signal\0"
+    "Idle Up Signal\0"
+    "A/C Signal\0"
+    "Vehicle Spec Signal 1\0"
+    "Total Distance Traveled\0"
+    "Previous Trip Alternator Max Output Time\0"
+    "Initial Engine Battery Minimum Voltage\0"
+    "Previous Trip Charge Control Time\0"
+    "Previous Trip Average Battery Temperature\0"
+    "Auxiliary Battery Average Current during IG OFF 1 Trip before\0"
+    "Auxiliary Battery Average Current during IG OFF 2 Trip before\0"
+    "Auxiliary Battery Average Current during IG OFF 3 Trip before\0"
+    "Total Distance Up to 1 Trip before\0"
+    "Total Distance Up to 2 Trip before\0"
+    "Total Distance Up to 3 Trip before\0"
+    "IG OFF Time before 1 trip\0"
+    "IG OFF Time before 2 trip\0"
+    "IG OFF Time before 3 trip\0"
+    "IG ON Time Up to 1 trip before\0"
+    "IG ON Time Up to 2 trip before\0"
+    "IG ON Time Up to 3 trip before\0"
+    "Engine Run Time before 1 trip\0"
+    "Engine Run Time before 2 trip\0"
+    "Engine Run Time before 3 trip\0"
+    "Time of Long Term Leaving with IG OFF (1st)\0"
+    "Time of Long Term Leaving with IG OFF (2nd)\0"
+    "Time of Long Term Leaving with IG OFF (3rd)\0"
+    "Total Distance Indicated after Long Term Leaving with IG OFF (1st)\0"
+    "Total Distance Indicated after Long Term Leaving with IG OFF (2nd)\0"
+    "Total Distance Indicated after Long Term Leaving with IG OFF (3rd)\0"
+    "Auxiliary Battery Charging Integrated Current\0"
+    "Auxiliary Battery Discharging Integrated Current\0"
+    "Auxiliary Battery Integrated Thermal Load\0"
+    "Auxiliary Battery Capacity after IG ON\0"
+    "Auxiliary Battery Capacity after IG OFF\0"
+    "Integrated Engine Run Time\0"
+    "Number of Long Term Leaving with IG OFF\0"
+    "Actual VVT Angle #1\0"
+    "Actual VVT Angle #2\0"
+    "Actual VVT Ex Angle #1\0"
+    "Actual VVT Ex Angle #2\0"
+    "Coolant Temp Variation after Waterpump Start\0"
+    "Intake Air Temp Variation after Engine Start\0"
+    "MAF #1\0"
+    "MAF #2\0"
+    "Intake Air #1\0"
+    "Intake Air #2\0"
+    "IAC Sensor Voltage\0"
+    "Intake Air Control Position\0"
+    "VALVEMATIC Current Angle\0"
+    "VALVEMATIC IG OFF\0"
+    "VALVEMATIC IG ON\0"
+    "VALVEMATIC Cranking\0"
+    "VALVEMATIC bef Warm Up\0"
+    "VALVEMATIC IDM Hi Temp\0"
+    "VALVEMATIC High(ACT)\0"
+    "VALVEMATIC aft Warm Up\0"
+    "VALVEMATIC Low(ACT)\0"
+    "Balance Pipe Pressure\0"
+    "VALVEMATIC Shaft Sensor Voltage\0"
+    "Intercooler Coolant Temperature\0"
+    "O2 LR Switch Time B1S1\0"
+    "O2 LR Switch Time B2S1\0"
+    "O2 RL Switch Time B1S1\0"
+    "O2 RL Switch Time B2S1\0"
+    "O2S Impedance B1S2\0"
+    "O2S Impedance B2S2\0"
+    "Air Pump Pressure (Absolute)\0"
+    "Air Pump2 Pressure (Absolute)\0"
+    "DPF Differential Pressure\0"
+    "DPR/DPNR Absolute Pressure\0"
+    "VN Position Sensor Out\0"
+    "VN Position Sensor Out #2\0"
+    "A/F Sensor Impedance B1S2\0"
+    "Radiator Coolant Temp\0"
+    "Power Steering Pressure\0"
+    "Engine Oil Pressure\0"
+    "PCV Voltage for Oil Tank\0"
+    "PCV Voltage for Ventilation Case\0"
+    "Brake Boost Pressure Sensor\0"
+    "Atmospheric Pressure Sensor\0"
+    "Initial Engine Coolant Temp\0"
+    "Initial Intake Air Temp\0"
+    "FPrs diff / Relief Vlv op\0"
+    "Air Pump Pulsation Pressure\0"
+    "Air Pump2 Pulsation Pressure\0"
+    "Knock Correct Learn Value\0"
+    "Knock Feedback Value\0"
+    "Purge Density Learn Value\0"
+    "Evap Purge Flow\0"
+    "IG OFF Elapsed Time\0"
+    "Dist Batt Cable Disconnect\0"
+    "NG\0"
+    "OK\0"
+    "Diesel Throttle Learn Status\0"
+    "EGR Close Lrn. Status\0"
+    "FC TAU\0"
+    "Idle Fuel Cut\0"
+    "Closed Throttle Position SW\0"
+    "READY\0"
+    "NOT RDY\0"
+    "AI Test\0"
+    "Throttle Learning\0"
+    "Fuel Cut Condition\0"
+    "Immobiliser Communication\0"
+    "Brake Override System\0"
+    "Auto Shift Up Status\0"
+    "Air Switching Valve2 Freeze\0"
+    "Air Switching Valve Freeze\0"
+    "Air Pump2 Freeze\0"
+    "Air Pump Freeze\0"
+    "Subfreezing Conditions\0"
+    "Engine Oil Temp for Eng Start\0"
+    "Engine Oil Press for Eng Start\0"
+    "PCV Volt Vibration for Oil Tank\0"
+    "PCV Volt Vibration for Ventilation Case\0"
+    "Balance Pipe Relative Pressure\0"
+    "Knock Sensor Lowest Learning Value\0"
+    "Driver Not Judge\0"
+    "Close(Incomplete)\0"
+    "Close(Complete)\0"
+    "Abnormal Level Lo\0"
+    "Abnormal Level Hi\0"
+    "Fully Open\0"
+    "Exhaust Exterior Valve Status (Valve 1)\0"
+    "Exhaust Exterior Valve Status (Valve 2)\0"
+    "Accel Position\0"
+    "VN Close Learn Value\0"
+    "VN Close Learn Value #2\0"
+    "VN Turbo Min Angle\0"
+    "VN Turbo Max Angle\0"
+    "Catalyst Differential Press\0"
+    "Catalyst Differential Press #2\0"
+    "Diff. Press. Sensor Corr.\0"
+    "Diff Press Sensor Corr #2\0"
+    "PM Accumulation Ratio\0"
+    "PM Accumulation Ratio #2\0"
+    "Sulfur Accumulation Ratio\0"
+    "Sulfur Accumulation Ratio #2\0"
+    "AF Sensor Learning Value\0"
+    "AF Sensor Learning Value #2\0"
+    "Exhaust Fuel Addition FB\0"
+    "Exhaust Fuel Addition FB #2\0"
+    "Standby\0"
+    "Ready\0"
+    "Operate\0"
+    "DPNR Status Reju (S)\0"
+    "DPNR/DPF Status Reju(PM)\0"
+    "Alternate Duty Ratio\0"
+    "Soot Blow Control Canceled Max Continuous Count\0"
+    "Soot Blow Control Canceled Accumulation Count\0"
+    "ACT VSV\0"
+    "Variable Intake Control VSV\0"
+    "Fuel Pressure Up VSV\0"
+    "EGR VSV\0"
+    "ACIS VSV\0"
+    "Fuel Pump Speed Control\0"
+    "Secondary Air Control VSV\0"
+    "Swirl Control Valve VSV\0"
+    "Idle Up VSV\0"
+    "Fuel Pump/Speed Status\0"
+    "Purge Cut VSV\0"
+    "A/C Magnetic Clutch Relay\0"
+    "EVAP Purge VSV\0"
+    "VVT Control Status #2\0"
+    "Intake Air Control VSV\0"
+    "VVT Control Status #1\0"
+    "Boost Pressure Control VSV\0"
+    "Exhaust Switching Control VSV\0"
+    "Exhaust Bypass Control VSV\0"
+    "Idle Fuel Cut Prohibit\0"
+    "TC and TE1\0"
+    "ACM Inhibit\0"
+    "Fuel Shutoff Valve for Delivery Pipe\0"
+    "Regulator Shut Valve\0"
+    "Fuel Pressure Status Stoichiometric\0"
+    "Fuel Pressure Status Stratification\0"
+    "HC Adsorber Catalyst Switching VSV\0"
+    "Canister Control VSV\0"
+    "Tank Bypass VSV\0"
+    "VVTL System #1\0"
+    "VVTL System #2\0"
+    "AICV VSV\0"
+    "Electric Fan Motor\0"
+    "EVAP System Vent Valve\0"
+    "Vacuum Pump\0"
+    "Starter Relay\0"
+    "ACC Relay\0"
+    "Intank Fuel Pump\0"
+    "Fuel Route Switching Valve\0"
+    "Low\0"
+    "High\0"
+    "Fuel Press Switching Valve\0"
+    "Air Pump Heater\0"
+    "Sub Fuel Tank VSV\0"
+    "CLOSE\0"
+    "OPEN\0"
+    "Brake Ejector VSV\0"
+    "EGR Cut VSV\0"
+    "Exhaust Pressure Control VSV\0"
+    "Fuel Vapor-Containment Valve\0"
+    "Fuel Filler Opener\0"
+    "Pressure Discharge Valve\0"
+    "HC Adsorber Catalyst VSV\0"
+    "Eng Oil Press Switch Valve\0"
+    "Exhaust Switching Valve\0"
+    "Fuel Return Pipe Valve\0"
+    "Coolant Water Route Switching Valve\0"
+    "ISC Duty\0"
+    "Swirl C.V. Duty Ratio\0"
+    "Tumble C.V Duty Ratio\0"
+    "ACM\0"
+    "ACIS Motor Duty\0"
+    "Resonator Mot Duty\0"
+    "VALVEMATIC Target Angle\0"
+    "Elec Water Pump Target Spd\0"
+    "Elec Water Pump Spd\0"
+    "Purge Cut VSV Duty\0"
+    "A/F Heater Duty B1S1\0"
+    "A/F Heater Duty B2S1\0"
+    "O2 Heater Curr Val B1S1\0"
+    "O2 Heater Curr Val B2S1\0"
+    "O2 Heater Curr Val B1S2\0"
+    "O2 Heater Curr Val B2S2\0"
+    "Not Act\0"
+    "Active\0"
+    "O2 Heater B2S2\0"
+    "O2 Heater B1S2\0"
+    "O2 Heater B2S1\0"
+    "O2 Heater B1S1\0"
+    "TCV Status\0"
+    "SCV Status (D4)\0"
+    "Purge Dilution Valve Duty(Bank 1)\0"
+    "Purge Dilution Valve Duty(Bank 2)\0"
+    "Fuel Pump Duty\0"
+    "VN Motor Duty\0"
+    "VN Motor Duty #2\0"
+    "Injection EDU Relay Request #2\0"
+    "Injection EDU Relay Request\0"
+    "Glow Relay Request #2\0"
+    "Glow Relay Request\0"
+    "Idle Signal Output Value #2\0"
+    "Idle Signal Output Value\0"
+    "Viscous Heater Stop Request\0"
+    "Electric Cooling Fan Low\0"
+    "Electric Cooling Fan High\0"
+    "Exhaust Fuel Addition Injector Status #2\0"
+    "Exhaust Fuel Addition Injector Status\0"
+    "Glow Control Unit Duty\0"
+    "Electric Cooling Fan Request Duty\0"
+    "Electric Cooling Fan Request Duty #2\0"
+    "A/F Heater Current Value B1S2\0"
+    "A/F Heater Duty B1S2\0"
+    "Delivery Heater Duty Ratio\0"
+    "Exhaust Exterior Valve Duty Ratio (Valve 1)\0"
+    "Exhaust Exterior Valve Duty Ratio (Valve 2)\0"
+    "Intercooler Water Pump Duty Ratio\0"
+    "Injection Volum (Cylinder1)\0"
+    "Injection Time (D4)\0"
+    "Injector (Port)\0"
+    "Total FT #1\0"
+    "Total FT #2\0"
+    "Injection Timing (D4)\0"
+    "Fuel Pump Duty (D4)\0"
+    "Fuel Pump2 Duty (D4)\0"
+    "HP FP Discharge Rate\0"
+    "HP FP Discharge Rate 2\0"
+    "Fuel Pressure Target Value\0"
+    "FC\0"
+    "Stratify\0"
+    "LeanBurn\0"
+    "Stoich1\0"
+    "Stoich2\0"
+    "Combustion Status (D4)\0"
+    "Unset\0"
+    "Port\0"
+    "Direct\0"
+    "Either\0"
+    "Injection Way\0"
+    "Injection Switching Status\0"
+    "Fuel Dilution Status\0"
+    "Alcohol Density Learning\0"
+    "High Pres FP Duty\0"
+    "Alcohol Feedback Value\0"
+    "Trip aft F/Crrctn by Stall\0"
+    "Alc FB Val bfr F/Crrctn by Stall\0"
+    "Fuel Dilution Estimate\0"
+    "Sub Injector VSV Duty\0"
+    "Sub Fuel Tank Pump Relay\0"
+    "High Fuel Pressure Sensor\0"
+    "Low Fuel Pressure Sensor\0"
+    "Distance from Injector Maintenance\0"
+    "Pilot 1 Injection Period\0"
+    "Pilot 2 Injection Period\0"
+    "Main Injection Period\0"
+    "After Injection Period\0"
+    "Pilot 1 Injection Timing\0"
+    "Pilot 2 Injection Timing\0"
+    "After Injection Timing\0"
+    "Inj Vol Feedback Learning\0"
+    "Injection Feedback Val #1\0"
+    "Injection Feedback Val #2\0"
+    "Injection Feedback Val #3\0"
+    "Injection Feedback Val #4\0"
+    "Injection Feedback Val #5\0"
+    "Injection Feedback Val #6\0"
+    "Injection Feedback Val #7\0"
+    "Injection Feedback Val #8\0"
+    "Injection Volume\0"
+    "Injection Pressure Correction\0"
+    "Inj. FB Vol. for Idle\0"
+    "Pump SCV Learning Value\0"
+    "Target Pump SCV Current\0"
+    "Pump SCV Duty Request\0"
+    "Pump SCV Status\0"
+    "Wait\0"
+    "Learn\0"
+    "Stop\0"
+    "Comple\0"
+    "Pilot Quantity Learning\0"
+    "Catalyst Pilot Quantity Learning\0"
+    "Temperature Pilot Quantity Learning\0"
+    "Actuator Pilot Quantity Learning\0"
+    "Injector Pilot Quantity Learning\0"
+    "PCV Energization Timing\0"
+    "Pump Difference Angle Learning Value\0"
+    "Pre Injection Period\0"
+    "Pre Injection Timing\0"
+    "Fuel Return Temperature\0"
+    "Injection Volume (Cylinder1)\0"
+    "Total Injection Volume\0"
+    "Injection Volume #1\0"
+    "Injection Volume #2\0"
+    "Injection Volume #3\0"
+    "Injection Volume #4\0"
+    "Fuel Pressure #1\0"
+    "Fuel Pressure #2\0"
+    "Fuel Pressure #3\0"
+    "Fuel Pressure #4\0"
+    "Fuel Temperature #1\0"
+    "Fuel Temperature #2\0"
+    "Fuel Temperature #3\0"
+    "Fuel Temperature #4\0"
+    "Throttle Sens Open Pos #1\0"
+    "Throttle Sens Open Pos #2\0"
+    "Accel Fully Close Learn #1\0"
+    "Accel Fully Close Learn #2\0"
+    "Throttle Position Command\0"
+    "Accelerator Position\0"
+    "+BM Voltage\0"
+    "Accel Sensor Out No.1\0"
+    "Throttle Position No.1\0"
+    "Throttle Position No.2\0"
+    "Throttle Require Position\0"
+    "Throttle Fully Close Learn\0"
+    "Throttle Motor Duty (Open)\0"
+    "Throttle Motor Duty (Close)\0"
+    "Throttle Motor Current\0"
+    "Throttle Step Position\0"
+    "Throttle Aim Position\0"
+    "Throttle Idle Position\0"
+    "Accelerator Idle Position\0"
+    "ST1\0"
+    "Actuator Power Supply\0"
+    "Open Side Malfunction\0"
+    "System Guard\0"
+    "Throttle Fully Close Learn Step\0"
+    "Battery Current\0"
+    "Battery Temperature\0"
+    "Alt Vol - Non Active Test\0"
+    "Alt Vol - Active Test\0"
+    "Alternator Output Duty\0"
+    "Battery Sensor Voltage\0"
+    "Middle\0"
+    "Disable\0"
+    "Auxiliary Battery Charging Rate Accuracy\0"
+    "Auxiliary Battery Status of Full Charge\0"
+    "Auxiliary Battery Dark Current\0"
+    "Auxiliary Battery Sensor Sleep Time\0"
+    "IG\0"
+    "Run\0"
+    "Stopreq\0"
+    "Restart\0"
+    "Stop&Start of Eng State\0"
+    "VVT Aim Angle #2\0"
+    "VVT OCV Duty #2\0"
+    "VVT Change Angle #2\0"
+    "VVT Ex Hold Lrn Val #1\0"
+    "VVT Ex OCV Duty #1\0"
+    "VVT Ex Chg Angle #1\0"
+    "VVT Ex Hold Lrn Val #2\0"
+    "VVT Ex OCV Duty #2\0"
+    "VVT Ex Chg Angle #2\0"
+    "VVT-iE Aim Angle #1\0"
+    "VVT-iE Aim Angle #2\0"
+    "Backward\0"
+    "VVT-iE Mot Direction #2\0"
+    "VVT-iE Mot Direction #1\0"
+    "VVT Target Angle #1\0"
+    "VVT Target Angle #2\0"
+    "VVT Ex Target Angle #1\0"
+    "VVT Ex Target Angle #2\0"
+    "VVT-iE Duty #1\0"
+    "VVT-iE Duty #2\0"
+    "Misfire RPM\0"
+    "Misfire Load\0"
+    "Cylinder #1 Misfire Count\0"
+    "Cylinder #2 Misfire Count\0"
+    "Cylinder #3 Misfire Count\0"
+    "Cylinder #4 Misfire Count\0"
+    "Cylinder #5 Misfire Count\0"
+    "Cylinder #6 Misfire Count\0"
+    "Cylinder #7 Misfire Count\0"
+    "Cylinder #8 Misfire Count\0"
+    "Cylinder #9 Misfire Count\0"
+    "Cylinder #10 Misfire Count\0"
+    "Cylinder #11 Misfire Count\0"
+    "Cylinder #12 Misfire Count\0"
+    "All Cylinders Misfire Count\0"
+    "Ignition Trig. Count\0"
+    "Multi Cylinders Misfire Count\0"
+    "Misfire Margin\0"
+    "Cat OT MF F/C Cylinder#9\0"
+    "Cat OT MF F/C Cylinder#10\0"
+    "Cat OT MF F/C Cylinder#11\0"
+    "Cat OT MF F/C Cylinder#12\0"
+    "Cat OT MF F/C Cylinder#1\0"
+    "Cat OT MF F/C Cylinder#2\0"
+    "Cat OT MF F/C Cylinder#3\0"
+    "Cat OT MF F/C Cylinder#4\0"
+    "Cat OT MF F/C Cylinder#5\0"
+    "Cat OT MF F/C Cylinder#6\0"
+    "Cat OT MF F/C Cylinder#7\0"
+    "Cat OT MF F/C Cylinder#8\0"
+    "Cat OT MF F/C History\0"
+    "Catalyst OT MF F/C\0"
+    "Vapor Pressure (Calculated)\0"
+    "Vapor Pressure Pump\0"
+    "Vapor Pressure Tank\0"
+    "EGR Step Position\0"
+    "EGR Gas Temperature\0"
+    "EGR Close Lrn. Val.\0"
+    "EGR Close Lrn. Val. #2\0"
+    "EGR Lift Sensor Volt %\0"
+    "EGR Lift Sensor Volt % #2\0"
+    "Actual EGR Valve Pos.\0"
+    "Target EGR Pos.\0"
+    "Actual EGR Valve Pos. #2\0"
+    "Target EGR Pos. #2\0"
+    "EGR Cooler Bypass VSV2\0"
+    "EGR Cooler Bypass VSV\0"
+    "EGR Operation Prohibit\0"
+    "EGR Position Sensor\0"
+    "EGR Position Sensor #2\0"
+    "EGR Motor Duty #1\0"
+    "EGR Motor Duty #2\0"
+    "Bypass\0"
+    "Half Pos\0"
+    "Cooler\0"
+    "EGR Cooler Bypass Position\0"
+    "Throttle Motor DUTY #2\0"
+    "Throttle Close Learning Val.\0"
+    "Throttle Close Learning Val.#2\0"
+    "Tank Fuel Pressure\0"
+    "Delivery Fuel Pressure\0"
+    "Tank Fuel Temperature\0"
+    "Delivery Fuel Temperature\0"
+    "Propane Ratio\0"
+    "Pre Trip Propane Ratio\0"
+    "Engine Start Waiting Time\0"
+    "Preignition F/C Detection Count #1\0"
+    "Preignition F/C Detection Count #2\0"
+    "Preignition F/C Detection Count #3\0"
+    "Preignition F/C Detection Count #4\0"
+    "No\0"
+    "Yes\0"
+    "Water Present on Ignition Plug\0"
+    "Fuel Cooler VSV\0"
+    "Compressor Oil Warning\0"
+    "Pump Previous Drive History\0"
+    "Fuel Pump2 Speed Control\0"
+    "Return Solenoid Valve\0"
+    "LPG Solenoid Valve\0"
+    "Emergency Solenoid Valve\0"
+    "Tank Fuel Pressure Sensor Voltage\0"
+    "Delivery Fuel Pressure Sensor Voltage\0"
+    "Delivery Fuel Temperature Sensor Voltage\0"
+    "Oil Separator Temperature\0"
+    "Oil Separator Temperature Sensor Voltage\0"
+    "Requested Engine Torque\0"
+    "HV Target Engine Speed\0"
+    "Actual Engine Torque\0"
+    "Request Engine Run Time\0"
+    "Judge Time Engine Ignition\0"
+    "Judge Time Engine Output\0"
+    "ISC Learning Value\0"
+    "Empty\0"
+    "Not Emp\0"
+    "Fuel Level\0"
+    "ISC Learning\0"
+    "F/C for Engine Stop Req\0"
+    "Not Opr\0"
+    "Engine Independent\0"
+    "Racing Operation\0"
+    "Not Req\0"
+    "Request\0"
+    "Request Warm-up\0"
+    "Engine Independent Control\0"
+    "AF Sensor Learning Value B1S2\0"
+    "Reductant Level\0"
+    "Reductant Temperature\0"
+    "Reductant Pressure\0"
+    "Reductant Pump Speed\0"
+    "-\0"
+    "Mode3\0"
+    "Reductant Injection Mode\0"
+    "Reductant Injection Value\0"
+    "Engine Exhaust NOx Density\0"
+    "SCR Temperature\0"
+    "Catalyst Thermal Degradation Count\0"
+    "NOx Sensor Carrying Request\0"
+    "Fr-NOx Sensor Carrying Request\0"
+    "Fr-NOx Sensor Active Status\0"
+    "Reductant Pipe Heater\0"
+    "Reductant Tank Heater\0"
+    "NOx Sensor Active Status\0"
+    "SCR NOx Purge High Efficiency Temp\0"
+    "Reductant Injection Value Restraint Control\0"
+    "NOx Sensor Cooling Time\0"
+    "Fr-NOx Sensor Cooling Time\0"
+    "Reductant Replenishment Possible Value\0"
+    "Caution\0"
+    "Warning\0"
+    "Danger\0"
+    "Status of NOx Reduction Efficiency\0"
+    "Not Detected\0"
+    "Abnormal(Open)\0"
+    "Unknown\0"
+    "Status of Fr-NOx Sensor Lambda Detection Unit\0"
+    "Status of Fr-NOx Sensor NOx Detection Unit\0"
+    "Abnormal(GND Short)\0"
+    "Abnormal(BATT Short)\0"
+    "Status of Fr-NOx Sensor\0"
+    "Status of Fr-NOx Sensor Heater\0"
+    "Fr-NOx Sensor NOx Active Status (SCU)\0"
+    "Fr-NOx Sensor A/F Active Status (SCU)\0"
+    "Control\0"
+    "OBD\0"
+    "Fr-NOx Sensor Status Information\0"
+    "Abnormal\0"
+    "Status of Fr-NOx Sensor Power Supply Voltage\0"
+    "Status of NOx Sensor Lambda Detection Unit\0"
+    "Status of NOx Sensor NOx Detection Unit\0"
+    "Status of NOx Sensor\0"
+    "Status of NOx Sensor Heater\0"
+    "NOx Sensor NOx Active Status (SCU)\0"
+    "NOx Sensor A/F Active Status (SCU)\0"
+    "NOx Sensor Status Information\0"
+    "Status of NOx Sensor Power Supply Voltage\0"
+    "PM Sensor Heater Duty\0"
+    "PM Sensor Power Supply Voltage\0"
+    "PM Sensor Output Current\0"
+    "PM Sensor Maximum Current Value\0"
+    "PM Sensor Element Temperature\0"
+    "Diagnosis Not Tested\0"
+    "Diagnosis Tested\0"
+    "Status of PM Sensor IDE Diagnosis (+ Side)\0"
+    "No Error Detected\0"
+    "Error Detected\0"
+    "Status of PM Sensor IDE (+ Side)\0"
+    "Status of PM Sensor Heater\0"
+    "Status of PM Sensor Heater Diagnosis\0"
+    "Status of PM Sensor IDE\0"
+    "Status of PM Sensor IDE Diagnosis\0"
+    "Status of PM Sensor IDE Circuit\0"
+    "Status of PM Sensor IDE Circuit Diagnosis\0"
+    "Conditions Not Given\0"
+    "Conditions Given\0"
+    "PM Sensor Clogged Diagnosis\0"
+    "SCU Not Ready\0"
+    "SCU Ready\0"
+    "Status of PM Sensor SCU Operation\0"
+    "Sensor Values\0"
+    "Initial Values\0"
+    "Status of PM Sensor SCU Output Data\0"
+    "Measurement Not Active\0"
+    "Measurement Active\0"
+    "Status of PM Sensor Measurement\0"
+    "Status of PM Sensor IDE (- Side)\0"
+    "Status of PM Sensor Temperature\0"
+    "Regeneration Not Active\0"
+    "Regeneration Active\0"
+    "Status of PM Sensor Rejuvenate\0"
+    "Status of PM Sensor Rejuvenate Finish\0"
+    "Status of PM Sensor Heater OFF Malfunction\0"
+    "Status of PM Sensor Heater ON Diagnosis\0"
+    "Status of PM Sensor Heater ON Malfunction\0"
+    "Status of PM Sensor Engine Operation\0"
+    "Status of PM Sensor Carrying Request\0"
+    "Status of PM Sensor Self Diagnosis Clear\0"
+    "Status of PM Sensor Measurement Request\0"
+    "Not Failure Mode\0"
+    "Failure Mode\0"
+    "Status of PM Sensor Malfunction\0"
+    "Status of IG Switch Terminal Low Voltage Guard Determination\0"
+    "Status of STA Terminal Low Voltage Guard Determination\0"
+    "Status of +B Terminal Low Voltage Guard Determination\0"
+    "Status of WI Terminal Low Voltage Guard Determination\0"
+    "Status of Ready\0"
+    "Status of IG Switch\0"
+    "Status of Engine Start\0"
+    "Soak Timer Start Request\0"
+    "Status of Soak Timer Start\0"
+    "Soak IC Current Timer Value\0"
+    "Soak Timer Clear\0"
+    "Soak Timer Start History\0"
+    "0\0"
+    "Soak IC First Start Time\0"
+    "Main Relay ON Time after IG OFF\0"
+    "Main Relay ON Time after IG OFF of Previous Trip\0"
+    "Main Relay ON Time after Soak Start of Previous Trip\0"
+    "Soak Start Count\0"
+    "Engine Starting Time\0"
+    "Engine Speed (Starter Off)\0"
+    "Starter Count\0"
+    "Run Dist of Previous Trip\0"
+    "Previous Trip Coolant Temp\0"
+    "Previous Trip Intake Temp\0"
+    "Engine Oil Temperature\0"
+    "Previous Trip Eng Oil Temp\0"
+    "Ambient Temp for A/C\0"
+    "Previous Trip Ambient Temp\0"
+    "Throttle Position\0"
+    "ISC Flow\0"
+    "ISC Position\0"
+    "ISC Feedback Value\0"
+    "Electric Load Feedback Val\0"
+    "Electric Duty Feedback Value\0"
+    "Air Conditioner FB Val\0"
+    "A/C Duty Feedback Value\0"
+    "PS Feedback Val\0"
+    "PS Duty Feedback Value\0"
+    "Idle Injection Volume (Min)\0"
+    "Pre Glow\0"
+    "After Glow\0"
+    "Engine Start Hesitation\0"
+    "Low Rev for Eng Start\0"
+    "VVT Advance Fail\0"
+    "Low Revolution Control\0"
+    "Neutral Control\0"
+    "N Range Status\0"
+    "Fuel Cut Bank 2 for Idle\0"
+    "Immobiliser Fuel Cut History\0"
+    "Immobiliser Fuel Cut\0"
+    "0_NG\0"
+    "1_No Mal\0"
+    "2_Auto Mode\0"
+    "3_Temp OK\0"
+    "4_Postulate\0"
+    "5_Other Sys OK\0"
+    "6_Idle OK\0"
+    "7_ASG OK\0"
+    "8_CAT OK\0"
+    "9_FC OK\0"
+    "Fuel Cut Info Bank 2 for Idle\0"
+    "ISC Feedback Learning Torque\0"
+    "ISC Total AUXS Torque\0"
+    "ISC Feedback Torque\0"
+    "ISC Feedback Torque(Recent)\0"
+    "ISC AUXS Torque(Alternator)\0"
+    "ISC AUXS Torque(Air Conditioner)\0"
+    "Throttle Air Flow F/B Value\0"
+    "IG-ON Time\0"
+    "Glow Request Lighting Time\0"
+    "Idle Spark Advn Ctrl #1\0"
+    "Idle Spark Advn Ctrl #2\0"
+    "Idle Spark Advn Ctrl #3\0"
+    "Idle Spark Advn Ctrl #4\0"
+    "Idle Spark Advn Ctrl #5\0"
+    "Idle Spark Advn Ctrl #6\0"
+    "Idle Spark Advn Ctrl #7\0"
+    "Idle Spark Advn Ctrl #8\0"
+    "Idle Spark Advn Ctrl #9\0"
+    "Idle Spark Advn Ctrl #10\0"
+    "Idle Spark Advn Ctrl #11\0"
+    "Idle Spark Advn Ctrl #12\0"
+    "Minimum Engine Speed\0"
+    "Eng Stall Control FB Flow\0"
+    "Deposit Loss Flow\0"
+    "Fuel Cut Elps Time\0"
+    "Rough Idle #8\0"
+    "Rough Idle #7\0"
+    "Rough Idle #6\0"
+    "Rough Idle #5\0"
+    "Rough Idle #4\0"
+    "Rough Idle #3\0"
+    "Rough Idle #2\0"
+    "Rough Idle #1\0"
+    "Engine Coolant Temp High\0"
+    "Common Rail Pressure Low\0"
+    "Boost Pressure Low\0"
+    "MAF Low\0"
+    "MAF/Estimate MAF Ratio\0"
+    "Target Idle Engine Speed\0"
+    "Throttle Air Flow Learning Value(Area 1)\0"
+    "Throttle Air Flow Learning Value(Area 2)\0"
+    "Throttle Air Flow Learning Value(Area 3)\0"
+    "Throttle Air Flow Learning Value(Calculated Value)\0"
+    "Throttle Air Flow Learning Value(Atmosphere Pressure Offset Value)\0"
+    "Throttle Air Flow Learning Prohibit(Air Fuel Ratio Malfunction)\0"
+    "Throttle Air Flow Learning Prohibit(Intake Air Pressure Malfunction)\0"
+    "Heated Injector System Circuit Relay Fixed ON\0"
+    "HICM FET Fixed\0"
+    "HICM Electric System Sensor\0"
+    "HICM Main Microcomputer Status\0"
+    "HICM Voltage Status\0"
+    "HICM-ECU Data Update Status\0"
+    "HICM FET Overtemperature\0"
+    "HICM-ECU Communication Status\0"
+    "Injector Heater Open #1\0"
+    "Injector Heater Open #2\0"
+    "Injector Heater Open #3\0"
+    "Injector Heater Open #4\0"
+    "Injector Heater GND Short #1\0"
+    "Injector Heater GND Short #2\0"
+    "Injector Heater GND Short #3\0"
+    "Injector Heater GND Short #4\0"
+    "Injector Heater Battery Short #1\0"
+    "Injector Heater Battery Short #2\0"
+    "Injector Heater Battery Short #3\0"
+    "Injector Heater Battery Short #4\0"
+    "Injector Heater Resistance Value #1\0"
+    "Injector Heater Resistance Value #2\0"
+    "Injector Heater Resistance Value #3\0"
+    "Injector Heater Resistance Value #4\0"
+    "i-ART Learning Status #1\0"
+    "i-ART Learning Status #2\0"
+    "i-ART Learning Status #3\0"
+    "i-ART Learning Status #4\0"
+    "Injector Leaking Count #1\0"
+    "Injector Leaking Count #2\0"
+    "Injector Leaking Count #3\0"
+    "Injector Leaking Count #4\0"
+    "i-ART Learning Status History #1\0"
+    "i-ART Learning Status History #2\0"
+    "i-ART Learning Status History #3\0"
+    "i-ART Learning Status History #4\0"
+    "Plural Cylinders Rough Idle\0"
+    "Compression Leakage Count\0"
+    "Misfire\0"
+    "Continuous poor combustion\0"
+    "Intermittent poor combustion\0"
+    "Low frequency poor combustion\0"
+    "Rough Idle Status\0"
+    "EGR Rate Differential(Actual-Target)\0"
+    "Electric Cooling Fan Drive Count when IG OFF\0"
+    "Time after Shift Change\0"
+    "Engine Speed of Cyl #1\0"
+    "Engine Speed of Cyl #2\0"
+    "Engine Speed of Cyl #3\0"
+    "Engine Speed of Cyl #4\0"
+    "Engine Speed of Cyl #5\0"
+    "Engine Speed of Cyl #6\0"
+    "Engine Speed of Cyl #7\0"
+    "Engine Speed of Cyl #8\0"
+    "Engine Speed of Cyl #9\0"
+    "Engine Speed of Cyl #10\0"
+    "Engine Speed of Cyl #11\0"
+    "Engine Speed of Cyl #12\0"
+    "Av Engine Speed of All Cyl\0"
+    "A/F Learn Value Idle #1\0"
+    "A/F Learn Value Low #1\0"
+    "A/F Learn Value Mid1 #1\0"
+    "A/F Learn Value Mid2 #1\0"
+    "A/F Learn Value Mid3 #1\0"
+    "A/F Learn Value High #1\0"
+    "A/F Learn Val Low #1 (Dual)\0"
+    "A/F Learn Val Mid1 #1 (Dual)\0"
+    "A/F Learn Val Mid2 #1 (Dual)\0"
+    "A/F Learn Val High #1 (Dual)\0"
+    "A/F Learn Value Idle #2\0"
+    "A/F Learn Value Low #2\0"
+    "A/F Learn Value Mid1 #2\0"
+    "A/F Learn Value Mid2 #2\0"
+    "A/F Learn Value High #2\0"
+    "A/F Learn Val Low #2 (Dual)\0"
+    "A/F Learn Val Mid1 #2 (Dual)\0"
+    "A/F Learn Val Mid2 #2 (Dual)\0"
+    "A/F Learn Val High #2 (Dual)\0"
+    "Maximum Engine Speed\0"
+    "Vehicle Speed for Maximum Engine Speed\0"
+    "Red Zone Duration Time\0"
+    "Red Zone Count\0"
+    "Maximum Vehicle Speed\0"
+    "A/F Sensor Determination (worst value) #1\0"
+    "A/F Sensor Determination (worst value) #2\0"
+    "Engine Speed Fluctuation Avg (worst value) #1\0"
+    "Engine Speed Fluctuation Avg (worst value) #2\0"
+    "Engine Speed Fluctuation Avg (worst value) #3\0"
+    "Engine Speed Fluctuation Avg (worst value) #4\0"
+    "Engine Speed Fluctuation Avg (worst value) #5\0"
+    "Engine Speed Fluctuation Avg (worst value) #6\0"
+    "Engine Speed Fluctuation Avg (worst value) #7\0"
+    "Engine Speed Fluctuation Avg (worst value) #8\0"
+    "A/F Sensor Determination (worst value) (Port) #1\0"
+    "A/F Sensor Determination (worst value) (Port) #2\0"
+    "Engine Speed Fluctuation Avg (worst value) (Port) #1\0"
+    "Engine Speed Fluctuation Avg (worst value) (Port) #2\0"
+    "Engine Speed Fluctuation Avg (worst value) (Port) #3\0"
+    "Engine Speed Fluctuation Avg (worst value) (Port) #4\0"
+    "Engine Speed Fluctuation Avg (worst value) (Port) #5\0"
+    "Engine Speed Fluctuation Avg (worst value) (Port) #6\0"
+    "Engine Speed Fluctuation Avg (worst value) (Port) #7\0"
+    "Engine Speed Fluctuation Avg (worst value) (Port) #8\0"
+    "GPF Clogged Determination Threshold Bank1\0"
+    "GPF Clogged Determination Threshold Bank2\0"
+    "GPF Steady Differential Pressure Average Bank1\0"
+    "GPF Steady Differential Pressure Average Bank2\0"
+    "GPF Steady Air Flow Average Bank1\0"
+    "GPF Steady Air Flow Average Bank2\0"
+    "GPF Differential Pressure Offset Bank1\0"
+    "GPF Differential Pressure Offset Bank2\0"
+    "GPF Variance Determination Threshold Bank1\0"
+    "GPF Variance Determination Threshold Bank2\0"
+    "GPF Variance Bank1\0"
+    "GPF Variance Bank2\0"
+    "PM Deposition Ratio Bank1\0"
+    "PM Deposition Ratio Bank2\0"
+    "Ash Deposition Ratio Bank1\0"
+    "Ash Deposition Ratio Bank2\0"
+    "Differential Pressure Sensor Learning Value Bank 1\0"
+    "Differential Pressure Sensor Learning Value Bank 2\0"
+    "Rear Catalyst Estimate Temperature\0"
+    "NT Sensor Voltage\0"
+    "NC Sensor Voltage\0"
+    "SPD (NC0)\0"
+    "NC0 Sensor Voltage\0"
+    "SPD (NC2)\0"
+    "NC2 Sensor Voltage\0"
+    "SPD (NC3)\0"
+    "NC3 Sensor Voltage\0"
+    "SPD (NIN)\0"
+    "NIN Sensor Voltage\0"
+    "SPD (NOUT)\0"
+    "NOUT Sensor Voltage\0"
+    "SP2 Sensor Voltage\0"
+    "SPD (NIM)\0"
+    "NIM Sensor Voltage\0"
+    "A/T Oil Temperature 1\0"
+    "A/T Oil Temperature 2\0"
+    "A/T Oil Temperature 3\0"
+    "A/T Oil Pressure\0"
+    "G Sensor\0"
+    "Clutch Stroke Position\0"
+    "Clutch Stroke Sensor Voltage\0"
+    "Type A\0"
+    "Type B\0"
+    "iMT Type\0"
+    "Torque Converter Temperature Raise History\0"
+    "S-mode\0"
+    "M-mode\0"
+    "Shift Control Mode\0"
+    "MT Down Shift Indication\0"
+    "MT Up Shift Indication\0"
+    "Incomplete\0"
+    "Complete\0"
+    "G Sensor Calibration\0"
+    "Incmp\0"
+    "CVT Oil Press Calibration\0"
+    "G Sensor Learning Value\0"
+    "Snow\0"
+    "Sand\0"
+    "Climb\0"
+    "Mogul\0"
+    "Rock\0"
+    "Off-road Guidance Status\0"
+    "ATF Thermal Degradation Estimate\0"
+    "Green\0"
+    "Yellow\0"
+    "iMT Telltale\0"
+    "9th\0"
+    "10th\0"
+    "Shift Range Indicator\0"
+    "Shift Status\0"
+    "Solenoid(SC)\0"
+    "SL Solenoid Status\0"
+    "ST Solenoid Status\0"
+    "Lock Up\0"
+    "Solenoid(SLP)\0"
+    "SLN Solenoid Status\0"
+    "SLU Solenoid Status\0"
+    "SLT Solenoid Status\0"
+    "Solenoid (SLC)\0"
+    "Solenoid (SLS)\0"
+    "DSL Solenoid Status\0"
+    "Solenoid (DSU)\0"
+    "Solenoid (DS2)\0"
+    "Solenoid (DS1)\0"
+    "CVT Shift Status Ratio\0"
+    "Model Code\0"
+    "Engine Type\0"
+    "Cylinder Number\0"
+    "MT\0"
+    "ECT 4th\0"
+    "ECT 5th\0"
+    "ECT 6th\0"
+    "CVT\0"
+    "MMT(5th)\0"
+    "MMT(6th)\0"
+    "ECT 8th\0"
+    "Transmission Type\0"
+    "Destination\0"
+    "Model Year\0"
+    "CNG/LPG\0"
+    "Gasoline&CNG/LPG\0"
+    "ECO\0"
+    "Diesel&ECO\0"
+    "CNG/LPG&ECO\0"
+    "MHV\0"
+    "HV\0"
+    "System Identification\0"
+    "ECT 10th\0"
+    "ASG\0"
+    "Transmission Type2\0"
+    "# Codes(Include History)\0"
+    "OXS1 (A/FS2) Test Result\0"
+    "OXS2 (A/FS2) Test Result\0"
+    "Misfire Test Result\0"
+    "AS Test Result\0"
+    "NSW Test Result\0"
+    "SPD Test Result\0"
+    "Misfire Test Result(CNG)\0"
+    "Check Mode\0"
+    "A/F Test Results #1\0"
+    "A/F Test Results #2\0"
+    "O2 HCAC #1 Test Result\0"
+    "O2 HCAC #2 Test Result\0"
+    "HC Adsorber Ex Temp B1S1\0"
+    "HC Adsorber Ex Temp B2S1\0"
+    "HC Adsorber Ex Temp B1S2\0"
+    "HC Adsorber Ex Temp B2S2\0"
+    "HC Adsorber Catalyst Test\0"
+    "Exhaust Temperature B1S1 Test Result\0"
+    "Exhaust Temperature B1S2 Test Result\0"
+    "Exhaust Temperature B1S3 Test Result\0"
+    "Exhaust Temperature B1S4 Test Result\0";
+
+// 87 distinct value tables
+inline constexpr uint16_t UDS_ENUM_DISPLAY[] = {
+    0, // without
+    8, // with
+    41, // OFF
+    45, // ON
+    111, // NOT Avail
+    121, // Available
+    UDS_STRING_NONE,
+    715, // Normal
+    722, // Replace
+    UDS_STRING_NONE,
+    752, // Shipping (Disable)
+    771, // Shipping (Enable)
+    789, // Full Services
+    803, // Full Services and F&I Service
+    833, // eCall only
+    910, // Low(0)
+    917, // High(1)
+    1110, // Forward
+    1118, // Back
+    2538, // Unsupp
+    2545, // Supp
+    3354, // Unused
+    3361, // OL
+    3364, // CL
+    UDS_STRING_NONE,
+    3367, // OLDrive
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    3375, // OLFault
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    3383, // CLFault
+    UDS_STRING_NONE,
+    3630, // Gasoline/petrol
+    3646, // Methanol
+    3655, // Ethanol
+    3663, // Diesel
+    3670, // Liquefied Petroleum Gas (LPG) LPG
+    3704, // Compressed Natural Gas (CNG) CNG
+    3737, // Propane
+    3745, // Battery/electric
+    3762, // Bi-fuel vehicle using gasoline
+    3793, // Bi-fuel vehicle using methanol
+    3824, // Bi-fuel vehicle using ethanol
+    3854, // Bi-fuel vehicle using LPG
+    3880, // Bi-fuel vehicle using CNG
+    3906, // Bi-fuel vehicle using propane
+    3936, // Bi-fuel vehicle using battery
+    3966, // Bi-fuel vehicle using battery and combustion engine
+    4018, // Hybrid vehicle using gasoline engine
+    4055, // Hybrid vehicle using gasoline engine on ethanol
+    4103, // Hybrid vehicle using diesel engine
+    4138, // Hybrid vehicle using battery
+    4167, // Hybrid vehicle using battery and combustion engine
+    4218, // Hybrid vehicle in regeneration mode
+    UDS_STRING_NONE,
+    4254, // Bi-fuel vehicle using Natural Gas
+    4288, // Bi-fuel vehicle using diesel
+    4317, // Natural Gas (Compressed or Liquefied Natural Gas)
+    4367, // Dual Fuel - Diesel and CNG
+    4394, // Dual Fuel - Diesel and LNG
+    4421, // Fuel Cell Utilizing Hydrogen
+    4450, // Hydrogen Internal Combustion Engine
+    45, // ON
+    41, // OFF
+    6586, // Not Avl
+    6594, // Avail
+    6659, // Compl
+    6665, // Incmpl
+    UDS_STRING_NONE,
+    6840, // OBD II (California ARB)
+    6864, // OBD (US Federal EPA)
+    6885, // OBD and OBD II
+    6900, // OBD I
+    6906, // Not OBD compliant
+    6924, // EOBD (Euro OBD)
+    6940, // EOBD and OBD II
+    6956, // EOBD and OBD
+    6969, // "EOBD
+    6975, // JOBD (Japan OBD)
+    6992, // JOBD and OBD II
+    7008, // JOBD and EOBD
+    7022, // "JOBD
+    7028, // EURO 4
+    7035, // EURO 5
+    UDS_STRING_NONE,
+    7042, // Engine Manufacturer Diagnostics (EMD)
+    7080, // Engine Manufacturer Diagnostics Enhanced (EMD+)
+    7128, // Heavy Duty On-Board Diagnostics (Child/Partial)
+    7176, // Heavy Duty On-Board Diagnostics
+    7208, // World Wide Harmonized OBD
+    UDS_STRING_NONE,
+    7234, // Heavy Duty Euro OBD Stage I without NOx control
+    7282, // Heavy Duty Euro OBD Stage I with NOx control
+    7327, // Heavy Duty Euro OBD Stage II without NOx control
+    7376, // Heavy Duty Euro OBD Stage II with NOx control
+    UDS_STRING_NONE,
+    7422, // Brazil OBD Phase 1
+    7441, // Brazil OBD Phase 2
+    7460, // Korean OBD
+    7471, // India OBD I
+    7483, // India OBD II
+    7496, // Heavy Duty Euro OBD Stage VI
+    7525, // "OBD
+    7530, // Brazil OBD Phase 3
+    7549, // "Motorcycle
+    7549, // "Motorcycle
+    7549, // "Motorcycle
+    7549, // "Motorcycle
+    7549, // "Motorcycle
+    7561, // China Nationwide Stage 6
+    7586, // Brazil OBD Diesel
+    7641, // Unable
+    7648, // Enable
+    41, // OFF
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    45, // ON
+    9414, // 1st
+    9418, // 2nd
+    9422, // 3rd
+    9426, // 4th
+    9430, // 5th
+    9434, // 6th
+    9438, // 7th
+    9442, // 8th
+    6586, // Not Avl
+    9550, // Commo
+    9556, // Vacuum
+    9563, // CAN Com
+    9571, // DC
+    9588, // No Comm
+    9596, // Comm
+    9918, // Gasoline
+    9927, // CNG
+    9966, // Close
+    9972, // Open
+    7641, // Unable
+    10786, // Able
+    41, // OFF
+    45, // ON
+    45, // ON
+    10980, // NA
+    45, // ON
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    41, // OFF
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    41, // OFF
+    41, // OFF
+    41, // OFF
+    UDS_STRING_NONE,
+    41, // OFF
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    41, // OFF
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    41, // OFF
+    41, // OFF
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    45, // ON
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    41, // OFF
+    41, // OFF
+    41, // OFF
+    UDS_STRING_NONE,
+    41, // OFF
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    41, // OFF
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    41, // OFF
+    41, // OFF
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    41, // OFF
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    45, // ON
+    41, // OFF
+    41, // OFF
+    UDS_STRING_NONE,
+    41, // OFF
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    41, // OFF
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    41, // OFF
+    41, // OFF
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    41, // OFF
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    41, // OFF
+    45, // ON
+    41, // OFF
+    UDS_STRING_NONE,
+    41, // OFF
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    41, // OFF
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    41, // OFF
+    41, // OFF
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    41, // OFF
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    41, // OFF
+    41, // OFF
+    45, // ON
+    UDS_STRING_NONE,
+    41, // OFF
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    41, // OFF
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    41, // OFF
+    41, // OFF
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    41, // OFF
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    41, // OFF
+    41, // OFF
+    41, // OFF
+    UDS_STRING_NONE,
+    45, // ON
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    41, // OFF
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    41, // OFF
+    41, // OFF
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    41, // OFF
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    41, // OFF
+    41, // OFF
+    41, // OFF
+    UDS_STRING_NONE,
+    41, // OFF
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    45, // ON
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    41, // OFF
+    41, // OFF
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    41, // OFF
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    41, // OFF
+    41, // OFF
+    41, // OFF
+    UDS_STRING_NONE,
+    41, // OFF
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    41, // OFF
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    45, // ON
+    13891, // NG
+    13894, // OK
+    13997, // READY
+    14003, // NOT RDY
+    14435, // Driver Not Judge
+    14452, // Close(Incomplete)
+    14470, // Close(Complete)
+    14486, // Abnormal Level Lo
+    14504, // Abnormal Level Hi
+    14522, // Fully Open
+    15030, // Standby
+    15038, // Ready
+    15044, // Operate
+    6659, // Compl
+    16011, // Low
+    16015, // High
+    16081, // CLOSE
+    16087, // OPEN
+    9972, // Open
+    9966, // Close
+    16679, // Not Act
+    16687, // Active
+    17722, // FC
+    17725, // Stratify
+    17734, // LeanBurn
+    17743, // Stoich1
+    17751, // Stoich2
+    17782, // Unset
+    17788, // Port
+    17793, // Direct
+    17800, // Either
+    15030, // Standby
+    18708, // Wait
+    18713, // Learn
+    UDS_STRING_NONE,
+    18719, // Stop
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    18724, // Comple
+    15038, // Ready
+    13891, // NG
+    16011, // Low
+    19978, // Middle
+    16015, // High
+    19985, // Disable
+    20141, // IG
+    20144, // Run
+    20148, // Stopreq
+    18719, // Stop
+    20156, // Restart
+    20405, // Backward
+    1110, // Forward
+    13894, // OK
+    13891, // NG
+    41, // OFF
+    21783, // Bypass
+    21790, // Half Pos
+    21799, // Cooler
+    22209, // No
+    22212, // Yes
+    22748, // Empty
+    22754, // Not Emp
+    6665, // Incmpl
+    6659, // Compl
+    22810, // Not Opr
+    15044, // Operate
+    22854, // Not Req
+    22862, // Request
+    23021, // -
+    23021, // -
+    23021, // -
+    23023, // Mode3
+    715, // Normal
+    23483, // Caution
+    23491, // Warning
+    23499, // Danger
+    23541, // Not Detected
+    715, // Normal
+    23554, // Abnormal(Open)
+    23569, // Unknown
+    23541, // Not Detected
+    715, // Normal
+    23666, // Abnormal(GND Short)
+    23686, // Abnormal(BATT Short)
+    23554, // Abnormal(Open)
+    3354, // Unused
+    41, // OFF
+    45, // ON
+    3354, // Unused
+    23838, // Control
+    15030, // Standby
+    23846, // OBD
+    23541, // Not Detected
+    715, // Normal
+    23883, // Abnormal
+    24351, // Diagnosis Not Tested
+    24372, // Diagnosis Tested
+    24432, // No Error Detected
+    24450, // Error Detected
+    24694, // Conditions Not Given
+    24715, // Conditions Given
+    24760, // SCU Not Ready
+    24774, // SCU Ready
+    24818, // Sensor Values
+    24832, // Initial Values
+    24883, // Measurement Not Active
+    24906, // Measurement Active
+    25022, // Regeneration Not Active
+    25046, // Regeneration Active
+    25415, // Not Failure Mode
+    25432, // Failure Mode
+    23569, // Unknown
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    41, // OFF
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    45, // ON
+    25882, // 0
+    23569, // Unknown
+    26740, // 0_NG
+    26745, // 1_No Mal
+    26754, // 2_Auto Mode
+    26766, // 3_Temp OK
+    26776, // 4_Postulate
+    26788, // 5_Other Sys OK
+    26803, // 6_Idle OK
+    26813, // 7_ASG OK
+    26822, // 8_CAT OK
+    26831, // 9_FC OK
+    715, // Normal
+    23883, // Abnormal
+    715, // Normal
+    16015, // High
+    16011, // Low
+    23569, // Unknown
+    23541, // Not Detected
+    41, // OFF
+    45, // ON
+    45, // ON
+    23541, // Not Detected
+    715, // Normal
+    23883, // Abnormal
+    23883, // Abnormal
+    715, // Normal
+    29182, // Misfire
+    29190, // Continuous poor combustion
+    29217, // Intermittent poor combustion
+    29246, // Low frequency poor combustion
+    32358, // Type A
+    32365, // Type B
+    32424, // S-mode
+    32431, // M-mode
+    32505, // Incomplete
+    32516, // Complete
+    32546, // Incmp
+    6659, // Compl
+    41, // OFF
+    32602, // Snow
+    32607, // Sand
+    32612, // Climb
+    32618, // Mogul
+    32624, // Rock
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    17782, // Unset
+    41, // OFF
+    32687, // Green
+    UDS_STRING_NONE,
+    32693, // Yellow
+    41, // OFF
+    9414, // 1st
+    9418, // 2nd
+    9422, // 3rd
+    9426, // 4th
+    9430, // 5th
+    9434, // 6th
+    9438, // 7th
+    9442, // 8th
+    32713, // 9th
+    32717, // 10th
+    UDS_STRING_NONE,
+    9414, // 1st
+    9418, // 2nd
+    9422, // 3rd
+    9426, // 4th
+    9430, // 5th
+    9434, // 6th
+    9438, // 7th
+    9442, // 8th
+    10980, // NA
+    33047, // MT
+    33050, // ECT 4th
+    UDS_STRING_NONE,
+    33058, // ECT 5th
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    33066, // ECT 6th
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    33074, // CVT
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    33078, // MMT(5th)
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    33087, // MMT(6th)
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    33096, // ECT 8th
+    UDS_STRING_NONE,
+    9918, // Gasoline
+    3663, // Diesel
+    UDS_STRING_NONE,
+    33145, // CNG/LPG
+    33153, // Gasoline&CNG/LPG
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    33170, // ECO
+    33170, // ECO
+    33174, // Diesel&ECO
+    UDS_STRING_NONE,
+    33185, // CNG/LPG&ECO
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    33197, // MHV
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    33201, // HV
+    33201, // HV
+    10980, // NA
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    33226, // ECT 10th
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    UDS_STRING_NONE,
+    33235, // ASG
+};
+
+inline constexpr UdsDefinition UDS_DEFINITIONS[] = {
+    { 0x0C7, 0x21, 0, 0, 0, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 13, 0, 2 }, // Current Com Back-Up Battery
+    { 0x0C7, 0x21, 0, 0, 1, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 48, 2, 2 }, // Emergency Switch
+    { 0x0C7, 0x22, 0, 0, 0, 8, ByteOrder::Motorola, false, true, 1.0f, 0.0f, 65, 0, 0 }, // VIN
+    { 0x0C7, 0x23, 0, 0, 0, 8, ByteOrder::Motorola, false, true, 1.0f, 0.0f, 69, 0, 0 }, // MIN
+    { 0x0C7, 0x24, 0, 0, 0, 8, ByteOrder::Motorola, false, true, 1.0f, 0.0f, 73, 0, 0 }, // MDN
+    { 0x0C7, 0x25, 0, 0, 0, 8, ByteOrder::Motorola, false, true, 1.0f, 0.0f, 77, 0, 0 }, // SIMRAV ID High
+    { 0x0C7, 0x25, 0, 1, 0, 8, ByteOrder::Motorola, false, true, 1.0f, 0.0f, 92, 0, 0 }, // MEID
+    { 0x0C7, 0x25, 0, 10, 0, 8, ByteOrder::Motorola, false, true, 1.0f, 0.0f, 97, 0, 0 }, // SIMRAV ID Low
+    { 0x0C7, 0x2B, 0, 0, 0, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 131, 4, 2 }, // Remote Warning
+    { 0x0C7, 0x2B, 0, 0, 1, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 146, 4, 2 }, // Remote Detected DTC
+    { 0x0C7, 0x2B, 0, 0, 2, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 166, 4, 2 }, // Remote FFD
+    { 0x0C7, 0x2B, 0, 0, 3, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 177, 4, 2 }, // Remote Detect DTC
+    { 0x0C7, 0x2B, 0, 0, 4, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 195, 4, 2 }, // Remote Vehicle Status
+    { 0x0C7, 0x2B, 0, 0, 5, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 217, 4, 2 }, // Remote Precaution
+    { 0x0C7, 0x2B, 0, 0, 6, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 235, 4, 2 }, // Remote Monitoring
+    { 0x0C7, 0x2B, 0, 0, 7, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 253, 4, 2 }, // Remote DTC Recorder
+    { 0x0C7, 0x2B, 0, 1, 0, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 273, 4, 2 }, // Remote Alarm Detect
+    { 0x0C7, 0x2B, 0, 1, 1, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 293, 4, 2 }, // Remote Operation
+    { 0x0C7, 0x2B, 0, 1, 2, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 310, 4, 2 }, // Remote Immobiliser
+    { 0x0C7, 0x2B, 0, 1, 3, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 329, 4, 2 }, // Remote Vehicle Control History
+    { 0x0C7, 0x2B, 0, 1, 4, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 360, 4, 2 }, // Maintenance Message
+    { 0x0C7, 0x2B, 0, 1, 5, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 380, 4, 2 }, // Remote Vehicle Location
+    { 0x0C7, 0x2B, 0, 1, 6, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 404, 4, 2 }, // Remote Navigation Display
+    { 0x0C7, 0x2B, 0, 1, 7, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 430, 4, 2 }, // Remote Guest Driver Status
+    { 0x0C7, 0x2B, 0, 2, 0, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 457, 4, 2 }, // Remote A/C by Smart Key
+    { 0x0C7, 0x2B, 0, 2, 1, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 481, 4, 2 }, // eConnect State Notification
+    { 0x0C7, 0x2B, 0, 2, 2, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 509, 4, 2 }, // eConnect Event Notification
+    { 0x0C7, 0x2B, 0, 2, 3, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 537, 4, 2 }, // eConnect State Change Notification
+    { 0x0C7, 0x2B, 0, 2, 4, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 572, 4, 2 }, // eConnect Remote Operation
+    { 0x0C7, 0x2B, 0, 2, 5, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 598, 4, 2 }, // Driving Trip Data Notification
+    { 0x0C7, 0x2B, 0, 2, 6, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 629, 4, 2 }, // eConnect Remote Vehicle Location
+    { 0x0C7, 0x2B, 0, 2, 7, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 662, 4, 2 }, // Remote Service Function
+    { 0x0C7, 0x2F, 0, 0, 0, 8, ByteOrder::Motorola, false, true, 1.0f, 0.0f, 686, 0, 0 }, // Unsent Emergency Call Number
+    { 0x0C7, 0x34, 0, 0, 0, 2, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 730, 6, 3 }, // Backup Battery Status
+    { 0x0C7, 0x35, 0, 0, 0, 3, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 844, 9, 6 }, // Activation Status
+    { 0x0C7, 0x3B, 0, 0, 0, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 862, 2, 2 }, // Remote Blocking State
+    { 0x0C7, 0x3B, 0, 0, 1, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 884, 2, 2 }, // Autonomous Blocking State
+    { 0x0C7, 0x3B, 0, 0, 2, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 925, 15, 2 }, // DWIMIHI/DWIMIHI2 State
+    { 0x0C7, 0xC1, 0, 0, 0, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 948, 2, 2 }, // Remote Engine Starter Registration Status
+    { 0x0C7, 0xC3, 0, 0, 0, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 990, 2, 2 }, // Communication Remote Engine Starter
+    { 0x0C7, 0xE1, 0, 0, 0, 8, ByteOrder::Motorola, false, true, 1.0f, 0.0f, 1026, 0, 0 }, // Number of Trouble Codes
+    { 0x7B0, 0x03, 42, 0, 0, 8, ByteOrder::Motorola, false, true, 1.28f, 0.0f, 1050, 0, 0 }, // FR Wheel Speed
+    { 0x7B0, 0x03, 42, 1, 0, 8, ByteOrder::Motorola, false, true, 1.28f, 0.0f, 1065, 0, 0 }, // FL Wheel Speed
+    { 0x7B0, 0x03, 42, 2, 0, 8, ByteOrder::Motorola, false, true, 1.28f, 0.0f, 1080, 0, 0 }, // RR Wheel Speed
+    { 0x7B0, 0x03, 42, 3, 0, 8, ByteOrder::Motorola, false, true, 1.28f, 0.0f, 1095, 0, 0 }, // RL Wheel Speed
+    { 0x7B0, 0x03, 0, 4, 4, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 1123, 17, 2 }, // RL Wheel Direction
+    { 0x7B0, 0x03, 0, 4, 5, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 1142, 17, 2 }, // RR Wheel Direction
+    { 0x7B0, 0x03, 0, 4, 6, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 1161, 17, 2 }, // FL Wheel Direction
+    { 0x7B0, 0x03, 0, 4, 7, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 1180, 17, 2 }, // FR Wheel Direction
+    { 0x7B0, 0x04, 48, 0, 0, 8, ByteOrder::Motorola, false, true, 0.019607844f, 0.0f, 1199, 0, 0 }, // Master Cylinder Sensor
+    { 0x7B0, 0x04, 48, 1, 0, 8, ByteOrder::Motorola, false, true, 0.019607844f, 0.0f, 1222, 0, 0 }, // Master Cylinder Sensor2
+    { 0x7B0, 0x04, 48, 2, 0, 8, ByteOrder::Motorola, false, true, 0.019607844f, 0.0f, 1246, 0, 0 }, // Stroke Sensor
+    { 0x7B0, 0x04, 48, 3, 0, 8, ByteOrder::Motorola, false, true, 0.019607844f, 0.0f, 1260, 0, 0 }, // Stroke Sensor2
+    { 0x7B0, 0x04, 48, 4, 0, 8, ByteOrder::Motorola, false, true, 0.019607844f, 0.0f, 1275, 0, 0 }, // Accumulator Sensor
+    { 0x7B0, 0x04, 48, 5, 0, 8, ByteOrder::Motorola, false, true, 0.019607844f, 0.0f, 1294, 0, 0 }, // Regulator Pressure Sensor Output
+    { 0x7B0, 0x04, 36, 6, 0, 8, ByteOrder::Motorola, false, true, 0.096f, 0.0f, 1327, 0, 0 }, // Reaction Force Pressure
+    { 0x7B0, 0x04, 36, 7, 0, 8, ByteOrder::Motorola, false, true, 0.096f, 0.0f, 1351, 0, 0 }, // Servo Pressure
+    { 0x7B0, 0x04, 36, 8, 0, 8, ByteOrder::Motorola, false, true, 0.096f, 0.0f, 1366, 0, 0 }, // Accumulator Pressure
+    { 0x7B0, 0x04, 36, 9, 0, 8, ByteOrder::Motorola, false, true, 0.096f, 0.0f, 1387, 0, 0 }, // Master Cylinder Pressure
+    { 0x7B0, 0x04, 57, 10, 0, 8, ByteOrder::Motorola, false, true, 1.0f, -8e+01f, 1412, 0, 0 }, // Master Cylinder Sensor Temperature
+    { 0x7B0, 0x04, 34, 12, 0, 8, ByteOrder::Motorola, false, true, 0.5f, 0.0f, 1447, 0, 0 }, // Brake Booster Pressure
+    { 0x7B0, 0x04, 34, 13, 0, 8, ByteOrder::Motorola, false, true, 0.5f, 0.0f, 1470, 0, 0 }, // Atmospheric Pressure
+    { 0x7B0, 0x04, 57, 14, 0, 8, ByteOrder::Motorola, false, true, 1.0f, -8e+01f, 1491, 0, 0 }, // Reaction Force Pressure Sensor Temperature
+    { 0x7B0, 0x04, 57, 16, 0, 8, ByteOrder::Motorola, false, true, 1.0f, -8e+01f, 1534, 0, 0 }, // Servo Pressure Sensor Temperature
+    { 0x7B0, 0x04, 34, 20, 0, 8, ByteOrder::Motorola, false, true, 0.5f, 0.0f, 1568, 0, 0 }, // Brake Booster Pressure "B"
+    { 0x7B0, 0x05, 1, 0, 0, 8, ByteOrder::Motorola, false, true, 0.14318f, -18.327f, 1595, 0, 0 }, // Deceleration Sensor
+    { 0x7B0, 0x05, 1, 1, 0, 8, ByteOrder::Motorola, false, true, 0.14318f, -18.327f, 1615, 0, 0 }, // Deceleration Sensor2
+    { 0x7B0, 0x05, 5, 6, 0, 8, ByteOrder::Motorola, false, true, 0.49019608f, 0.0f, 1636, 0, 0 }, // Throttle Opening Angle
+    { 0x7B0, 0x05, 33, 7, 0, 8, ByteOrder::Motorola, false, true, 0.49019608f, 0.0f, 1659, 0, 0 }, // Throttle Opening Angle %
+    { 0x7B0, 0x05, 5, 8, 0, 8, ByteOrder::Motorola, false, true, 0.49019608f, 0.0f, 1684, 0, 0 }, // Accelerator Opening Angle
+    { 0x7B0, 0x05, 33, 9, 0, 8, ByteOrder::Motorola, false, true, 0.5f, 0.0f, 1710, 0, 0 }, // Accelerator Opening Angle %
+    { 0x7B0, 0x05, 58, 10, 0, 16, ByteOrder::Motorola, false, true, 0.03125f, 0.0f, 1738, 0, 0 }, // Real Engine Torque
+    { 0x7B0, 0x06, 7, 0, 0, 8, ByteOrder::Motorola, false, true, 1.0f, -128.0f, 1757, 0, 0 }, // Yaw Rate Sensor
+    { 0x7B0, 0x06, 7, 1, 0, 8, ByteOrder::Motorola, false, true, 1.0f, -128.0f, 1773, 0, 0 }, // Yaw Rate Sensor2
+    { 0x7B0, 0x06, 5, 2, 0, 16, ByteOrder::Motorola, false, true, 0.1f, -3276.8f, 1790, 0, 0 }, // Steering Angle Sensor
+    { 0x7B0, 0x21, 42, 0, 0, 8, ByteOrder::Motorola, false, true, 1.28f, 0.0f, 1812, 0, 0 }, // Vehicle Speed
+    { 0x7B0, 0x3C, 0, 0, 6, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 1826, 2, 2 }, // EBS Relay
+    { 0x7B0, 0x3C, 0, 0, 7, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 1836, 2, 2 }, // Stop Light Relay Output
+    { 0x7B0, 0x41, 36, 0, 0, 16, ByteOrder::Motorola, false, true, 0.098f, 0.0f, 1860, 0, 0 }, // Zero Point of M/C
+    { 0x7B0, 0x41, 36, 3, 0, 16, ByteOrder::Motorola, false, true, 0.098f, 0.0f, 1878, 0, 0 }, // Zero Point of M/C2
+    { 0x7B0, 0x41, 48, 5, 0, 8, ByteOrder::Motorola, false, true, 0.019607844f, 0.0f, 1897, 0, 0 }, // Voltage of M/C
+    { 0x7B0, 0x41, 48, 6, 0, 8, ByteOrder::Motorola, false, true, 0.019607844f, 0.0f, 1912, 0, 0 }, // Voltage of M/C2
+    { 0x7B0, 0x41, 48, 7, 0, 8, ByteOrder::Motorola, false, true, 0.019607844f, 0.0f, 1928, 0, 0 }, // Voltage of Stroke Sensor
+    { 0x7B0, 0x41, 48, 8, 0, 8, ByteOrder::Motorola, false, true, 0.019607844f, 0.0f, 1953, 0, 0 }, // Voltage of Stroke Sensor2
+    { 0x7B0, 0x41, 36, 9, 0, 8, ByteOrder::Motorola, false, true, 0.098f, -1.0f, 1979, 0, 0 }, // Regulator Pressure Sensor Output After Filter
+    { 0x7B0, 0x41, 37, 10, 0, 8, ByteOrder::Motorola, false, true, 1.0f, -3e+01f, 2025, 0, 0 }, // Regulator Pressure Sensor Variation
+    { 0x7B0, 0x41, 48, 11, 0, 8, ByteOrder::Motorola, false, true, 0.019607844f, 0.0f, 2061, 0, 0 }, // Regulator Pressure Sensor Correction Voltage
+    { 0x7B0, 0x85, 42, 0, 0, 8, ByteOrder::Motorola, false, true, 0.1f, 0.0f, 2106, 0, 0 }, // FR Gap Wheel Speed
+    { 0x7B0, 0x85, 42, 1, 0, 8, ByteOrder::Motorola, false, true, 0.1f, 0.0f, 2125, 0, 0 }, // FL Gap Wheel Speed
+    { 0x7B0, 0x85, 42, 2, 0, 16, ByteOrder::Motorola, false, true, 0.1f, 0.0f, 2144, 0, 0 }, // RR Gap Wheel Speed
+    { 0x7B0, 0xE1, 0, 0, 0, 8, ByteOrder::Motorola, false, true, 1.0f, 0.0f, 2163, 0, 0 }, // Number of DTC
+    { 0x7E0, 0x01, 33, 0, 0, 8, ByteOrder::Motorola, false, true, 0.39215687f, 0.0f, 2177, 0, 0 }, // Calculate Load
+    { 0x7E0, 0x01, 33, 1, 0, 8, ByteOrder::Motorola, false, true, 0.39215687f, 0.0f, 2192, 0, 0 }, // Vehicle Load
+    { 0x7E0, 0x01, 46, 3, 0, 16, ByteOrder::Motorola, false, true, 0.01f, 0.0f, 2205, 0, 0 }, // MAF
+    { 0x7E0, 0x01, 34, 5, 0, 8, ByteOrder::Motorola, false, true, 1.0f, 0.0f, 2209, 0, 0 }, // MAP
+    { 0x7E0, 0x01, 57, 6, 0, 8, ByteOrder::Motorola, false, true, 1.0f, -4e+01f, 2213, 0, 0 }, // Intake Air
+    { 0x7E0, 0x01, 57, 7, 0, 8, ByteOrder::Motorola, false, true, 1.0f, -4e+01f, 2224, 0, 0 }, // Ambient Temperature
+    { 0x7E0, 0x01, 34, 8, 0, 8, ByteOrder::Motorola, false, true, 1.0f, 0.0f, 2244, 0, 0 }, // Atmosphere Pressure
+    { 0x7E0, 0x01, 57, 9, 0, 8, ByteOrder::Motorola, false, true, 1.0f, -4e+01f, 2264, 0, 0 }, // Coolant Temp
+    { 0x7E0, 0x01, 39, 10, 0, 16, ByteOrder::Motorola, false, true, 0.25f, 0.0f, 2277, 0, 0 }, // Engine Speed
+    { 0x7E0, 0x01, 42, 12, 0, 8, ByteOrder::Motorola, false, true, 1.0f, 0.0f, 1812, 0, 0 }, // Vehicle Speed
+    { 0x7E0, 0x01, 52, 13, 0, 16, ByteOrder::Motorola, false, true, 1.0f, 0.0f, 2290, 0, 0 }, // Engine Run Time
+    { 0x7E0, 0x01, 33, 15, 0, 8, ByteOrder::Motorola, false, true, 0.39215687f, 0.0f, 2306, 0, 0 }, // Throttle Sensor Position
+    { 0x7E0, 0x01, 33, 16, 0, 8, ByteOrder::Motorola, false, true, 0.39215687f, 0.0f, 2331, 0, 0 }, // Throttle Sensor Volt %
+    { 0x7E0, 0x01, 33, 17, 0, 8, ByteOrder::Motorola, false, true, 0.39215687f, 0.0f, 2354, 0, 0 }, // Throttle Sensor #2 Volt %
+    { 0x7E0, 0x01, 33, 18, 0, 8, ByteOrder::Motorola, false, true, 0.39215687f, 0.0f, 2380, 0, 0 }, // Accel Sens. No.1 Volt %
+    { 0x7E0, 0x01, 33, 19, 0, 8, ByteOrder::Motorola, false, true, 0.39215687f, 0.0f, 2404, 0, 0 }, // Accel Sens. No.2 Volt %
+    { 0x7E0, 0x01, 33, 20, 0, 8, ByteOrder::Motorola, false, true, 0.39215687f, 0.0f, 2428, 0, 0 }, // Throttle Motor DUTY
+    { 0x7E0, 0x01, 0, 21, 0, 8, ByteOrder::Motorola, false, true, 1.0f, 0.0f, 2448, 0, 0 }, // Warmup Cycle Cleared DTC
+    { 0x7E0, 0x01, 13, 22, 0, 16, ByteOrder::Motorola, false, true, 1.0f, 0.0f, 2473, 0, 0 }, // Distance from DTC Cleared
+    { 0x7E0, 0x01, 53, 24, 0, 16, ByteOrder::Motorola, false, true, 1.0f, 0.0f, 2499, 0, 0 }, // Time after DTC Cleared
+    { 0x7E0, 0x01, 48, 26, 0, 16, ByteOrder::Motorola, false, true, 0.001f, 0.0f, 2522, 0, 0 }, // Battery Voltage
+    { 0x7E0, 0x01, 0, 29, 0, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 2550, 19, 2 }, // MAF Sensor 1 Supported
+    { 0x7E0, 0x01, 0, 29, 1, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 2573, 19, 2 }, // MAF Sensor 2 Supported
+    { 0x7E0, 0x01, 46, 30, 0, 16, ByteOrder::Motorola, false, true, 0.03125f, 0.0f, 2596, 0, 0 }, // MAF Sensor 1
+    { 0x7E0, 0x01, 46, 32, 0, 16, ByteOrder::Motorola, false, true, 0.03125f, 0.0f, 2609, 0, 0 }, // MAF Sensor 2
+    { 0x7E0, 0x01, 0, 34, 0, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 2622, 19, 2 }, // Coolant Temp Sensor1 Supported
+    { 0x7E0, 0x01, 0, 34, 1, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 2653, 19, 2 }, // Coolant Temp Sensor2 Supported
+    { 0x7E0, 0x01, 57, 35, 0, 8, ByteOrder::Motorola, false, true, 1.0f, -4e+01f, 2684, 0, 0 }, // Coolant Temperature1
+    { 0x7E0, 0x01, 57, 36, 0, 8, ByteOrder::Motorola, false, true, 1.0f, -4e+01f, 2705, 0, 0 }, // Coolant Temperature2
+    { 0x7E0, 0x01, 0, 37, 0, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 2726, 19, 2 }, // Intake Air Temp B1S1 Supported
+    { 0x7E0, 0x01, 0, 37, 1, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 2757, 19, 2 }, // Intake Air Temp B1S2 Supported
+    { 0x7E0, 0x01, 0, 37, 2, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 2788, 19, 2 }, // Intake Air Temp B1S3 Supported
+    { 0x7E0, 0x01, 0, 37, 3, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 2819, 19, 2 }, // Intake Air Temp B2S1 Supported
+    { 0x7E0, 0x01, 0, 37, 4, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 2850, 19, 2 }, // Intake Air Temp B2S2 Supported
+    { 0x7E0, 0x01, 0, 37, 5, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 2881, 19, 2 }, // Intake Air Temp B2S3 Supported
+    { 0x7E0, 0x01, 57, 38, 0, 8, ByteOrder::Motorola, false, true, 1.0f, -4e+01f, 2912, 0, 0 }, // Intake Air Temp B1S1
+    { 0x7E0, 0x01, 57, 39, 0, 8, ByteOrder::Motorola, false, true, 1.0f, -4e+01f, 2933, 0, 0 }, // Intake Air Temp B1S2
+    { 0x7E0, 0x01, 57, 40, 0, 8, ByteOrder::Motorola, false, true, 1.0f, -4e+01f, 2954, 0, 0 }, // Intake Air Temp B1S3
+    { 0x7E0, 0x01, 57, 41, 0, 8, ByteOrder::Motorola, false, true, 1.0f, -4e+01f, 2975, 0, 0 }, // Intake Air Temp B2S1
+    { 0x7E0, 0x01, 57, 42, 0, 8, ByteOrder::Motorola, false, true, 1.0f, -4e+01f, 2996, 0, 0 }, // Intake Air Temp B2S2
+    { 0x7E0, 0x01, 57, 43, 0, 8, ByteOrder::Motorola, false, true, 1.0f, -4e+01f, 3017, 0, 0 }, // Intake Air Temp B2S3
+    { 0x7E0, 0x01, 0, 44, 0, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 3038, 19, 2 }, // Target Throttle Position #1 Supported
+    { 0x7E0, 0x01, 0, 44, 1, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 3076, 19, 2 }, // Throttle Sensor Position #1 Supported
+    { 0x7E0, 0x01, 0, 44, 2, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 3114, 19, 2 }, // Target Throttle Position #2 Supported
+    { 0x7E0, 0x01, 0, 44, 3, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 3152, 19, 2 }, // Throttle Sensor Position #2 Supported
+    { 0x7E0, 0x01, 33, 45, 0, 8, ByteOrder::Motorola, false, true, 0.39215687f, 0.0f, 3190, 0, 0 }, // Target Throttle Position #1
+    { 0x7E0, 0x01, 33, 46, 0, 8, ByteOrder::Motorola, false, true, 0.39215687f, 0.0f, 3218, 0, 0 }, // Throttle Sensor Position #1
+    { 0x7E0, 0x01, 33, 47, 0, 8, ByteOrder::Motorola, false, true, 0.39215687f, 0.0f, 3246, 0, 0 }, // Target Throttle Position #2
+    { 0x7E0, 0x01, 33, 48, 0, 8, ByteOrder::Motorola, false, true, 0.39215687f, 0.0f, 3274, 0, 0 }, // Throttle Sensor Position #2
+    { 0x7E0, 0x01, 57, 49, 0, 8, ByteOrder::Motorola, false, true, 1.0f, -4e+01f, 3302, 0, 0 }, // Engine Oil Temperature Sensor
+    { 0x7E0, 0x01, 60, 50, 0, 16, ByteOrder::Motorola, false, true, 0.0078125f, -2.1e+02f, 3332, 0, 0 }, // Main Injection Timing
+    { 0x7E0, 0x03, 0, 0, 0, 5, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 3391, 21, 17 }, // Fuel System Status #1
+    { 0x7E0, 0x03, 0, 1, 0, 5, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 3413, 21, 17 }, // Fuel System Status #2
+    { 0x7E0, 0x03, 33, 2, 0, 8, ByteOrder::Motorola, false, true, 0.78125f, -1e+02f, 3435, 0, 0 }, // Short FT B1S1
+    { 0x7E0, 0x03, 33, 3, 0, 8, ByteOrder::Motorola, false, true, 0.78125f, -1e+02f, 3449, 0, 0 }, // Long FT B1S1
+    { 0x7E0, 0x03, 33, 4, 0, 8, ByteOrder::Motorola, false, true, 0.78125f, -1e+02f, 3462, 0, 0 }, // Short FT B2S1
+    { 0x7E0, 0x03, 33, 5, 0, 8, ByteOrder::Motorola, false, true, 0.78125f, -1e+02f, 3476, 0, 0 }, // Long FT B2S1
+    { 0x7E0, 0x03, 5, 6, 0, 8, ByteOrder::Motorola, false, true, 0.5f, -64.0f, 3489, 0, 0 }, // IGN Advance
+    { 0x7E0, 0x03, 0, 7, 0, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 3501, 2, 2 }, // 2nd Air System Status
+    { 0x7E0, 0x03, 0, 7, 2, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 3523, 2, 2 }, // Atmosphere Adoption (Secondary Air)
+    { 0x7E0, 0x03, 0, 7, 3, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 3559, 2, 2 }, // Air Pump
+    { 0x7E0, 0x03, 33, 8, 0, 8, ByteOrder::Motorola, false, true, 0.39215687f, 0.0f, 3568, 0, 0 }, // EVAP (Purge) VSV
+    { 0x7E0, 0x03, 33, 9, 0, 8, ByteOrder::Motorola, false, true, 0.39215687f, 0.0f, 3585, 0, 0 }, // Target EGR Position
+    { 0x7E0, 0x03, 33, 11, 0, 8, ByteOrder::Motorola, false, true, 0.39215687f, 0.0f, 3605, 0, 0 }, // Alcohol Density Estimate
+    { 0x7E0, 0x03, 0, 12, 0, 5, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 4486, 38, 31 }, // Current Fuel Type
+    { 0x7E0, 0x03, 33, 13, 0, 8, ByteOrder::Motorola, false, true, 0.39215687f, 0.0f, 4504, 0, 0 }, // Fuel Remaining Volume
+    { 0x7E0, 0x03, 0, 14, 1, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 4526, 19, 2 }, // Shift SW Status (N,P Range) Supported
+    { 0x7E0, 0x03, 0, 14, 3, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 4564, 19, 2 }, // Glow Indicator Supported
+    { 0x7E0, 0x03, 0, 15, 1, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 4589, 69, 2 }, // Shift SW Status (N,P Range)
+    { 0x7E0, 0x03, 0, 15, 3, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 4617, 2, 2 }, // Glow Indicator
+    { 0x7E0, 0x03, 0, 16, 0, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 4632, 19, 2 }, // Target EGR Valve Pos Supported
+    { 0x7E0, 0x03, 0, 16, 1, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 4663, 19, 2 }, // Actual EGR Valve Pos Supported
+    { 0x7E0, 0x03, 0, 16, 3, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 4694, 19, 2 }, // Target EGR Valve Pos #2 Supported
+    { 0x7E0, 0x03, 0, 16, 4, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 4728, 19, 2 }, // Actual EGR Valve Pos #2 Supported
+    { 0x7E0, 0x03, 33, 17, 0, 8, ByteOrder::Motorola, false, true, 0.39215687f, 0.0f, 4762, 0, 0 }, // Target EGR Valve Pos
+    { 0x7E0, 0x03, 33, 18, 0, 8, ByteOrder::Motorola, false, true, 0.39215687f, 0.0f, 4783, 0, 0 }, // Actual EGR Valve Pos
+    { 0x7E0, 0x03, 33, 20, 0, 8, ByteOrder::Motorola, false, true, 0.39215687f, 0.0f, 4804, 0, 0 }, // Target EGR Valve Pos #2
+    { 0x7E0, 0x03, 33, 21, 0, 8, ByteOrder::Motorola, false, true, 0.39215687f, 0.0f, 4828, 0, 0 }, // Actual EGR Valve Pos #2
+    { 0x7E0, 0x03, 0, 23, 0, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 4852, 19, 2 }, // Target Throttle Position Supported
+    { 0x7E0, 0x03, 0, 23, 1, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 4887, 19, 2 }, // Actual Throttle Position Supported
+    { 0x7E0, 0x03, 0, 23, 2, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 3114, 19, 2 }, // Target Throttle Position #2 Supported
+    { 0x7E0, 0x03, 0, 23, 3, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 4922, 19, 2 }, // Actual Throttle Position #2 Supported
+    { 0x7E0, 0x03, 33, 24, 0, 8, ByteOrder::Motorola, false, true, 0.39215687f, 0.0f, 4960, 0, 0 }, // Target Throttle Position
+    { 0x7E0, 0x03, 33, 25, 0, 8, ByteOrder::Motorola, false, true, 0.39215687f, 0.0f, 4985, 0, 0 }, // Actual Throttle Position
+    { 0x7E0, 0x03, 33, 26, 0, 8, ByteOrder::Motorola, false, true, 0.39215687f, 0.0f, 3246, 0, 0 }, // Target Throttle Position #2
+    { 0x7E0, 0x03, 33, 27, 0, 8, ByteOrder::Motorola, false, true, 0.39215687f, 0.0f, 5010, 0, 0 }, // Actual Throttle Position #2
+    { 0x7E0, 0x03, 0, 28, 0, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 5038, 19, 2 }, // Target Booster Pressure Supported
+    { 0x7E0, 0x03, 34, 29, 0, 16, ByteOrder::Motorola, false, true, 0.03125f, 0.0f, 5072, 0, 0 }, // Target Booster Pressure
+    { 0x7E0, 0x03, 0, 38, 0, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 5096, 19, 2 }, // Target VN Turbo Position Supported
+    { 0x7E0, 0x03, 0, 38, 1, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 5131, 19, 2 }, // Actual VN Position Supported
+    { 0x7E0, 0x03, 0, 38, 3, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 5160, 19, 2 }, // Target VN Turbo Position #2 Supported
+    { 0x7E0, 0x03, 0, 38, 4, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 5198, 19, 2 }, // Actual VN Position #2 Supported
+    { 0x7E0, 0x03, 33, 39, 0, 8, ByteOrder::Motorola, false, true, 0.39215687f, 0.0f, 5230, 0, 0 }, // Target VN Turbo Position
+    { 0x7E0, 0x03, 33, 40, 0, 8, ByteOrder::Motorola, false, true, 0.39215687f, 0.0f, 5255, 0, 0 }, // Actual VN Turbo Position
+    { 0x7E0, 0x03, 33, 41, 0, 8, ByteOrder::Motorola, false, true, 0.39215687f, 0.0f, 5280, 0, 0 }, // Target VN Turbo Position #2
+    { 0x7E0, 0x03, 33, 42, 0, 8, ByteOrder::Motorola, false, true, 0.39215687f, 0.0f, 5308, 0, 0 }, // Actual VN Turbo Position #2
+    { 0x7E0, 0x03, 33, 44, 0, 8, ByteOrder::Motorola, false, true, 0.78125f, -1e+02f, 5336, 0, 0 }, // Short FT B1S2
+    { 0x7E0, 0x03, 33, 45, 0, 8, ByteOrder::Motorola, false, true, 0.78125f, -1e+02f, 5350, 0, 0 }, // Long FT B1S2
+    { 0x7E0, 0x03, 33, 46, 0, 8, ByteOrder::Motorola, false, true, 0.78125f, -1e+02f, 5363, 0, 0 }, // Short FT B2S2
+    { 0x7E0, 0x03, 33, 47, 0, 8, ByteOrder::Motorola, false, true, 0.78125f, -1e+02f, 5377, 0, 0 }, // Long FT B2S2
+    { 0x7E0, 0x04, 0, 0, 0, 8, ByteOrder::Motorola, false, true, 3.05e-05f, 0.0f, 5390, 0, 0 }, // Target Air-Fuel Ratio
+    { 0x7E0, 0x04, 0, 2, 0, 8, ByteOrder::Motorola, false, true, 3.05e-05f, 0.0f, 5412, 0, 0 }, // AF Lambda B1S1
+    { 0x7E0, 0x04, 48, 4, 0, 16, ByteOrder::Motorola, false, true, 0.000122f, 0.0f, 5427, 0, 0 }, // AFS Voltage B1S1
+    { 0x7E0, 0x04, 0, 6, 0, 8, ByteOrder::Motorola, false, true, 3.05e-05f, 0.0f, 5444, 0, 0 }, // AF Lambda B2S1
+    { 0x7E0, 0x04, 48, 8, 0, 16, ByteOrder::Motorola, false, true, 0.000122f, 0.0f, 5459, 0, 0 }, // AFS Voltage B2S1
+    { 0x7E0, 0x04, 0, 10, 0, 8, ByteOrder::Motorola, false, true, 3.05e-05f, 0.0f, 5412, 0, 0 }, // AF Lambda B1S1
+    { 0x7E0, 0x04, 12, 12, 0, 16, ByteOrder::Motorola, false, true, 0.00390625f, -128.0f, 5476, 0, 0 }, // AFS Current B1S1
+    { 0x7E0, 0x04, 0, 14, 0, 8, ByteOrder::Motorola, false, true, 3.05e-05f, 0.0f, 5444, 0, 0 }, // AF Lambda B2S1
+    { 0x7E0, 0x04, 12, 16, 0, 16, ByteOrder::Motorola, false, true, 0.00390625f, -128.0f, 5493, 0, 0 }, // AFS Current B2S1
+    { 0x7E0, 0x04, 48, 18, 0, 8, ByteOrder::Motorola, false, true, 0.005f, 0.0f, 5510, 0, 0 }, // O2S B1S1
+    { 0x7E0, 0x04, 33, 19, 0, 8, ByteOrder::Motorola, false, true, 0.78125f, -1e+02f, 5519, 0, 0 }, // O2FT B1S1
+    { 0x7E0, 0x04, 48, 20, 0, 16, ByteOrder::Motorola, false, true, 0.005f, 0.0f, 5529, 0, 0 }, // O2S B1S2
+    { 0x7E0, 0x04, 48, 22, 0, 8, ByteOrder::Motorola, false, true, 0.005f, 0.0f, 5538, 0, 0 }, // O2S B2S1
+    { 0x7E0, 0x04, 33, 23, 0, 8, ByteOrder::Motorola, false, true, 0.78125f, -1e+02f, 5547, 0, 0 }, // O2FT B2S1
+    { 0x7E0, 0x04, 48, 24, 0, 16, ByteOrder::Motorola, false, true, 0.005f, 0.0f, 5557, 0, 0 }, // O2S B2S2
+    { 0x7E0, 0x04, 0, 26, 0, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 5566, 19, 2 }, // Particulate Filter Differential Pressure Supported
+    { 0x7E0, 0x04, 34, 27, 0, 16, ByteOrder::Motorola, false, true, 0.01f, -327.68f, 5617, 0, 0 }, // Particulate Filter Differential Pressure
+    { 0x7E0, 0x04, 0, 33, 0, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 5658, 19, 2 }, // Particulate Filter Differential Pressure #2 Supported
+    { 0x7E0, 0x04, 34, 34, 0, 16, ByteOrder::Motorola, false, true, 0.01f, -327.68f, 5712, 0, 0 }, // Particulate Filter Differential Pressure #2
+    { 0x7E0, 0x04, 0, 40, 0, 8, ByteOrder::Motorola, false, true, 3.05e-05f, 0.0f, 5756, 0, 0 }, // AF Lambda B1S2
+    { 0x7E0, 0x04, 12, 42, 0, 16, ByteOrder::Motorola, false, true, 0.00390625f, -128.0f, 5771, 0, 0 }, // AFS Current B1S2
+    { 0x7E0, 0x04, 0, 44, 0, 8, ByteOrder::Motorola, false, true, 3.05e-05f, 0.0f, 5756, 0, 0 }, // AF Lambda B1S2
+    { 0x7E0, 0x04, 48, 46, 0, 16, ByteOrder::Motorola, false, true, 0.000122f, 0.0f, 5788, 0, 0 }, // AFS Voltage B1S2
+    { 0x7E0, 0x05, 34, 0, 0, 8, ByteOrder::Motorola, false, true, 1e+01f, 0.0f, 5805, 0, 0 }, // Fuel Press
+    { 0x7E0, 0x05, 34, 4, 0, 16, ByteOrder::Motorola, false, true, 0.001f, 0.0f, 5816, 0, 0 }, // EVAP Vapor Pressure (Wide)
+    { 0x7E0, 0x05, 57, 6, 0, 16, ByteOrder::Motorola, false, true, 0.1f, -4e+01f, 5843, 0, 0 }, // Catalyst Temp B1S1
+    { 0x7E0, 0x05, 57, 8, 0, 16, ByteOrder::Motorola, false, true, 0.1f, -4e+01f, 5862, 0, 0 }, // Catalyst Temp B2S1
+    { 0x7E0, 0x05, 57, 10, 0, 16, ByteOrder::Motorola, false, true, 0.1f, -4e+01f, 5881, 0, 0 }, // Catalyst Temp B1S2
+    { 0x7E0, 0x05, 57, 12, 0, 16, ByteOrder::Motorola, false, true, 0.1f, -4e+01f, 5900, 0, 0 }, // Catalyst Temp B2S2
+    { 0x7E0, 0x05, 0, 14, 0, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 5919, 19, 2 }, // Target Common Rail Pressure Supported
+    { 0x7E0, 0x05, 0, 14, 1, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 5957, 19, 2 }, // Common Rail Pressure Supported
+    { 0x7E0, 0x05, 0, 14, 2, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 5988, 19, 2 }, // Fuel Temperature Supported
+    { 0x7E0, 0x05, 34, 15, 0, 8, ByteOrder::Motorola, false, true, 1e+01f, 0.0f, 6015, 0, 0 }, // Target Common Rail Pressure
+    { 0x7E0, 0x05, 34, 17, 0, 8, ByteOrder::Motorola, false, true, 1e+01f, 0.0f, 6043, 0, 0 }, // Common Rail Pressure
+    { 0x7E0, 0x05, 57, 19, 0, 8, ByteOrder::Motorola, false, true, 1.0f, -4e+01f, 6064, 0, 0 }, // Fuel Temperature
+    { 0x7E0, 0x05, 0, 25, 0, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 6081, 19, 2 }, // Intake Air Temp (Turbo) Supported
+    { 0x7E0, 0x05, 57, 26, 0, 8, ByteOrder::Motorola, false, true, 1.0f, -4e+01f, 6115, 0, 0 }, // Intake Air Temp (Turbo)
+    { 0x7E0, 0x05, 0, 30, 0, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 6139, 19, 2 }, // Exhaust Temperature B1S1 Supported
+    { 0x7E0, 0x05, 0, 30, 1, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 6174, 19, 2 }, // Exhaust Temperature B1S2 Supported
+    { 0x7E0, 0x05, 0, 30, 2, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 6209, 19, 2 }, // Exhaust Temperature B1S3 Supported
+    { 0x7E0, 0x05, 0, 30, 3, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 6244, 19, 2 }, // Exhaust Temperature B1S4 Supported
+    { 0x7E0, 0x05, 57, 31, 0, 16, ByteOrder::Motorola, false, true, 0.1f, -4e+01f, 6279, 0, 0 }, // Exhaust Temperature B1S1
+    { 0x7E0, 0x05, 57, 33, 0, 16, ByteOrder::Motorola, false, true, 0.1f, -4e+01f, 6304, 0, 0 }, // Exhaust Temperature B1S2
+    { 0x7E0, 0x05, 57, 35, 0, 16, ByteOrder::Motorola, false, true, 0.1f, -4e+01f, 6329, 0, 0 }, // Exhaust Temperature B1S3
+    { 0x7E0, 0x05, 57, 37, 0, 16, ByteOrder::Motorola, false, true, 0.1f, -4e+01f, 6354, 0, 0 }, // Exhaust Temperature B1S4
+    { 0x7E0, 0x05, 0, 39, 0, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 6379, 19, 2 }, // Exhaust Temperature B2S1 Supported
+    { 0x7E0, 0x05, 0, 39, 1, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 6414, 19, 2 }, // Exhaust Temperature B2S2 Supported
+    { 0x7E0, 0x05, 0, 39, 2, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 6449, 19, 2 }, // Exhaust Temperature B2S3 Supported
+    { 0x7E0, 0x05, 57, 40, 0, 16, ByteOrder::Motorola, false, true, 0.1f, -4e+01f, 6484, 0, 0 }, // Exhaust Temperature B2S1
+    { 0x7E0, 0x05, 57, 42, 0, 16, ByteOrder::Motorola, false, true, 0.1f, -4e+01f, 6509, 0, 0 }, // Exhaust Temperature B2S2
+    { 0x7E0, 0x05, 57, 44, 0, 16, ByteOrder::Motorola, false, true, 0.1f, -4e+01f, 6534, 0, 0 }, // Exhaust Temperature B2S3
+    { 0x7E0, 0x06, 0, 0, 0, 8, ByteOrder::Motorola, false, true, 1.0f, 0.0f, 6559, 0, 0 }, // Number of Emission DTC
+    { 0x7E0, 0x06, 0, 0, 7, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 6582, 2, 2 }, // MIL
+    { 0x7E0, 0x06, 0, 1, 0, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 6600, 71, 2 }, // Misfire Monitor
+    { 0x7E0, 0x06, 0, 1, 1, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 6616, 71, 2 }, // Fuel System Monitor
+    { 0x7E0, 0x06, 0, 1, 2, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 6636, 71, 2 }, // Complete Parts Monitor
+    { 0x7E0, 0x06, 0, 1, 5, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 6672, 73, 2 }, // Fuel System Monitor Result
+    { 0x7E0, 0x06, 0, 2, 0, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 6699, 71, 2 }, // Catalyst Monitor
+    { 0x7E0, 0x06, 0, 2, 1, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 6716, 71, 2 }, // Heated Catalyst Monitor
+    { 0x7E0, 0x06, 0, 2, 2, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 6740, 71, 2 }, // EVAP Monitor
+    { 0x7E0, 0x06, 0, 2, 3, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 6753, 71, 2 }, // 2nd Air Monitor
+    { 0x7E0, 0x06, 0, 2, 4, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 6769, 71, 2 }, // A/C Monitor
+    { 0x7E0, 0x06, 0, 2, 5, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 6781, 71, 2 }, // O2S(A/FS) Monitor
+    { 0x7E0, 0x06, 0, 2, 6, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 6799, 71, 2 }, // O2S(A/FS) Heater Monitor
+    { 0x7E0, 0x06, 0, 2, 7, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 6824, 71, 2 }, // EGR/VVT Monitor
+    { 0x7E0, 0x06, 0, 3, 0, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 6699, 73, 2 }, // Catalyst Monitor
+    { 0x7E0, 0x06, 0, 3, 1, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 6716, 73, 2 }, // Heated Catalyst Monitor
+    { 0x7E0, 0x06, 0, 3, 2, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 6740, 73, 2 }, // EVAP Monitor
+    { 0x7E0, 0x06, 0, 3, 3, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 6753, 73, 2 }, // 2nd Air Monitor
+    { 0x7E0, 0x06, 0, 3, 4, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 6769, 73, 2 }, // A/C Monitor
+    { 0x7E0, 0x06, 0, 3, 5, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 6781, 73, 2 }, // O2S(A/FS) Monitor
+    { 0x7E0, 0x06, 0, 3, 6, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 6799, 73, 2 }, // O2S(A/FS) Heater Monitor
+    { 0x7E0, 0x06, 0, 3, 7, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 6824, 73, 2 }, // EGR/VVT Monitor
+    { 0x7E0, 0x06, 0, 5, 0, 6, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 7604, 75, 43 }, // OBD Requirements
+    { 0x7E0, 0x06, 13, 6, 0, 16, ByteOrder::Motorola, false, true, 1.0f, 0.0f, 7621, 0, 0 }, // MIL ON Run Distance
+    { 0x7E0, 0x06, 0, 9, 0, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 7655, 118, 2 }, // Misfire Monitor ENA
+    { 0x7E0, 0x06, 0, 9, 1, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 7675, 118, 2 }, // Fuel System Monitor ENA
+    { 0x7E0, 0x06, 0, 9, 2, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 7699, 118, 2 }, // Component Monitor ENA
+    { 0x7E0, 0x06, 0, 9, 4, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 7721, 73, 2 }, // Misfire Monitor CMPL
+    { 0x7E0, 0x06, 0, 9, 5, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 7742, 73, 2 }, // Fuel System Monitor CMPL
+    { 0x7E0, 0x06, 0, 9, 6, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 7767, 73, 2 }, // Component Monitor CMPL
+    { 0x7E0, 0x06, 0, 10, 0, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 7790, 118, 2 }, // Catalyst Monitor ENA
+    { 0x7E0, 0x06, 0, 10, 1, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 7811, 118, 2 }, // Heated Cat Monitor ENA
+    { 0x7E0, 0x06, 0, 10, 2, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 7834, 118, 2 }, // EVAP Monitor ENA
+    { 0x7E0, 0x06, 0, 10, 3, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 7851, 118, 2 }, // 2nd Air Monitor ENA
+    { 0x7E0, 0x06, 0, 10, 4, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 7871, 118, 2 }, // A/C Monitor ENA
+    { 0x7E0, 0x06, 0, 10, 5, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 7887, 118, 2 }, // O2S(A/FS) Monitor ENA
+    { 0x7E0, 0x06, 0, 10, 6, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 7909, 118, 2 }, // Heater Monitor ENA
+    { 0x7E0, 0x06, 0, 10, 7, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 7928, 118, 2 }, // EGR/VVT Monitor ENA
+    { 0x7E0, 0x06, 0, 11, 0, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 7948, 73, 2 }, // Catalyst Monitor CMPL
+    { 0x7E0, 0x06, 0, 11, 1, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 7970, 73, 2 }, // Heated Cat Monitor CMPL
+    { 0x7E0, 0x06, 0, 11, 2, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 7994, 73, 2 }, // EVAP Monitor CMPL
+    { 0x7E0, 0x06, 0, 11, 3, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 8012, 73, 2 }, // 2nd Air Monitor CMPL
+    { 0x7E0, 0x06, 0, 11, 4, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 8033, 73, 2 }, // A/C Monitor CMPL
+    { 0x7E0, 0x06, 0, 11, 5, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 8050, 73, 2 }, // O2S(A/FS) Monitor CMPL
+    { 0x7E0, 0x06, 0, 11, 6, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 8073, 73, 2 }, // Heater Monitor CMPL
+    { 0x7E0, 0x06, 0, 11, 7, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 8093, 73, 2 }, // EGR/VVT Monitor CMPL
+    { 0x7E0, 0x06, 53, 12, 0, 8, ByteOrder::Motorola, false, true, 1.0f, 0.0f, 8114, 0, 0 }, // Running Time from MIL ON
+    { 0x7E0, 0x07, 0, 0, 0, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 8139, 19, 2 }, // NOx Density B1S1 Supported
+    { 0x7E0, 0x07, 0, 0, 1, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 8166, 19, 2 }, // NOx Density B1S2 Supported
+    { 0x7E0, 0x07, 0, 0, 2, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 8193, 19, 2 }, // NOx Density B2S1 Supported
+    { 0x7E0, 0x07, 0, 0, 3, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 8220, 19, 2 }, // NOx Density B2S2 Supported
+    { 0x7E0, 0x07, 32, 1, 0, 8, ByteOrder::Motorola, false, true, 1.0f, 0.0f, 8247, 0, 0 }, // NOx Density B1S1
+    { 0x7E0, 0x07, 32, 3, 0, 8, ByteOrder::Motorola, false, true, 1.0f, 0.0f, 8264, 0, 0 }, // NOx Density B1S2
+    { 0x7E0, 0x07, 32, 5, 0, 8, ByteOrder::Motorola, false, true, 1.0f, 0.0f, 8281, 0, 0 }, // NOx Density B2S1
+    { 0x7E0, 0x07, 32, 7, 0, 8, ByteOrder::Motorola, false, true, 1.0f, 0.0f, 8298, 0, 0 }, // NOx Density B2S2
+    { 0x7E0, 0x07, 0, 22, 0, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 8315, 19, 2 }, // A/F (O2) Density B1S1 Supported
+    { 0x7E0, 0x07, 0, 22, 1, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 8347, 19, 2 }, // A/F (O2) Density B1S2 Supported
+    { 0x7E0, 0x07, 0, 22, 2, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 8379, 19, 2 }, // A/F (O2) Density B2S1 Supported
+    { 0x7E0, 0x07, 0, 22, 3, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 8411, 19, 2 }, // A/F (O2) Density B2S2 Supported
+    { 0x7E0, 0x07, 0, 22, 4, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 8443, 19, 2 }, // AF Lambda B1S1 Supported
+    { 0x7E0, 0x07, 0, 22, 5, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 8468, 19, 2 }, // AF Lambda B1S2 Supported
+    { 0x7E0, 0x07, 0, 22, 6, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 8493, 19, 2 }, // AF Lambda B2S1 Supported
+    { 0x7E0, 0x07, 0, 22, 7, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 8518, 19, 2 }, // AF Lambda B2S2 Supported
+    { 0x7E0, 0x07, 33, 23, 0, 16, ByteOrder::Motorola, false, true, 0.001526f, 0.0f, 8543, 0, 0 }, // A/F (O2) Density B1S1
+    { 0x7E0, 0x07, 33, 25, 0, 16, ByteOrder::Motorola, false, true, 0.001526f, 0.0f, 8565, 0, 0 }, // A/F (O2) Density B1S2
+    { 0x7E0, 0x07, 33, 27, 0, 16, ByteOrder::Motorola, false, true, 0.001526f, 0.0f, 8587, 0, 0 }, // A/F (O2) Density B2S1
+    { 0x7E0, 0x07, 33, 29, 0, 16, ByteOrder::Motorola, false, true, 0.001526f, 0.0f, 8609, 0, 0 }, // A/F (O2) Density B2S2
+    { 0x7E0, 0x07, 0, 31, 0, 8, ByteOrder::Motorola, false, true, 0.000122f, 0.0f, 5412, 0, 0 }, // AF Lambda B1S1
+    { 0x7E0, 0x07, 0, 33, 0, 8, ByteOrder::Motorola, false, true, 0.000122f, 0.0f, 5756, 0, 0 }, // AF Lambda B1S2
+    { 0x7E0, 0x07, 0, 35, 0, 8, ByteOrder::Motorola, false, true, 0.000122f, 0.0f, 5444, 0, 0 }, // AF Lambda B2S1
+    { 0x7E0, 0x07, 0, 37, 0, 8, ByteOrder::Motorola, false, true, 0.000122f, 0.0f, 8631, 0, 0 }, // AF Lambda B2S2
+    { 0x7E0, 0x07, 0, 39, 0, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 8646, 19, 2 }, // NOx Corrected Density B1S1 Supported
+    { 0x7E0, 0x07, 0, 39, 1, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 8683, 19, 2 }, // NOx Corrected Density B1S2 Supported
+    { 0x7E0, 0x07, 0, 39, 2, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 8720, 19, 2 }, // NOx Corrected Density B2S1 Supported
+    { 0x7E0, 0x07, 0, 39, 3, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 8757, 19, 2 }, // NOx Corrected Density B2S2 Supported
+    { 0x7E0, 0x07, 32, 40, 0, 8, ByteOrder::Motorola, false, true, 1.0f, 0.0f, 8794, 0, 0 }, // NOx Corrected Density B1S1
+    { 0x7E0, 0x07, 32, 42, 0, 8, ByteOrder::Motorola, false, true, 1.0f, 0.0f, 8821, 0, 0 }, // NOx Corrected Density B1S2
+    { 0x7E0, 0x07, 32, 44, 0, 8, ByteOrder::Motorola, false, true, 1.0f, 0.0f, 8848, 0, 0 }, // NOx Corrected Density B2S1
+    { 0x7E0, 0x07, 32, 46, 0, 8, ByteOrder::Motorola, false, true, 1.0f, 0.0f, 8875, 0, 0 }, // NOx Corrected Density B2S2
+    { 0x7E0, 0x08, 33, 0, 0, 8, ByteOrder::Motorola, false, true, 1.0f, -125.0f, 8902, 0, 0 }, // Actual Engine Percent Torque
+    { 0x7E0, 0x08, 58, 1, 0, 16, ByteOrder::Motorola, false, true, 1.0f, 0.0f, 8931, 0, 0 }, // Engine Reference Torque (Fixed Value)
+    { 0x7E0, 0x08, 33, 3, 0, 8, ByteOrder::Motorola, false, true, 1.0f, -125.0f, 8969, 0, 0 }, // Engine Friction Percent Torque
+    { 0x7E0, 0x08, 46, 4, 0, 16, ByteOrder::Motorola, false, true, 0.02f, 0.0f, 9000, 0, 0 }, // Engine Fuel Rate
+    { 0x7E0, 0x08, 46, 6, 0, 16, ByteOrder::Motorola, false, true, 0.02f, 0.0f, 9017, 0, 0 }, // Vehicle Fuel Rate
+    { 0x7E0, 0x08, 69, 8, 0, 8, ByteOrder::Motorola, false, true, 0.2f, 0.0f, 9035, 0, 0 }, // Engine Exhaust Flow Rate
+    { 0x7E0, 0x21, 0, 10, 2, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 9060, 2, 2 }, // Cancel Switch
+    { 0x7E0, 0x21, 0, 10, 3, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 9074, 2, 2 }, // SET/COAST Switch
+    { 0x7E0, 0x21, 0, 10, 4, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 9091, 2, 2 }, // RES/ACC Switch
+    { 0x7E0, 0x21, 42, 26, 0, 8, ByteOrder::Motorola, false, true, 1.0f, 0.0f, 9106, 0, 0 }, // ASL Vehicle Speed
+    { 0x7E0, 0x21, 42, 27, 0, 8, ByteOrder::Motorola, false, true, 1.0f, 0.0f, 9124, 0, 0 }, // ASL Memory Vehicle Speed
+    { 0x7E0, 0x21, 0, 28, 0, 8, ByteOrder::Motorola, false, true, 1.0f, 0.0f, 9149, 0, 0 }, // ASL Shift Position Request
+    { 0x7E0, 0x21, 5, 29, 0, 8, ByteOrder::Motorola, false, true, 0.48828125f, 0.0f, 9176, 0, 0 }, // ASL Throttle Position
+    { 0x7E0, 0x21, 33, 30, 0, 8, ByteOrder::Motorola, false, true, 0.48828125f, 0.0f, 9176, 0, 0 }, // ASL Throttle Position
+    { 0x7E0, 0x21, 0, 31, 6, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 9198, 2, 2 }, // ASL Ready
+    { 0x7E0, 0x21, 0, 31, 7, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 9208, 2, 2 }, // ASL Main Switch
+    { 0x7E0, 0x22, 39, 0, 0, 16, ByteOrder::Motorola, false, true, 0.78125f, 0.0f, 9224, 0, 0 }, // Engine Speed from EFI
+    { 0x7E0, 0x22, 57, 2, 0, 8, ByteOrder::Motorola, false, true, 1.0f, -4e+01f, 9246, 0, 0 }, // Intake-Air Temp from EFI
+    { 0x7E0, 0x22, 57, 3, 0, 8, ByteOrder::Motorola, false, true, 1.0f, -4e+01f, 9271, 0, 0 }, // Coolant Temp from EFI
+    { 0x7E0, 0x22, 33, 4, 0, 8, ByteOrder::Motorola, false, true, 0.5f, 0.0f, 9293, 0, 0 }, // Accel Position from EFI
+    { 0x7E0, 0x22, 33, 5, 0, 8, ByteOrder::Motorola, false, true, 0.5f, 0.0f, 9317, 0, 0 }, // Throttle Position from EFI
+    { 0x7E0, 0x22, 62, 6, 0, 16, ByteOrder::Motorola, false, true, 0.01953125f, 0.0f, 9344, 0, 0 }, // Injection Volume from EFI
+    { 0x7E0, 0x22, 0, 8, 0, 7, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 9370, 120, 91 }, // Received MIL from ECT
+    { 0x7E0, 0x22, 57, 9, 0, 16, ByteOrder::Motorola, false, true, 0.00390625f, -4e+01f, 9392, 0, 0 }, // A/T Oil Temp from ECT
+    { 0x7E0, 0x22, 0, 11, 0, 3, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 9446, 211, 8 }, // Shift Position Sig from ECT
+    { 0x7E0, 0x22, 39, 12, 0, 8, ByteOrder::Motorola, false, true, 5e+01f, 0.0f, 9474, 0, 0 }, // SPD (NO)
+    { 0x7E0, 0x22, 39, 13, 0, 8, ByteOrder::Motorola, false, true, 5e+01f, 0.0f, 9483, 0, 0 }, // SPD (NT)
+    { 0x7E0, 0x22, 0, 14, 7, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 9492, 2, 2 }, // ECT Lock Up
+    { 0x7E0, 0x22, 39, 15, 0, 8, ByteOrder::Motorola, false, true, 5e+01f, 0.0f, 9504, 0, 0 }, // SPD (NC)
+    { 0x7E0, 0x22, 42, 16, 0, 8, ByteOrder::Motorola, false, true, 1.0f, 0.0f, 9513, 0, 0 }, // SPD (SP2)
+    { 0x7E0, 0x22, 0, 17, 7, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 9523, 2, 2 }, // Stop Light Signal from EFI
+    { 0x7E0, 0x23, 0, 1, 0, 3, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 9574, 219, 5 }, // VN Turbo Type
+    { 0x7E0, 0x24, 0, 0, 0, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 9601, 224, 2 }, // Comm with Reductant Control Module
+    { 0x7E0, 0x24, 0, 0, 1, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 9636, 224, 2 }, // Comm with VALVEMATIC
+    { 0x7E0, 0x24, 0, 0, 2, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 9657, 224, 2 }, // Comm with Air Conditioner
+    { 0x7E0, 0x24, 0, 0, 3, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 9683, 224, 2 }, // Communication with Brake
+    { 0x7E0, 0x24, 0, 0, 4, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 9708, 224, 2 }, // Comm with Driving Support Sys
+    { 0x7E0, 0x24, 0, 0, 5, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 9738, 224, 2 }, // Communication with HV
+    { 0x7E0, 0x24, 0, 0, 6, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 9760, 224, 2 }, // Comm with Power Manage
+    { 0x7E0, 0x24, 0, 0, 7, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 9783, 224, 2 }, // Communication with ECT
+    { 0x7E0, 0x25, 0, 0, 2, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 9806, 2, 2 }, // Stop Light Switch
+    { 0x7E0, 0x25, 0, 0, 3, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 9824, 2, 2 }, // Power Steering Signal
+    { 0x7E0, 0x25, 0, 0, 4, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 9846, 2, 2 }, // Cooler Box Switch
+    { 0x7E0, 0x25, 0, 0, 5, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 9864, 2, 2 }, // Beacon Light Signal
+    { 0x7E0, 0x25, 0, 0, 6, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 9884, 2, 2 }, // Engine Oil Pressure SW
+    { 0x7E0, 0x25, 0, 0, 7, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 9907, 2, 2 }, // Idle Up SW
+    { 0x7E0, 0x25, 0, 1, 0, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 9931, 226, 2 }, // Fuel Select Switch
+    { 0x7E0, 0x25, 0, 1, 1, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 9950, 2, 2 }, // Fuel Lid Switch
+    { 0x7E0, 0x25, 0, 1, 2, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 9977, 228, 2 }, // Fuel Lid
+    { 0x7E0, 0x25, 0, 1, 3, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 9986, 2, 2 }, // Starter Control
+    { 0x7E0, 0x25, 0, 1, 4, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 10002, 2, 2 }, // Starter Signal
+    { 0x7E0, 0x25, 0, 1, 5, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 10017, 2, 2 }, // Clutch Start SW
+    { 0x7E0, 0x25, 0, 2, 4, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 10033, 2, 2 }, // Catalyst Regeneration Switch
+    { 0x7E0, 0x25, 0, 2, 5, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 10062, 2, 2 }, // Clogged Fuel Filter Switch
+    { 0x7E0, 0x25, 0, 2, 6, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 10089, 2, 2 }, // Door Courtesy SW
+    { 0x7E0, 0x25, 0, 2, 7, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 10106, 2, 2 }, // Fuel Cooler SW
+    { 0x7E0, 0x25, 0, 3, 4, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 10121, 2, 2 }, // Electrical Load Signal 4
+    { 0x7E0, 0x25, 0, 3, 5, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 10146, 2, 2 }, // Electrical Load Signal 3
+    { 0x7E0, 0x25, 0, 3, 6, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 10171, 2, 2 }, // Electrical Load Signal 2
+    { 0x7E0, 0x25, 0, 3, 7, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 10196, 2, 2 }, // Electrical Load Signal 1
+    { 0x7E0, 0x25, 0, 4, 0, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 10221, 2, 2 }, // Shift SW Status (L Range)
+    { 0x7E0, 0x25, 0, 4, 1, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 10247, 2, 2 }, // Shift SW Status (2 Range)
+    { 0x7E0, 0x25, 0, 4, 2, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 10273, 2, 2 }, // Shift SW Status (3 Range)
+    { 0x7E0, 0x25, 0, 4, 3, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 10299, 2, 2 }, // Shift SW Status (4 Range)
+    { 0x7E0, 0x25, 0, 4, 4, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 10325, 2, 2 }, // Shift SW Status (D Range)
+    { 0x7E0, 0x25, 0, 4, 5, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 10351, 2, 2 }, // Shift SW Status (N Range)
+    { 0x7E0, 0x25, 0, 4, 6, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 10377, 2, 2 }, // Shift SW Status (R Range)
+    { 0x7E0, 0x25, 0, 4, 7, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 10403, 2, 2 }, // Shift SW Status (P Range)
+    { 0x7E0, 0x25, 0, 5, 2, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 10429, 2, 2 }, // Reverse Switch
+    { 0x7E0, 0x25, 0, 5, 3, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 10444, 2, 2 }, // Shift SW Status (B Range)
+    { 0x7E0, 0x25, 0, 5, 4, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 10470, 2, 2 }, // SD Switch
+    { 0x7E0, 0x25, 0, 5, 5, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 10480, 2, 2 }, // Sports Shift Down SW
+    { 0x7E0, 0x25, 0, 5, 6, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 10501, 2, 2 }, // Sports Shift Up SW
+    { 0x7E0, 0x25, 0, 5, 7, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 10520, 2, 2 }, // Sports Mode Selection SW
+    { 0x7E0, 0x25, 0, 6, 0, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 10545, 2, 2 }, // Normal Mode Switch
+    { 0x7E0, 0x25, 0, 6, 1, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 10564, 2, 2 }, // ECO Switch
+    { 0x7E0, 0x25, 0, 6, 2, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 10575, 2, 2 }, // Snow Switch Status
+    { 0x7E0, 0x25, 0, 6, 3, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 10594, 2, 2 }, // Sports Drive Switch
+    { 0x7E0, 0x25, 0, 6, 4, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 10614, 2, 2 }, // Snow or 2nd Start Mode
+    { 0x7E0, 0x25, 0, 6, 5, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 10637, 2, 2 }, // Pattern Switch (PWR/M)
+    { 0x7E0, 0x25, 0, 6, 6, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 10660, 2, 2 }, // Overdrive Cut Switch #2
+    { 0x7E0, 0x25, 0, 6, 7, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 10684, 2, 2 }, // Overdrive Cut Switch #1
+    { 0x7E0, 0x25, 0, 7, 2, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 10708, 2, 2 }, // TPS 6 Switch
+    { 0x7E0, 0x25, 0, 7, 3, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 10721, 2, 2 }, // TPS 5 Switch
+    { 0x7E0, 0x25, 0, 7, 4, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 10734, 2, 2 }, // TPS 4 Switch
+    { 0x7E0, 0x25, 0, 7, 5, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 10747, 2, 2 }, // TPS 3 Switch
+    { 0x7E0, 0x25, 0, 7, 6, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 10760, 2, 2 }, // TPS 2 Switch
+    { 0x7E0, 0x25, 0, 7, 7, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 10773, 2, 2 }, // TPS 1 Switch
+    { 0x7E0, 0x25, 0, 8, 0, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 10791, 230, 2 }, // Brake Switch Status
+    { 0x7E0, 0x25, 0, 8, 1, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 10811, 2, 2 }, // Brake Switch
+    { 0x7E0, 0x25, 0, 8, 2, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 10824, 2, 2 }, // Neutral Position SW Signal
+    { 0x7E0, 0x25, 0, 8, 3, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 10851, 2, 2 }, // Transfer L4
+    { 0x7E0, 0x25, 0, 8, 4, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 10863, 2, 2 }, // Kick Down Switch Status
+    { 0x7E0, 0x25, 0, 8, 5, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 10887, 2, 2 }, // 4WD SW
+    { 0x7E0, 0x25, 0, 8, 6, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 10894, 2, 2 }, // Transfer Neutral
+    { 0x7E0, 0x25, 0, 8, 7, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 10911, 2, 2 }, // Low Gear Switch
+    { 0x7E0, 0x25, 0, 9, 2, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 10927, 2, 2 }, // Launch Control Switch
+    { 0x7E0, 0x25, 0, 9, 3, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 10824, 2, 2 }, // Neutral Position SW Signal
+    { 0x7E0, 0x25, 0, 9, 4, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 10949, 2, 2 }, // iMT Switch
+    { 0x7E0, 0x25, 0, 9, 5, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 10960, 2, 2 }, // EV City Mode Switch
+    { 0x7E0, 0x25, 0, 9, 6, 2, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 10983, 232, 4 }, // Sports Mode Switch
+    { 0x7E0, 0x25, 0, 10, 0, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 11002, 2, 2 }, // ASL Switch
+    { 0x7E0, 0x25, 0, 10, 2, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 11013, 2, 2 }, // A/C Pressure Abnormal SW
+    { 0x7E0, 0x25, 0, 10, 3, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 11038, 2, 2 }, // A/C Pressure Normal SW
+    { 0x7E0, 0x25, 0, 10, 4, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 11061, 2, 2 }, // Cruise Cancel Signal
+    { 0x7E0, 0x25, 0, 10, 6, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 11082, 2, 2 }, // Clutch Switch
+    { 0x7E0, 0x25, 0, 10, 7, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 11096, 2, 2 }, // Shift Indication Enable
+    { 0x7E0, 0x25, 0, 11, 0, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 11120, 2, 2 }, // Cruise Main SW
+    { 0x7E0, 0x25, 0, 11, 1, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 11135, 2, 2 }, // Throttle Open Switch
+    { 0x7E0, 0x25, 0, 11, 2, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 11156, 2, 2 }, // TC Terminal
+    { 0x7E0, 0x25, 0, 11, 3, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 11168, 2, 2 }, // Key Unlock Signal
+    { 0x7E0, 0x25, 0, 11, 6, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 11186, 2, 2 }, // Idle Up Signal
+    { 0x7E0, 0x25, 0, 11, 7, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 11201, 2, 2 }, // A/C Signal
+    { 0x7E0, 0x25, 0, 15, 7, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 11212, 2, 2 }, // Vehicle Spec Signal 1
+    { 0x7E0, 0x28, 13, 0, 0, 16, ByteOrder::Motorola, false, true, 1.0f, 0.0f, 11234, 0, 0 }, // Total Distance Traveled
+    { 0x7E0, 0x29, 52, 0, 0, 16, ByteOrder::Motorola, false, true, 1.0f, 0.0f, 11258, 0, 0 }, // Previous Trip Alternator Max Output Time
+    { 0x7E0, 0x29, 48, 2, 0, 8, ByteOrder::Motorola, false, true, 0.1f, 0.0f, 11299, 0, 0 }, // Initial Engine Battery Minimum Voltage
+    { 0x7E0, 0x29, 52, 3, 0, 16, ByteOrder::Motorola, false, true, 1.0f, 0.0f, 11338, 0, 0 }, // Previous Trip Charge Control Time
+    { 0x7E0, 0x29, 57, 5, 0, 8, ByteOrder::Motorola, false, true, 1.0f, -4e+01f, 11372, 0, 0 }, // Previous Trip Average Battery Temperature
+    { 0x7E0, 0x2C, 9, 0, 0, 16, ByteOrder::Motorola, false, true, 0.001f, -32.768f, 11414, 0, 0 }, // Auxiliary Battery Average Current during IG OFF 1 Trip before
+    { 0x7E0, 0x2C, 9, 2, 0, 16, ByteOrder::Motorola, false, true, 0.001f, -32.768f, 11476, 0, 0 }, // Auxiliary Battery Average Current during IG OFF 2 Trip before
+    { 0x7E0, 0x2C, 9, 4, 0, 16, ByteOrder::Motorola, false, true, 0.001f, -32.768f, 11538, 0, 0 }, // Auxiliary Battery Average Current during IG OFF 3 Trip before
+    { 0x7E0, 0x2C, 13, 6, 0, 16, ByteOrder::Motorola, false, true, 2.0f, 0.0f, 11600, 0, 0 }, // Total Distance Up to 1 Trip before
+    { 0x7E0, 0x2C, 13, 8, 0, 16, ByteOrder::Motorola, false, true, 2.0f, 0.0f, 11635, 0, 0 }, // Total Distance Up to 2 Trip before
+    { 0x7E0, 0x2C, 13, 10, 0, 16, ByteOrder::Motorola, false, true, 2.0f, 0.0f, 11670, 0, 0 }, // Total Distance Up to 3 Trip before
+    { 0x7E0, 0x2C, 55, 12, 0, 8, ByteOrder::Motorola, false, true, 1.0f, 0.0f, 11705, 0, 0 }, // IG OFF Time before 1 trip
+    { 0x7E0, 0x2C, 55, 13, 0, 8, ByteOrder::Motorola, false, true, 1.0f, 0.0f, 11731, 0, 0 }, // IG OFF Time before 2 trip
+    { 0x7E0, 0x2C, 55, 14, 0, 8, ByteOrder::Motorola, false, true, 1.0f, 0.0f, 11757, 0, 0 }, // IG OFF Time before 3 trip
+    { 0x7E0, 0x2C, 53, 15, 0, 8, ByteOrder::Motorola, false, true, 2.0f, 0.0f, 11783, 0, 0 }, // IG ON Time Up to 1 trip before
+    { 0x7E0, 0x2C, 53, 16, 0, 8, ByteOrder::Motorola, false, true, 2.0f, 0.0f, 11814, 0, 0 }, // IG ON Time Up to 2 trip before
+    { 0x7E0, 0x2C, 53, 17, 0, 8, ByteOrder::Motorola, false, true, 2.0f, 0.0f, 11845, 0, 0 }, // IG ON Time Up to 3 trip before
+    { 0x7E0, 0x2C, 53, 18, 0, 8, ByteOrder::Motorola, false, true, 2.0f, 0.0f, 11876, 0, 0 }, // Engine Run Time before 1 trip
+    { 0x7E0, 0x2C, 53, 19, 0, 8, ByteOrder::Motorola, false, true, 2.0f, 0.0f, 11906, 0, 0 }, // Engine Run Time before 2 trip
+    { 0x7E0, 0x2C, 53, 20, 0, 8, ByteOrder::Motorola, false, true, 2.0f, 0.0f, 11936, 0, 0 }, // Engine Run Time before 3 trip
+    { 0x7E0, 0x2C, 55, 21, 0, 8, ByteOrder::Motorola, false, true, 1.0f, 0.0f, 11966, 0, 0 }, // Time of Long Term Leaving with IG OFF (1st)
+    { 0x7E0, 0x2C, 55, 22, 0, 8, ByteOrder::Motorola, false, true, 1.0f, 0.0f, 12010, 0, 0 }, // Time of Long Term Leaving with IG OFF (2nd)
+    { 0x7E0, 0x2C, 55, 23, 0, 8, ByteOrder::Motorola, false, true, 1.0f, 0.0f, 12054, 0, 0 }, // Time of Long Term Leaving with IG OFF (3rd)
+    { 0x7E0, 0x2C, 13, 24, 0, 16, ByteOrder::Motorola, false, true, 2.0f, 0.0f, 12098, 0, 0 }, // Total Distance Indicated after Long Term Leaving with IG OFF (1st)
+    { 0x7E0, 0x2C, 13, 26, 0, 16, ByteOrder::Motorola, false, true, 2.0f, 0.0f, 12165, 0, 0 }, // Total Distance Indicated after Long Term Leaving with IG OFF (2nd)
+    { 0x7E0, 0x2C, 13, 28, 0, 16, ByteOrder::Motorola, false, true, 2.0f, 0.0f, 12232, 0, 0 }, // Total Distance Indicated after Long Term Leaving with IG OFF (3rd)
+    { 0x7E0, 0x2C, 18, 30, 0, 8, ByteOrder::Motorola, false, true, 0.1f, 0.0f, 12299, 0, 0 }, // Auxiliary Battery Charging Integrated Current
+    { 0x7E0, 0x2C, 18, 34, 0, 8, ByteOrder::Motorola, false, true, 0.1f, 0.0f, 12345, 0, 0 }, // Auxiliary Battery Discharging Integrated Current
+    { 0x7E0, 0x2C, 0, 38, 0, 8, ByteOrder::Motorola, false, true, 1.0f, 0.0f, 12394, 0, 0 }, // Auxiliary Battery Integrated Thermal Load
+    { 0x7E0, 0x2C, 18, 42, 0, 8, ByteOrder::Motorola, false, true, 1.0f, -128.0f, 12436, 0, 0 }, // Auxiliary Battery Capacity after IG ON
+    { 0x7E0, 0x2C, 18, 43, 0, 8, ByteOrder::Motorola, false, true, 1.0f, -128.0f, 12475, 0, 0 }, // Auxiliary Battery Capacity after IG OFF
+    { 0x7E0, 0x2C, 54, 44, 0, 16, ByteOrder::Motorola, false, true, 1.0f, 0.0f, 12515, 0, 0 }, // Integrated Engine Run Time
+    { 0x7E0, 0x2C, 0, 46, 0, 8, ByteOrder::Motorola, false, true, 1.0f, 0.0f, 12542, 0, 0 }, // Number of Long Term Leaving with IG OFF
+    { 0x7E0, 0x30, 5, 0, 0, 16, ByteOrder::Motorola, false, true, 0.009765625f, 0.0f, 12582, 0, 0 }, // Actual VVT Angle #1
+    { 0x7E0, 0x30, 5, 2, 0, 16, ByteOrder::Motorola, false, true, 0.009765625f, 0.0f, 12602, 0, 0 }, // Actual VVT Angle #2
+    { 0x7E0, 0x30, 5, 4, 0, 16, ByteOrder::Motorola, false, true, 0.009765625f, 0.0f, 12622, 0, 0 }, // Actual VVT Ex Angle #1
+    { 0x7E0, 0x30, 5, 6, 0, 16, ByteOrder::Motorola, false, true, 0.009765625f, 0.0f, 12645, 0, 0 }, // Actual VVT Ex Angle #2
+    { 0x7E0, 0x30, 57, 8, 0, 8, ByteOrder::Motorola, false, true, 0.625f, -4e+01f, 12668, 0, 0 }, // Coolant Temp Variation after Waterpump Start
+    { 0x7E0, 0x30, 57, 9, 0, 8, ByteOrder::Motorola, false, true, 0.625f, -4e+01f, 12713, 0, 0 }, // Intake Air Temp Variation after Engine Start
+    { 0x7E0, 0x31, 46, 0, 0, 16, ByteOrder::Motorola, false, true, 0.01f, 0.0f, 12758, 0, 0 }, // MAF #1
+    { 0x7E0, 0x31, 46, 2, 0, 16, ByteOrder::Motorola, false, true, 0.01f, 0.0f, 12765, 0, 0 }, // MAF #2
+    { 0x7E0, 0x31, 57, 4, 0, 8, ByteOrder::Motorola, false, true, 1.0f, -4e+01f, 12772, 0, 0 }, // Intake Air #1
+    { 0x7E0, 0x31, 57, 5, 0, 8, ByteOrder::Motorola, false, true, 1.0f, -4e+01f, 12786, 0, 0 }, // Intake Air #2
+    { 0x7E0, 0x31, 57, 6, 0, 8, ByteOrder::Motorola, false, true, 1.0f, -4e+01f, 6115, 0, 0 }, // Intake Air Temp (Turbo)
+    { 0x7E0, 0x31, 48, 7, 0, 16, ByteOrder::Motorola, false, true, 7.6293945e-05f, 0.0f, 12800, 0, 0 }, // IAC Sensor Voltage
+    { 0x7E0, 0x31, 5, 9, 0, 16, ByteOrder::Motorola, false, true, 0.0076293945f, -2.5e+02f, 12819, 0, 0 }, // Intake Air Control Position
+    { 0x7E0, 0x31, 60, 13, 0, 16, ByteOrder::Motorola, false, true, 0.009765625f, 0.0f, 12847, 0, 0 }, // VALVEMATIC Current Angle
+    { 0x7E0, 0x31, 0, 15, 0, 7, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 12872, 236, 106 }, // VALVEMATIC IG OFF
+    { 0x7E0, 0x31, 0, 15, 0, 7, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 12890, 342, 106 }, // VALVEMATIC IG ON
+    { 0x7E0, 0x31, 0, 15, 0, 7, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 12907, 448, 106 }, // VALVEMATIC Cranking
+    { 0x7E0, 0x31, 0, 15, 0, 7, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 12927, 554, 106 }, // VALVEMATIC bef Warm Up
+    { 0x7E0, 0x31, 0, 15, 0, 7, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 12950, 660, 106 }, // VALVEMATIC IDM Hi Temp
+    { 0x7E0, 0x31, 0, 15, 0, 7, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 12973, 766, 106 }, // VALVEMATIC High(ACT)
+    { 0x7E0, 0x31, 0, 15, 0, 7, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 12994, 872, 106 }, // VALVEMATIC aft Warm Up
+    { 0x7E0, 0x31, 0, 15, 0, 7, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 13017, 978, 106 }, // VALVEMATIC Low(ACT)
+    { 0x7E0, 0x31, 34, 16, 0, 16, ByteOrder::Motorola, false, true, 0.01f, 0.0f, 13037, 0, 0 }, // Balance Pipe Pressure
+    { 0x7E0, 0x31, 48, 18, 0, 8, ByteOrder::Motorola, false, true, 0.01953125f, 0.0f, 13059, 0, 0 }, // VALVEMATIC Shaft Sensor Voltage
+    { 0x7E0, 0x31, 57, 19, 0, 8, ByteOrder::Motorola, false, true, 1.0f, -4e+01f, 13091, 0, 0 }, // Intercooler Coolant Temperature
+    { 0x7E0, 0x33, 56, 10, 0, 8, ByteOrder::Motorola, false, true, 65.536f, 0.0f, 13123, 0, 0 }, // O2 LR Switch Time B1S1
+    { 0x7E0, 0x33, 56, 11, 0, 8, ByteOrder::Motorola, false, true, 65.536f, 0.0f, 13146, 0, 0 }, // O2 LR Switch Time B2S1
+    { 0x7E0, 0x33, 56, 12, 0, 8, ByteOrder::Motorola, false, true, 65.536f, 0.0f, 13169, 0, 0 }, // O2 RL Switch Time B1S1
+    { 0x7E0, 0x33, 56, 13, 0, 8, ByteOrder::Motorola, false, true, 65.536f, 0.0f, 13192, 0, 0 }, // O2 RL Switch Time B2S1
+    { 0x7E0, 0x33, 40, 14, 0, 16, ByteOrder::Motorola, false, true, 0.32421875f, 0.0f, 13215, 0, 0 }, // O2S Impedance B1S2
+    { 0x7E0, 0x33, 40, 16, 0, 16, ByteOrder::Motorola, false, true, 0.32421875f, 0.0f, 13234, 0, 0 }, // O2S Impedance B2S2
+    { 0x7E0, 0x33, 57, 18, 0, 16, ByteOrder::Motorola, false, true, 0.1f, -4e+01f, 6279, 0, 0 }, // Exhaust Temperature B1S1
+    { 0x7E0, 0x33, 57, 20, 0, 16, ByteOrder::Motorola, false, true, 0.1f, -4e+01f, 6304, 0, 0 }, // Exhaust Temperature B1S2
+    { 0x7E0, 0x33, 57, 22, 0, 16, ByteOrder::Motorola, false, true, 0.1f, -4e+01f, 6484, 0, 0 }, // Exhaust Temperature B2S1
+    { 0x7E0, 0x33, 57, 24, 0, 16, ByteOrder::Motorola, false, true, 0.1f, -4e+01f, 6509, 0, 0 }, // Exhaust Temperature B2S2
+    { 0x7E0, 0x33, 34, 26, 0, 8, ByteOrder::Motorola, false, true, 1.0f, 0.0f, 13253, 0, 0 }, // Air Pump Pressure (Absolute)
+    { 0x7E0, 0x33, 34, 28, 0, 8, ByteOrder::Motorola, false, true, 1.0f, 0.0f, 13282, 0, 0 }, // Air Pump2 Pressure (Absolute)
+    { 0x7E0, 0x33, 34, 30, 0, 16, ByteOrder::Motorola, false, true, 0.01f, -327.68f, 13312, 0, 0 }, // DPF Differential Pressure
+    { 0x7E0, 0x33, 34, 32, 0, 16, ByteOrder::Motorola, false, true, 0.01f, 0.0f, 13338, 0, 0 }, // DPR/DPNR Absolute Pressure
+    { 0x7E0, 0x33, 48, 34, 0, 16, ByteOrder::Motorola, false, true, 7.6293945e-05f, 0.0f, 13365, 0, 0 }, // VN Position Sensor Out
+    { 0x7E0, 0x33, 48, 36, 0, 16, ByteOrder::Motorola, false, true, 7.6293945e-05f, 0.0f, 13388, 0, 0 }, // VN Position Sensor Out #2
+    { 0x7E0, 0x33, 40, 38, 0, 8, ByteOrder::Motorola, false, true, 0.32421875f, 0.0f, 13414, 0, 0 }, // A/F Sensor Impedance B1S2
+    { 0x7E0, 0x35, 57, 0, 0, 8, ByteOrder::Motorola, false, true, 1.0f, -4e+01f, 13440, 0, 0 }, // Radiator Coolant Temp
+    { 0x7E0, 0x35, 36, 1, 0, 16, ByteOrder::Motorola, false, true, 0.000390625f, 0.0f, 13462, 0, 0 }, // Power Steering Pressure
+    { 0x7E0, 0x35, 34, 3, 0, 16, ByteOrder::Motorola, false, true, 0.022f, 0.0f, 13486, 0, 0 }, // Engine Oil Pressure
+    { 0x7E0, 0x35, 48, 5, 0, 8, ByteOrder::Motorola, false, true, 0.01953125f, 0.0f, 13506, 0, 0 }, // PCV Voltage for Oil Tank
+    { 0x7E0, 0x35, 48, 6, 0, 8, ByteOrder::Motorola, false, true, 0.01953125f, 0.0f, 13531, 0, 0 }, // PCV Voltage for Ventilation Case
+    { 0x7E0, 0x35, 48, 7, 0, 16, ByteOrder::Motorola, false, true, 7.6293945e-05f, 0.0f, 13564, 0, 0 }, // Brake Boost Pressure Sensor
+    { 0x7E0, 0x35, 48, 9, 0, 16, ByteOrder::Motorola, false, true, 7.6293945e-05f, 0.0f, 13592, 0, 0 }, // Atmospheric Pressure Sensor
+    { 0x7E0, 0x37, 57, 0, 0, 8, ByteOrder::Motorola, false, true, 0.625f, -4e+01f, 13620, 0, 0 }, // Initial Engine Coolant Temp
+    { 0x7E0, 0x37, 57, 1, 0, 8, ByteOrder::Motorola, false, true, 0.625f, -4e+01f, 13648, 0, 0 }, // Initial Intake Air Temp
+    { 0x7E0, 0x37, 36, 2, 0, 16, ByteOrder::Motorola, false, true, 0.001953125f, 0.0f, 13672, 0, 0 }, // FPrs diff / Relief Vlv op
+    { 0x7E0, 0x37, 34, 4, 0, 16, ByteOrder::Motorola, false, true, 0.01f, 0.0f, 13698, 0, 0 }, // Air Pump Pulsation Pressure
+    { 0x7E0, 0x37, 34, 6, 0, 16, ByteOrder::Motorola, false, true, 0.01f, 0.0f, 13726, 0, 0 }, // Air Pump2 Pulsation Pressure
+    { 0x7E0, 0x37, 60, 8, 0, 16, ByteOrder::Motorola, false, true, 0.03125f, -1024.0f, 13755, 0, 0 }, // Knock Correct Learn Value
+    { 0x7E0, 0x37, 60, 10, 0, 16, ByteOrder::Motorola, false, true, 0.03125f, -1024.0f, 13781, 0, 0 }, // Knock Feedback Value
+    { 0x7E0, 0x37, 0, 12, 0, 8, ByteOrder::Motorola, false, true, 0.0061035156f, -2e+02f, 13802, 0, 0 }, // Purge Density Learn Value
+    { 0x7E0, 0x37, 33, 14, 0, 16, ByteOrder::Motorola, false, true, 0.0061035156f, 0.0f, 13828, 0, 0 }, // Evap Purge Flow
+    { 0x7E0, 0x37, 53, 16, 0, 16, ByteOrder::Motorola, false, true, 1e+01f, 0.0f, 13844, 0, 0 }, // IG OFF Elapsed Time
+    { 0x7E0, 0x37, 13, 18, 0, 16, ByteOrder::Motorola, false, true, 1.0f, 0.0f, 13864, 0, 0 }, // Dist Batt Cable Disconnect
+    { 0x7E0, 0x37, 0, 20, 6, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 13897, 1084, 2 }, // Diesel Throttle Learn Status
+    { 0x7E0, 0x37, 0, 20, 7, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 13926, 1084, 2 }, // EGR Close Lrn. Status
+    { 0x7E0, 0x37, 0, 21, 0, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 13948, 2, 2 }, // FC TAU
+    { 0x7E0, 0x37, 0, 21, 1, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 13955, 2, 2 }, // Idle Fuel Cut
+    { 0x7E0, 0x37, 0, 21, 2, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 13969, 2, 2 }, // Closed Throttle Position SW
+    { 0x7E0, 0x37, 0, 21, 3, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 14011, 1086, 2 }, // AI Test
+    { 0x7E0, 0x37, 0, 21, 4, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 14019, 1084, 2 }, // Throttle Learning
+    { 0x7E0, 0x37, 0, 21, 6, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 14037, 2, 2 }, // Fuel Cut Condition
+    { 0x7E0, 0x37, 0, 21, 7, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 14056, 2, 2 }, // Immobiliser Communication
+    { 0x7E0, 0x37, 0, 22, 4, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 14082, 2, 2 }, // Brake Override System
+    { 0x7E0, 0x37, 0, 22, 5, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 14104, 2, 2 }, // Auto Shift Up Status
+    { 0x7E0, 0x37, 0, 23, 1, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 14125, 2, 2 }, // Air Switching Valve2 Freeze
+    { 0x7E0, 0x37, 0, 23, 2, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 14153, 2, 2 }, // Air Switching Valve Freeze
+    { 0x7E0, 0x37, 0, 23, 3, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 14180, 2, 2 }, // Air Pump2 Freeze
+    { 0x7E0, 0x37, 0, 23, 4, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 14197, 2, 2 }, // Air Pump Freeze
+    { 0x7E0, 0x37, 0, 23, 6, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 14213, 2, 2 }, // Subfreezing Conditions
+    { 0x7E0, 0x37, 57, 24, 0, 8, ByteOrder::Motorola, false, true, 1.0f, -4e+01f, 14236, 0, 0 }, // Engine Oil Temp for Eng Start
+    { 0x7E0, 0x37, 34, 25, 0, 16, ByteOrder::Motorola, false, true, 0.022f, 0.0f, 14266, 0, 0 }, // Engine Oil Press for Eng Start
+    { 0x7E0, 0x37, 0, 27, 0, 8, ByteOrder::Motorola, false, true, 1.0f, 0.0f, 14297, 0, 0 }, // PCV Volt Vibration for Oil Tank
+    { 0x7E0, 0x37, 0, 28, 0, 8, ByteOrder::Motorola, false, true, 1.0f, 0.0f, 14329, 0, 0 }, // PCV Volt Vibration for Ventilation Case
+    { 0x7E0, 0x37, 34, 29, 0, 16, ByteOrder::Motorola, false, true, 0.01f, -327.68f, 14369, 0, 0 }, // Balance Pipe Relative Pressure
+    { 0x7E0, 0x37, 60, 31, 0, 16, ByteOrder::Motorola, false, true, 0.03125f, 0.0f, 14400, 0, 0 }, // Knock Sensor Lowest Learning Value
+    { 0x7E0, 0x37, 0, 33, 0, 3, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 14533, 1088, 6 }, // Exhaust Exterior Valve Status (Valve 1)
+    { 0x7E0, 0x37, 0, 34, 0, 3, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 14573, 1088, 6 }, // Exhaust Exterior Valve Status (Valve 2)
+    { 0x7E0, 0x38, 33, 0, 0, 8, ByteOrder::Motorola, false, true, 0.39215687f, 0.0f, 14613, 0, 0 }, // Accel Position
+    { 0x7E0, 0x38, 48, 1, 0, 16, ByteOrder::Motorola, false, true, 7.6293945e-05f, 0.0f, 14628, 0, 0 }, // VN Close Learn Value
+    { 0x7E0, 0x38, 48, 3, 0, 16, ByteOrder::Motorola, false, true, 7.6293945e-05f, 0.0f, 14649, 0, 0 }, // VN Close Learn Value #2
+    { 0x7E0, 0x38, 33, 5, 0, 8, ByteOrder::Motorola, false, true, 0.5f, 0.0f, 14673, 0, 0 }, // VN Turbo Min Angle
+    { 0x7E0, 0x38, 33, 6, 0, 8, ByteOrder::Motorola, false, true, 0.5f, 0.0f, 14692, 0, 0 }, // VN Turbo Max Angle
+    { 0x7E0, 0x38, 0, 7, 0, 8, ByteOrder::Motorola, false, true, 0.001f, -32.768f, 14711, 0, 0 }, // Catalyst Differential Press
+    { 0x7E0, 0x38, 0, 9, 0, 8, ByteOrder::Motorola, false, true, 0.001f, -32.768f, 14739, 0, 0 }, // Catalyst Differential Press #2
+    { 0x7E0, 0x38, 34, 11, 0, 16, ByteOrder::Motorola, false, true, 0.01f, -327.68f, 14770, 0, 0 }, // Diff. Press. Sensor Corr.
+    { 0x7E0, 0x38, 34, 13, 0, 16, ByteOrder::Motorola, false, true, 0.01f, -327.68f, 14796, 0, 0 }, // Diff Press Sensor Corr #2
+    { 0x7E0, 0x38, 33, 15, 0, 8, ByteOrder::Motorola, false, true, 2.0f, 0.0f, 14822, 0, 0 }, // PM Accumulation Ratio
+    { 0x7E0, 0x38, 33, 16, 0, 8, ByteOrder::Motorola, false, true, 2.0f, 0.0f, 14844, 0, 0 }, // PM Accumulation Ratio #2
+    { 0x7E0, 0x38, 33, 17, 0, 8, ByteOrder::Motorola, false, true, 2.0f, 0.0f, 14869, 0, 0 }, // Sulfur Accumulation Ratio
+    { 0x7E0, 0x38, 33, 18, 0, 8, ByteOrder::Motorola, false, true, 2.0f, 0.0f, 14895, 0, 0 }, // Sulfur Accumulation Ratio #2
+    { 0x7E0, 0x38, 48, 19, 0, 16, ByteOrder::Motorola, false, true, 0.0012207031f, 0.0f, 14924, 0, 0 }, // AF Sensor Learning Value
+    { 0x7E0, 0x38, 48, 21, 0, 16, ByteOrder::Motorola, false, true, 0.0012207031f, 0.0f, 14949, 0, 0 }, // AF Sensor Learning Value #2
+    { 0x7E0, 0x38, 0, 23, 0, 8, ByteOrder::Motorola, false, true, 0.01f, -327.68f, 14977, 0, 0 }, // Exhaust Fuel Addition FB
+    { 0x7E0, 0x38, 0, 25, 0, 8, ByteOrder::Motorola, false, true, 0.01f, -327.68f, 15002, 0, 0 }, // Exhaust Fuel Addition FB #2
+    { 0x7E0, 0x38, 0, 27, 0, 2, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 15052, 1094, 4 }, // DPNR Status Reju (S)
+    { 0x7E0, 0x38, 0, 28, 0, 2, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 15073, 1094, 4 }, // DPNR/DPF Status Reju(PM)
+    { 0x7E0, 0x38, 33, 29, 0, 8, ByteOrder::Motorola, false, true, 0.5f, 0.0f, 15098, 0, 0 }, // Alternate Duty Ratio
+    { 0x7E0, 0x38, 0, 30, 0, 8, ByteOrder::Motorola, false, true, 1.0f, 0.0f, 15119, 0, 0 }, // Soot Blow Control Canceled Max Continuous Count
+    { 0x7E0, 0x38, 0, 31, 0, 8, ByteOrder::Motorola, false, true, 1.0f, 0.0f, 15167, 0, 0 }, // Soot Blow Control Canceled Accumulation Count
+    { 0x7E0, 0x39, 0, 0, 0, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 15213, 2, 2 }, // ACT VSV
+    { 0x7E0, 0x39, 0, 0, 1, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 15221, 2, 2 }, // Variable Intake Control VSV
+    { 0x7E0, 0x39, 0, 0, 2, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 15249, 2, 2 }, // Fuel Pressure Up VSV
+    { 0x7E0, 0x39, 0, 0, 3, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 15270, 2, 2 }, // EGR VSV
+    { 0x7E0, 0x39, 0, 0, 4, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 15278, 2, 2 }, // ACIS VSV
+    { 0x7E0, 0x39, 0, 0, 5, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 15287, 2, 2 }, // Fuel Pump Speed Control
+    { 0x7E0, 0x39, 0, 0, 6, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 15311, 2, 2 }, // Secondary Air Control VSV
+    { 0x7E0, 0x39, 0, 0, 7, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 15337, 2, 2 }, // Swirl Control Valve VSV
+    { 0x7E0, 0x39, 0, 1, 0, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 15361, 2, 2 }, // Idle Up VSV
+    { 0x7E0, 0x39, 0, 1, 1, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 15373, 2, 2 }, // Fuel Pump/Speed Status
+    { 0x7E0, 0x39, 0, 1, 2, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 15396, 2, 2 }, // Purge Cut VSV
+    { 0x7E0, 0x39, 0, 1, 3, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 15410, 2, 2 }, // A/C Magnetic Clutch Relay
+    { 0x7E0, 0x39, 0, 1, 4, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 15436, 2, 2 }, // EVAP Purge VSV
+    { 0x7E0, 0x39, 0, 1, 6, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 15451, 2, 2 }, // VVT Control Status #2
+    { 0x7E0, 0x39, 0, 1, 7, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 15473, 2, 2 }, // Intake Air Control VSV
+    { 0x7E0, 0x39, 0, 2, 1, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 15496, 2, 2 }, // VVT Control Status #1
+    { 0x7E0, 0x39, 0, 2, 2, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 15518, 2, 2 }, // Boost Pressure Control VSV
+    { 0x7E0, 0x39, 0, 2, 5, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 15473, 2, 2 }, // Intake Air Control VSV
+    { 0x7E0, 0x39, 0, 2, 6, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 15545, 2, 2 }, // Exhaust Switching Control VSV
+    { 0x7E0, 0x39, 0, 2, 7, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 15575, 2, 2 }, // Exhaust Bypass Control VSV
+    { 0x7E0, 0x39, 0, 3, 0, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 15602, 2, 2 }, // Idle Fuel Cut Prohibit
+    { 0x7E0, 0x39, 0, 3, 1, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 15625, 2, 2 }, // TC and TE1
+    { 0x7E0, 0x39, 0, 3, 2, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 15636, 2, 2 }, // ACM Inhibit
+    { 0x7E0, 0x39, 0, 3, 3, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 15648, 2, 2 }, // Fuel Shutoff Valve for Delivery Pipe
+    { 0x7E0, 0x39, 0, 3, 4, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 15685, 2, 2 }, // Regulator Shut Valve
+    { 0x7E0, 0x39, 0, 3, 5, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 15706, 2, 2 }, // Fuel Pressure Status Stoichiometric
+    { 0x7E0, 0x39, 0, 3, 6, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 15742, 2, 2 }, // Fuel Pressure Status Stratification
+    { 0x7E0, 0x39, 0, 3, 7, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 15778, 2, 2 }, // HC Adsorber Catalyst Switching VSV
+    { 0x7E0, 0x39, 0, 4, 0, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 15813, 2, 2 }, // Canister Control VSV
+    { 0x7E0, 0x39, 0, 4, 1, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 15834, 2, 2 }, // Tank Bypass VSV
+    { 0x7E0, 0x39, 0, 4, 2, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 15850, 2, 2 }, // VVTL System #1
+    { 0x7E0, 0x39, 0, 4, 3, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 15865, 2, 2 }, // VVTL System #2
+    { 0x7E0, 0x39, 0, 4, 4, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 15880, 2, 2 }, // AICV VSV
+    { 0x7E0, 0x39, 0, 4, 5, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 15889, 2, 2 }, // Electric Fan Motor
+    { 0x7E0, 0x39, 0, 4, 6, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 15908, 2, 2 }, // EVAP System Vent Valve
+    { 0x7E0, 0x39, 0, 4, 7, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 15931, 2, 2 }, // Vacuum Pump
+    { 0x7E0, 0x39, 0, 5, 0, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 15943, 2, 2 }, // Starter Relay
+    { 0x7E0, 0x39, 0, 5, 1, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 15957, 2, 2 }, // ACC Relay
+    { 0x7E0, 0x39, 0, 5, 2, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 15967, 2, 2 }, // Intank Fuel Pump
+    { 0x7E0, 0x39, 0, 5, 3, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 15984, 2, 2 }, // Fuel Route Switching Valve
+    { 0x7E0, 0x39, 0, 5, 4, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 16020, 1098, 2 }, // Fuel Press Switching Valve
+    { 0x7E0, 0x39, 0, 5, 5, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 16047, 2, 2 }, // Air Pump Heater
+    { 0x7E0, 0x39, 0, 5, 6, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 15967, 2, 2 }, // Intank Fuel Pump
+    { 0x7E0, 0x39, 0, 5, 7, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 15984, 2, 2 }, // Fuel Route Switching Valve
+    { 0x7E0, 0x39, 0, 6, 0, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 16063, 2, 2 }, // Sub Fuel Tank VSV
+    { 0x7E0, 0x39, 0, 6, 6, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 16092, 1100, 2 }, // Brake Ejector VSV
+    { 0x7E0, 0x39, 0, 7, 0, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 16110, 2, 2 }, // EGR Cut VSV
+    { 0x7E0, 0x39, 0, 7, 5, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 16122, 2, 2 }, // Exhaust Pressure Control VSV
+    { 0x7E0, 0x39, 0, 8, 3, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 16151, 2, 2 }, // Fuel Vapor-Containment Valve
+    { 0x7E0, 0x39, 0, 8, 4, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 16180, 2, 2 }, // Fuel Filler Opener
+    { 0x7E0, 0x39, 0, 9, 2, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 16199, 2, 2 }, // Pressure Discharge Valve
+    { 0x7E0, 0x39, 0, 9, 6, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 16224, 2, 2 }, // HC Adsorber Catalyst VSV
+    { 0x7E0, 0x39, 0, 10, 0, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 16249, 2, 2 }, // Eng Oil Press Switch Valve
+    { 0x7E0, 0x39, 0, 10, 1, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 16276, 2, 2 }, // Exhaust Switching Valve
+    { 0x7E0, 0x39, 0, 10, 2, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 16300, 1100, 2 }, // Fuel Return Pipe Valve
+    { 0x7E0, 0x39, 0, 10, 4, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 16323, 1102, 2 }, // Coolant Water Route Switching Valve
+    { 0x7E0, 0x3A, 33, 0, 0, 8, ByteOrder::Motorola, false, true, 0.5f, 0.0f, 16359, 0, 0 }, // ISC Duty
+    { 0x7E0, 0x3A, 33, 2, 0, 8, ByteOrder::Motorola, false, true, 1.0f, -128.0f, 16368, 0, 0 }, // Swirl C.V. Duty Ratio
+    { 0x7E0, 0x3A, 33, 3, 0, 8, ByteOrder::Motorola, false, true, 1.0f, -128.0f, 16390, 0, 0 }, // Tumble C.V Duty Ratio
+    { 0x7E0, 0x3A, 33, 4, 0, 8, ByteOrder::Motorola, false, true, 1.0f, 0.0f, 16412, 0, 0 }, // ACM
+    { 0x7E0, 0x3A, 33, 5, 0, 16, ByteOrder::Motorola, false, true, 0.0061035156f, -2e+02f, 16416, 0, 0 }, // ACIS Motor Duty
+    { 0x7E0, 0x3A, 33, 7, 0, 16, ByteOrder::Motorola, false, true, 0.0061035156f, 0.0f, 16432, 0, 0 }, // Resonator Mot Duty
+    { 0x7E0, 0x3A, 60, 9, 0, 16, ByteOrder::Motorola, false, true, 0.009765625f, 0.0f, 16451, 0, 0 }, // VALVEMATIC Target Angle
+    { 0x7E0, 0x3A, 39, 11, 0, 8, ByteOrder::Motorola, false, true, 25.0f, 0.0f, 16475, 0, 0 }, // Elec Water Pump Target Spd
+    { 0x7E0, 0x3A, 39, 12, 0, 8, ByteOrder::Motorola, false, true, 25.0f, 0.0f, 16502, 0, 0 }, // Elec Water Pump Spd
+    { 0x7E0, 0x3A, 33, 13, 0, 16, ByteOrder::Motorola, false, true, 0.0061035156f, 0.0f, 16522, 0, 0 }, // Purge Cut VSV Duty
+    { 0x7E0, 0x3A, 33, 15, 0, 16, ByteOrder::Motorola, false, true, 0.0061035156f, 0.0f, 15270, 0, 0 }, // EGR VSV
+    { 0x7E0, 0x3A, 33, 17, 0, 16, ByteOrder::Motorola, false, true, 0.0061035156f, 0.0f, 16541, 0, 0 }, // A/F Heater Duty B1S1
+    { 0x7E0, 0x3A, 33, 19, 0, 16, ByteOrder::Motorola, false, true, 0.0061035156f, 0.0f, 16562, 0, 0 }, // A/F Heater Duty B2S1
+    { 0x7E0, 0x3A, 9, 21, 0, 16, ByteOrder::Motorola, false, true, 7.6293945e-05f, 0.0f, 16583, 0, 0 }, // O2 Heater Curr Val B1S1
+    { 0x7E0, 0x3A, 9, 23, 0, 16, ByteOrder::Motorola, false, true, 7.6293945e-05f, 0.0f, 16607, 0, 0 }, // O2 Heater Curr Val B2S1
+    { 0x7E0, 0x3A, 9, 25, 0, 16, ByteOrder::Motorola, false, true, 7.6293945e-05f, 0.0f, 16631, 0, 0 }, // O2 Heater Curr Val B1S2
+    { 0x7E0, 0x3A, 9, 27, 0, 16, ByteOrder::Motorola, false, true, 7.6293945e-05f, 0.0f, 16655, 0, 0 }, // O2 Heater Curr Val B2S2
+    { 0x7E0, 0x3A, 0, 29, 2, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 16694, 1104, 2 }, // O2 Heater B2S2
+    { 0x7E0, 0x3A, 0, 29, 3, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 16709, 1104, 2 }, // O2 Heater B1S2
+    { 0x7E0, 0x3A, 0, 29, 4, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 16724, 2, 2 }, // O2 Heater B2S1
+    { 0x7E0, 0x3A, 0, 29, 5, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 16739, 2, 2 }, // O2 Heater B1S1
+    { 0x7E0, 0x3A, 0, 29, 6, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 16754, 2, 2 }, // TCV Status
+    { 0x7E0, 0x3A, 0, 29, 7, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 16765, 2, 2 }, // SCV Status (D4)
+    { 0x7E0, 0x3A, 33, 30, 0, 8, ByteOrder::Motorola, false, true, 0.5f, 0.0f, 16781, 0, 0 }, // Purge Dilution Valve Duty(Bank 1)
+    { 0x7E0, 0x3A, 33, 31, 0, 8, ByteOrder::Motorola, false, true, 0.5f, 0.0f, 16815, 0, 0 }, // Purge Dilution Valve Duty(Bank 2)
+    { 0x7E0, 0x3A, 33, 32, 0, 16, ByteOrder::Motorola, false, true, 0.0061035156f, 0.0f, 16849, 0, 0 }, // Fuel Pump Duty
+    { 0x7E0, 0x3A, 33, 34, 0, 8, ByteOrder::Motorola, false, true, 0.5f, 0.0f, 16864, 0, 0 }, // VN Motor Duty
+    { 0x7E0, 0x3A, 33, 35, 0, 8, ByteOrder::Motorola, false, true, 0.5f, 0.0f, 16878, 0, 0 }, // VN Motor Duty #2
+    { 0x7E0, 0x3A, 0, 36, 1, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 16895, 2, 2 }, // Injection EDU Relay Request #2
+    { 0x7E0, 0x3A, 0, 36, 2, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 16926, 2, 2 }, // Injection EDU Relay Request
+    { 0x7E0, 0x3A, 0, 36, 3, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 16954, 2, 2 }, // Glow Relay Request #2
+    { 0x7E0, 0x3A, 0, 36, 4, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 16976, 2, 2 }, // Glow Relay Request
+    { 0x7E0, 0x3A, 0, 36, 5, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 16995, 2, 2 }, // Idle Signal Output Value #2
+    { 0x7E0, 0x3A, 0, 36, 6, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 17023, 2, 2 }, // Idle Signal Output Value
+    { 0x7E0, 0x3A, 0, 36, 7, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 17048, 2, 2 }, // Viscous Heater Stop Request
+    { 0x7E0, 0x3A, 0, 37, 4, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 17076, 2, 2 }, // Electric Cooling Fan Low
+    { 0x7E0, 0x3A, 0, 37, 5, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 17101, 2, 2 }, // Electric Cooling Fan High
+    { 0x7E0, 0x3A, 0, 37, 6, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 17127, 2, 2 }, // Exhaust Fuel Addition Injector Status #2
+    { 0x7E0, 0x3A, 0, 37, 7, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 17168, 2, 2 }, // Exhaust Fuel Addition Injector Status
+    { 0x7E0, 0x3A, 33, 38, 0, 8, ByteOrder::Motorola, false, true, 0.5f, 0.0f, 17206, 0, 0 }, // Glow Control Unit Duty
+    { 0x7E0, 0x3A, 33, 39, 0, 8, ByteOrder::Motorola, false, true, 0.5f, 0.0f, 17229, 0, 0 }, // Electric Cooling Fan Request Duty
+    { 0x7E0, 0x3A, 33, 40, 0, 8, ByteOrder::Motorola, false, true, 0.5f, 0.0f, 17263, 0, 0 }, // Electric Cooling Fan Request Duty #2
+    { 0x7E0, 0x3A, 9, 41, 0, 16, ByteOrder::Motorola, false, true, 0.001f, 0.0f, 17300, 0, 0 }, // A/F Heater Current Value B1S2
+    { 0x7E0, 0x3A, 33, 43, 0, 16, ByteOrder::Motorola, false, true, 0.0061035156f, 0.0f, 17330, 0, 0 }, // A/F Heater Duty B1S2
+    { 0x7E0, 0x3A, 33, 45, 0, 8, ByteOrder::Motorola, false, true, 0.5f, 0.0f, 17351, 0, 0 }, // Delivery Heater Duty Ratio
+    { 0x7E0, 0x3A, 33, 46, 0, 8, ByteOrder::Motorola, false, true, 0.5f, 0.0f, 17378, 0, 0 }, // Exhaust Exterior Valve Duty Ratio (Valve 1)
+    { 0x7E0, 0x3A, 33, 47, 0, 8, ByteOrder::Motorola, false, true, 0.5f, 0.0f, 17422, 0, 0 }, // Exhaust Exterior Valve Duty Ratio (Valve 2)
+    { 0x7E0, 0x3A, 33, 48, 0, 16, ByteOrder::Motorola, false, true, 0.0061035156f, 0.0f, 17466, 0, 0 }, // Intercooler Water Pump Duty Ratio
+    { 0x7E0, 0x3C, 24, 0, 0, 16, ByteOrder::Motorola, false, true, 3.125e-05f, 0.0f, 17500, 0, 0 }, // Injection Volum (Cylinder1)
+    { 0x7E0, 0x3C, 31, 2, 0, 16, ByteOrder::Motorola, false, true, 1.0f, 0.0f, 17528, 0, 0 }, // Injection Time (D4)
+    { 0x7E0, 0x3C, 31, 4, 0, 16, ByteOrder::Motorola, false, true, 1.0f, 0.0f, 17548, 0, 0 }, // Injector (Port)
+    { 0x7E0, 0x3C, 0, 6, 0, 8, ByteOrder::Motorola, false, true, 0.00390625f, -0.5f, 17564, 0, 0 }, // Total FT #1
+    { 0x7E0, 0x3C, 0, 7, 0, 8, ByteOrder::Motorola, false, true, 0.00390625f, -0.5f, 17576, 0, 0 }, // Total FT #2
+    { 0x7E0, 0x3C, 60, 8, 0, 16, ByteOrder::Motorola, false, true, 0.1f, -3276.8f, 17588, 0, 0 }, // Injection Timing (D4)
+    { 0x7E0, 0x3C, 33, 10, 0, 8, ByteOrder::Motorola, false, true, 0.5f, 0.0f, 17610, 0, 0 }, // Fuel Pump Duty (D4)
+    { 0x7E0, 0x3C, 33, 11, 0, 8, ByteOrder::Motorola, false, true, 0.5f, 0.0f, 17630, 0, 0 }, // Fuel Pump2 Duty (D4)
+    { 0x7E0, 0x3C, 24, 12, 0, 16, ByteOrder::Motorola, false, true, 3.125e-05f, 0.0f, 17651, 0, 0 }, // HP FP Discharge Rate
+    { 0x7E0, 0x3C, 24, 14, 0, 16, ByteOrder::Motorola, false, true, 3.125e-05f, 0.0f, 17672, 0, 0 }, // HP FP Discharge Rate 2
+    { 0x7E0, 0x3C, 36, 16, 0, 16, ByteOrder::Motorola, false, true, 0.001f, 0.0f, 17695, 0, 0 }, // Fuel Pressure Target Value
+    { 0x7E0, 0x3C, 0, 18, 0, 3, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 17759, 1106, 5 }, // Combustion Status (D4)
+    { 0x7E0, 0x3C, 0, 19, 0, 2, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 17807, 1111, 4 }, // Injection Way
+    { 0x7E0, 0x3C, 0, 20, 7, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 17821, 1084, 2 }, // Injection Switching Status
+    { 0x7E0, 0x3C, 0, 21, 6, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 17848, 2, 2 }, // Fuel Dilution Status
+    { 0x7E0, 0x3C, 0, 21, 7, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 17869, 73, 2 }, // Alcohol Density Learning
+    { 0x7E0, 0x3C, 33, 22, 0, 16, ByteOrder::Motorola, false, true, 0.0061035156f, 0.0f, 17894, 0, 0 }, // High Pres FP Duty
+    { 0x7E0, 0x3C, 33, 26, 0, 16, ByteOrder::Motorola, false, true, 0.0061035156f, 0.0f, 17912, 0, 0 }, // Alcohol Feedback Value
+    { 0x7E0, 0x3C, 0, 28, 0, 8, ByteOrder::Motorola, false, true, 1.0f, 0.0f, 17935, 0, 0 }, // Trip aft F/Crrctn by Stall
+    { 0x7E0, 0x3C, 33, 29, 0, 16, ByteOrder::Motorola, false, true, 0.0061035156f, 0.0f, 17962, 0, 0 }, // Alc FB Val bfr F/Crrctn by Stall
+    { 0x7E0, 0x3C, 24, 31, 0, 16, ByteOrder::Motorola, false, true, 0.01953125f, 0.0f, 17995, 0, 0 }, // Fuel Dilution Estimate
+    { 0x7E0, 0x3C, 33, 33, 0, 16, ByteOrder::Motorola, false, true, 0.0061035156f, 0.0f, 18018, 0, 0 }, // Sub Injector VSV Duty
+    { 0x7E0, 0x3C, 0, 35, 7, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 18040, 2, 2 }, // Sub Fuel Tank Pump Relay
+    { 0x7E0, 0x3C, 36, 36, 0, 16, ByteOrder::Motorola, false, true, 0.001953125f, -64.0f, 18065, 0, 0 }, // High Fuel Pressure Sensor
+    { 0x7E0, 0x3C, 34, 38, 0, 16, ByteOrder::Motorola, false, true, 0.022f, -720.896f, 18091, 0, 0 }, // Low Fuel Pressure Sensor
+    { 0x7E0, 0x3C, 13, 40, 0, 16, ByteOrder::Motorola, false, true, 0.1f, 0.0f, 18116, 0, 0 }, // Distance from Injector Maintenance
+    { 0x7E0, 0x3D, 31, 0, 0, 16, ByteOrder::Motorola, false, true, 1.0f, 0.0f, 18151, 0, 0 }, // Pilot 1 Injection Period
+    { 0x7E0, 0x3D, 31, 2, 0, 16, ByteOrder::Motorola, false, true, 1.0f, 0.0f, 18176, 0, 0 }, // Pilot 2 Injection Period
+    { 0x7E0, 0x3D, 31, 4, 0, 16, ByteOrder::Motorola, false, true, 1.0f, 0.0f, 18201, 0, 0 }, // Main Injection Period
+    { 0x7E0, 0x3D, 31, 6, 0, 16, ByteOrder::Motorola, false, true, 1.0f, 0.0f, 18223, 0, 0 }, // After Injection Period
+    { 0x7E0, 0x3D, 60, 8, 0, 16, ByteOrder::Motorola, false, true, 0.0078125f, -2.1e+02f, 18246, 0, 0 }, // Pilot 1 Injection Timing
+    { 0x7E0, 0x3D, 60, 10, 0, 16, ByteOrder::Motorola, false, true, 0.0078125f, -2.1e+02f, 18271, 0, 0 }, // Pilot 2 Injection Timing
+    { 0x7E0, 0x3D, 60, 12, 0, 16, ByteOrder::Motorola, false, true, 0.0078125f, -2.1e+02f, 18296, 0, 0 }, // After Injection Timing
+    { 0x7E0, 0x3D, 62, 14, 0, 8, ByteOrder::Motorola, false, true, 0.15625f, -2e+01f, 18319, 0, 0 }, // Inj Vol Feedback Learning
+    { 0x7E0, 0x3D, 62, 15, 0, 8, ByteOrder::Motorola, false, true, 0.15625f, -2e+01f, 18345, 0, 0 }, // Injection Feedback Val #1
+    { 0x7E0, 0x3D, 62, 16, 0, 8, ByteOrder::Motorola, false, true, 0.15625f, -2e+01f, 18371, 0, 0 }, // Injection Feedback Val #2
+    { 0x7E0, 0x3D, 62, 17, 0, 8, ByteOrder::Motorola, false, true, 0.15625f, -2e+01f, 18397, 0, 0 }, // Injection Feedback Val #3
+    { 0x7E0, 0x3D, 62, 18, 0, 8, ByteOrder::Motorola, false, true, 0.15625f, -2e+01f, 18423, 0, 0 }, // Injection Feedback Val #4
+    { 0x7E0, 0x3D, 62, 19, 0, 8, ByteOrder::Motorola, false, true, 0.15625f, -2e+01f, 18449, 0, 0 }, // Injection Feedback Val #5
+    { 0x7E0, 0x3D, 62, 20, 0, 8, ByteOrder::Motorola, false, true, 0.15625f, -2e+01f, 18475, 0, 0 }, // Injection Feedback Val #6
+    { 0x7E0, 0x3D, 62, 21, 0, 8, ByteOrder::Motorola, false, true, 0.15625f, -2e+01f, 18501, 0, 0 }, // Injection Feedback Val #7
+    { 0x7E0, 0x3D, 62, 22, 0, 8, ByteOrder::Motorola, false, true, 0.15625f, -2e+01f, 18527, 0, 0 }, // Injection Feedback Val #8
+    { 0x7E0, 0x3D, 62, 23, 0, 16, ByteOrder::Motorola, false, true, 0.01953125f, 0.0f, 18553, 0, 0 }, // Injection Volume
+    { 0x7E0, 0x3D, 62, 25, 0, 16, ByteOrder::Motorola, false, true, 0.01953125f, -6.4e+02f, 18570, 0, 0 }, // Injection Pressure Correction
+    { 0x7E0, 0x3D, 62, 27, 0, 16, ByteOrder::Motorola, false, true, 0.01953125f, -6.4e+02f, 18600, 0, 0 }, // Inj. FB Vol. for Idle
+    { 0x7E0, 0x3D, 12, 33, 0, 16, ByteOrder::Motorola, false, true, 0.125f, -4096.0f, 18622, 0, 0 }, // Pump SCV Learning Value
+    { 0x7E0, 0x3D, 12, 35, 0, 16, ByteOrder::Motorola, false, true, 0.125f, 0.0f, 18646, 0, 0 }, // Target Pump SCV Current
+    { 0x7E0, 0x3D, 33, 37, 0, 16, ByteOrder::Motorola, false, true, 0.0061035156f, 0.0f, 18670, 0, 0 }, // Pump SCV Duty Request
+    { 0x7E0, 0x3D, 0, 39, 7, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 18692, 2, 2 }, // Pump SCV Status
+    { 0x7E0, 0x3D, 0, 40, 0, 4, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 18731, 1115, 9 }, // Pilot Quantity Learning
+    { 0x7E0, 0x3D, 0, 40, 4, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 18755, 1124, 2 }, // Catalyst Pilot Quantity Learning
+    { 0x7E0, 0x3D, 0, 40, 5, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 18788, 1124, 2 }, // Temperature Pilot Quantity Learning
+    { 0x7E0, 0x3D, 0, 40, 6, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 18824, 1124, 2 }, // Actuator Pilot Quantity Learning
+    { 0x7E0, 0x3D, 0, 40, 7, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 18857, 1124, 2 }, // Injector Pilot Quantity Learning
+    { 0x7E0, 0x3D, 60, 41, 0, 16, ByteOrder::Motorola, false, true, 0.009765625f, 0.0f, 18890, 0, 0 }, // PCV Energization Timing
+    { 0x7E0, 0x3D, 60, 43, 0, 16, ByteOrder::Motorola, false, true, 0.03125f, -1024.0f, 18914, 0, 0 }, // Pump Difference Angle Learning Value
+    { 0x7E0, 0x3D, 31, 45, 0, 16, ByteOrder::Motorola, false, true, 1.0f, 0.0f, 18951, 0, 0 }, // Pre Injection Period
+    { 0x7E0, 0x3D, 60, 47, 0, 16, ByteOrder::Motorola, false, true, 0.0078125f, -2.1e+02f, 18972, 0, 0 }, // Pre Injection Timing
+    { 0x7E0, 0x3D, 57, 49, 0, 8, ByteOrder::Motorola, false, true, 1.0f, -4e+01f, 18993, 0, 0 }, // Fuel Return Temperature
+    { 0x7E0, 0x3D, 24, 50, 0, 16, ByteOrder::Motorola, false, true, 3.125e-05f, 0.0f, 19017, 0, 0 }, // Injection Volume (Cylinder1)
+    { 0x7E0, 0x3E, 62, 0, 0, 16, ByteOrder::Motorola, false, true, 0.01953125f, -6.4e+02f, 19046, 0, 0 }, // Total Injection Volume
+    { 0x7E0, 0x3E, 62, 2, 0, 16, ByteOrder::Motorola, false, true, 0.01953125f, -6.4e+02f, 19069, 0, 0 }, // Injection Volume #1
+    { 0x7E0, 0x3E, 62, 4, 0, 16, ByteOrder::Motorola, false, true, 0.01953125f, -6.4e+02f, 19089, 0, 0 }, // Injection Volume #2
+    { 0x7E0, 0x3E, 62, 6, 0, 16, ByteOrder::Motorola, false, true, 0.01953125f, -6.4e+02f, 19109, 0, 0 }, // Injection Volume #3
+    { 0x7E0, 0x3E, 62, 8, 0, 16, ByteOrder::Motorola, false, true, 0.01953125f, -6.4e+02f, 19129, 0, 0 }, // Injection Volume #4
+    { 0x7E0, 0x3E, 34, 10, 0, 8, ByteOrder::Motorola, false, true, 1e+01f, 0.0f, 19149, 0, 0 }, // Fuel Pressure #1
+    { 0x7E0, 0x3E, 34, 12, 0, 8, ByteOrder::Motorola, false, true, 1e+01f, 0.0f, 19166, 0, 0 }, // Fuel Pressure #2
+    { 0x7E0, 0x3E, 34, 14, 0, 8, ByteOrder::Motorola, false, true, 1e+01f, 0.0f, 19183, 0, 0 }, // Fuel Pressure #3
+    { 0x7E0, 0x3E, 34, 16, 0, 8, ByteOrder::Motorola, false, true, 1e+01f, 0.0f, 19200, 0, 0 }, // Fuel Pressure #4
+    { 0x7E0, 0x3E, 57, 18, 0, 8, ByteOrder::Motorola, false, true, 1.0f, -4e+01f, 19217, 0, 0 }, // Fuel Temperature #1
+    { 0x7E0, 0x3E, 57, 19, 0, 8, ByteOrder::Motorola, false, true, 1.0f, -4e+01f, 19237, 0, 0 }, // Fuel Temperature #2
+    { 0x7E0, 0x3E, 57, 20, 0, 8, ByteOrder::Motorola, false, true, 1.0f, -4e+01f, 19257, 0, 0 }, // Fuel Temperature #3
+    { 0x7E0, 0x3E, 57, 21, 0, 8, ByteOrder::Motorola, false, true, 1.0f, -4e+01f, 19277, 0, 0 }, // Fuel Temperature #4
+    { 0x7E0, 0x41, 48, 0, 0, 8, ByteOrder::Motorola, false, true, 0.01953125f, 0.0f, 19297, 0, 0 }, // Throttle Sens Open Pos #1
+    { 0x7E0, 0x41, 48, 1, 0, 8, ByteOrder::Motorola, false, true, 0.01953125f, 0.0f, 19323, 0, 0 }, // Throttle Sens Open Pos #2
+    { 0x7E0, 0x41, 5, 2, 0, 8, ByteOrder::Motorola, false, true, 0.48828125f, 0.0f, 19349, 0, 0 }, // Accel Fully Close Learn #1
+    { 0x7E0, 0x41, 5, 3, 0, 8, ByteOrder::Motorola, false, true, 0.48828125f, 0.0f, 19376, 0, 0 }, // Accel Fully Close Learn #2
+    { 0x7E0, 0x41, 48, 4, 0, 8, ByteOrder::Motorola, false, true, 0.01953125f, 0.0f, 19403, 0, 0 }, // Throttle Position Command
+    { 0x7E0, 0x41, 33, 5, 0, 16, ByteOrder::Motorola, false, true, 0.0061035156f, 0.0f, 19429, 0, 0 }, // Accelerator Position
+    { 0x7E0, 0x41, 48, 7, 0, 16, ByteOrder::Motorola, false, true, 0.0012207031f, 0.0f, 19450, 0, 0 }, // +BM Voltage
+    { 0x7E0, 0x41, 48, 9, 0, 8, ByteOrder::Motorola, false, true, 0.01953125f, 0.0f, 19462, 0, 0 }, // Accel Sensor Out No.1
+    { 0x7E0, 0x41, 48, 11, 0, 8, ByteOrder::Motorola, false, true, 0.01953125f, 0.0f, 19484, 0, 0 }, // Throttle Position No.1
+    { 0x7E0, 0x41, 48, 12, 0, 8, ByteOrder::Motorola, false, true, 0.01953125f, 0.0f, 19507, 0, 0 }, // Throttle Position No.2
+    { 0x7E0, 0x41, 48, 13, 0, 8, ByteOrder::Motorola, false, true, 0.01953125f, 0.0f, 19530, 0, 0 }, // Throttle Require Position
+    { 0x7E0, 0x41, 48, 14, 0, 8, ByteOrder::Motorola, false, true, 0.01953125f, 0.0f, 19556, 0, 0 }, // Throttle Fully Close Learn
+    { 0x7E0, 0x41, 33, 15, 0, 8, ByteOrder::Motorola, false, true, 1.0f, 0.0f, 19583, 0, 0 }, // Throttle Motor Duty (Open)
+    { 0x7E0, 0x41, 33, 16, 0, 8, ByteOrder::Motorola, false, true, 1.0f, 0.0f, 19610, 0, 0 }, // Throttle Motor Duty (Close)
+    { 0x7E0, 0x41, 9, 17, 0, 8, ByteOrder::Motorola, false, true, 0.078125f, 0.0f, 19638, 0, 0 }, // Throttle Motor Current
+    { 0x7E0, 0x41, 33, 18, 0, 8, ByteOrder::Motorola, false, true, 0.5f, 0.0f, 19661, 0, 0 }, // Throttle Step Position
+    { 0x7E0, 0x41, 33, 19, 0, 8, ByteOrder::Motorola, false, true, 0.5f, 0.0f, 19684, 0, 0 }, // Throttle Aim Position
+    { 0x7E0, 0x41, 0, 20, 2, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 19706, 2, 2 }, // Throttle Idle Position
+    { 0x7E0, 0x41, 0, 20, 3, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 19729, 2, 2 }, // Accelerator Idle Position
+    { 0x7E0, 0x41, 0, 20, 4, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 19755, 2, 2 }, // ST1
+    { 0x7E0, 0x41, 0, 20, 5, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 19759, 2, 2 }, // Actuator Power Supply
+    { 0x7E0, 0x41, 0, 20, 6, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 19781, 2, 2 }, // Open Side Malfunction
+    { 0x7E0, 0x41, 0, 20, 7, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 19803, 2, 2 }, // System Guard
+    { 0x7E0, 0x41, 59, 21, 0, 8, ByteOrder::Motorola, false, true, 1.0f, 0.0f, 19816, 0, 0 }, // Throttle Fully Close Learn Step
+    { 0x7E0, 0x42, 9, 0, 0, 16, ByteOrder::Motorola, false, true, 0.0038146973f, -125.0f, 19848, 0, 0 }, // Battery Current
+    { 0x7E0, 0x42, 57, 2, 0, 16, ByteOrder::Motorola, false, true, 0.1f, -4e+01f, 19864, 0, 0 }, // Battery Temperature
+    { 0x7E0, 0x42, 48, 4, 0, 16, ByteOrder::Motorola, false, true, 0.0012207031f, 0.0f, 19884, 0, 0 }, // Alt Vol - Non Active Test
+    { 0x7E0, 0x42, 48, 6, 0, 16, ByteOrder::Motorola, false, true, 0.0012207031f, 0.0f, 19910, 0, 0 }, // Alt Vol - Active Test
+    { 0x7E0, 0x42, 33, 8, 0, 16, ByteOrder::Motorola, false, true, 0.0061035156f, 0.0f, 19932, 0, 0 }, // Alternator Output Duty
+    { 0x7E0, 0x42, 48, 14, 0, 16, ByteOrder::Motorola, false, true, 0.0012207031f, 0.0f, 19955, 0, 0 }, // Battery Sensor Voltage
+    { 0x7E0, 0x42, 0, 18, 0, 2, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 19993, 1126, 4 }, // Auxiliary Battery Charging Rate Accuracy
+    { 0x7E0, 0x42, 18, 19, 0, 8, ByteOrder::Motorola, false, true, 0.5f, 0.0f, 20034, 0, 0 }, // Auxiliary Battery Status of Full Charge
+    { 0x7E0, 0x42, 12, 20, 0, 16, ByteOrder::Motorola, false, true, 1.0f, 0.0f, 20074, 0, 0 }, // Auxiliary Battery Dark Current
+    { 0x7E0, 0x42, 54, 22, 0, 8, ByteOrder::Motorola, false, true, 1.0f, 0.0f, 20105, 0, 0 }, // Auxiliary Battery Sensor Sleep Time
+    { 0x7E0, 0x43, 0, 0, 0, 3, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 20164, 1130, 5 }, // Stop&Start of Eng State
+    { 0x7E0, 0x44, 33, 6, 0, 16, ByteOrder::Motorola, false, true, 0.0061035156f, 0.0f, 20188, 0, 0 }, // VVT Aim Angle #2
+    { 0x7E0, 0x44, 33, 8, 0, 16, ByteOrder::Motorola, false, true, 0.0061035156f, 0.0f, 20205, 0, 0 }, // VVT OCV Duty #2
+    { 0x7E0, 0x44, 5, 10, 0, 16, ByteOrder::Motorola, false, true, 0.009765625f, 0.0f, 20221, 0, 0 }, // VVT Change Angle #2
+    { 0x7E0, 0x44, 33, 12, 0, 16, ByteOrder::Motorola, false, true, 0.0061035156f, 0.0f, 20241, 0, 0 }, // VVT Ex Hold Lrn Val #1
+    { 0x7E0, 0x44, 33, 14, 0, 16, ByteOrder::Motorola, false, true, 0.0061035156f, 0.0f, 20264, 0, 0 }, // VVT Ex OCV Duty #1
+    { 0x7E0, 0x44, 5, 16, 0, 16, ByteOrder::Motorola, false, true, 0.009765625f, 0.0f, 20283, 0, 0 }, // VVT Ex Chg Angle #1
+    { 0x7E0, 0x44, 33, 18, 0, 16, ByteOrder::Motorola, false, true, 0.0061035156f, 0.0f, 20303, 0, 0 }, // VVT Ex Hold Lrn Val #2
+    { 0x7E0, 0x44, 33, 20, 0, 16, ByteOrder::Motorola, false, true, 0.0061035156f, 0.0f, 20326, 0, 0 }, // VVT Ex OCV Duty #2
+    { 0x7E0, 0x44, 5, 22, 0, 16, ByteOrder::Motorola, false, true, 0.009765625f, 0.0f, 20345, 0, 0 }, // VVT Ex Chg Angle #2
+    { 0x7E0, 0x44, 5, 24, 0, 16, ByteOrder::Motorola, false, true, 0.009765625f, 0.0f, 20365, 0, 0 }, // VVT-iE Aim Angle #1
+    { 0x7E0, 0x44, 5, 26, 0, 16, ByteOrder::Motorola, false, true, 0.009765625f, 0.0f, 20385, 0, 0 }, // VVT-iE Aim Angle #2
+    { 0x7E0, 0x44, 0, 28, 6, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 20414, 1135, 2 }, // VVT-iE Mot Direction #2
+    { 0x7E0, 0x44, 0, 28, 7, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 20438, 1135, 2 }, // VVT-iE Mot Direction #1
+    { 0x7E0, 0x44, 5, 29, 0, 16, ByteOrder::Motorola, false, true, 0.009765625f, 0.0f, 20462, 0, 0 }, // VVT Target Angle #1
+    { 0x7E0, 0x44, 5, 31, 0, 16, ByteOrder::Motorola, false, true, 0.009765625f, 0.0f, 20482, 0, 0 }, // VVT Target Angle #2
+    { 0x7E0, 0x44, 5, 33, 0, 16, ByteOrder::Motorola, false, true, 0.009765625f, 0.0f, 20502, 0, 0 }, // VVT Ex Target Angle #1
+    { 0x7E0, 0x44, 5, 35, 0, 16, ByteOrder::Motorola, false, true, 0.009765625f, 0.0f, 20525, 0, 0 }, // VVT Ex Target Angle #2
+    { 0x7E0, 0x44, 33, 37, 0, 16, ByteOrder::Motorola, false, true, 0.0061035156f, -2e+02f, 20548, 0, 0 }, // VVT-iE Duty #1
+    { 0x7E0, 0x44, 33, 39, 0, 16, ByteOrder::Motorola, false, true, 0.0061035156f, -2e+02f, 20563, 0, 0 }, // VVT-iE Duty #2
+    { 0x7E0, 0x45, 39, 1, 0, 8, ByteOrder::Motorola, false, true, 25.0f, 0.0f, 20578, 0, 0 }, // Misfire RPM
+    { 0x7E0, 0x45, 61, 2, 0, 8, ByteOrder::Motorola, false, true, 0.015625f, 0.0f, 20590, 0, 0 }, // Misfire Load
+    { 0x7E0, 0x45, 34, 3, 0, 16, ByteOrder::Motorola, false, true, 0.01f, 0.0f, 20590, 0, 0 }, // Misfire Load
+    { 0x7E0, 0x45, 0, 5, 0, 8, ByteOrder::Motorola, false, true, 1.0f, 0.0f, 20603, 0, 0 }, // Cylinder #1 Misfire Count
+    { 0x7E0, 0x45, 0, 6, 0, 8, ByteOrder::Motorola, false, true, 1.0f, 0.0f, 20629, 0, 0 }, // Cylinder #2 Misfire Count
+    { 0x7E0, 0x45, 0, 7, 0, 8, ByteOrder::Motorola, false, true, 1.0f, 0.0f, 20655, 0, 0 }, // Cylinder #3 Misfire Count
+    { 0x7E0, 0x45, 0, 8, 0, 8, ByteOrder::Motorola, false, true, 1.0f, 0.0f, 20681, 0, 0 }, // Cylinder #4 Misfire Count
+    { 0x7E0, 0x45, 0, 9, 0, 8, ByteOrder::Motorola, false, true, 1.0f, 0.0f, 20707, 0, 0 }, // Cylinder #5 Misfire Count
+    { 0x7E0, 0x45, 0, 10, 0, 8, ByteOrder::Motorola, false, true, 1.0f, 0.0f, 20733, 0, 0 }, // Cylinder #6 Misfire Count
+    { 0x7E0, 0x45, 0, 11, 0, 8, ByteOrder::Motorola, false, true, 1.0f, 0.0f, 20759, 0, 0 }, // Cylinder #7 Misfire Count
+    { 0x7E0, 0x45, 0, 12, 0, 8, ByteOrder::Motorola, false, true, 1.0f, 0.0f, 20785, 0, 0 }, // Cylinder #8 Misfire Count
+    { 0x7E0, 0x45, 0, 13, 0, 8, ByteOrder::Motorola, false, true, 1.0f, 0.0f, 20811, 0, 0 }, // Cylinder #9 Misfire Count
+    { 0x7E0, 0x45, 0, 14, 0, 8, ByteOrder::Motorola, false, true, 1.0f, 0.0f, 20837, 0, 0 }, // Cylinder #10 Misfire Count
+    { 0x7E0, 0x45, 0, 15, 0, 8, ByteOrder::Motorola, false, true, 1.0f, 0.0f, 20864, 0, 0 }, // Cylinder #11 Misfire Count
+    { 0x7E0, 0x45, 0, 16, 0, 8, ByteOrder::Motorola, false, true, 1.0f, 0.0f, 20891, 0, 0 }, // Cylinder #12 Misfire Count
+    { 0x7E0, 0x45, 0, 17, 0, 8, ByteOrder::Motorola, false, true, 1.0f, 0.0f, 20918, 0, 0 }, // All Cylinders Misfire Count
+    { 0x7E0, 0x45, 0, 18, 0, 8, ByteOrder::Motorola, false, true, 1.0f, 0.0f, 20946, 0, 0 }, // Ignition Trig. Count
+    { 0x7E0, 0x45, 0, 20, 0, 8, ByteOrder::Motorola, false, true, 1.0f, 0.0f, 20967, 0, 0 }, // Multi Cylinders Misfire Count
+    { 0x7E0, 0x45, 33, 22, 0, 8, ByteOrder::Motorola, false, true, 1.0f, -128.0f, 20997, 0, 0 }, // Misfire Margin
+    { 0x7E0, 0x45, 0, 23, 0, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 21012, 2, 2 }, // Cat OT MF F/C Cylinder#9
+    { 0x7E0, 0x45, 0, 23, 1, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 21037, 2, 2 }, // Cat OT MF F/C Cylinder#10
+    { 0x7E0, 0x45, 0, 23, 2, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 21063, 2, 2 }, // Cat OT MF F/C Cylinder#11
+    { 0x7E0, 0x45, 0, 23, 3, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 21089, 2, 2 }, // Cat OT MF F/C Cylinder#12
+    { 0x7E0, 0x45, 0, 24, 0, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 21115, 2, 2 }, // Cat OT MF F/C Cylinder#1
+    { 0x7E0, 0x45, 0, 24, 1, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 21140, 2, 2 }, // Cat OT MF F/C Cylinder#2
+    { 0x7E0, 0x45, 0, 24, 2, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 21165, 2, 2 }, // Cat OT MF F/C Cylinder#3
+    { 0x7E0, 0x45, 0, 24, 3, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 21190, 2, 2 }, // Cat OT MF F/C Cylinder#4
+    { 0x7E0, 0x45, 0, 24, 4, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 21215, 2, 2 }, // Cat OT MF F/C Cylinder#5
+    { 0x7E0, 0x45, 0, 24, 5, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 21240, 2, 2 }, // Cat OT MF F/C Cylinder#6
+    { 0x7E0, 0x45, 0, 24, 6, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 21265, 2, 2 }, // Cat OT MF F/C Cylinder#7
+    { 0x7E0, 0x45, 0, 24, 7, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 21290, 2, 2 }, // Cat OT MF F/C Cylinder#8
+    { 0x7E0, 0x45, 0, 25, 6, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 21315, 2, 2 }, // Cat OT MF F/C History
+    { 0x7E0, 0x45, 0, 25, 7, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 21337, 71, 2 }, // Catalyst OT MF F/C
+    { 0x7E0, 0x46, 34, 1, 0, 16, ByteOrder::Motorola, false, true, 0.022f, -720.896f, 21356, 0, 0 }, // Vapor Pressure (Calculated)
+    { 0x7E0, 0x46, 34, 3, 0, 16, ByteOrder::Motorola, false, true, 0.022f, 0.0f, 21384, 0, 0 }, // Vapor Pressure Pump
+    { 0x7E0, 0x46, 34, 5, 0, 16, ByteOrder::Motorola, false, true, 0.00078125f, -25.6f, 21404, 0, 0 }, // Vapor Pressure Tank
+    { 0x7E0, 0x47, 59, 0, 0, 8, ByteOrder::Motorola, false, true, 1.0f, 0.0f, 21424, 0, 0 }, // EGR Step Position
+    { 0x7E0, 0x47, 57, 1, 0, 8, ByteOrder::Motorola, false, true, 0.625f, 0.0f, 21442, 0, 0 }, // EGR Gas Temperature
+    { 0x7E0, 0x47, 48, 2, 0, 16, ByteOrder::Motorola, false, true, 7.6293945e-05f, 0.0f, 21462, 0, 0 }, // EGR Close Lrn. Val.
+    { 0x7E0, 0x47, 48, 4, 0, 16, ByteOrder::Motorola, false, true, 7.6293945e-05f, 0.0f, 21482, 0, 0 }, // EGR Close Lrn. Val. #2
+    { 0x7E0, 0x47, 33, 6, 0, 8, ByteOrder::Motorola, false, true, 0.5f, 0.0f, 21505, 0, 0 }, // EGR Lift Sensor Volt %
+    { 0x7E0, 0x47, 33, 7, 0, 8, ByteOrder::Motorola, false, true, 0.5f, 0.0f, 21528, 0, 0 }, // EGR Lift Sensor Volt % #2
+    { 0x7E0, 0x47, 33, 8, 0, 8, ByteOrder::Motorola, false, true, 0.5f, 0.0f, 21554, 0, 0 }, // Actual EGR Valve Pos.
+    { 0x7E0, 0x47, 33, 9, 0, 8, ByteOrder::Motorola, false, true, 0.5f, 0.0f, 21576, 0, 0 }, // Target EGR Pos.
+    { 0x7E0, 0x47, 33, 10, 0, 8, ByteOrder::Motorola, false, true, 0.5f, 0.0f, 21592, 0, 0 }, // Actual EGR Valve Pos. #2
+    { 0x7E0, 0x47, 33, 11, 0, 8, ByteOrder::Motorola, false, true, 0.5f, 0.0f, 21617, 0, 0 }, // Target EGR Pos. #2
+    { 0x7E0, 0x47, 0, 12, 5, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 21636, 2, 2 }, // EGR Cooler Bypass VSV2
+    { 0x7E0, 0x47, 0, 12, 6, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 21659, 2, 2 }, // EGR Cooler Bypass VSV
+    { 0x7E0, 0x47, 0, 12, 7, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 21681, 1137, 2 }, // EGR Operation Prohibit
+    { 0x7E0, 0x47, 48, 13, 0, 16, ByteOrder::Motorola, false, true, 7.6293945e-05f, 0.0f, 21704, 0, 0 }, // EGR Position Sensor
+    { 0x7E0, 0x47, 48, 15, 0, 16, ByteOrder::Motorola, false, true, 7.6293945e-05f, 0.0f, 21724, 0, 0 }, // EGR Position Sensor #2
+    { 0x7E0, 0x47, 33, 17, 0, 8, ByteOrder::Motorola, false, true, 0.5f, 0.0f, 21747, 0, 0 }, // EGR Motor Duty #1
+    { 0x7E0, 0x47, 33, 18, 0, 8, ByteOrder::Motorola, false, true, 0.5f, 0.0f, 21765, 0, 0 }, // EGR Motor Duty #2
+    { 0x7E0, 0x47, 0, 19, 0, 2, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 21806, 1139, 4 }, // EGR Cooler Bypass Position
+    { 0x7E0, 0x47, 33, 20, 0, 8, ByteOrder::Motorola, false, true, 0.5f, 0.0f, 2428, 0, 0 }, // Throttle Motor DUTY
+    { 0x7E0, 0x47, 33, 21, 0, 8, ByteOrder::Motorola, false, true, 0.5f, 0.0f, 21833, 0, 0 }, // Throttle Motor DUTY #2
+    { 0x7E0, 0x47, 5, 22, 0, 16, ByteOrder::Motorola, false, true, 0.0076293945f, 0.0f, 21856, 0, 0 }, // Throttle Close Learning Val.
+    { 0x7E0, 0x47, 5, 24, 0, 16, ByteOrder::Motorola, false, true, 0.0076293945f, 0.0f, 21885, 0, 0 }, // Throttle Close Learning Val.#2
+    { 0x7E0, 0x48, 36, 0, 0, 16, ByteOrder::Motorola, false, true, 0.00023376464f, 0.0f, 21916, 0, 0 }, // Tank Fuel Pressure
+    { 0x7E0, 0x48, 36, 2, 0, 16, ByteOrder::Motorola, false, true, 0.00023376464f, 0.0f, 21935, 0, 0 }, // Delivery Fuel Pressure
+    { 0x7E0, 0x48, 57, 4, 0, 8, ByteOrder::Motorola, false, true, 1.0f, -4e+01f, 21958, 0, 0 }, // Tank Fuel Temperature
+    { 0x7E0, 0x48, 57, 5, 0, 8, ByteOrder::Motorola, false, true, 1.0f, -4e+01f, 21980, 0, 0 }, // Delivery Fuel Temperature
+    { 0x7E0, 0x48, 33, 6, 0, 8, ByteOrder::Motorola, false, true, 1.0f, 0.0f, 22006, 0, 0 }, // Propane Ratio
+    { 0x7E0, 0x48, 33, 7, 0, 8, ByteOrder::Motorola, false, true, 1.0f, 0.0f, 22020, 0, 0 }, // Pre Trip Propane Ratio
+    { 0x7E0, 0x48, 52, 8, 0, 16, ByteOrder::Motorola, false, true, 1.0f, 0.0f, 22043, 0, 0 }, // Engine Start Waiting Time
+    { 0x7E0, 0x48, 0, 10, 0, 8, ByteOrder::Motorola, false, true, 1.0f, 0.0f, 22069, 0, 0 }, // Preignition F/C Detection Count #1
+    { 0x7E0, 0x48, 0, 11, 0, 8, ByteOrder::Motorola, false, true, 1.0f, 0.0f, 22104, 0, 0 }, // Preignition F/C Detection Count #2
+    { 0x7E0, 0x48, 0, 12, 0, 8, ByteOrder::Motorola, false, true, 1.0f, 0.0f, 22139, 0, 0 }, // Preignition F/C Detection Count #3
+    { 0x7E0, 0x48, 0, 13, 0, 8, ByteOrder::Motorola, false, true, 1.0f, 0.0f, 22174, 0, 0 }, // Preignition F/C Detection Count #4
+    { 0x7E0, 0x48, 0, 14, 4, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 22216, 1143, 2 }, // Water Present on Ignition Plug
+    { 0x7E0, 0x48, 0, 14, 5, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 22247, 228, 2 }, // Fuel Cooler VSV
+    { 0x7E0, 0x48, 0, 14, 6, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 22263, 2, 2 }, // Compressor Oil Warning
+    { 0x7E0, 0x48, 0, 14, 7, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 22286, 2, 2 }, // Pump Previous Drive History
+    { 0x7E0, 0x48, 0, 15, 3, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 15685, 228, 2 }, // Regulator Shut Valve
+    { 0x7E0, 0x48, 0, 15, 4, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 22314, 2, 2 }, // Fuel Pump2 Speed Control
+    { 0x7E0, 0x48, 0, 15, 5, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 22339, 228, 2 }, // Return Solenoid Valve
+    { 0x7E0, 0x48, 0, 15, 6, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 22361, 228, 2 }, // LPG Solenoid Valve
+    { 0x7E0, 0x48, 0, 15, 7, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 22380, 228, 2 }, // Emergency Solenoid Valve
+    { 0x7E0, 0x48, 48, 18, 0, 16, ByteOrder::Motorola, false, true, 7.6293945e-05f, 0.0f, 22405, 0, 0 }, // Tank Fuel Pressure Sensor Voltage
+    { 0x7E0, 0x48, 48, 20, 0, 16, ByteOrder::Motorola, false, true, 7.6293945e-05f, 0.0f, 22439, 0, 0 }, // Delivery Fuel Pressure Sensor Voltage
+    { 0x7E0, 0x48, 48, 22, 0, 16, ByteOrder::Motorola, false, true, 7.6293945e-05f, 0.0f, 22477, 0, 0 }, // Delivery Fuel Temperature Sensor Voltage
+    { 0x7E0, 0x48, 57, 24, 0, 8, ByteOrder::Motorola, false, true, 1.0f, -4e+01f, 22518, 0, 0 }, // Oil Separator Temperature
+    { 0x7E0, 0x48, 48, 25, 0, 16, ByteOrder::Motorola, false, true, 7.6293945e-05f, 0.0f, 22544, 0, 0 }, // Oil Separator Temperature Sensor Voltage
+    { 0x7E0, 0x48, 36, 27, 0, 8, ByteOrder::Motorola, false, true, 0.001953125f, 0.0f, 21916, 0, 0 }, // Tank Fuel Pressure
+    { 0x7E0, 0x49, 51, 0, 0, 16, ByteOrder::Motorola, false, true, 0.25f, 0.0f, 22585, 0, 0 }, // Requested Engine Torque
+    { 0x7E0, 0x49, 39, 2, 0, 8, ByteOrder::Motorola, false, true, 25.0f, 0.0f, 22609, 0, 0 }, // HV Target Engine Speed
+    { 0x7E0, 0x49, 58, 3, 0, 16, ByteOrder::Motorola, false, true, 1.0f, -32768.0f, 22632, 0, 0 }, // Actual Engine Torque
+    { 0x7E0, 0x49, 52, 5, 0, 8, ByteOrder::Motorola, false, true, 1.0f, 0.0f, 2290, 0, 0 }, // Engine Run Time
+    { 0x7E0, 0x49, 52, 6, 0, 8, ByteOrder::Motorola, false, true, 0.1f, 0.0f, 22653, 0, 0 }, // Request Engine Run Time
+    { 0x7E0, 0x49, 52, 7, 0, 8, ByteOrder::Motorola, false, true, 0.1f, 0.0f, 22677, 0, 0 }, // Judge Time Engine Ignition
+    { 0x7E0, 0x49, 52, 8, 0, 8, ByteOrder::Motorola, false, true, 0.1f, 0.0f, 22704, 0, 0 }, // Judge Time Engine Output
+    { 0x7E0, 0x49, 27, 9, 0, 16, ByteOrder::Motorola, false, true, 0.0012207031f, 0.0f, 22729, 0, 0 }, // ISC Learning Value
+    { 0x7E0, 0x49, 0, 11, 1, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 22762, 1145, 2 }, // Fuel Level
+    { 0x7E0, 0x49, 0, 11, 2, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 22773, 1147, 2 }, // ISC Learning
+    { 0x7E0, 0x49, 0, 11, 3, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 22786, 2, 2 }, // F/C for Engine Stop Req
+    { 0x7E0, 0x49, 0, 11, 4, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 22818, 1149, 2 }, // Engine Independent
+    { 0x7E0, 0x49, 0, 11, 5, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 22837, 1149, 2 }, // Racing Operation
+    { 0x7E0, 0x49, 0, 11, 6, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 22870, 1151, 2 }, // Request Warm-up
+    { 0x7E0, 0x49, 0, 11, 7, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 22886, 1149, 2 }, // Engine Independent Control
+    { 0x7E0, 0x4A, 48, 0, 0, 16, ByteOrder::Motorola, false, true, 0.0012207031f, 0.0f, 22913, 0, 0 }, // AF Sensor Learning Value B1S2
+    { 0x7E0, 0x4B, 0, 0, 0, 8, ByteOrder::Motorola, false, true, 1.0f, 0.0f, 22943, 0, 0 }, // Reductant Level
+    { 0x7E0, 0x4B, 57, 1, 0, 8, ByteOrder::Motorola, false, true, 1.0f, -4e+01f, 22959, 0, 0 }, // Reductant Temperature
+    { 0x7E0, 0x4B, 34, 2, 0, 16, ByteOrder::Motorola, false, true, 0.1f, -3276.8f, 22981, 0, 0 }, // Reductant Pressure
+    { 0x7E0, 0x4B, 39, 4, 0, 16, ByteOrder::Motorola, false, true, 1.0f, 0.0f, 23000, 0, 0 }, // Reductant Pump Speed
+    { 0x7E0, 0x4B, 0, 8, 0, 2, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 23029, 1153, 4 }, // Reductant Injection Mode
+    { 0x7E0, 0x4B, 45, 9, 0, 16, ByteOrder::Motorola, false, true, 0.05f, 0.0f, 23054, 0, 0 }, // Reductant Injection Value
+    { 0x7E0, 0x4B, 32, 11, 0, 8, ByteOrder::Motorola, false, true, 1.0f, 0.0f, 23080, 0, 0 }, // Engine Exhaust NOx Density
+    { 0x7E0, 0x4B, 57, 13, 0, 16, ByteOrder::Motorola, false, true, 0.1f, -4e+01f, 23107, 0, 0 }, // SCR Temperature
+    { 0x7E0, 0x4B, 0, 15, 0, 8, ByteOrder::Motorola, false, true, 1.0f, 0.0f, 23123, 0, 0 }, // Catalyst Thermal Degradation Count
+    { 0x7E0, 0x4B, 0, 19, 0, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 23158, 2, 2 }, // NOx Sensor Carrying Request
+    { 0x7E0, 0x4B, 0, 19, 1, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 23186, 2, 2 }, // Fr-NOx Sensor Carrying Request
+    { 0x7E0, 0x4B, 0, 19, 2, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 23217, 2, 2 }, // Fr-NOx Sensor Active Status
+    { 0x7E0, 0x4B, 0, 19, 3, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 23245, 2, 2 }, // Reductant Pipe Heater
+    { 0x7E0, 0x4B, 0, 19, 4, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 23267, 2, 2 }, // Reductant Tank Heater
+    { 0x7E0, 0x4B, 0, 19, 5, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 23289, 2, 2 }, // NOx Sensor Active Status
+    { 0x7E0, 0x4B, 0, 19, 6, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 23314, 2, 2 }, // SCR NOx Purge High Efficiency Temp
+    { 0x7E0, 0x4B, 0, 19, 7, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 23349, 2, 2 }, // Reductant Injection Value Restraint Control
+    { 0x7E0, 0x4B, 52, 20, 0, 16, ByteOrder::Motorola, false, true, 1.0f, 0.0f, 23393, 0, 0 }, // NOx Sensor Cooling Time
+    { 0x7E0, 0x4B, 52, 22, 0, 16, ByteOrder::Motorola, false, true, 1.0f, 0.0f, 23417, 0, 0 }, // Fr-NOx Sensor Cooling Time
+    { 0x7E0, 0x4B, 23, 24, 0, 16, ByteOrder::Motorola, false, true, 0.001f, 0.0f, 23444, 0, 0 }, // Reductant Replenishment Possible Value
+    { 0x7E0, 0x4B, 0, 26, 0, 2, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 23506, 1157, 4 }, // Status of NOx Reduction Efficiency
+    { 0x7E0, 0x4B, 0, 27, 0, 2, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 23577, 1161, 4 }, // Status of Fr-NOx Sensor Lambda Detection Unit
+    { 0x7E0, 0x4B, 0, 28, 0, 2, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 23623, 1161, 4 }, // Status of Fr-NOx Sensor NOx Detection Unit
+    { 0x7E0, 0x4B, 0, 29, 0, 3, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 23707, 1165, 5 }, // Status of Fr-NOx Sensor
+    { 0x7E0, 0x4B, 0, 30, 0, 3, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 23731, 1165, 5 }, // Status of Fr-NOx Sensor Heater
+    { 0x7E0, 0x4B, 0, 31, 0, 2, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 23762, 1170, 4 }, // Fr-NOx Sensor NOx Active Status (SCU)
+    { 0x7E0, 0x4B, 0, 32, 0, 2, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 23800, 1170, 4 }, // Fr-NOx Sensor A/F Active Status (SCU)
+    { 0x7E0, 0x4B, 0, 33, 0, 2, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 23850, 1174, 3 }, // Fr-NOx Sensor Status Information
+    { 0x7E0, 0x4B, 0, 34, 0, 2, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 23892, 1177, 3 }, // Status of Fr-NOx Sensor Power Supply Voltage
+    { 0x7E0, 0x4B, 0, 35, 0, 2, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 23937, 1161, 4 }, // Status of NOx Sensor Lambda Detection Unit
+    { 0x7E0, 0x4B, 0, 36, 0, 2, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 23980, 1161, 4 }, // Status of NOx Sensor NOx Detection Unit
+    { 0x7E0, 0x4B, 0, 37, 0, 3, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 24020, 1165, 5 }, // Status of NOx Sensor
+    { 0x7E0, 0x4B, 0, 38, 0, 3, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 24041, 1165, 5 }, // Status of NOx Sensor Heater
+    { 0x7E0, 0x4B, 0, 39, 0, 2, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 24069, 1170, 4 }, // NOx Sensor NOx Active Status (SCU)
+    { 0x7E0, 0x4B, 0, 40, 0, 2, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 24104, 1170, 4 }, // NOx Sensor A/F Active Status (SCU)
+    { 0x7E0, 0x4B, 0, 41, 0, 2, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 24139, 1174, 3 }, // NOx Sensor Status Information
+    { 0x7E0, 0x4B, 0, 42, 0, 2, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 24169, 1177, 3 }, // Status of NOx Sensor Power Supply Voltage
+    { 0x7E0, 0x4B, 33, 43, 0, 8, ByteOrder::Motorola, false, true, 0.5f, 0.0f, 24211, 0, 0 }, // PM Sensor Heater Duty
+    { 0x7E0, 0x4B, 48, 44, 0, 8, ByteOrder::Motorola, false, true, 0.1f, 0.0f, 24233, 0, 0 }, // PM Sensor Power Supply Voltage
+    { 0x7E0, 0x4B, 11, 45, 0, 8, ByteOrder::Motorola, false, true, 0.5f, 0.0f, 24264, 0, 0 }, // PM Sensor Output Current
+    { 0x7E0, 0x4B, 11, 46, 0, 8, ByteOrder::Motorola, false, true, 0.5f, 0.0f, 24289, 0, 0 }, // PM Sensor Maximum Current Value
+    { 0x7E0, 0x4B, 57, 47, 0, 8, ByteOrder::Motorola, false, true, 0.625f, -4e+01f, 24321, 0, 0 }, // PM Sensor Element Temperature
+    { 0x7E0, 0x4B, 0, 48, 0, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 24389, 1180, 2 }, // Status of PM Sensor IDE Diagnosis (+ Side)
+    { 0x7E0, 0x4B, 0, 48, 1, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 24465, 1182, 2 }, // Status of PM Sensor IDE (+ Side)
+    { 0x7E0, 0x4B, 0, 48, 2, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 24498, 1182, 2 }, // Status of PM Sensor Heater
+    { 0x7E0, 0x4B, 0, 48, 3, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 24525, 1180, 2 }, // Status of PM Sensor Heater Diagnosis
+    { 0x7E0, 0x4B, 0, 48, 4, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 24562, 1182, 2 }, // Status of PM Sensor IDE
+    { 0x7E0, 0x4B, 0, 48, 5, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 24586, 1180, 2 }, // Status of PM Sensor IDE Diagnosis
+    { 0x7E0, 0x4B, 0, 48, 6, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 24620, 1182, 2 }, // Status of PM Sensor IDE Circuit
+    { 0x7E0, 0x4B, 0, 48, 7, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 24652, 1180, 2 }, // Status of PM Sensor IDE Circuit Diagnosis
+    { 0x7E0, 0x4B, 0, 49, 0, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 24732, 1184, 2 }, // PM Sensor Clogged Diagnosis
+    { 0x7E0, 0x4B, 0, 49, 1, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 24784, 1186, 2 }, // Status of PM Sensor SCU Operation
+    { 0x7E0, 0x4B, 0, 49, 2, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 24847, 1188, 2 }, // Status of PM Sensor SCU Output Data
+    { 0x7E0, 0x4B, 0, 49, 3, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 24925, 1190, 2 }, // Status of PM Sensor Measurement
+    { 0x7E0, 0x4B, 0, 49, 4, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 24957, 1182, 2 }, // Status of PM Sensor IDE (- Side)
+    { 0x7E0, 0x4B, 0, 49, 5, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 24990, 1182, 2 }, // Status of PM Sensor Temperature
+    { 0x7E0, 0x4B, 0, 49, 6, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 25066, 1192, 2 }, // Status of PM Sensor Rejuvenate
+    { 0x7E0, 0x4B, 0, 49, 7, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 25097, 2, 2 }, // Status of PM Sensor Rejuvenate Finish
+    { 0x7E0, 0x4B, 0, 50, 0, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 25135, 2, 2 }, // Status of PM Sensor Heater OFF Malfunction
+    { 0x7E0, 0x4B, 0, 50, 1, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 25178, 1180, 2 }, // Status of PM Sensor Heater ON Diagnosis
+    { 0x7E0, 0x4B, 0, 50, 2, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 25218, 2, 2 }, // Status of PM Sensor Heater ON Malfunction
+    { 0x7E0, 0x4B, 0, 50, 3, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 25260, 2, 2 }, // Status of PM Sensor Engine Operation
+    { 0x7E0, 0x4B, 0, 50, 4, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 25297, 2, 2 }, // Status of PM Sensor Carrying Request
+    { 0x7E0, 0x4B, 0, 50, 5, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 25334, 2, 2 }, // Status of PM Sensor Self Diagnosis Clear
+    { 0x7E0, 0x4B, 0, 50, 6, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 25375, 2, 2 }, // Status of PM Sensor Measurement Request
+    { 0x7E0, 0x4B, 0, 50, 7, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 25445, 1194, 2 }, // Status of PM Sensor Malfunction
+    { 0x7E0, 0x4C, 0, 0, 2, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 25477, 2, 2 }, // Status of IG Switch Terminal Low Voltage Guard Determination
+    { 0x7E0, 0x4C, 0, 0, 3, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 25538, 2, 2 }, // Status of STA Terminal Low Voltage Guard Determination
+    { 0x7E0, 0x4C, 0, 0, 4, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 25593, 2, 2 }, // Status of +B Terminal Low Voltage Guard Determination
+    { 0x7E0, 0x4C, 0, 0, 5, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 25647, 2, 2 }, // Status of WI Terminal Low Voltage Guard Determination
+    { 0x7E0, 0x4C, 0, 0, 6, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 25701, 2, 2 }, // Status of Ready
+    { 0x7E0, 0x4C, 0, 0, 7, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 25717, 2, 2 }, // Status of IG Switch
+    { 0x7E0, 0x4C, 0, 1, 5, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 25737, 2, 2 }, // Status of Engine Start
+    { 0x7E0, 0x4C, 0, 1, 6, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 25760, 2, 2 }, // Soak Timer Start Request
+    { 0x7E0, 0x4C, 0, 1, 7, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 25785, 2, 2 }, // Status of Soak Timer Start
+    { 0x7E0, 0x4C, 52, 2, 0, 16, ByteOrder::Motorola, false, true, 9.375f, 0.0f, 25812, 0, 0 }, // Soak IC Current Timer Value
+    { 0x7E0, 0x4C, 56, 4, 0, 16, ByteOrder::Motorola, false, true, 65.536f, 0.0f, 25840, 0, 0 }, // Soak Timer Clear
+    { 0x7E0, 0x4C, 0, 6, 0, 8, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 25857, 1196, 166 }, // Soak Timer Start History
+    { 0x7E0, 0x4C, 53, 7, 0, 1, ByteOrder::Motorola, false, false, 1e+01f, 0.0f, 25884, 1362, 2 }, // Soak IC First Start Time
+    { 0x7E0, 0x4C, 56, 8, 0, 16, ByteOrder::Motorola, false, true, 65.536f, 0.0f, 25909, 0, 0 }, // Main Relay ON Time after IG OFF
+    { 0x7E0, 0x4C, 56, 10, 0, 16, ByteOrder::Motorola, false, true, 65.536f, 0.0f, 25941, 0, 0 }, // Main Relay ON Time after IG OFF of Previous Trip
+    { 0x7E0, 0x4C, 56, 12, 0, 16, ByteOrder::Motorola, false, true, 65.536f, 0.0f, 25990, 0, 0 }, // Main Relay ON Time after Soak Start of Previous Trip
+    { 0x7E0, 0x4C, 0, 14, 0, 8, ByteOrder::Motorola, false, true, 1.0f, 0.0f, 26043, 0, 0 }, // Soak Start Count
+    { 0x7E0, 0x51, 56, 0, 0, 16, ByteOrder::Motorola, false, true, 1e+01f, 0.0f, 26060, 0, 0 }, // Engine Starting Time
+    { 0x7E0, 0x51, 39, 2, 0, 16, ByteOrder::Motorola, false, true, 0.78125f, 0.0f, 26081, 0, 0 }, // Engine Speed (Starter Off)
+    { 0x7E0, 0x51, 0, 4, 0, 8, ByteOrder::Motorola, false, true, 1.0f, 0.0f, 26108, 0, 0 }, // Starter Count
+    { 0x7E0, 0x51, 13, 5, 0, 16, ByteOrder::Motorola, false, true, 0.01f, 0.0f, 26122, 0, 0 }, // Run Dist of Previous Trip
+    { 0x7E0, 0x51, 57, 7, 0, 8, ByteOrder::Motorola, false, true, 1.0f, -4e+01f, 26148, 0, 0 }, // Previous Trip Coolant Temp
+    { 0x7E0, 0x51, 57, 8, 0, 8, ByteOrder::Motorola, false, true, 1.0f, -4e+01f, 26175, 0, 0 }, // Previous Trip Intake Temp
+    { 0x7E0, 0x51, 57, 9, 0, 8, ByteOrder::Motorola, false, true, 1.0f, -4e+01f, 26201, 0, 0 }, // Engine Oil Temperature
+    { 0x7E0, 0x51, 57, 10, 0, 8, ByteOrder::Motorola, false, true, 1.0f, -4e+01f, 26224, 0, 0 }, // Previous Trip Eng Oil Temp
+    { 0x7E0, 0x51, 57, 11, 0, 8, ByteOrder::Motorola, false, true, 1.0f, -4e+01f, 26251, 0, 0 }, // Ambient Temp for A/C
+    { 0x7E0, 0x51, 57, 12, 0, 8, ByteOrder::Motorola, false, true, 1.0f, -4e+01f, 26272, 0, 0 }, // Previous Trip Ambient Temp
+    { 0x7E0, 0x51, 5, 13, 0, 16, ByteOrder::Motorola, false, true, 0.0076293945f, 0.0f, 26299, 0, 0 }, // Throttle Position
+    { 0x7E0, 0x51, 27, 15, 0, 16, ByteOrder::Motorola, false, true, 0.0012207031f, 0.0f, 26317, 0, 0 }, // ISC Flow
+    { 0x7E0, 0x51, 5, 17, 0, 16, ByteOrder::Motorola, false, true, 0.0076293945f, 0.0f, 26326, 0, 0 }, // ISC Position
+    { 0x7E0, 0x51, 27, 21, 0, 16, ByteOrder::Motorola, false, true, 0.0012207031f, -4e+01f, 26339, 0, 0 }, // ISC Feedback Value
+    { 0x7E0, 0x51, 27, 23, 0, 16, ByteOrder::Motorola, false, true, 0.0012207031f, -4e+01f, 22729, 0, 0 }, // ISC Learning Value
+    { 0x7E0, 0x51, 27, 25, 0, 16, ByteOrder::Motorola, false, true, 0.0012207031f, -4e+01f, 26358, 0, 0 }, // Electric Load Feedback Val
+    { 0x7E0, 0x51, 62, 27, 0, 8, ByteOrder::Motorola, false, true, 0.15625f, 0.0f, 26385, 0, 0 }, // Electric Duty Feedback Value
+    { 0x7E0, 0x51, 27, 28, 0, 16, ByteOrder::Motorola, false, true, 0.0012207031f, -4e+01f, 26414, 0, 0 }, // Air Conditioner FB Val
+    { 0x7E0, 0x51, 62, 30, 0, 8, ByteOrder::Motorola, false, true, 0.15625f, 0.0f, 26437, 0, 0 }, // A/C Duty Feedback Value
+    { 0x7E0, 0x51, 27, 31, 0, 16, ByteOrder::Motorola, false, true, 0.0012207031f, -4e+01f, 26461, 0, 0 }, // PS Feedback Val
+    { 0x7E0, 0x51, 62, 33, 0, 8, ByteOrder::Motorola, false, true, 0.15625f, 0.0f, 26477, 0, 0 }, // PS Duty Feedback Value
+    { 0x7E0, 0x51, 62, 34, 0, 8, ByteOrder::Motorola, false, true, 0.15625f, 0.0f, 26500, 0, 0 }, // Idle Injection Volume (Min)
+    { 0x7E0, 0x51, 0, 35, 0, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 26528, 2, 2 }, // Pre Glow
+    { 0x7E0, 0x51, 0, 35, 1, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 26537, 2, 2 }, // After Glow
+    { 0x7E0, 0x51, 0, 35, 2, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 26548, 2, 2 }, // Engine Start Hesitation
+    { 0x7E0, 0x51, 0, 35, 3, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 26572, 2, 2 }, // Low Rev for Eng Start
+    { 0x7E0, 0x51, 0, 35, 4, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 26594, 2, 2 }, // VVT Advance Fail
+    { 0x7E0, 0x51, 0, 35, 5, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 26611, 2, 2 }, // Low Revolution Control
+    { 0x7E0, 0x51, 0, 35, 6, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 26634, 2, 2 }, // Neutral Control
+    { 0x7E0, 0x51, 0, 35, 7, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 26650, 2, 2 }, // N Range Status
+    { 0x7E0, 0x51, 0, 36, 5, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 26665, 2, 2 }, // Fuel Cut Bank 2 for Idle
+    { 0x7E0, 0x51, 0, 36, 6, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 26690, 2, 2 }, // Immobiliser Fuel Cut History
+    { 0x7E0, 0x51, 0, 36, 7, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 26719, 2, 2 }, // Immobiliser Fuel Cut
+    { 0x7E0, 0x51, 0, 37, 0, 4, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 26839, 1364, 10 }, // Fuel Cut Info Bank 2 for Idle
+    { 0x7E0, 0x51, 58, 38, 0, 16, ByteOrder::Motorola, false, true, 0.03125f, -1024.0f, 26869, 0, 0 }, // ISC Feedback Learning Torque
+    { 0x7E0, 0x51, 58, 40, 0, 16, ByteOrder::Motorola, false, true, 0.03125f, -1024.0f, 26898, 0, 0 }, // ISC Total AUXS Torque
+    { 0x7E0, 0x51, 58, 42, 0, 16, ByteOrder::Motorola, false, true, 0.03125f, -1024.0f, 26920, 0, 0 }, // ISC Feedback Torque
+    { 0x7E0, 0x51, 58, 44, 0, 16, ByteOrder::Motorola, false, true, 0.03125f, -1024.0f, 26940, 0, 0 }, // ISC Feedback Torque(Recent)
+    { 0x7E0, 0x51, 58, 46, 0, 16, ByteOrder::Motorola, false, true, 0.03125f, -1024.0f, 26968, 0, 0 }, // ISC AUXS Torque(Alternator)
+    { 0x7E0, 0x51, 58, 48, 0, 16, ByteOrder::Motorola, false, true, 0.03125f, -1024.0f, 26996, 0, 0 }, // ISC AUXS Torque(Air Conditioner)
+    { 0x7E0, 0x51, 27, 50, 0, 16, ByteOrder::Motorola, false, true, 0.0012207031f, -4e+01f, 27029, 0, 0 }, // Throttle Air Flow F/B Value
+    { 0x7E0, 0x51, 56, 52, 0, 8, ByteOrder::Motorola, false, true, 1e+02f, 0.0f, 27057, 0, 0 }, // IG-ON Time
+    { 0x7E0, 0x51, 56, 53, 0, 8, ByteOrder::Motorola, false, true, 1e+02f, 0.0f, 27068, 0, 0 }, // Glow Request Lighting Time
+    { 0x7E0, 0x52, 60, 0, 0, 8, ByteOrder::Motorola, false, true, 0.0625f, 0.0f, 27095, 0, 0 }, // Idle Spark Advn Ctrl #1
+    { 0x7E0, 0x52, 60, 1, 0, 8, ByteOrder::Motorola, false, true, 0.0625f, 0.0f, 27119, 0, 0 }, // Idle Spark Advn Ctrl #2
+    { 0x7E0, 0x52, 60, 2, 0, 8, ByteOrder::Motorola, false, true, 0.0625f, 0.0f, 27143, 0, 0 }, // Idle Spark Advn Ctrl #3
+    { 0x7E0, 0x52, 60, 3, 0, 8, ByteOrder::Motorola, false, true, 0.0625f, 0.0f, 27167, 0, 0 }, // Idle Spark Advn Ctrl #4
+    { 0x7E0, 0x52, 60, 4, 0, 8, ByteOrder::Motorola, false, true, 0.0625f, 0.0f, 27191, 0, 0 }, // Idle Spark Advn Ctrl #5
+    { 0x7E0, 0x52, 60, 5, 0, 8, ByteOrder::Motorola, false, true, 0.0625f, 0.0f, 27215, 0, 0 }, // Idle Spark Advn Ctrl #6
+    { 0x7E0, 0x52, 60, 6, 0, 8, ByteOrder::Motorola, false, true, 0.0625f, 0.0f, 27239, 0, 0 }, // Idle Spark Advn Ctrl #7
+    { 0x7E0, 0x52, 60, 7, 0, 8, ByteOrder::Motorola, false, true, 0.0625f, 0.0f, 27263, 0, 0 }, // Idle Spark Advn Ctrl #8
+    { 0x7E0, 0x52, 60, 8, 0, 8, ByteOrder::Motorola, false, true, 0.0625f, 0.0f, 27287, 0, 0 }, // Idle Spark Advn Ctrl #9
+    { 0x7E0, 0x52, 60, 9, 0, 8, ByteOrder::Motorola, false, true, 0.0625f, 0.0f, 27311, 0, 0 }, // Idle Spark Advn Ctrl #10
+    { 0x7E0, 0x52, 60, 10, 0, 8, ByteOrder::Motorola, false, true, 0.0625f, 0.0f, 27336, 0, 0 }, // Idle Spark Advn Ctrl #11
+    { 0x7E0, 0x52, 60, 11, 0, 8, ByteOrder::Motorola, false, true, 0.0625f, 0.0f, 27361, 0, 0 }, // Idle Spark Advn Ctrl #12
+    { 0x7E0, 0x52, 39, 12, 0, 16, ByteOrder::Motorola, false, true, 0.78125f, 0.0f, 27386, 0, 0 }, // Minimum Engine Speed
+    { 0x7E0, 0x52, 27, 14, 0, 16, ByteOrder::Motorola, false, true, 0.0012207031f, -4e+01f, 27407, 0, 0 }, // Eng Stall Control FB Flow
+    { 0x7E0, 0x52, 27, 16, 0, 16, ByteOrder::Motorola, false, true, 0.0012207031f, -4e+01f, 27433, 0, 0 }, // Deposit Loss Flow
+    { 0x7E0, 0x52, 52, 18, 0, 16, ByteOrder::Motorola, false, true, 1.049f, 0.0f, 27451, 0, 0 }, // Fuel Cut Elps Time
+    { 0x7E0, 0x52, 0, 20, 0, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 27470, 2, 2 }, // Rough Idle #8
+    { 0x7E0, 0x52, 0, 20, 1, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 27484, 2, 2 }, // Rough Idle #7
+    { 0x7E0, 0x52, 0, 20, 2, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 27498, 2, 2 }, // Rough Idle #6
+    { 0x7E0, 0x52, 0, 20, 3, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 27512, 2, 2 }, // Rough Idle #5
+    { 0x7E0, 0x52, 0, 20, 4, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 27526, 2, 2 }, // Rough Idle #4
+    { 0x7E0, 0x52, 0, 20, 5, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 27540, 2, 2 }, // Rough Idle #3
+    { 0x7E0, 0x52, 0, 20, 6, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 27554, 2, 2 }, // Rough Idle #2
+    { 0x7E0, 0x52, 0, 20, 7, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 27568, 2, 2 }, // Rough Idle #1
+    { 0x7E0, 0x52, 0, 21, 4, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 27582, 2, 2 }, // Engine Coolant Temp High
+    { 0x7E0, 0x52, 0, 21, 5, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 27607, 2, 2 }, // Common Rail Pressure Low
+    { 0x7E0, 0x52, 0, 21, 6, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 27632, 2, 2 }, // Boost Pressure Low
+    { 0x7E0, 0x52, 0, 21, 7, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 27651, 2, 2 }, // MAF Low
+    { 0x7E0, 0x52, 0, 22, 0, 8, ByteOrder::Motorola, false, true, 0.01f, 0.0f, 27659, 0, 0 }, // MAF/Estimate MAF Ratio
+    { 0x7E0, 0x52, 39, 23, 0, 16, ByteOrder::Motorola, false, true, 0.78125f, 0.0f, 27682, 0, 0 }, // Target Idle Engine Speed
+    { 0x7E0, 0x52, 0, 25, 0, 8, ByteOrder::Motorola, false, true, 3.0517578e-05f, 0.0f, 27707, 0, 0 }, // Throttle Air Flow Learning Value(Area 1)
+    { 0x7E0, 0x52, 0, 27, 0, 8, ByteOrder::Motorola, false, true, 3.0517578e-05f, 0.0f, 27748, 0, 0 }, // Throttle Air Flow Learning Value(Area 2)
+    { 0x7E0, 0x52, 0, 29, 0, 8, ByteOrder::Motorola, false, true, 3.0517578e-05f, 0.0f, 27789, 0, 0 }, // Throttle Air Flow Learning Value(Area 3)
+    { 0x7E0, 0x52, 0, 31, 0, 8, ByteOrder::Motorola, false, true, 3.0517578e-05f, 0.0f, 27830, 0, 0 }, // Throttle Air Flow Learning Value(Calculated Value)
+    { 0x7E0, 0x52, 0, 33, 0, 8, ByteOrder::Motorola, false, true, 0.01f, 0.0f, 27881, 0, 0 }, // Throttle Air Flow Learning Value(Atmosphere Pressure Offset Value)
+    { 0x7E0, 0x52, 0, 34, 6, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 27948, 1137, 2 }, // Throttle Air Flow Learning Prohibit(Air Fuel Ratio Malfunction)
+    { 0x7E0, 0x52, 0, 34, 7, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 28012, 1137, 2 }, // Throttle Air Flow Learning Prohibit(Intake Air Pressure Malfunction)
+    { 0x7E0, 0x52, 0, 35, 0, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 28081, 1374, 2 }, // Heated Injector System Circuit Relay Fixed ON
+    { 0x7E0, 0x52, 0, 35, 1, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 28127, 1374, 2 }, // HICM FET Fixed
+    { 0x7E0, 0x52, 0, 35, 2, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 28142, 1374, 2 }, // HICM Electric System Sensor
+    { 0x7E0, 0x52, 0, 35, 3, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 28170, 1374, 2 }, // HICM Main Microcomputer Status
+    { 0x7E0, 0x52, 0, 35, 4, 2, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 28201, 1376, 4 }, // HICM Voltage Status
+    { 0x7E0, 0x52, 0, 35, 6, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 28221, 1374, 2 }, // HICM-ECU Data Update Status
+    { 0x7E0, 0x52, 0, 35, 7, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 28249, 1374, 2 }, // HICM FET Overtemperature
+    { 0x7E0, 0x52, 0, 36, 0, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 28274, 1374, 2 }, // HICM-ECU Communication Status
+    { 0x7E0, 0x52, 0, 37, 0, 2, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 28304, 1380, 4 }, // Injector Heater Open #1
+    { 0x7E0, 0x52, 0, 37, 2, 2, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 28328, 1380, 4 }, // Injector Heater Open #2
+    { 0x7E0, 0x52, 0, 37, 4, 2, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 28352, 1380, 4 }, // Injector Heater Open #3
+    { 0x7E0, 0x52, 0, 37, 6, 2, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 28376, 1380, 4 }, // Injector Heater Open #4
+    { 0x7E0, 0x52, 0, 38, 0, 2, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 28400, 1380, 4 }, // Injector Heater GND Short #1
+    { 0x7E0, 0x52, 0, 38, 2, 2, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 28429, 1380, 4 }, // Injector Heater GND Short #2
+    { 0x7E0, 0x52, 0, 38, 4, 2, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 28458, 1380, 4 }, // Injector Heater GND Short #3
+    { 0x7E0, 0x52, 0, 38, 6, 2, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 28487, 1380, 4 }, // Injector Heater GND Short #4
+    { 0x7E0, 0x52, 0, 39, 0, 2, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 28516, 1380, 4 }, // Injector Heater Battery Short #1
+    { 0x7E0, 0x52, 0, 39, 2, 2, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 28549, 1380, 4 }, // Injector Heater Battery Short #2
+    { 0x7E0, 0x52, 0, 39, 4, 2, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 28582, 1380, 4 }, // Injector Heater Battery Short #3
+    { 0x7E0, 0x52, 0, 39, 6, 2, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 28615, 1380, 4 }, // Injector Heater Battery Short #4
+    { 0x7E0, 0x52, 0, 40, 0, 2, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 28648, 1384, 4 }, // Injector Heater Resistance Value #1
+    { 0x7E0, 0x52, 0, 40, 2, 2, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 28684, 1384, 4 }, // Injector Heater Resistance Value #2
+    { 0x7E0, 0x52, 0, 40, 4, 2, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 28720, 1384, 4 }, // Injector Heater Resistance Value #3
+    { 0x7E0, 0x52, 0, 40, 6, 2, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 28756, 1384, 4 }, // Injector Heater Resistance Value #4
+    { 0x7E0, 0x52, 0, 41, 0, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 28792, 1137, 2 }, // i-ART Learning Status #1
+    { 0x7E0, 0x52, 0, 41, 1, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 28817, 1137, 2 }, // i-ART Learning Status #2
+    { 0x7E0, 0x52, 0, 41, 2, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 28842, 1137, 2 }, // i-ART Learning Status #3
+    { 0x7E0, 0x52, 0, 41, 3, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 28867, 1137, 2 }, // i-ART Learning Status #4
+    { 0x7E0, 0x52, 0, 42, 0, 8, ByteOrder::Motorola, false, true, 1.0f, 0.0f, 28892, 0, 0 }, // Injector Leaking Count #1
+    { 0x7E0, 0x52, 0, 43, 0, 8, ByteOrder::Motorola, false, true, 1.0f, 0.0f, 28918, 0, 0 }, // Injector Leaking Count #2
+    { 0x7E0, 0x52, 0, 44, 0, 8, ByteOrder::Motorola, false, true, 1.0f, 0.0f, 28944, 0, 0 }, // Injector Leaking Count #3
+    { 0x7E0, 0x52, 0, 45, 0, 8, ByteOrder::Motorola, false, true, 1.0f, 0.0f, 28970, 0, 0 }, // Injector Leaking Count #4
+    { 0x7E0, 0x52, 59, 46, 0, 8, ByteOrder::Motorola, false, true, 1.0f, 0.0f, 28996, 0, 0 }, // i-ART Learning Status History #1
+    { 0x7E0, 0x52, 59, 47, 0, 8, ByteOrder::Motorola, false, true, 1.0f, 0.0f, 29029, 0, 0 }, // i-ART Learning Status History #2
+    { 0x7E0, 0x52, 59, 48, 0, 8, ByteOrder::Motorola, false, true, 1.0f, 0.0f, 29062, 0, 0 }, // i-ART Learning Status History #3
+    { 0x7E0, 0x52, 59, 49, 0, 8, ByteOrder::Motorola, false, true, 1.0f, 0.0f, 29095, 0, 0 }, // i-ART Learning Status History #4
+    { 0x7E0, 0x52, 0, 50, 0, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 29128, 2, 2 }, // Plural Cylinders Rough Idle
+    { 0x7E0, 0x52, 0, 51, 0, 8, ByteOrder::Motorola, false, true, 1.0f, 0.0f, 29156, 0, 0 }, // Compression Leakage Count
+    { 0x7E0, 0x52, 0, 52, 0, 3, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 29276, 1388, 5 }, // Rough Idle Status
+    { 0x7E0, 0x52, 33, 53, 0, 8, ByteOrder::Motorola, false, true, 1.0f, -128.0f, 29294, 0, 0 }, // EGR Rate Differential(Actual-Target)
+    { 0x7E0, 0x53, 0, 0, 0, 8, ByteOrder::Motorola, false, true, 1.0f, 0.0f, 29331, 0, 0 }, // Electric Cooling Fan Drive Count when IG OFF
+    { 0x7E0, 0x53, 56, 1, 0, 8, ByteOrder::Motorola, false, true, 65.536f, 0.0f, 29376, 0, 0 }, // Time after Shift Change
+    { 0x7E0, 0x54, 39, 0, 0, 16, ByteOrder::Motorola, false, true, 0.78125f, 0.0f, 29400, 0, 0 }, // Engine Speed of Cyl #1
+    { 0x7E0, 0x54, 39, 2, 0, 16, ByteOrder::Motorola, false, true, 0.78125f, 0.0f, 29423, 0, 0 }, // Engine Speed of Cyl #2
+    { 0x7E0, 0x54, 39, 4, 0, 16, ByteOrder::Motorola, false, true, 0.78125f, 0.0f, 29446, 0, 0 }, // Engine Speed of Cyl #3
+    { 0x7E0, 0x54, 39, 6, 0, 16, ByteOrder::Motorola, false, true, 0.78125f, 0.0f, 29469, 0, 0 }, // Engine Speed of Cyl #4
+    { 0x7E0, 0x54, 39, 8, 0, 16, ByteOrder::Motorola, false, true, 0.78125f, 0.0f, 29492, 0, 0 }, // Engine Speed of Cyl #5
+    { 0x7E0, 0x54, 39, 10, 0, 16, ByteOrder::Motorola, false, true, 0.78125f, 0.0f, 29515, 0, 0 }, // Engine Speed of Cyl #6
+    { 0x7E0, 0x54, 39, 12, 0, 16, ByteOrder::Motorola, false, true, 0.78125f, 0.0f, 29538, 0, 0 }, // Engine Speed of Cyl #7
+    { 0x7E0, 0x54, 39, 14, 0, 16, ByteOrder::Motorola, false, true, 0.78125f, 0.0f, 29561, 0, 0 }, // Engine Speed of Cyl #8
+    { 0x7E0, 0x54, 39, 16, 0, 16, ByteOrder::Motorola, false, true, 0.78125f, 0.0f, 29584, 0, 0 }, // Engine Speed of Cyl #9
+    { 0x7E0, 0x54, 39, 18, 0, 16, ByteOrder::Motorola, false, true, 0.78125f, 0.0f, 29607, 0, 0 }, // Engine Speed of Cyl #10
+    { 0x7E0, 0x54, 39, 20, 0, 16, ByteOrder::Motorola, false, true, 0.78125f, 0.0f, 29631, 0, 0 }, // Engine Speed of Cyl #11
+    { 0x7E0, 0x54, 39, 22, 0, 16, ByteOrder::Motorola, false, true, 0.78125f, 0.0f, 29655, 0, 0 }, // Engine Speed of Cyl #12
+    { 0x7E0, 0x54, 39, 24, 0, 16, ByteOrder::Motorola, false, true, 0.78125f, 0.0f, 29679, 0, 0 }, // Av Engine Speed of All Cyl
+    { 0x7E0, 0x55, 33, 0, 0, 8, ByteOrder::Motorola, false, true, 0.390625f, -5e+01f, 29706, 0, 0 }, // A/F Learn Value Idle #1
+    { 0x7E0, 0x55, 33, 1, 0, 8, ByteOrder::Motorola, false, true, 0.390625f, -5e+01f, 29730, 0, 0 }, // A/F Learn Value Low #1
+    { 0x7E0, 0x55, 33, 2, 0, 8, ByteOrder::Motorola, false, true, 0.390625f, -5e+01f, 29753, 0, 0 }, // A/F Learn Value Mid1 #1
+    { 0x7E0, 0x55, 33, 3, 0, 8, ByteOrder::Motorola, false, true, 0.390625f, -5e+01f, 29777, 0, 0 }, // A/F Learn Value Mid2 #1
+    { 0x7E0, 0x55, 33, 4, 0, 8, ByteOrder::Motorola, false, true, 0.390625f, -5e+01f, 29801, 0, 0 }, // A/F Learn Value Mid3 #1
+    { 0x7E0, 0x55, 33, 5, 0, 8, ByteOrder::Motorola, false, true, 0.390625f, -5e+01f, 29825, 0, 0 }, // A/F Learn Value High #1
+    { 0x7E0, 0x55, 33, 7, 0, 8, ByteOrder::Motorola, false, true, 0.390625f, -5e+01f, 29849, 0, 0 }, // A/F Learn Val Low #1 (Dual)
+    { 0x7E0, 0x55, 33, 8, 0, 8, ByteOrder::Motorola, false, true, 0.390625f, -5e+01f, 29877, 0, 0 }, // A/F Learn Val Mid1 #1 (Dual)
+    { 0x7E0, 0x55, 33, 9, 0, 8, ByteOrder::Motorola, false, true, 0.390625f, -5e+01f, 29906, 0, 0 }, // A/F Learn Val Mid2 #1 (Dual)
+    { 0x7E0, 0x55, 33, 10, 0, 8, ByteOrder::Motorola, false, true, 0.390625f, -5e+01f, 29935, 0, 0 }, // A/F Learn Val High #1 (Dual)
+    { 0x7E0, 0x55, 33, 11, 0, 8, ByteOrder::Motorola, false, true, 0.390625f, -5e+01f, 29964, 0, 0 }, // A/F Learn Value Idle #2
+    { 0x7E0, 0x55, 33, 12, 0, 8, ByteOrder::Motorola, false, true, 0.390625f, -5e+01f, 29988, 0, 0 }, // A/F Learn Value Low #2
+    { 0x7E0, 0x55, 33, 13, 0, 8, ByteOrder::Motorola, false, true, 0.390625f, -5e+01f, 30011, 0, 0 }, // A/F Learn Value Mid1 #2
+    { 0x7E0, 0x55, 33, 14, 0, 8, ByteOrder::Motorola, false, true, 0.390625f, -5e+01f, 30035, 0, 0 }, // A/F Learn Value Mid2 #2
+    { 0x7E0, 0x55, 33, 16, 0, 8, ByteOrder::Motorola, false, true, 0.390625f, -5e+01f, 30059, 0, 0 }, // A/F Learn Value High #2
+    { 0x7E0, 0x55, 33, 18, 0, 8, ByteOrder::Motorola, false, true, 0.390625f, -5e+01f, 30083, 0, 0 }, // A/F Learn Val Low #2 (Dual)
+    { 0x7E0, 0x55, 33, 19, 0, 8, ByteOrder::Motorola, false, true, 0.390625f, -5e+01f, 30111, 0, 0 }, // A/F Learn Val Mid1 #2 (Dual)
+    { 0x7E0, 0x55, 33, 20, 0, 8, ByteOrder::Motorola, false, true, 0.390625f, -5e+01f, 30140, 0, 0 }, // A/F Learn Val Mid2 #2 (Dual)
+    { 0x7E0, 0x55, 33, 21, 0, 8, ByteOrder::Motorola, false, true, 0.390625f, -5e+01f, 30169, 0, 0 }, // A/F Learn Val High #2 (Dual)
+    { 0x7E0, 0x56, 39, 0, 0, 16, ByteOrder::Motorola, false, true, 0.25f, 0.0f, 30198, 0, 0 }, // Maximum Engine Speed
+    { 0x7E0, 0x56, 42, 2, 0, 16, ByteOrder::Motorola, false, true, 0.01f, 0.0f, 30219, 0, 0 }, // Vehicle Speed for Maximum Engine Speed
+    { 0x7E0, 0x56, 56, 4, 0, 16, ByteOrder::Motorola, false, true, 65.536f, 0.0f, 30258, 0, 0 }, // Red Zone Duration Time
+    { 0x7E0, 0x56, 0, 6, 0, 8, ByteOrder::Motorola, false, true, 1.0f, 0.0f, 30281, 0, 0 }, // Red Zone Count
+    { 0x7E0, 0x56, 42, 8, 0, 16, ByteOrder::Motorola, false, true, 0.01f, 0.0f, 30296, 0, 0 }, // Maximum Vehicle Speed
+    { 0x7E0, 0x57, 0, 0, 0, 8, ByteOrder::Motorola, false, true, 3.0517578e-05f, -1.0f, 30318, 0, 0 }, // A/F Sensor Determination (worst value) #1
+    { 0x7E0, 0x57, 0, 2, 0, 8, ByteOrder::Motorola, false, true, 3.0517578e-05f, -1.0f, 30360, 0, 0 }, // A/F Sensor Determination (worst value) #2
+    { 0x7E0, 0x57, 0, 4, 0, 8, ByteOrder::Motorola, false, true, 0.01f, 0.0f, 30402, 0, 0 }, // Engine Speed Fluctuation Avg (worst value) #1
+    { 0x7E0, 0x57, 0, 5, 0, 8, ByteOrder::Motorola, false, true, 0.01f, 0.0f, 30448, 0, 0 }, // Engine Speed Fluctuation Avg (worst value) #2
+    { 0x7E0, 0x57, 0, 6, 0, 8, ByteOrder::Motorola, false, true, 0.01f, 0.0f, 30494, 0, 0 }, // Engine Speed Fluctuation Avg (worst value) #3
+    { 0x7E0, 0x57, 0, 7, 0, 8, ByteOrder::Motorola, false, true, 0.01f, 0.0f, 30540, 0, 0 }, // Engine Speed Fluctuation Avg (worst value) #4
+    { 0x7E0, 0x57, 0, 8, 0, 8, ByteOrder::Motorola, false, true, 0.01f, 0.0f, 30586, 0, 0 }, // Engine Speed Fluctuation Avg (worst value) #5
+    { 0x7E0, 0x57, 0, 9, 0, 8, ByteOrder::Motorola, false, true, 0.01f, 0.0f, 30632, 0, 0 }, // Engine Speed Fluctuation Avg (worst value) #6
+    { 0x7E0, 0x57, 0, 10, 0, 8, ByteOrder::Motorola, false, true, 0.01f, 0.0f, 30678, 0, 0 }, // Engine Speed Fluctuation Avg (worst value) #7
+    { 0x7E0, 0x57, 0, 11, 0, 8, ByteOrder::Motorola, false, true, 0.01f, 0.0f, 30724, 0, 0 }, // Engine Speed Fluctuation Avg (worst value) #8
+    { 0x7E0, 0x57, 0, 12, 0, 8, ByteOrder::Motorola, false, true, 3.0517578e-05f, -1.0f, 30770, 0, 0 }, // A/F Sensor Determination (worst value) (Port) #1
+    { 0x7E0, 0x57, 0, 14, 0, 8, ByteOrder::Motorola, false, true, 3.0517578e-05f, -1.0f, 30819, 0, 0 }, // A/F Sensor Determination (worst value) (Port) #2
+    { 0x7E0, 0x57, 0, 16, 0, 8, ByteOrder::Motorola, false, true, 0.01f, 0.0f, 30868, 0, 0 }, // Engine Speed Fluctuation Avg (worst value) (Port) #1
+    { 0x7E0, 0x57, 0, 17, 0, 8, ByteOrder::Motorola, false, true, 0.01f, 0.0f, 30921, 0, 0 }, // Engine Speed Fluctuation Avg (worst value) (Port) #2
+    { 0x7E0, 0x57, 0, 18, 0, 8, ByteOrder::Motorola, false, true, 0.01f, 0.0f, 30974, 0, 0 }, // Engine Speed Fluctuation Avg (worst value) (Port) #3
+    { 0x7E0, 0x57, 0, 19, 0, 8, ByteOrder::Motorola, false, true, 0.01f, 0.0f, 31027, 0, 0 }, // Engine Speed Fluctuation Avg (worst value) (Port) #4
+    { 0x7E0, 0x57, 0, 20, 0, 8, ByteOrder::Motorola, false, true, 0.01f, 0.0f, 31080, 0, 0 }, // Engine Speed Fluctuation Avg (worst value) (Port) #5
+    { 0x7E0, 0x57, 0, 21, 0, 8, ByteOrder::Motorola, false, true, 0.01f, 0.0f, 31133, 0, 0 }, // Engine Speed Fluctuation Avg (worst value) (Port) #6
+    { 0x7E0, 0x57, 0, 22, 0, 8, ByteOrder::Motorola, false, true, 0.01f, 0.0f, 31186, 0, 0 }, // Engine Speed Fluctuation Avg (worst value) (Port) #7
+    { 0x7E0, 0x57, 0, 23, 0, 8, ByteOrder::Motorola, false, true, 0.01f, 0.0f, 31239, 0, 0 }, // Engine Speed Fluctuation Avg (worst value) (Port) #8
+    { 0x7E0, 0x58, 34, 0, 0, 16, ByteOrder::Motorola, false, true, 0.01f, -327.68f, 31292, 0, 0 }, // GPF Clogged Determination Threshold Bank1
+    { 0x7E0, 0x58, 34, 2, 0, 16, ByteOrder::Motorola, false, true, 0.01f, -327.68f, 31334, 0, 0 }, // GPF Clogged Determination Threshold Bank2
+    { 0x7E0, 0x58, 34, 4, 0, 16, ByteOrder::Motorola, false, true, 0.01f, -327.68f, 31376, 0, 0 }, // GPF Steady Differential Pressure Average Bank1
+    { 0x7E0, 0x58, 34, 6, 0, 16, ByteOrder::Motorola, false, true, 0.01f, -327.68f, 31423, 0, 0 }, // GPF Steady Differential Pressure Average Bank2
+    { 0x7E0, 0x58, 46, 8, 0, 16, ByteOrder::Motorola, false, true, 0.01f, 0.0f, 31470, 0, 0 }, // GPF Steady Air Flow Average Bank1
+    { 0x7E0, 0x58, 46, 10, 0, 16, ByteOrder::Motorola, false, true, 0.01f, 0.0f, 31504, 0, 0 }, // GPF Steady Air Flow Average Bank2
+    { 0x7E0, 0x58, 34, 16, 0, 16, ByteOrder::Motorola, false, true, 0.01f, -327.68f, 31538, 0, 0 }, // GPF Differential Pressure Offset Bank1
+    { 0x7E0, 0x58, 34, 18, 0, 16, ByteOrder::Motorola, false, true, 0.01f, -327.68f, 31577, 0, 0 }, // GPF Differential Pressure Offset Bank2
+    { 0x7E0, 0x58, 0, 24, 0, 8, ByteOrder::Motorola, false, true, 0.001f, 0.0f, 31616, 0, 0 }, // GPF Variance Determination Threshold Bank1
+    { 0x7E0, 0x58, 0, 26, 0, 8, ByteOrder::Motorola, false, true, 0.001f, 0.0f, 31659, 0, 0 }, // GPF Variance Determination Threshold Bank2
+    { 0x7E0, 0x58, 0, 28, 0, 8, ByteOrder::Motorola, false, true, 0.001f, 0.0f, 31702, 0, 0 }, // GPF Variance Bank1
+    { 0x7E0, 0x58, 0, 30, 0, 8, ByteOrder::Motorola, false, true, 0.001f, 0.0f, 31721, 0, 0 }, // GPF Variance Bank2
+    { 0x7E0, 0x58, 33, 36, 0, 8, ByteOrder::Motorola, false, true, 1.0f, 0.0f, 31740, 0, 0 }, // PM Deposition Ratio Bank1
+    { 0x7E0, 0x58, 33, 37, 0, 8, ByteOrder::Motorola, false, true, 1.0f, 0.0f, 31766, 0, 0 }, // PM Deposition Ratio Bank2
+    { 0x7E0, 0x58, 33, 38, 0, 8, ByteOrder::Motorola, false, true, 1.0f, 0.0f, 31792, 0, 0 }, // Ash Deposition Ratio Bank1
+    { 0x7E0, 0x58, 33, 39, 0, 8, ByteOrder::Motorola, false, true, 1.0f, 0.0f, 31819, 0, 0 }, // Ash Deposition Ratio Bank2
+    { 0x7E0, 0x58, 34, 40, 0, 16, ByteOrder::Motorola, false, true, 0.01f, -327.68f, 31846, 0, 0 }, // Differential Pressure Sensor Learning Value Bank 1
+    { 0x7E0, 0x58, 34, 42, 0, 16, ByteOrder::Motorola, false, true, 0.01f, -327.68f, 31897, 0, 0 }, // Differential Pressure Sensor Learning Value Bank 2
+    { 0x7E0, 0x58, 57, 44, 0, 16, ByteOrder::Motorola, false, true, 0.1f, -4e+01f, 31948, 0, 0 }, // Rear Catalyst Estimate Temperature
+    { 0x7E0, 0x81, 39, 0, 0, 8, ByteOrder::Motorola, false, true, 5e+01f, 0.0f, 9483, 0, 0 }, // SPD (NT)
+    { 0x7E0, 0x81, 48, 1, 0, 16, ByteOrder::Motorola, false, true, 7.6293945e-05f, 0.0f, 31983, 0, 0 }, // NT Sensor Voltage
+    { 0x7E0, 0x81, 39, 3, 0, 8, ByteOrder::Motorola, false, true, 5e+01f, 0.0f, 9504, 0, 0 }, // SPD (NC)
+    { 0x7E0, 0x81, 48, 4, 0, 16, ByteOrder::Motorola, false, true, 7.6293945e-05f, 0.0f, 32001, 0, 0 }, // NC Sensor Voltage
+    { 0x7E0, 0x81, 39, 6, 0, 8, ByteOrder::Motorola, false, true, 5e+01f, 0.0f, 32019, 0, 0 }, // SPD (NC0)
+    { 0x7E0, 0x81, 48, 7, 0, 16, ByteOrder::Motorola, false, true, 7.6293945e-05f, 0.0f, 32029, 0, 0 }, // NC0 Sensor Voltage
+    { 0x7E0, 0x81, 39, 9, 0, 8, ByteOrder::Motorola, false, true, 5e+01f, 0.0f, 32048, 0, 0 }, // SPD (NC2)
+    { 0x7E0, 0x81, 48, 10, 0, 16, ByteOrder::Motorola, false, true, 7.6293945e-05f, 0.0f, 32058, 0, 0 }, // NC2 Sensor Voltage
+    { 0x7E0, 0x81, 39, 12, 0, 8, ByteOrder::Motorola, false, true, 5e+01f, 0.0f, 32077, 0, 0 }, // SPD (NC3)
+    { 0x7E0, 0x81, 48, 13, 0, 16, ByteOrder::Motorola, false, true, 7.6293945e-05f, 0.0f, 32087, 0, 0 }, // NC3 Sensor Voltage
+    { 0x7E0, 0x81, 39, 15, 0, 8, ByteOrder::Motorola, false, true, 5e+01f, 0.0f, 32106, 0, 0 }, // SPD (NIN)
+    { 0x7E0, 0x81, 48, 16, 0, 16, ByteOrder::Motorola, false, true, 7.6293945e-05f, 0.0f, 32116, 0, 0 }, // NIN Sensor Voltage
+    { 0x7E0, 0x81, 39, 18, 0, 8, ByteOrder::Motorola, false, true, 5e+01f, 0.0f, 32135, 0, 0 }, // SPD (NOUT)
+    { 0x7E0, 0x81, 48, 19, 0, 16, ByteOrder::Motorola, false, true, 7.6293945e-05f, 0.0f, 32146, 0, 0 }, // NOUT Sensor Voltage
+    { 0x7E0, 0x81, 42, 21, 0, 8, ByteOrder::Motorola, false, true, 1.0f, 0.0f, 9513, 0, 0 }, // SPD (SP2)
+    { 0x7E0, 0x81, 48, 22, 0, 16, ByteOrder::Motorola, false, true, 7.6293945e-05f, 0.0f, 32166, 0, 0 }, // SP2 Sensor Voltage
+    { 0x7E0, 0x81, 39, 24, 0, 16, ByteOrder::Motorola, false, true, 0.25f, 0.0f, 32185, 0, 0 }, // SPD (NIM)
+    { 0x7E0, 0x81, 48, 26, 0, 16, ByteOrder::Motorola, false, true, 7.6293945e-05f, 0.0f, 32195, 0, 0 }, // NIM Sensor Voltage
+    { 0x7E0, 0x81, 39, 28, 0, 16, ByteOrder::Motorola, false, true, 1.0f, 0.0f, 9483, 0, 0 }, // SPD (NT)
+    { 0x7E0, 0x81, 39, 30, 0, 16, ByteOrder::Motorola, false, true, 1.0f, 0.0f, 32106, 0, 0 }, // SPD (NIN)
+    { 0x7E0, 0x81, 39, 32, 0, 16, ByteOrder::Motorola, false, true, 1.0f, 0.0f, 32135, 0, 0 }, // SPD (NOUT)
+    { 0x7E0, 0x82, 57, 0, 0, 16, ByteOrder::Motorola, false, true, 0.00390625f, -4e+01f, 32214, 0, 0 }, // A/T Oil Temperature 1
+    { 0x7E0, 0x82, 57, 2, 0, 16, ByteOrder::Motorola, false, true, 0.00390625f, -4e+01f, 32236, 0, 0 }, // A/T Oil Temperature 2
+    { 0x7E0, 0x82, 57, 4, 0, 16, ByteOrder::Motorola, false, true, 0.00390625f, -4e+01f, 32258, 0, 0 }, // A/T Oil Temperature 3
+    { 0x7E0, 0x82, 36, 6, 0, 16, ByteOrder::Motorola, false, true, 0.001953125f, -64.0f, 32280, 0, 0 }, // A/T Oil Pressure
+    { 0x7E0, 0x82, 48, 8, 0, 16, ByteOrder::Motorola, false, true, 0.0012207031f, 0.0f, 32297, 0, 0 }, // G Sensor
+    { 0x7E0, 0x82, 33, 10, 0, 16, ByteOrder::Motorola, false, true, 0.0061035156f, -2e+02f, 32306, 0, 0 }, // Clutch Stroke Position
+    { 0x7E0, 0x82, 48, 12, 0, 16, ByteOrder::Motorola, false, true, 7.6293945e-05f, 0.0f, 32329, 0, 0 }, // Clutch Stroke Sensor Voltage
+    { 0x7E0, 0x83, 0, 0, 0, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 32372, 1393, 2 }, // iMT Type
+    { 0x7E0, 0x83, 0, 0, 1, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 32381, 2, 2 }, // Torque Converter Temperature Raise History
+    { 0x7E0, 0x83, 0, 0, 2, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 32438, 1395, 2 }, // Shift Control Mode
+    { 0x7E0, 0x83, 0, 0, 3, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 32457, 2, 2 }, // MT Down Shift Indication
+    { 0x7E0, 0x83, 0, 0, 4, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 32482, 2, 2 }, // MT Up Shift Indication
+    { 0x7E0, 0x83, 0, 0, 5, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 32525, 1397, 2 }, // G Sensor Calibration
+    { 0x7E0, 0x83, 0, 0, 6, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 32552, 1399, 2 }, // CVT Oil Press Calibration
+    { 0x7E0, 0x83, 48, 1, 0, 16, ByteOrder::Motorola, false, true, 0.0012207031f, 0.0f, 32578, 0, 0 }, // G Sensor Learning Value
+    { 0x7E0, 0x83, 0, 3, 0, 8, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 32629, 1401, 256 }, // Off-road Guidance Status
+    { 0x7E0, 0x83, 0, 4, 0, 8, ByteOrder::Motorola, false, true, 1.0f, 0.0f, 32654, 0, 0 }, // ATF Thermal Degradation Estimate
+    { 0x7E0, 0x83, 0, 6, 0, 2, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 32700, 1657, 4 }, // iMT Telltale
+    { 0x7E0, 0x83, 0, 16, 0, 4, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 32722, 1661, 11 }, // Shift Range Indicator
+    { 0x7E0, 0x85, 0, 0, 0, 4, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 32744, 1672, 9 }, // Shift Status
+    { 0x7E0, 0x85, 0, 1, 4, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 32757, 2, 2 }, // Solenoid(SC)
+    { 0x7E0, 0x85, 0, 1, 5, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 32770, 2, 2 }, // SL Solenoid Status
+    { 0x7E0, 0x85, 0, 1, 6, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 32789, 2, 2 }, // ST Solenoid Status
+    { 0x7E0, 0x85, 0, 1, 7, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 32808, 2, 2 }, // Lock Up
+    { 0x7E0, 0x85, 0, 2, 1, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 32816, 2, 2 }, // Solenoid(SLP)
+    { 0x7E0, 0x85, 0, 2, 2, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 32830, 2, 2 }, // SLN Solenoid Status
+    { 0x7E0, 0x85, 0, 2, 3, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 32850, 2, 2 }, // SLU Solenoid Status
+    { 0x7E0, 0x85, 0, 2, 4, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 32870, 2, 2 }, // SLT Solenoid Status
+    { 0x7E0, 0x85, 0, 2, 6, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 32890, 2, 2 }, // Solenoid (SLC)
+    { 0x7E0, 0x85, 0, 2, 7, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 32905, 2, 2 }, // Solenoid (SLS)
+    { 0x7E0, 0x85, 0, 3, 4, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 32920, 2, 2 }, // DSL Solenoid Status
+    { 0x7E0, 0x85, 0, 3, 5, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 32940, 2, 2 }, // Solenoid (DSU)
+    { 0x7E0, 0x85, 0, 3, 6, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 32955, 2, 2 }, // Solenoid (DS2)
+    { 0x7E0, 0x85, 0, 3, 7, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 32970, 2, 2 }, // Solenoid (DS1)
+    { 0x7E0, 0x85, 0, 4, 0, 8, ByteOrder::Motorola, false, true, 0.00024414062f, 0.0f, 32985, 0, 0 }, // CVT Shift Status Ratio
+    { 0x7E0, 0xC1, 0, 0, 0, 8, ByteOrder::Motorola, false, true, 1.0f, 0.0f, 33008, 0, 0 }, // Model Code
+    { 0x7E0, 0xC1, 0, 7, 0, 8, ByteOrder::Motorola, false, true, 1.0f, 0.0f, 33019, 0, 0 }, // Engine Type
+    { 0x7E0, 0xC1, 0, 13, 0, 8, ByteOrder::Motorola, false, true, 1.0f, 0.0f, 33031, 0, 0 }, // Cylinder Number
+    { 0x7E0, 0xC1, 0, 14, 0, 8, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 33104, 1681, 129 }, // Transmission Type
+    { 0x7E0, 0xC1, 0, 15, 0, 8, ByteOrder::Motorola, false, true, 1.0f, 0.0f, 33122, 0, 0 }, // Destination
+    { 0x7E0, 0xC1, 0, 16, 0, 8, ByteOrder::Motorola, false, true, 1.0f, 1.9e+03f, 33134, 0, 0 }, // Model Year
+    { 0x7E0, 0xC1, 0, 17, 0, 6, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 33204, 1810, 34 }, // System Identification
+    { 0x7E0, 0xC1, 0, 18, 0, 8, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 33239, 1844, 129 }, // Transmission Type2
+    { 0x7E0, 0xE1, 0, 0, 0, 8, ByteOrder::Motorola, false, true, 1.0f, 0.0f, 33258, 0, 0 }, // # Codes(Include History)
+    { 0x7E0, 0xE3, 0, 0, 0, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 33283, 73, 2 }, // OXS1 (A/FS2) Test Result
+    { 0x7E0, 0xE3, 0, 0, 1, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 33308, 73, 2 }, // OXS2 (A/FS2) Test Result
+    { 0x7E0, 0xE3, 0, 0, 2, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 33333, 73, 2 }, // Misfire Test Result
+    { 0x7E0, 0xE3, 0, 0, 3, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 33353, 73, 2 }, // AS Test Result
+    { 0x7E0, 0xE3, 0, 0, 4, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 33368, 73, 2 }, // NSW Test Result
+    { 0x7E0, 0xE3, 0, 0, 5, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 33384, 73, 2 }, // SPD Test Result
+    { 0x7E0, 0xE3, 0, 0, 6, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 33400, 73, 2 }, // Misfire Test Result(CNG)
+    { 0x7E0, 0xE3, 0, 0, 7, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 33425, 2, 2 }, // Check Mode
+    { 0x7E0, 0xE3, 0, 1, 0, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 33436, 73, 2 }, // A/F Test Results #1
+    { 0x7E0, 0xE3, 0, 1, 1, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 33456, 73, 2 }, // A/F Test Results #2
+    { 0x7E0, 0xE3, 0, 1, 2, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 33476, 73, 2 }, // O2 HCAC #1 Test Result
+    { 0x7E0, 0xE3, 0, 1, 3, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 33499, 73, 2 }, // O2 HCAC #2 Test Result
+    { 0x7E0, 0xE3, 0, 2, 0, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 33522, 73, 2 }, // HC Adsorber Ex Temp B1S1
+    { 0x7E0, 0xE3, 0, 2, 1, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 33547, 73, 2 }, // HC Adsorber Ex Temp B2S1
+    { 0x7E0, 0xE3, 0, 2, 2, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 33572, 73, 2 }, // HC Adsorber Ex Temp B1S2
+    { 0x7E0, 0xE3, 0, 2, 3, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 33597, 73, 2 }, // HC Adsorber Ex Temp B2S2
+    { 0x7E0, 0xE3, 0, 2, 4, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 33622, 73, 2 }, // HC Adsorber Catalyst Test
+    { 0x7E0, 0xE3, 0, 3, 0, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 33648, 73, 2 }, // Exhaust Temperature B1S1 Test Result
+    { 0x7E0, 0xE3, 0, 3, 1, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 33685, 73, 2 }, // Exhaust Temperature B1S2 Test Result
+    { 0x7E0, 0xE3, 0, 3, 2, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 33722, 73, 2 }, // Exhaust Temperature B1S3 Test Result
+    { 0x7E0, 0xE3, 0, 3, 3, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 33759, 73, 2 }, // Exhaust Temperature B1S4 Test Result
+    { 0x7E1, 0x01, 33, 0, 0, 8, ByteOrder::Motorola, false, true, 0.39215687f, 0.0f, 2177, 0, 0 }, // Calculate Load
+    { 0x7E1, 0x01, 57, 9, 0, 8, ByteOrder::Motorola, false, true, 1.0f, -4e+01f, 2264, 0, 0 }, // Coolant Temp
+    { 0x7E1, 0x01, 42, 12, 0, 8, ByteOrder::Motorola, false, true, 1.0f, 0.0f, 1812, 0, 0 }, // Vehicle Speed
+    { 0x7E1, 0x06, 0, 0, 7, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 6582, 2, 2 }, // MIL
+    { 0x7E1, 0x25, 0, 4, 4, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 10325, 2, 2 }, // Shift SW Status (D Range)
+    { 0x7E1, 0x25, 0, 4, 5, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 10351, 2, 2 }, // Shift SW Status (N Range)
+    { 0x7E1, 0x25, 0, 4, 6, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 10377, 2, 2 }, // Shift SW Status (R Range)
+    { 0x7E1, 0x25, 0, 4, 7, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 10403, 2, 2 }, // Shift SW Status (P Range)
+    { 0x7E1, 0x25, 0, 5, 3, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 10444, 2, 2 }, // Shift SW Status (B Range)
+    { 0x7E1, 0x82, 57, 0, 0, 16, ByteOrder::Motorola, false, true, 0.00390625f, -4e+01f, 32214, 0, 0 }, // A/T Oil Temperature 1
+    { 0x7E1, 0x83, 0, 0, 6, 1, ByteOrder::Motorola, false, false, 1.0f, 0.0f, 32552, 1399, 2 }, // CVT Oil Press Calibration
+    { 0x7E1, 0xE1, 0, 0, 0, 8, ByteOrder::Motorola, false, true, 1.0f, 0.0f, 33258, 0, 0 }, // # Codes(Include History)
+};
+
+inline constexpr UdsDidEntry UDS_DIDS[] = {
+    { 0x0C7, 0x21, 0, 2 },
+    { 0x0C7, 0x22, 2, 1 },
+    { 0x0C7, 0x23, 3, 1 },
+    { 0x0C7, 0x24, 4, 1 },
+    { 0x0C7, 0x25, 5, 3 },
+    { 0x0C7, 0x2B, 8, 24 },
+    { 0x0C7, 0x2F, 32, 1 },
+    { 0x0C7, 0x34, 33, 1 },
+    { 0x0C7, 0x35, 34, 1 },
+    { 0x0C7, 0x3B, 35, 3 },
+    { 0x0C7, 0xC1, 38, 1 },
+    { 0x0C7, 0xC3, 39, 1 },
+    { 0x0C7, 0xE1, 40, 1 },
+    { 0x7B0, 0x03, 41, 8 },
+    { 0x7B0, 0x04, 49, 16 },
+    { 0x7B0, 0x05, 65, 7 },
+    { 0x7B0, 0x06, 72, 3 },
+    { 0x7B0, 0x21, 75, 1 },
+    { 0x7B0, 0x3C, 76, 2 },
+    { 0x7B0, 0x41, 78, 9 },
+    { 0x7B0, 0x85, 87, 3 },
+    { 0x7B0, 0xE1, 90, 1 },
+    { 0x7E0, 0x01, 91, 51 },
+    { 0x7E0, 0x03, 142, 49 },
+    { 0x7E0, 0x04, 191, 23 },
+    { 0x7E0, 0x05, 214, 28 },
+    { 0x7E0, 0x06, 242, 47 },
+    { 0x7E0, 0x07, 289, 32 },
+    { 0x7E0, 0x08, 321, 6 },
+    { 0x7E0, 0x21, 327, 10 },
+    { 0x7E0, 0x22, 337, 15 },
+    { 0x7E0, 0x23, 352, 1 },
+    { 0x7E0, 0x24, 353, 8 },
+    { 0x7E0, 0x25, 361, 74 },
+    { 0x7E0, 0x28, 435, 1 },
+    { 0x7E0, 0x29, 436, 4 },
+    { 0x7E0, 0x2C, 440, 28 },
+    { 0x7E0, 0x30, 468, 6 },
+    { 0x7E0, 0x31, 474, 19 },
+    { 0x7E0, 0x33, 493, 17 },
+    { 0x7E0, 0x35, 510, 7 },
+    { 0x7E0, 0x37, 517, 35 },
+    { 0x7E0, 0x38, 552, 22 },
+    { 0x7E0, 0x39, 574, 56 },
+    { 0x7E0, 0x3A, 630, 48 },
+    { 0x7E0, 0x3C, 678, 26 },
+    { 0x7E0, 0x3D, 704, 34 },
+    { 0x7E0, 0x3E, 738, 13 },
+    { 0x7E0, 0x41, 751, 24 },
+    { 0x7E0, 0x42, 775, 10 },
+    { 0x7E0, 0x43, 785, 1 },
+    { 0x7E0, 0x44, 786, 19 },
+    { 0x7E0, 0x45, 805, 33 },
+    { 0x7E0, 0x46, 838, 3 },
+    { 0x7E0, 0x47, 841, 22 },
+    { 0x7E0, 0x48, 863, 26 },
+    { 0x7E0, 0x49, 889, 15 },
+    { 0x7E0, 0x4A, 904, 1 },
+    { 0x7E0, 0x4B, 905, 66 },
+    { 0x7E0, 0x4C, 971, 17 },
+    { 0x7E0, 0x51, 988, 43 },
+    { 0x7E0, 0x52, 1031, 77 },
+    { 0x7E0, 0x53, 1108, 2 },
+    { 0x7E0, 0x54, 1110, 13 },
+    { 0x7E0, 0x55, 1123, 19 },
+    { 0x7E0, 0x56, 1142, 5 },
+    { 0x7E0, 0x57, 1147, 20 },
+    { 0x7E0, 0x58, 1167, 19 },
+    { 0x7E0, 0x81, 1186, 21 },
+    { 0x7E0, 0x82, 1207, 7 },
+    { 0x7E0, 0x83, 1214, 12 },
+    { 0x7E0, 0x85, 1226, 16 },
+    { 0x7E0, 0xC1, 1242, 8 },
+    { 0x7E0, 0xE1, 1250, 1 },
+    { 0x7E0, 0xE3, 1251, 21 },
+    { 0x7E1, 0x01, 1272, 3 },
+    { 0x7E1, 0x06, 1275, 1 },
+    { 0x7E1, 0x25, 1276, 5 },
+    { 0x7E1, 0x82, 1281, 1 },
+    { 0x7E1, 0x83, 1282, 1 },
+    { 0x7E1, 0xE1, 1283, 1 },
+};
+
+#endif // _UDS_TABLES_H
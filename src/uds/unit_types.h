@@ -0,0 +1,81 @@
+#ifndef _UNIT_TYPES_H
+#define _UNIT_TYPES_H
+
+#include <cstdint>
+#include <array>
+#include <optional>
+#include <string>
+
+// Helper enum to tag the C++ type
+enum class ValueType : uint8_t {
+    Float,
+    UInt16,
+    UInt32,
+    Boolean
+};
+
+struct UnitTypeInfo {
+    uint8_t                 id;
+    std::string             name;
+    std::string             description;
+    std::optional<float>    minValue;
+    std::optional<float>    maxValue;
+    ValueType               valueType;
+};
+
+// Array of all infos, in increasing Id order
+inline const std::array<UnitTypeInfo, 32> unitTypeInfos{{
+    { 0,   "GENERAL",            "Generic / ECU Identifiers",         std::nullopt,    std::nullopt,    ValueType::Boolean },
+    { 1,   "ACCELERATION",       "Acceleration, Gradient",              -10.0f,          10.0f,           ValueType::Float },
+    { 2,   "G_FORCE",            "G-force sensors",                     -5.0f,           5.0f,            ValueType::Float },
+    { 3,   "ACCEL_REQUEST",      "Acceleration request signals",        0.0f,            100.0f,          ValueType::Float },
+    { 4,   "DECELERATION",       "Deceleration sensor",                 -10.0f,          10.0f,           ValueType::Float },
+    { 5,   "IGNITION_FEEDBACK",  "Ignition timing and feedback",        -20.0f,          60.0f,           ValueType::Float },
+    { 6,   "ANGLE_SENSOR",       "Absolute angles (Steering, Pinion)",  -900.0f,         900.0f,          ValueType::Float },
+    { 7,   "YAW_RATE",           "Yaw rate sensors",                    -200.0f,         200.0f,          ValueType::Float },
+    { 9,   "CURRENT_SENSOR",     "Current draw sensors (Throttle, Clutch)", -50.0f, 50.0f,     ValueType::Float },
+    { 11,  "PM_SENSOR",          "Particulate Matter Sensors",              0.0f,            1000.0f,         ValueType::Float },
+    { 13,  "DISTANCE",           "Distance / Mileage / Odometer-related",   0.0f, 999999.0f,   ValueType::Float },
+    { 14,  "FORWARD_DISTANCE",   "Forward vehicle distance measurement",    0.0f,    300.0f,       ValueType::Float },
+    { 17,  "ODOMETER",           "Odometer history and mileage",            0.0f,            999999.0f,       ValueType::UInt32 },
+    { 18,  "BATTERY_STATUS",     "Battery charge, hybrid systems",          0.0f,            100.0f,          ValueType::Float },
+    { 19,  "POWER_MANAGEMENT",   "Request Power, Wout Control",             0.0f,            100.0f,          ValueType::Float },
+    { 22,  "HYBRID_BATTERY",     "Hybrid / EV Battery power levels",        0.0f,            500.0f,          ValueType::Float },
+    { 23,  "FUEL_SYSTEM",        "Fuel system-related parameters",          0.0f,            100.0f,          ValueType::Float },
+    { 24,  "FUEL_INJECTION",     "Injection volume, fuel pump parameters",  0.0f, 200.0f,    ValueType::Float },
+    { 25,  "CRUISE_CONTROL",     "Cruise control request forces",             0.0f,            100.0f,          ValueType::Float },
+    { 29,  "FREQUENCY_SENSOR",   "Frequency-based sensors (Motor, Generator)", 0.0f, 5000.0f, ValueType::UInt16 },
+    { 30,  "ILLUMINATION_SENSOR","Light control, brightness",         0.0f,            100000.0f,       ValueType::UInt32 },
+    { 32,  "EXHAUST_SENSOR",     "NOx and exhaust emissions",         0.0f,            1000.0f,         ValueType::Float },
+    { 33,  "LOAD_FUEL_TRIM",     "Load calculations, Fuel trims",     0.0f,            100.0f,          ValueType::Float },
+    { 34,  "MAP_TIRE_PRESSURE",  "Manifold Pressure and Tire Inflation sensors", 10.0f, 400.0f, ValueType::Float },
+    { 39,  "ENGINE_RPM",         "Engine Speed, RPM",                 0.0f,            10000.0f,        ValueType::UInt16 },
+    { 42,  "SPEED_SENSOR",       "Vehicle Speed Sensors",             0.0f,            300.0f,          ValueType::UInt16 },
+    { 48,  "VOLTAGE_SENSOR",     "Oxygen Sensor, Solar Voltage, Battery Voltage", 0.0f, 18.0f, ValueType::Float },
+    { 57,  "TEMPERATURE_SENSOR", "Coolant Temperature, Intake Air Temp",    -40.0f, 150.0f,   ValueType::Float },
+    { 58,  "TORQUE_SENSOR",      "Steering, Motor, Brake Torque",           -500.0f,         1000.0f,         ValueType::Float },
+    { 59,  "POSITION_SENSOR",    "Throttle, Clutch, ASL Gear Position",     0.0f,   100.0f,        ValueType::Float },
+    { 66,  "AMBIENT_TEMP",       "Outside temperature sensors",             -50.0f,          60.0f,           ValueType::Float },
+    { 75,  "MASS_AIR_FLOW",      "MAF Sensors (filtered & raw values)",     0.0f,    655.0f,        ValueType::Float }
+}};
+
+/**
+ * @brief Finds UnitTypeInfo by unit ID
+ *
+ * Searches through the unitTypeInfos array to find the entry with matching unit ID.
+ * This is necessary because unit IDs are not consecutive and cannot be used as direct array indices.
+ *
+ * @param unit_id The unit ID to search for
+ * @return Pointer to UnitTypeInfo if found, nullptr if not found
+ */
+inline const UnitTypeInfo* findUnitTypeInfo(uint8_t unit_id)
+{
+    for (const auto &info : unitTypeInfos) {
+        if (info.id == unit_id) {
+            return &info;
+        }
+    }
+    return nullptr;
+}
+
+#endif // _UNIT_TYPES_H
@@ -0,0 +1,212 @@
+// Host test of the shipped derived signals: each compiled program evaluated from published inputs, including
+// the divide-by-zero guard of the gear ratio and inputs without data or gone stale.
+//
+//   g++ -std=gnu++17 -Wall -Wextra -Isrc -Itest/host -o derived_signals_test test/derived_signals_test.cpp
+//       src/signals/derived_signals.cpp src/signals/change_notifier.cpp src/signals/signal_registry.cpp src/signals/signal_store.cpp
+
+#include "signals/derived_signals.h"
+#include "signals/signal_registry.h"
+#include "logger/logger.h"
+#include "freertos/task.h"
+#include <chrono>
+#include <cmath>
+#include <cstdarg>
+#include <cstdio>
+
+static int failures = 0;
+
+#define CHECK(condition)                                                      \
+    do                                                                        \
+    {                                                                         \
+        if (!(condition))                                                     \
+        {                                                                     \
+            printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #condition); \
+            failures++;                                                       \
+        }                                                                     \
+    } while (0)
+
+static int compileErrors = 0;
+
+static void log(const char *func, const char *format, va_list args)
+{
+    printf("%s: ", func);
+    vprintf(format, args);
+    printf("\n");
+}
+
+void Logger::error(const char *func, const char *format, ...)
+{
+    compileErrors++;
+    va_list args;
+    va_start(args, format);
+    log(func, format, args);
+    va_end(args);
+}
+
+void Logger::info(const char *func, const char *format, ...)
+{
+    va_list args;
+    va_start(args, format);
+    log(func, format, args);
+    va_end(args);
+}
+
+unsigned long millis()
+{
+    return 0;
+}
+
+unsigned long micros()
+{
+    using namespace std::chrono;
+    return (unsigned long)duration_cast<microseconds>(steady_clock::now().time_since_epoch()).count();
+}
+
+BaseType_t xTaskNotifyGive(TaskHandle_t)
+{
+    return pdTRUE;
+}
+
+// What the ISF task does for a decoded value, then for the end of the response
+static void publish(SignalId id, float value, uint32_t timestamp)
+{
+    derivedSignals.onPublished(id, value, timestamp);
+}
+
+static bool published(SignalId id, float &value, uint32_t &timestamp)
+{
+    SignalSample sample;
+    if (!signalStore.read(id, sample) || sample.quality == SignalQuality::NoData)
+    {
+        return false;
+    }
+    value = sample.value;
+    timestamp = sample.timestamp;
+    return true;
+}
+
+static bool near(float value, float expected)
+{
+    return fabsf(value - expected) <= 1e-4f * fmaxf(1.0f, fabsf(expected));
+}
+
+int main()
+{
+    derivedSignals.initialize();
+    CHECK(compileErrors == 0);
+
+    const SignalId average_wheel = derivedSignals.find("Average Wheel Speed");
+    const SignalId gear_ratio = derivedSignals.find("Overall Gear Ratio");
+    const SignalId oil = derivedSignals.find("Oil Temperature");
+    CHECK(average_wheel != SIGNAL_NONE && gear_ratio != SIGNAL_NONE && oil != SIGNAL_NONE);
+    CHECK(derivedSignals.find("Not A Signal") == SIGNAL_NONE);
+
+    const SignalId wheels[4] = {findSignalId(0x7B0, "FR Wheel Speed"), findSignalId(0x7B0, "FL Wheel Speed"),
+                                findSignalId(0x7B0, "RR Wheel Speed"), findSignalId(0x7B0, "RL Wheel Speed")};
+    const SignalId engine_speed = findSignalId(0x7E0, "Engine Speed");
+    const SignalId vehicle_speed = findSignalId(0x7E0, "Vehicle Speed");
+    const SignalId engine_oil = findSignalId(0x7E0, "Engine Oil Temperature");
+    const SignalId coolant = findSignalId(0x7E0, "Coolant Temp");
+
+    // require() subscribes every input so the ISF side polls it
+    derivedSignals.require(average_wheel);
+    derivedSignals.require(gear_ratio);
+    derivedSignals.require(oil);
+    const ConsumerMask derived_bit = 1u << (uint8_t)SignalConsumer::DerivedSignals;
+    for (SignalId wheel : wheels)
+    {
+        CHECK(signalRegistry.subscribers(wheel) & derived_bit);
+    }
+    CHECK(signalRegistry.subscribers(coolant) & derived_bit);
+
+    float value = 0.0f;
+    uint32_t timestamp = 0;
+
+    // Nothing is published until every input has data
+    uint32_t now = 1000;
+    publish(wheels[0], 50.0f, now);
+    publish(wheels[1], 52.0f, now);
+    publish(wheels[2], 54.0f, now);
+    publish(engine_speed, 3000.0f, now);
+    derivedSignals.evaluateDirty(now);
+    CHECK(!published(average_wheel, value, timestamp));
+    CHECK(!published(gear_ratio, value, timestamp));    // max() must not hide the missing vehicle speed
+    CHECK(!published(oil, value, timestamp));
+
+    // Average Wheel Speed: the mean of the four wheels
+    now = 1100;
+    publish(wheels[3], 56.0f, now);
+    derivedSignals.evaluateDirty(now);
+    CHECK(published(average_wheel, value, timestamp) && near(value, 53.0f) && timestamp == now);
+
+    // Overall Gear Ratio: rpm * 0.1242 / km/h
+    now = 1200;
+    publish(vehicle_speed, 100.0f, now);
+    derivedSignals.evaluateDirty(now);
+    CHECK(published(gear_ratio, value, timestamp) && near(value, 3000.0f * 0.1242f / 100.0f));
+
+    // Standing still divides by the max(..., 1) floor instead of zero
+    now = 1300;
+    publish(vehicle_speed, 0.0f, now);
+    derivedSignals.evaluateDirty(now);
+    CHECK(published(gear_ratio, value, timestamp) && std::isfinite(value) && near(value, 3000.0f * 0.1242f));
+    now = 1400;
+    publish(vehicle_speed, 0.4f, now);
+    derivedSignals.evaluateDirty(now);
+    CHECK(published(gear_ratio, value, timestamp) && near(value, 3000.0f * 0.1242f) && timestamp == now);
+
+    // An unchanged input does not re-evaluate
+    now = 1500;
+    publish(vehicle_speed, 0.4f, now);
+    derivedSignals.evaluateDirty(now);
+    CHECK(published(gear_ratio, value, timestamp) && timestamp == 1400);
+
+    // Oil Temperature: the coolant stands in until the oil sensor reports, then the oil reading wins
+    now = 2000;
+    publish(coolant, 85.0f, now);
+    derivedSignals.evaluateDirty(now);
+    CHECK(published(oil, value, timestamp) && value == 85.0f);
+    now = 2100;
+    publish(engine_oil, 97.0f, now);
+    derivedSignals.evaluateDirty(now);
+    CHECK(published(oil, value, timestamp) && value == 97.0f);
+
+    // The oil sensor goes quiet: once it is stale, the next coolant sample falls back to the coolant
+    now = 2100 + DERIVED_INPUT_STALE_MS;
+    publish(coolant, 86.0f, now);
+    derivedSignals.evaluateDirty(now);
+    CHECK(published(oil, value, timestamp) && value == 97.0f);     // Not stale yet at exactly the limit
+    now++;
+    publish(coolant, 86.0f, now);    // Unchanged, but the oil input went stale
+    derivedSignals.evaluateDirty(now);
+    CHECK(published(oil, value, timestamp) && value == 86.0f && timestamp == now);
+
+    // It comes back with a fresh sample
+    now += 100;
+    publish(engine_oil, 98.0f, now);
+    derivedSignals.evaluateDirty(now);
+    CHECK(published(oil, value, timestamp) && value == 98.0f);
+
+    // A stale wheel leaves the average at its last value rather than averaging three wheels
+    now = 1100 + DERIVED_INPUT_STALE_MS + 1;
+    publish(wheels[0], 60.0f, now);
+    publish(wheels[1], 60.0f, now);
+    publish(wheels[2], 60.0f, now);
+    derivedSignals.evaluateDirty(now);
+    CHECK(published(average_wheel, value, timestamp) && near(value, 53.0f) && timestamp == 1100);
+    publish(wheels[3], 60.0f, now);
+    derivedSignals.evaluateDirty(now);
+    CHECK(published(average_wheel, value, timestamp) && near(value, 60.0f) && timestamp == now);
+
+    // A stale vehicle speed stops the gear ratio instead of dividing by the floor
+    now = 1500 + DERIVED_INPUT_STALE_MS + 1;    // An unchanged sample still refreshes the input
+    publish(engine_speed, 2000.0f, now);
+    derivedSignals.evaluateDirty(now);
+    CHECK(published(gear_ratio, value, timestamp) && timestamp == 1400);
+
+    // Evaluation cost of each program, as logged at boot
+    derivedSignals.benchmark();
+
+    printf(failures ? "%d checks failed\n" : "All checks passed\n", failures);
+    return failures ? 1 : 0;
+}
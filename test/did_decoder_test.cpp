@@ -0,0 +1,278 @@
+// Host test and benchmark of DidDecoder: every DID decoded with all of its signals subscribed, checked against
+// a double-precision reference, and timed in ns per decoded signal against the per-signal path it replaced.
+//
+//   g++ -std=gnu++17 -O2 -Wall -Wextra -Isrc -Itest/host -o did_decoder_test
+//       test/did_decoder_test.cpp src/uds/did_decoder.cpp
+
+#include "uds/did_decoder.h"
+#include "uds/uds_mapper.h"
+#include "logger/logger.h"
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <unordered_map>
+
+static int failures = 0;
+
+#define CHECK(condition)                                                      \
+    do                                                                        \
+    {                                                                         \
+        if (!(condition))                                                     \
+        {                                                                     \
+            printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #condition); \
+            failures++;                                                       \
+        }                                                                     \
+    } while (0)
+
+// Signals whose unit has no unitTypeInfos entry are refused by DidDecoder::add()
+static int refusedSignals = 0;
+
+void Logger::error(const char *, const char *, ...)
+{
+    refusedSignals++;
+}
+
+static uint32_t nextRandom(uint32_t &state)
+{
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return state;
+}
+
+// Engineering value in double precision, from the raw value the decoder extracted
+static double referenceValue(const UdsDefinition &def, uint32_t raw)
+{
+    const UnitTypeInfo *unit_info = findUnitTypeInfo(def.unit);
+    if (unit_info->valueType == ValueType::Boolean)
+    {
+        return raw;
+    }
+
+    double value = (def.is_signed ? (double)(int32_t)raw : (double)raw) * def.scaling_factor + def.offset_value;
+    if (unit_info->minValue.has_value() && value < unit_info->minValue.value())
+    {
+        value = unit_info->minValue.value();
+    }
+    if (unit_info->maxValue.has_value() && value > unit_info->maxValue.value())
+    {
+        value = unit_info->maxValue.value();
+    }
+    return value;
+}
+
+/**
+ * The per-signal decode transformResponse() made before DidDecoder, logging removed: a unitTypeInfos scan,
+ * a bounds-checked little-endian extraction and an unordered_map lookup for the change tracking of every signal.
+ */
+struct LegacyDecoder
+{
+    std::vector<const UdsDefinition *> definitions;
+    std::unordered_map<const UdsDefinition *, float> lastValues;
+
+    static bool rawValue(const uint8_t *data, int8_t byte_pos, int8_t bit_pos, int8_t bit_length, int8_t data_len,
+                         uint32_t &raw_value)
+    {
+        if (bit_length <= 0 || bit_length > 32 || byte_pos < 0 || byte_pos >= data_len)
+        {
+            return false;
+        }
+        int8_t required_bytes = (bit_pos + bit_length + 7) / 8;
+        if (byte_pos + required_bytes > data_len)
+        {
+            return false;
+        }
+        uint32_t raw = 0;
+        memcpy(&raw, &data[byte_pos], required_bytes);
+        raw >>= bit_pos;
+        raw_value = raw & (bit_length == 32 ? 0xFFFFFFFF : ((1U << bit_length) - 1));
+        return true;
+    }
+
+    size_t decode(const uint8_t *payload, int8_t length, float &change_fraction)
+    {
+        size_t decoded = 0;
+        for (const UdsDefinition *def : definitions)
+        {
+            const UnitTypeInfo *unit_info = findUnitTypeInfo(def->unit);
+            uint32_t raw = 0;
+            if (unit_info == nullptr ||
+                !rawValue(payload, def->byte_position, def->bit_offset_position, def->bit_length, length, raw))
+            {
+                continue;
+            }
+
+            float value = (float)raw;
+            if (unit_info->valueType != ValueType::Boolean)
+            {
+                value = value * def->scaling_factor + def->offset_value;
+                if (unit_info->minValue.has_value() && value < unit_info->minValue.value())
+                {
+                    value = unit_info->minValue.value();
+                }
+                if (unit_info->maxValue.has_value() && value > unit_info->maxValue.value())
+                {
+                    value = unit_info->maxValue.value();
+                }
+            }
+
+            auto previous = lastValues.find(def);
+            if (previous == lastValues.end())
+            {
+                lastValues.emplace(def, value);
+            }
+            else
+            {
+                float span = 1.0f;
+                if (unit_info->valueType != ValueType::Boolean && unit_info->minValue.has_value() &&
+                    unit_info->maxValue.has_value())
+                {
+                    span = unit_info->maxValue.value() - unit_info->minValue.value();
+                }
+                float fraction = span > 0.0f ? fabsf(value - previous->second) / span : 0.0f;
+                change_fraction = fraction > change_fraction ? fraction : change_fraction;
+                previous->second = value;
+            }
+            decoded++;
+        }
+        return decoded;
+    }
+};
+
+static constexpr int PAYLOADS = 32;
+static constexpr int PAYLOAD_LENGTH = 64;
+static constexpr int BENCHMARK_ROUNDS = 500;
+
+int main()
+{
+    static uint8_t payloads[PAYLOADS][PAYLOAD_LENGTH];
+    uint32_t state = 0x9E3779B9;
+    for (auto &payload : payloads)
+    {
+        for (uint8_t &byte : payload)
+        {
+            byte = (uint8_t)nextRandom(state);
+        }
+    }
+
+    static DidDecoder decoders[UDS_DID_COUNT];
+    static LegacyDecoder legacy[UDS_DID_COUNT];
+    size_t signals = 0;
+    size_t aliases = 0;
+    for (size_t d = 0; d < UDS_DID_COUNT; d++)
+    {
+        for (const UdsDefinition &def : findUdsDefinitions(UDS_DIDS[d].request_id, UDS_DIDS[d].did))
+        {
+            if (findUnitTypeInfo(def.unit) == nullptr)
+            {
+                continue;
+            }
+            if (decoders[d].add(def))
+            {
+                legacy[d].definitions.push_back(&def);
+            }
+            else
+            {
+                aliases++;
+            }
+        }
+        signals += decoders[d].size();
+    }
+    printf("%zu DIDs, %zu decoded signals, %zu aliases\n", UDS_DID_COUNT, signals, aliases);
+    CHECK(signals > 0);
+    CHECK(refusedSignals == 0);
+
+    // Every signal and alias of every DID against the reference, on every payload
+    double worst_error = 0.0;
+    for (size_t d = 0; d < UDS_DID_COUNT; d++)
+    {
+        DidDecoder &decoder = decoders[d];
+        for (const auto &payload : payloads)
+        {
+            float change_fraction = 0.0f;
+            CHECK(decoder.decode(payload, PAYLOAD_LENGTH, change_fraction) == decoder.size());
+            CHECK(change_fraction >= 0.0f && std::isfinite(change_fraction));
+
+            for (size_t i = 0; i < decoder.size(); i++)
+            {
+                double expected = referenceValue(decoder.definition(i), decoder.rawValue(i));
+                double error = fabs(decoder.value(i) - expected) /
+                               fmax(1.0, fabs(decoder.rawValue(i) * (double)decoder.definition(i).scaling_factor));
+                worst_error = fmax(worst_error, error);
+                if (error > 1e-6)
+                {
+                    printf("%s: %.9g, reference %.9g\n", udsName(decoder.definition(i)), decoder.value(i), expected);
+                    failures++;
+                }
+            }
+
+            size_t visited = 0;
+            decoder.forEachDecoded([&](const UdsDefinition &def, float value)
+                                   {
+                                       visited++;
+                                       CHECK(std::isfinite(value));
+                                       CHECK(findUnitTypeInfo(def.unit) != nullptr);
+                                   });
+            CHECK(visited >= decoder.size());
+        }
+
+        // The same response again changes nothing
+        float change_fraction = 0.0f;
+        decoder.decode(payloads[PAYLOADS - 1], PAYLOAD_LENGTH, change_fraction);
+        CHECK(change_fraction == 0.0f);
+    }
+    printf("worst relative error against the double reference: %.3g\n", worst_error);
+
+    // A partial response decodes what fits and leaves the rest at their previous value
+    for (size_t d = 0; d < UDS_DID_COUNT; d++)
+    {
+        DidDecoder &decoder = decoders[d];
+        if (decoder.size() < 2)
+        {
+            continue;
+        }
+        const size_t length = decoder.definition(decoder.size() - 1).byte_position;
+        std::vector<float> before(decoder.size());
+        for (size_t i = 0; i < decoder.size(); i++)
+        {
+            before[i] = decoder.value(i);
+        }
+        float change_fraction = 0.0f;
+        size_t decoded = decoder.decode(payloads[0], length, change_fraction);
+        CHECK(decoded < decoder.size());
+        for (size_t i = 0; i < decoder.size(); i++)
+        {
+            const UdsDefinition &def = decoder.definition(i);
+            bool fits = def.byte_position + fieldBytes(def.bit_offset_position, def.bit_length) <= length;
+            CHECK(decoder.decoded(i) == fits);
+            CHECK(fits || decoder.value(i) == before[i]);
+        }
+        break;
+    }
+
+    // Timing over every DID: ns per decoded signal for DidDecoder and the per-signal path
+    using Clock = std::chrono::steady_clock;
+    volatile float sink = 0.0f;
+    size_t decoded[2] = {0, 0};
+    double ns[2];
+    for (int old_path = 0; old_path < 2; old_path++)
+    {
+        Clock::time_point start = Clock::now();
+        for (int round = 0; round < BENCHMARK_ROUNDS; round++)
+        {
+            for (size_t d = 0; d < UDS_DID_COUNT; d++)
+            {
+                float change_fraction = 0.0f;
+                decoded[old_path] += old_path ? legacy[d].decode(payloads[round % PAYLOADS], PAYLOAD_LENGTH, change_fraction)
+                                              : decoders[d].decode(payloads[round % PAYLOADS], PAYLOAD_LENGTH, change_fraction);
+                sink = sink + change_fraction;
+            }
+        }
+        ns[old_path] = std::chrono::duration<double, std::nano>(Clock::now() - start).count() / decoded[old_path];
+    }
+    CHECK(decoded[0] == decoded[1]);
+    printf("decode: DidDecoder %.2f ns/signal, per-signal lookups %.2f ns/signal\n", ns[0], ns[1]);
+
+    printf(failures ? "%d checks failed\n" : "All checks passed\n", failures);
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,126 @@
+// Host test of the GT86 diagnostic responder: table answers, TesterPresent with and without a suppressed
+// positive response, negative responses and the source subscription.
+//
+//   g++ -std=gnu++17 -Wall -Wextra -Isrc -Itest/host -o gt86_diag_responder_test test/gt86_diag_responder_test.cpp
+//       src/services/gt86_diag_responder.cpp src/signals/derived_signals.cpp src/signals/change_notifier.cpp src/signals/signal_registry.cpp src/signals/signal_store.cpp
+
+#include "services/gt86_diag_responder.h"
+#include "signals/signal_registry.h"
+#include "logger/logger.h"
+#include "freertos/task.h"
+#include <cstdarg>
+#include <cstdio>
+
+static int failures = 0;
+
+#define CHECK(condition)                                                      \
+    do                                                                        \
+    {                                                                         \
+        if (!(condition))                                                     \
+        {                                                                     \
+            printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #condition); \
+            failures++;                                                       \
+        }                                                                     \
+    } while (0)
+
+static char lastLog[256];
+
+static void log(const char *func, const char *format, va_list args)
+{
+    vsnprintf(lastLog, sizeof(lastLog), format, args);
+    printf("%s: %s\n", func, lastLog);
+}
+
+void Logger::error(const char *func, const char *format, ...)
+{
+    va_list args;
+    va_start(args, format);
+    log(func, format, args);
+    va_end(args);
+}
+
+void Logger::info(const char *func, const char *format, ...)
+{
+    va_list args;
+    va_start(args, format);
+    log(func, format, args);
+    va_end(args);
+}
+
+unsigned long millis()
+{
+    return 0;
+}
+
+unsigned long micros()
+{
+    return 0;
+}
+
+BaseType_t xTaskNotifyGive(TaskHandle_t)
+{
+    return pdTRUE;
+}
+
+int main()
+{
+    const Gt86DiagResponse &fuel = GT86_DIAG_RESPONSES[0];
+    const SignalId fuel_level = findObdSignalId(fuel.source_name);
+    CHECK(fuel_level != SIGNAL_NONE);
+
+    Gt86DiagResponder responder;
+    responder.initialize();
+
+    // The responder subscribes its sources under its own consumer, not the translator's
+    const ConsumerMask responder_bit = 1u << (uint8_t)SignalConsumer::DiagResponder;
+    CHECK(signalRegistry.subscribers(fuel_level) == responder_bit);
+
+    uint32_t response_id = 0;
+    const uint8_t *response;
+
+    // The default is answered until the source has a value
+    const uint8_t request[8] = {0x02, fuel.service_id, fuel.local_id, 0, 0, 0, 0, 0};
+    response = responder.respond(fuel.request_id, request, 8, response_id);
+    const uint8_t answer[8] = {0x03, (uint8_t)(fuel.service_id + 0x40), fuel.local_id, (uint8_t)fuel.default_raw, 0, 0, 0, 0};
+    CHECK(response != nullptr && response_id == fuel.response_id && memcmp(response, answer, 8) == 0);
+
+    signalStore.beginPublish(fuel_level);
+    signalStore.publish(fuel_level, 62.4f, 1000);
+    signalStore.endPublish(fuel_level);
+    responder.refresh();
+    response = responder.respond(fuel.request_id, request, 8, response_id);
+    CHECK(response != nullptr && response[3] == 62);
+
+    // TesterPresent gets a positive response only without the suppress-positive-response bit
+    const uint8_t tester_present[8] = {0x02, 0x3E, 0x00, 0, 0, 0, 0, 0};
+    response = responder.respond(fuel.request_id, tester_present, 8, response_id);
+    const uint8_t tester_present_answer[8] = {0x02, 0x7E, 0, 0, 0, 0, 0, 0};
+    CHECK(response != nullptr && response_id == fuel.response_id && memcmp(response, tester_present_answer, 8) == 0);
+
+    const uint8_t tester_present_suppressed[8] = {0x02, 0x3E, 0x80, 0, 0, 0, 0, 0};
+    CHECK(responder.respond(fuel.request_id, tester_present_suppressed, 8, response_id) == nullptr);
+
+    // An unknown local ID of a known service, and an unknown service, get negative responses
+    const uint8_t other_local_id[8] = {0x02, fuel.service_id, (uint8_t)(fuel.local_id + 1), 0, 0, 0, 0, 0};
+    response = responder.respond(fuel.request_id, other_local_id, 8, response_id);
+    const uint8_t out_of_range[8] = {0x03, 0x7F, fuel.service_id, 0x31, 0, 0, 0, 0};
+    CHECK(response != nullptr && memcmp(response, out_of_range, 8) == 0);
+
+    const uint8_t other_service[8] = {0x02, 0x22, 0x01, 0, 0, 0, 0, 0};
+    response = responder.respond(fuel.request_id, other_service, 8, response_id);
+    const uint8_t not_supported[8] = {0x03, 0x7F, 0x22, 0x11, 0, 0, 0, 0};
+    CHECK(response != nullptr && memcmp(response, not_supported, 8) == 0);
+
+    // Other IDs and frames that are not single frames are left alone
+    CHECK(responder.respond(fuel.request_id + 1, request, 8, response_id) == nullptr);
+    const uint8_t first_frame[8] = {0x10, 0x0A, fuel.service_id, fuel.local_id, 0, 0, 0, 0};
+    CHECK(responder.respond(fuel.request_id, first_frame, 8, response_id) == nullptr);
+
+    responder.recordResponse(0, 300);
+    responder.logMetrics();
+    CHECK(strcmp(lastLog, "diag responses: 6 requests (2 negative), max 300 us, <=0.25/0.5/1/2/5/10/20/>20 ms: "
+                          "0/1/0/0/0/0/0/0") == 0);
+
+    printf(failures ? "%d checks failed\n" : "All checks passed\n", failures);
+    return failures ? 1 : 0;
+}
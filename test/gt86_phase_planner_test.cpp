@@ -0,0 +1,78 @@
+// Host test of the GT86 release phase planner against GT86_PID_MESSAGES.
+//
+//   g++ -std=gnu++17 -Wall -Wextra -Isrc -o gt86_phase_planner_test
+//       test/gt86_phase_planner_test.cpp src/services/gt86_phase_planner.cpp
+
+#include "services/gt86_messages.h"
+#include "services/gt86_phase_planner.h"
+#include <cstdio>
+
+static int failures = 0;
+
+#define CHECK(condition)                                                      \
+    do                                                                        \
+    {                                                                         \
+        if (!(condition))                                                     \
+        {                                                                     \
+            printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #condition); \
+            failures++;                                                       \
+        }                                                                     \
+    } while (0)
+
+int main()
+{
+    uint32_t offsets[GT86_CAN_MESSAGES_COUNT];
+    PhasePlan plan;
+    CHECK(planPhaseOffsets(GT86_PID_MESSAGES, GT86_CAN_MESSAGES_COUNT, offsets, plan));
+
+    printf("GT86 bus load: %.1f%% average, %.0f%% peak per ms (%.0f%% unplanned), hyperperiod %lu ms\n",
+           plan.average_load * 100.0f, plan.peak_load * 100.0f, plan.unplanned_peak_load * 100.0f,
+           (unsigned long)plan.hyperperiod_ms);
+
+    // Periods of 100 ms to 10 s
+    CHECK(plan.hyperperiod_ms == 10000);
+
+    // Every offset lies within its period
+    for (int i = 0; i < GT86_CAN_MESSAGES_COUNT; i++)
+    {
+        CHECK(offsets[i] < GT86_PID_MESSAGES[i].interval);
+    }
+
+    // Recompute the busiest 1 ms slot from the offsets the planner returned
+    static uint32_t slots[10000] = {};
+    uint32_t burst_bits = 0;
+    for (int i = 0; i < GT86_CAN_MESSAGES_COUNT; i++)
+    {
+        uint32_t bits = canFrameBits(GT86_PID_MESSAGES[i].len, false);
+        burst_bits += bits;
+        for (uint32_t slot = offsets[i]; slot < plan.hyperperiod_ms; slot += GT86_PID_MESSAGES[i].interval)
+        {
+            slots[slot] += bits;
+        }
+    }
+    uint32_t peak_bits = 0;
+    for (uint32_t slot : slots)
+    {
+        peak_bits = slot > peak_bits ? slot : peak_bits;
+    }
+    const float bits_per_ms = GT86_CAN_BITRATE / 1000.0f;
+    CHECK(peak_bits / bits_per_ms == plan.peak_load);
+    CHECK(burst_bits / bits_per_ms == plan.unplanned_peak_load);
+
+    // Released together the frames overrun a 1 ms slot several times; spread out, no slot holds two
+    CHECK(plan.average_load > 0.015f && plan.average_load < 0.02f);
+    CHECK(peak_bits <= canFrameBits(8, false));
+    CHECK(plan.unplanned_peak_load > 4.0f);
+
+    // Too long a hyperperiod is refused and leaves every frame at offset 0
+    const CANMessage coprime[] = {
+        {0x100, {}, 8, false, 9973, "a"},
+        {0x101, {}, 8, false, 9967, "b"},
+    };
+    uint32_t coprime_offsets[2] = {1, 1};
+    CHECK(!planPhaseOffsets(coprime, 2, coprime_offsets, plan));
+    CHECK(coprime_offsets[0] == 0 && coprime_offsets[1] == 0);
+
+    printf(failures ? "%d checks failed\n" : "All checks passed\n", failures);
+    return failures ? 1 : 0;
+}
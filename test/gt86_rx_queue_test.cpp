@@ -0,0 +1,95 @@
+// Host test of the GT86 receive queue's load-shedding policy.
+//
+//   g++ -std=gnu++17 -Wall -Wextra -Isrc -Itest/host -o gt86_rx_queue_test
+//       test/gt86_rx_queue_test.cpp src/services/gt86_rx_queue.cpp
+
+#include "services/gt86_rx_queue.h"
+#include "services/gt86_diag_responder.h"
+#include "logger/logger.h"
+#include <cstdarg>
+#include <cstdio>
+#include <cstring>
+
+static int failures = 0;
+
+#define CHECK(condition)                                                      \
+    do                                                                        \
+    {                                                                         \
+        if (!(condition))                                                     \
+        {                                                                     \
+            printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #condition); \
+            failures++;                                                       \
+        }                                                                     \
+    } while (0)
+
+static char lastLog[256];
+
+void Logger::info(const char *func, const char *format, ...)
+{
+    va_list args;
+    va_start(args, format);
+    vsnprintf(lastLog, sizeof(lastLog), format, args);
+    va_end(args);
+    printf("%s: %s\n", func, lastLog);
+}
+
+static Gt86RxFrame frame(uint32_t id)
+{
+    Gt86RxFrame frame = {};
+    frame.id = id;
+    frame.len = 8;
+    return frame;
+}
+
+int main()
+{
+    const uint32_t request = GT86_DIAG_RESPONSES[0].request_id;
+    const uint32_t body = 0x2F4;
+
+    Gt86RxQueue queue;
+
+    // Below SHED_DEPTH every frame is kept, low priority or not
+    for (size_t i = 0; i < Gt86RxQueue::SHED_DEPTH; i++)
+    {
+        CHECK(queue.push(frame(i % 2 ? body : request)));
+    }
+    CHECK(queue.size() == Gt86RxQueue::SHED_DEPTH);
+
+    // From SHED_DEPTH on the body broadcasts and other watched IDs are shed, requests still get in
+    CHECK(!queue.push(frame(body)));
+    CHECK(!queue.push(frame(GT86CAN::HVAC_STATUS)));
+    CHECK(!queue.push(frame(GT86CAN::LIGHT_STATUS)));
+    for (size_t i = Gt86RxQueue::SHED_DEPTH; i < Gt86RxQueue::CAPACITY; i++)
+    {
+        CHECK(queue.push(frame(request)));
+    }
+    CHECK(queue.size() == Gt86RxQueue::CAPACITY);
+
+    // A full queue drops anything
+    CHECK(!queue.push(frame(request)));
+
+    // The gateway's own GT86 frames are not low priority; they only arrive if another node sends them
+    CHECK(!queue.push(frame(GT86CAN::VEHICLE_SPEED)));
+
+    // FIFO order survives the shedding
+    Gt86RxFrame popped;
+    for (size_t i = 0; i < Gt86RxQueue::CAPACITY; i++)
+    {
+        CHECK(queue.pop(popped));
+        CHECK(popped.id == (i < Gt86RxQueue::SHED_DEPTH && i % 2 ? body : request));
+    }
+    CHECK(!queue.pop(popped));
+
+    queue.recordHardwareOverflow(2);
+    queue.logMetrics();
+    char expected[128];
+    snprintf(expected, sizeof(expected), "gt86 rx: %u frames, max depth %u/%u, 3 shed, 2 queue full, 2 controller overruns",
+             (unsigned)(Gt86RxQueue::CAPACITY + 5), (unsigned)Gt86RxQueue::CAPACITY, (unsigned)Gt86RxQueue::CAPACITY);
+    CHECK(strcmp(lastLog, expected) == 0);
+
+    // Room again: low priority frames are kept once the backlog is gone
+    CHECK(queue.push(frame(body)));
+
+    printf(failures ? "%d checks failed\n" : "All checks passed\n", failures);
+    return failures ? 1 : 0;
+}
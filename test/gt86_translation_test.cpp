@@ -0,0 +1,174 @@
+// Host conformance test of GT86_FIELD_ROUTES against the Readme: known values are translated and packed
+// into the Readme section 5 default frames, and the bytes compared with the section 6 layouts.
+//
+//   g++ -std=gnu++17 -Wall -Wextra -Isrc -Itest/host -o gt86_translation_test
+//       test/gt86_translation_test.cpp src/message_translator.cpp src/signals/change_notifier.cpp
+//       src/signals/derived_signals.cpp src/signals/signal_registry.cpp src/signals/signal_store.cpp
+
+#include "message_translator.h"
+#include "signals/derived_signals.h"
+#include "logger/logger.h"
+#include "freertos/task.h"
+#include <chrono>
+#include <cstdarg>
+#include <cstdio>
+
+static int failures = 0;
+
+#define CHECK(condition)                                                      \
+    do                                                                        \
+    {                                                                         \
+        if (!(condition))                                                     \
+        {                                                                     \
+            printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #condition); \
+            failures++;                                                       \
+        }                                                                     \
+    } while (0)
+
+static void log(const char *func, const char *format, va_list args)
+{
+    printf("%s: ", func);
+    vprintf(format, args);
+    printf("\n");
+}
+
+void Logger::error(const char *func, const char *format, ...)
+{
+    va_list args;
+    va_start(args, format);
+    log(func, format, args);
+    va_end(args);
+}
+
+void Logger::info(const char *func, const char *format, ...)
+{
+    va_list args;
+    va_start(args, format);
+    log(func, format, args);
+    va_end(args);
+}
+
+unsigned long millis()
+{
+    return 0;
+}
+
+unsigned long micros()
+{
+    using namespace std::chrono;
+    return (unsigned long)duration_cast<microseconds>(steady_clock::now().time_since_epoch()).count();
+}
+
+BaseType_t xTaskNotifyGive(TaskHandle_t)
+{
+    return pdTRUE;
+}
+
+struct Frame
+{
+    uint32_t id;
+    uint8_t data[8];
+};
+
+// Readme section 5, "Minimum Required GT86 Messages"
+static Frame frames[] = {
+    {0xD1, {0xF0, 0x07, 0x00, 0x00, 0xB8, 0x0F, 0xFC, 0x08}},
+    {0xD4, {0xF0, 0x07, 0xF0, 0x07, 0xF0, 0x07, 0xF0, 0x07}},
+    {0x140, {0x00, 0x05, 0x00, 0x43, 0x00, 0x00, 0x00, 0x01}},
+    {0x141, {0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0xA7, 0x00}},
+    {0x360, {0x00, 0x00, 0x84, 0x50, 0x00, 0x00, 0x11, 0x00}},
+};
+
+// Readme section 6 layouts applied to the values translated below
+static const Frame EXPECTED[] = {
+    // A-B = 100 km/h * 63.72 = 6372
+    {0xD1, {0xE4, 0x18, 0x00, 0x00, 0xB8, 0x0F, 0xFC, 0x08}},
+    // FL 10, FR 20, RL 30, RR 40 km/h: 637, 1274, 1912, 2549
+    {0xD4, {0x7D, 0x02, 0xFA, 0x04, 0x78, 0x07, 0xF5, 0x09}},
+    // A = 50 % * 2.55 = 128, C-D = 3000 rpm in the low 14 bits under D's top bits (0x43 -> 0x40)
+    {0x140, {0x80, 0x05, 0xB8, 0x4B, 0x00, 0x00, 0x00, 0x01}},
+    // E-F = 3000 rpm in the low 14 bits under F's top bits (0x83 -> 0x80)
+    {0x141, {0x00, 0x00, 0x00, 0x00, 0xB8, 0x8B, 0xA7, 0x00}},
+    // C = 95 + 40 oil, D = 88 + 40 coolant
+    {0x360, {0x00, 0x00, 0x87, 0x80, 0x00, 0x00, 0x11, 0x00}},
+};
+
+static uint8_t *frameData(uint32_t id)
+{
+    for (Frame &frame : frames)
+    {
+        if (frame.id == id)
+        {
+            return frame.data;
+        }
+    }
+    return nullptr;
+}
+
+static size_t translateInto(MessageTranslator &translator, SignalId id, float value)
+{
+    Gt86FieldUpdate updates[GT86_FIELD_ROUTE_COUNT];
+    size_t count = translator.translate(id, value, updates);
+    for (size_t i = 0; i < count; i++)
+    {
+        const Gt86FieldRoute &route = GT86_FIELD_ROUTES[updates[i].route];
+        uint8_t *data = frameData(route.frame_id);
+        CHECK(data != nullptr);
+        if (data != nullptr)
+        {
+            packGt86Field(data, route, updates[i].raw);
+        }
+    }
+    return count;
+}
+
+int main()
+{
+    derivedSignals.initialize();
+
+    MessageTranslator translator;
+    CHECK(translator.initialize(SignalConsumer::Gt86Translator) == GT86_FIELD_ROUTE_COUNT);
+
+    // Each signal reaches exactly the fields the Readme lists for it
+    CHECK(translateInto(translator, findSignalId(0x7E0, "Vehicle Speed"), 100.0f) == 1);
+    CHECK(translateInto(translator, findSignalId(0x7B0, "FL Wheel Speed"), 10.0f) == 1);
+    CHECK(translateInto(translator, findSignalId(0x7B0, "FR Wheel Speed"), 20.0f) == 1);
+    CHECK(translateInto(translator, findSignalId(0x7B0, "RL Wheel Speed"), 30.0f) == 1);
+    CHECK(translateInto(translator, findSignalId(0x7B0, "RR Wheel Speed"), 40.0f) == 1);
+    CHECK(translateInto(translator, findSignalId(0x7E0, "Engine Speed"), 3000.0f) == 2);
+    CHECK(translateInto(translator, findSignalId(0x7E0, "Accelerator Position"), 50.0f) == 1);
+    CHECK(translateInto(translator, derivedSignals.find("Oil Temperature"), 95.0f) == 1);
+    CHECK(translateInto(translator, findSignalId(0x7E0, "Coolant Temp"), 88.0f) == 1);
+
+    for (size_t f = 0; f < sizeof(EXPECTED) / sizeof(EXPECTED[0]); f++)
+    {
+        const uint8_t *data = frameData(EXPECTED[f].id);
+        if (memcmp(data, EXPECTED[f].data, 8) != 0)
+        {
+            printf("0x%03X: %02X %02X %02X %02X %02X %02X %02X %02X, Readme layout %02X %02X %02X %02X %02X %02X %02X %02X\n",
+                   (unsigned)EXPECTED[f].id, data[0], data[1], data[2], data[3], data[4], data[5], data[6], data[7],
+                   EXPECTED[f].data[0], EXPECTED[f].data[1], EXPECTED[f].data[2], EXPECTED[f].data[3],
+                   EXPECTED[f].data[4], EXPECTED[f].data[5], EXPECTED[f].data[6], EXPECTED[f].data[7]);
+            failures++;
+        }
+    }
+
+    // Only changed fields are reported, and every field reads back what was packed
+    CHECK(translateInto(translator, findSignalId(0x7E0, "Engine Speed"), 3000.0f) == 0);
+    for (const Gt86FieldRoute &route : GT86_FIELD_ROUTES)
+    {
+        CHECK(unpackGt86Field(frameData(route.frame_id), route) != 0);
+    }
+
+    // Out-of-range values clamp to the field instead of spilling into neighbours
+    CHECK(translateInto(translator, findSignalId(0x7E0, "Engine Speed"), 20000.0f) == 2);
+    CHECK(frameData(0x140)[2] == 0xFF && frameData(0x140)[3] == 0x7F);
+    CHECK(translateInto(translator, findSignalId(0x7E0, "Coolant Temp"), -60.0f) == 1);
+    CHECK(frameData(0x360)[3] == 0x00 && frameData(0x360)[2] == 0x87);
+
+    // Translations per second, as logged at boot
+    translator.benchmark();
+
+    printf(failures ? "%d checks failed\n" : "All checks passed\n", failures);
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,9 @@
+#pragma once
+
+// Host stand-in for the Arduino core: just enough for logger.h and the timing calls, whose functions each
+// test defines itself
+#include <cstdint>
+#include <cstring>
+
+unsigned long millis();
+unsigned long micros();
@@ -0,0 +1,4 @@
+#pragma once
+
+// Host stand-in for the ESP-IDF TWAI driver: the CAN wrapper header only needs the FreeRTOS tick types from it
+#include "freertos/FreeRTOS.h"
@@ -0,0 +1,6 @@
+#pragma once
+
+// Host stand-in for the ESP-IDF high resolution timer; each test defines esp_timer_get_time() as its clock
+#include <cstdint>
+
+int64_t esp_timer_get_time();
@@ -0,0 +1,54 @@
+#pragma once
+
+// Host stand-in for FreeRTOS queues: a copying ring buffer for single-threaded tests; waits are ignored
+#include "FreeRTOS.h"
+#include <cstring>
+#include <vector>
+
+struct HostQueue
+{
+    std::vector<uint8_t> storage;
+    UBaseType_t length;
+    UBaseType_t item_size;
+    UBaseType_t head = 0;
+    UBaseType_t count = 0;
+};
+
+typedef HostQueue *QueueHandle_t;
+
+inline QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t item_size)
+{
+    HostQueue *queue = new HostQueue;
+    queue->storage.resize(length * item_size);
+    queue->length = length;
+    queue->item_size = item_size;
+    return queue;
+}
+
+inline void vQueueDelete(QueueHandle_t queue)
+{
+    delete queue;
+}
+
+inline BaseType_t xQueueSend(QueueHandle_t queue, const void *item, TickType_t)
+{
+    if (queue->count == queue->length)
+    {
+        return pdFALSE;
+    }
+    memcpy(&queue->storage[((queue->head + queue->count) % queue->length) * queue->item_size], item, queue->item_size);
+    queue->count++;
+    return pdTRUE;
+}
+
+inline BaseType_t xQueueReceive(QueueHandle_t queue, void *item, TickType_t)
+{
+    if (queue->count == 0)
+    {
+        return pdFALSE;
+    }
+    memcpy(item, &queue->storage[queue->head * queue->item_size], queue->item_size);
+    queue->head = (queue->head + 1) % queue->length;
+    queue->count--;
+    return pdTRUE;
+}
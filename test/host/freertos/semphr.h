@@ -0,0 +1,24 @@
+#pragma once
+
+// Host stand-in for FreeRTOS mutexes; host tests are single-threaded, so taking one always succeeds
+#include "FreeRTOS.h"
+
+typedef void *SemaphoreHandle_t;
+
+#define portMAX_DELAY ((TickType_t)0xFFFFFFFF)
+
+inline SemaphoreHandle_t xSemaphoreCreateMutex()
+{
+    static int mutex;
+    return &mutex;
+}
+
+inline BaseType_t xSemaphoreTake(SemaphoreHandle_t, TickType_t)
+{
+    return pdTRUE;
+}
+
+inline BaseType_t xSemaphoreGive(SemaphoreHandle_t)
+{
+    return pdTRUE;
+}
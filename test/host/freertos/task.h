@@ -0,0 +1,8 @@
+#pragma once
+
+// Host stand-in for FreeRTOS task notifications; tests that need them define xTaskNotifyGive()
+#include "FreeRTOS.h"
+
+typedef void *TaskHandle_t;
+
+BaseType_t xTaskNotifyGive(TaskHandle_t task);
@@ -0,0 +1,153 @@
+// Host test and benchmark of the OBD-II mode 01 request builder and PID decoder.
+//
+//   g++ -std=gnu++17 -O2 -Wall -Wextra -Isrc -Itest/host -o obd_pids_test
+//       test/obd_pids_test.cpp src/obd/obd_pids.cpp
+
+#include "obd/obd_pids.h"
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+
+static int failures = 0;
+
+#define CHECK(condition)                                                      \
+    do                                                                        \
+    {                                                                         \
+        if (!(condition))                                                     \
+        {                                                                     \
+            printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #condition); \
+            failures++;                                                       \
+        }                                                                     \
+    } while (0)
+
+static bool near(float value, float expected)
+{
+    return fabsf(value - expected) <= 1e-3f * fmaxf(1.0f, fabsf(expected));
+}
+
+// The decoder as it would be without OBD_PID_INDEX: a table search per PID
+static size_t linearDecode(const uint8_t *payload, size_t length, ObdPidValue *values, size_t max_values)
+{
+    if (length < 1 || payload[0] != 0x41)
+    {
+        return 0;
+    }
+
+    size_t decoded = 0;
+    size_t pos = 1;
+    while (pos < length && decoded < max_values)
+    {
+        const ObdPidDefinition *definition = nullptr;
+        for (const ObdPidDefinition &row : OBD_PID_TABLE)
+        {
+            if (row.pid == payload[pos])
+            {
+                definition = &row;
+                break;
+            }
+        }
+        if (definition == nullptr || pos + 1 + definition->data_bytes > length)
+        {
+            break;
+        }
+
+        uint32_t raw = 0;
+        for (uint8_t i = 0; i < definition->data_bytes; i++)
+        {
+            raw = (raw << 8) | payload[pos + 1 + i];
+        }
+        values[decoded++] = {definition->pid, raw, (float)raw * definition->scale + definition->offset, definition};
+        pos += 1 + definition->data_bytes;
+    }
+    return decoded;
+}
+
+static constexpr int BENCHMARK_ROUNDS = 200000;
+
+int main()
+{
+    // Every table row is reachable through the index, and nothing else is
+    for (const ObdPidDefinition &row : OBD_PID_TABLE)
+    {
+        CHECK(findObdPid(row.pid) == &row);
+        CHECK(row.data_bytes >= 1 && row.data_bytes <= 4);
+    }
+    size_t indexed = 0;
+    for (int pid = 0; pid < 256; pid++)
+    {
+        indexed += findObdPid((uint8_t)pid) != nullptr;
+    }
+    CHECK(indexed == OBD_PID_COUNT);
+
+    // Requests carry at most six PIDs in one single frame
+    const uint8_t pids[8] = {0x0C, 0x0D, 0x05, 0x0F, 0x11, 0x5C, 0x42, 0x2F};
+    uint8_t frame[8];
+    CHECK(buildObdMode01Request(pids, 2, frame) == 4);
+    const uint8_t two[8] = {0x03, 0x01, 0x0C, 0x0D, 0x00, 0x00, 0x00, 0x00};
+    CHECK(memcmp(frame, two, 8) == 0);
+    CHECK(buildObdMode01Request(pids, 8, frame) == 8);
+    const uint8_t six[8] = {0x07, 0x01, 0x0C, 0x0D, 0x05, 0x0F, 0x11, 0x5C};
+    CHECK(memcmp(frame, six, 8) == 0);
+
+    // A multi-frame response, values worked out by hand from SAE J1979
+    const uint8_t response[] = {
+        0x41,
+        0x0C, 0x2E, 0xE0,  // (256 * 46 + 224) / 4 = 3000 rpm
+        0x0D, 0x64,        // 100 km/h
+        0x05, 0x7B,        // 123 - 40 = 83 C
+        0x0F, 0x3C,        // 60 - 40 = 20 C
+        0x11, 0x80,        // 128 * 100 / 255 = 50.2 %
+        0x42, 0x36, 0xB0,  // 14000 / 1000 = 14.0 V
+        0x01, 0x83, 0x07, 0xE5, 0x00,  // MIL on, 3 confirmed DTCs
+    };
+    ObdPidValue values[8];
+    CHECK(decodeObdMode01Response(response, sizeof(response), values, 8) == 7);
+    CHECK(values[0].pid == 0x0C && values[0].raw == 0x2EE0 && near(values[0].value, 3000.0f));
+    CHECK(values[1].pid == 0x0D && near(values[1].value, 100.0f));
+    CHECK(values[2].pid == 0x05 && near(values[2].value, 83.0f));
+    CHECK(values[3].pid == 0x0F && near(values[3].value, 20.0f));
+    CHECK(values[4].pid == 0x11 && near(values[4].value, 128.0f * 100.0f / 255.0f));
+    CHECK(values[5].pid == 0x42 && near(values[5].value, 14.0f));
+    CHECK(values[6].pid == 0x01 && obdMilOn(values[6].raw) && obdDtcCount(values[6].raw) == 3);
+    CHECK(values[0].definition == findObdPid(0x0C));
+
+    // Capacity, truncation, an unknown PID and a negative response all stop decoding
+    CHECK(decodeObdMode01Response(response, sizeof(response), values, 2) == 2);
+    CHECK(decodeObdMode01Response(response, 4, values, 8) == 1);
+    CHECK(decodeObdMode01Response(response, 3, values, 8) == 0);
+    const uint8_t unknown[] = {0x41, 0x0D, 0x64, 0x02, 0x00, 0x00, 0x05, 0x7B};
+    CHECK(decodeObdMode01Response(unknown, sizeof(unknown), values, 8) == 1);
+    const uint8_t negative[] = {0x7F, 0x01, 0x12};
+    CHECK(decodeObdMode01Response(negative, sizeof(negative), values, 8) == 0);
+
+    // The indexed decoder agrees with a table search on the same response
+    ObdPidValue expected[8];
+    CHECK(decodeObdMode01Response(response, sizeof(response), values, 8) == 7);
+    CHECK(linearDecode(response, sizeof(response), expected, 8) == 7);
+    for (size_t i = 0; i < 7; i++)
+    {
+        CHECK(values[i].definition == expected[i].definition && values[i].raw == expected[i].raw &&
+              values[i].value == expected[i].value);
+    }
+
+    // Timing: the indexed lookup against the table search, per decoded PID
+    using Clock = std::chrono::steady_clock;
+    volatile float sink = 0.0f;
+    double ns[2];
+    for (int linear = 0; linear < 2; linear++)
+    {
+        Clock::time_point start = Clock::now();
+        for (int round = 0; round < BENCHMARK_ROUNDS; round++)
+        {
+            size_t count = linear ? linearDecode(response, sizeof(response), values, 8)
+                                  : decodeObdMode01Response(response, sizeof(response), values, 8);
+            sink = sink + values[count - 1].value;
+        }
+        ns[linear] = std::chrono::duration<double, std::nano>(Clock::now() - start).count() / (BENCHMARK_ROUNDS * 7.0);
+    }
+    printf("mode 01 decode: indexed %.2f ns/PID, table search %.2f ns/PID\n", ns[0], ns[1]);
+
+    printf(failures ? "%d checks failed\n" : "All checks passed\n", failures);
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,131 @@
+// Host test of the passthrough bridge: remap masks, queueing and the hold-back of replaced defaults.
+//
+//   g++ -std=gnu++17 -Wall -Wextra -Isrc -Itest/host -o passthrough_bridge_test
+//       test/passthrough_bridge_test.cpp src/services/passthrough_bridge.cpp
+
+#include "services/passthrough_bridge.h"
+#include "logger/logger.h"
+#include <cstdarg>
+#include <cstdio>
+#include <cstring>
+
+static int failures = 0;
+
+#define CHECK(condition)                                                      \
+    do                                                                        \
+    {                                                                         \
+        if (!(condition))                                                     \
+        {                                                                     \
+            printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #condition); \
+            failures++;                                                       \
+        }                                                                     \
+    } while (0)
+
+static int64_t nowUs = 1000000;
+static int notifications = 0;
+static char lastLog[256];
+
+int64_t esp_timer_get_time()
+{
+    return nowUs;
+}
+
+BaseType_t xTaskNotifyGive(TaskHandle_t)
+{
+    notifications++;
+    return pdTRUE;
+}
+
+void Logger::info(const char *func, const char *format, ...)
+{
+    va_list args;
+    va_start(args, format);
+    vsnprintf(lastLog, sizeof(lastLog), format, args);
+    va_end(args);
+    printf("%s: %s\n", func, lastLog);
+}
+
+// Shaped like PASSTHROUGH_ROUTES, with the routes enabled
+static constexpr PassthroughRoute ROUTES[] = {
+    {0x284, 0xD3, 0x000000000000FFFFULL, 0x003200000FC00000ULL, "VSC, TCS lights", true},
+    {0x3B0, 0x3B0, PASSTHROUGH_KEEP_ALL, 0, "Unchanged", true},
+    {0x3B1, 0x3B2, PASSTHROUGH_KEEP_ALL, 0, "Disabled", false},
+};
+
+static constexpr uint32_t D3_INTERVAL_MS = 500;
+
+int main()
+{
+    const uint8_t data[8] = {0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88};
+    PassthroughFrame frame;
+    int marker = 0;
+
+    PassthroughBridge bridge(ROUTES, sizeof(ROUTES) / sizeof(ROUTES[0]));
+
+    // Nothing is queued before begin()
+    CHECK(!bridge.forward(0x284, data, 8));
+    CHECK(bridge.begin());
+    bridge.setWakeTask(&marker);
+
+    // Bytes 0-1 are kept, the rest is the 0xD3 baseline 00 06 C0 0F 00 00 32 00 with byte 0-1 replaced
+    CHECK(bridge.forward(0x284, data, 8));
+    CHECK(notifications == 1);
+    CHECK(bridge.next(frame));
+    const uint8_t lights[8] = {0x11, 0x22, 0xC0, 0x0F, 0x00, 0x00, 0x32, 0x00};
+    CHECK(frame.id == 0xD3 && frame.len == 8 && frame.route == 0);
+    CHECK(memcmp(frame.data, lights, 8) == 0);
+    CHECK(frame.received_us == nowUs);
+    CHECK(!bridge.next(frame));
+
+    // A short source frame is padded to 8 bytes when set_bits reach past its end
+    CHECK(bridge.forward(0x284, data, 2));
+    CHECK(bridge.next(frame));
+    CHECK(frame.len == 8 && memcmp(frame.data, lights, 8) == 0);
+
+    // Without set_bits the length and payload carry over unchanged
+    CHECK(bridge.forward(0x3B0, data, 5));
+    CHECK(bridge.next(frame));
+    CHECK(frame.id == 0x3B0 && frame.len == 5 && memcmp(frame.data, data, 5) == 0);
+
+    // No route, a disabled route, and an extended ID are not forwarded
+    CHECK(!bridge.forward(0x285, data, 8));
+    CHECK(!bridge.forward(0x3B1, data, 8));
+    CHECK(!bridge.forward(0x18DAF110, data, 8));
+    CHECK(notifications == 3);
+
+    // A full queue drops the frame
+    for (UBaseType_t i = 0; i < PassthroughBridge::QUEUE_DEPTH; i++)
+    {
+        CHECK(bridge.forward(0x3B0, data, 8));
+    }
+    CHECK(!bridge.forward(0x3B0, data, 8));
+    while (bridge.next(frame))
+    {
+    }
+
+    // The 0xD3 default is held back only after a forwarded frame was sent, for two of its periods
+    CHECK(!bridge.holds(0xD3, D3_INTERVAL_MS, nowUs));
+    CHECK(bridge.forward(0x284, data, 8));
+    CHECK(bridge.next(frame));
+    CHECK(!bridge.holds(0xD3, D3_INTERVAL_MS, nowUs));
+    const int64_t sent = nowUs + 150;
+    bridge.sent(frame, sent);
+    CHECK(bridge.holds(0xD3, D3_INTERVAL_MS, sent));
+    CHECK(bridge.holds(0xD3, D3_INTERVAL_MS, sent + 2 * D3_INTERVAL_MS * 1000 - 1));
+    CHECK(!bridge.holds(0xD3, D3_INTERVAL_MS, sent + 2 * D3_INTERVAL_MS * 1000));
+
+    // Other frames, including the target of the disabled route, are never held
+    CHECK(!bridge.holds(0xD1, D3_INTERVAL_MS, sent));
+    CHECK(!bridge.holds(0x3B2, D3_INTERVAL_MS, sent));
+
+    bridge.logMetrics();
+    CHECK(strcmp(lastLog, "passthrough: 20 forwarded, 1 dropped, 1 sent, latency avg 150 max 150 us") == 0);
+
+    // The shipped table has its unverified route disabled, so the gateway forwards nothing
+    PassthroughBridge shipped;
+    CHECK(shipped.begin());
+    CHECK(!shipped.forward(0x284, data, 8));
+
+    printf(failures ? "%d checks failed\n" : "All checks passed\n", failures);
+    return failures ? 1 : 0;
+}
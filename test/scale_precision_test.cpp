@@ -0,0 +1,237 @@
+// Host precision report and benchmark of the single-precision UDS scaling, run from the repository root: every
+// scaled CSV signal through the firmware's float arithmetic against the CSV's doubles, as --precision-report does.
+//
+//   g++ -std=gnu++17 -O2 -Wall -Wextra -Isrc -Itest/host -o scale_precision_test test/scale_precision_test.cpp
+
+#include "uds/uds_mapper.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+static int failures = 0;
+
+#define CHECK(condition)                                                      \
+    do                                                                        \
+    {                                                                         \
+        if (!(condition))                                                     \
+        {                                                                     \
+            printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #condition); \
+            failures++;                                                       \
+        }                                                                     \
+    } while (0)
+
+static const char *CSV_PATH = "ISF CAN UDS Message Definitions.csv";
+
+// Raw values checked per signal, as PRECISION_SAMPLES in the generator; narrower fields are checked exhaustively
+static constexpr int64_t PRECISION_SAMPLES = 4096;
+
+// The generator reports a worst error of 0.007 of one raw step
+static constexpr double MAX_ERROR_LSB = 0.01;
+
+static constexpr int BENCHMARK_ROUNDS = 2000;
+
+struct ScaledSignal
+{
+    const UdsDefinition *def;
+    double scale;
+    double offset;
+    double error;   // Largest |float - double| over the raw range
+};
+
+static std::vector<std::string> splitCsvLine(const std::string &line)
+{
+    std::vector<std::string> fields(1);
+    bool quoted = false;
+    for (size_t i = 0; i < line.size(); i++)
+    {
+        char c = line[i];
+        if (c == '"' && quoted && i + 1 < line.size() && line[i + 1] == '"')
+        {
+            fields.back() += '"';
+            i++;
+        }
+        else if (c == '"')
+        {
+            quoted = !quoted;
+        }
+        else if (c == ',' && !quoted)
+        {
+            fields.emplace_back();
+        }
+        else if (c != '\r')
+        {
+            fields.back() += c;
+        }
+    }
+    return fields;
+}
+
+static const UdsDefinition *findDefinition(uint16_t ecu, uint16_t did, uint8_t byte_position, uint8_t bit_offset,
+                                           const std::string &name)
+{
+    for (const UdsDefinition &def : findUdsDefinitions(ecu, did))
+    {
+        if (def.byte_position == byte_position && def.bit_offset_position == bit_offset && name == udsName(def))
+        {
+            return &def;
+        }
+    }
+    return nullptr;
+}
+
+// Rounds after the multiply and after the add, as the decoder and the generator's report do
+static float singleValue(int64_t raw, float scale, float offset)
+{
+    volatile float product = (float)raw * scale;
+    return product + offset;
+}
+
+static double floatError(const UdsDefinition &def, double scale, double offset)
+{
+    const int64_t count = int64_t(1) << def.bit_length;
+    const int64_t low = def.is_signed ? -(count >> 1) : 0;
+    const int64_t step = std::max<int64_t>(1, count / PRECISION_SAMPLES);
+
+    double worst = 0.0;
+    for (int64_t raw = low; raw < low + count + step - 1; raw += step)
+    {
+        int64_t sample = std::min(raw, low + count - 1);
+        double error = fabs(singleValue(sample, def.scaling_factor, def.offset_value) - (sample * scale + offset));
+        worst = std::max(worst, error);
+    }
+    return worst;
+}
+
+int main()
+{
+    FILE *file = fopen(CSV_PATH, "r");
+    if (file == nullptr)
+    {
+        printf("%s not found; run from the repository root\n", CSV_PATH);
+        return 1;
+    }
+
+    // One entry per numeric signal: enum rows repeat the signal once per display value
+    std::vector<ScaledSignal> signals;
+    size_t unmatched = 0;
+    char buffer[512];
+    bool header = true;
+    while (fgets(buffer, sizeof(buffer), file) != nullptr)
+    {
+        std::string line(buffer);
+        line.erase(line.find_last_not_of("\r\n") + 1);
+        if (header || line.empty())
+        {
+            header = false;
+            continue;
+        }
+
+        // ecu_id_hex, parameter_id_hex, uds_data_identifier_hex, unit_type, byte_position, bitOffset_position,
+        // scaling_factor, offset_value, bit_length, parameter_name, parameter_value, parameter_display_value
+        std::vector<std::string> fields = splitCsvLine(line);
+        if (fields.size() < 10)
+        {
+            continue;
+        }
+        const UdsDefinition *def =
+            findDefinition((uint16_t)strtoul(fields[0].c_str(), nullptr, 0), (uint16_t)strtoul(fields[2].c_str(), nullptr, 0),
+                           (uint8_t)atoi(fields[4].c_str()), (uint8_t)atoi(fields[5].c_str()), fields[9]);
+        if (def == nullptr)
+        {
+            unmatched++;
+            continue;
+        }
+
+        double scale = strtod(fields[6].c_str(), nullptr);
+        double offset = strtod(fields[7].c_str(), nullptr);
+        if (def->enum_size != 0 || (scale == 1.0 && offset == 0.0) ||
+            std::any_of(signals.begin(), signals.end(), [def](const ScaledSignal &s) { return s.def == def; }))
+        {
+            continue;
+        }
+
+        // The tables hold the nearest float to the CSV's double
+        CHECK(def->scaling_factor == (float)scale && def->offset_value == (float)offset);
+        signals.push_back({def, scale, offset, floatError(*def, scale, offset)});
+    }
+    fclose(file);
+
+    CHECK(unmatched == 0);
+    CHECK(!signals.empty());
+
+    std::sort(signals.begin(), signals.end(), [](const ScaledSignal &a, const ScaledSignal &b)
+              { return a.error / fabs(a.scale) > b.error / fabs(b.scale); });
+
+    size_t exact = 0;
+    printf("  ECU  DID bits        scale     offset    max error       LSB  signal\n");
+    for (const ScaledSignal &signal : signals)
+    {
+        const UdsDefinition &def = *signal.def;
+        if (signal.error == 0.0)
+        {
+            exact++;
+            continue;
+        }
+        if (&signal - signals.data() < 10)
+        {
+            printf("0x%03X 0x%02X %4u %12.6g %10.6g %12.3g %9.2e  %s\n", (unsigned)def.request_id, (unsigned)def.did,
+                   (unsigned)def.bit_length, signal.scale, signal.offset, signal.error,
+                   signal.error / fabs(signal.scale), udsName(def));
+        }
+    }
+    const double worst_lsb = signals.front().error / fabs(signals.front().scale);
+    printf("%zu scaled signals, %zu exact in float, worst error %.2e LSB\n", signals.size(), exact, worst_lsb);
+    CHECK(worst_lsb < MAX_ERROR_LSB);
+
+    // Timing: the scaling in float and in double. The host FPU does both in hardware, so this shows the
+    // cost of the arithmetic itself; on the ESP32-S3 double goes through software routines.
+    std::vector<float> raw_f(signals.size()), scale_f(signals.size()), offset_f(signals.size());
+    std::vector<double> scale_d(signals.size()), offset_d(signals.size());
+    for (size_t i = 0; i < signals.size(); i++)
+    {
+        raw_f[i] = (float)(i * 37 % 256);
+        scale_f[i] = signals[i].def->scaling_factor;
+        offset_f[i] = signals[i].def->offset_value;
+        scale_d[i] = signals[i].scale;
+        offset_d[i] = signals[i].offset;
+    }
+
+    using Clock = std::chrono::steady_clock;
+    volatile float sink_f = 0.0f;
+    volatile double sink_d = 0.0;
+    const double conversions = (double)BENCHMARK_ROUNDS * signals.size();
+
+    Clock::time_point start = Clock::now();
+    for (int round = 0; round < BENCHMARK_ROUNDS; round++)
+    {
+        float sum = 0.0f;
+        for (size_t i = 0; i < signals.size(); i++)
+        {
+            sum += raw_f[i] * scale_f[i] + offset_f[i];
+        }
+        sink_f = sink_f + sum;
+    }
+    double float_ns = std::chrono::duration<double, std::nano>(Clock::now() - start).count() / conversions;
+
+    start = Clock::now();
+    for (int round = 0; round < BENCHMARK_ROUNDS; round++)
+    {
+        double sum = 0.0;
+        for (size_t i = 0; i < signals.size(); i++)
+        {
+            sum += raw_f[i] * scale_d[i] + offset_d[i];
+        }
+        sink_d = sink_d + sum;
+    }
+    double double_ns = std::chrono::duration<double, std::nano>(Clock::now() - start).count() / conversions;
+
+    printf("scaling: float %.2f ns/signal, double %.2f ns/signal\n", float_ns, double_ns);
+
+    printf(failures ? "%d checks failed\n" : "All checks passed\n", failures);
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,117 @@
+// Host replay test of the alpha-beta signal predictor.
+//
+//   g++ -std=gnu++17 -Wall -Wextra -Isrc -Itest/host -o signal_predictor_test
+//       test/signal_predictor_test.cpp src/signals/signal_predictor.cpp src/signals/signal_store.cpp
+
+#include "signals/signal_predictor.h"
+#include "logger/logger.h"
+#include <cmath>
+#include <cstdarg>
+#include <cstdio>
+
+static int failures = 0;
+
+#define CHECK(condition)                                                      \
+    do                                                                        \
+    {                                                                         \
+        if (!(condition))                                                     \
+        {                                                                     \
+            printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #condition); \
+            failures++;                                                       \
+        }                                                                     \
+    } while (0)
+
+void Logger::info(const char *func, const char *format, ...)
+{
+    va_list args;
+    va_start(args, format);
+    printf("%s: ", func);
+    vprintf(format, args);
+    printf("\n");
+    va_end(args);
+}
+
+// Engine Speed in GT86_PREDICTED_SIGNALS
+static constexpr PredictorConfig ENGINE_SPEED = {0.85f, 0.63f, 250, 1500.0f};
+
+static constexpr uint32_t POLL_MS = 200;    // 5 Hz UDS poll
+static constexpr uint32_t TICK_MS = 20;     // GT86 task tick
+
+// A 1000-4000 rpm sweep, as when revving through a gear
+static float engineSpeed(uint32_t ms)
+{
+    return 1000.0f + 3000.0f * (0.5f - 0.5f * cosf(ms * 0.0008f));
+}
+
+static void publish(SignalId id, float value, uint32_t timestamp)
+{
+    signalStore.beginPublish(id);
+    signalStore.publish(id, value, timestamp);
+    signalStore.endPublish(id);
+}
+
+int main()
+{
+    const SignalId id = findSignalId(0x7E0, "Engine Speed");
+    CHECK(id != SIGNAL_NONE);
+
+    SignalPredictor predictor;
+    CHECK(predictor.track(id, ENGINE_SPEED));
+    CHECK(!predictor.track(SIGNAL_NONE, ENGINE_SPEED));
+
+    float value = 0.0f;
+    uint32_t sampled = 0;
+    CHECK(!predictor.predict(0, 0, value, sampled));
+
+    // Replay the sweep with +-30 rpm of decode noise and compare with holding the last sample
+    double predicted_error = 0.0;
+    double held_error = 0.0;
+    int ticks = 0;
+    float estimate = 0.0f;
+    float held = 0.0f;
+    for (uint32_t now = 0; now < 20000; now += TICK_MS)
+    {
+        if (now % POLL_MS == 0)
+        {
+            held = engineSpeed(now) + (float)((now * 7919) % 61) - 30.0f;
+            publish(id, held, now);
+        }
+        if (predictor.predict(0, now, value, sampled))
+        {
+            estimate = value;
+        }
+
+        // After the filter has settled
+        if (now >= 1000)
+        {
+            double truth = engineSpeed(now);
+            predicted_error += (estimate - truth) * (estimate - truth);
+            held_error += (held - truth) * (held - truth);
+            ticks++;
+        }
+    }
+    double predicted_rms = sqrt(predicted_error / ticks);
+    double held_rms = sqrt(held_error / ticks);
+    printf("rms error: predicted %.1f rpm, last sample held %.1f rpm\n", predicted_rms, held_rms);
+    CHECK(predicted_rms < 0.5 * held_rms);
+    predictor.logMetrics();
+
+    // Without new samples the estimate stops max_extrapolation_ms after the last one
+    const uint32_t last = 20000 - POLL_MS;
+    predictor.predict(0, last + ENGINE_SPEED.max_extrapolation_ms, value, sampled);
+    CHECK(sampled == last);
+    CHECK(!predictor.predict(0, last + ENGINE_SPEED.max_extrapolation_ms + 100, value, sampled));
+
+    // A step change moves the rate far enough that the extrapolation is clamped to max_delta
+    SignalPredictor step;
+    step.track(id, ENGINE_SPEED);
+    publish(id, 1000.0f, 100000);
+    step.predict(0, 100000, value, sampled);
+    publish(id, 7000.0f, 100100);
+    CHECK(step.predict(0, 100350, value, sampled));
+    float filtered = 1000.0f + ENGINE_SPEED.alpha * 6000.0f;
+    CHECK(fabsf(value - (filtered + ENGINE_SPEED.max_delta)) < 0.01f);
+
+    printf(failures ? "%d checks failed\n" : "All checks passed\n", failures);
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,144 @@
+// Host test of the signal store seqlock with the ISF broadcast targets separated.
+//
+//   g++ -std=gnu++17 -Wall -Wextra -pthread -Isrc -Itest/host -o signal_store_test
+//       test/signal_store_test.cpp src/signals/signal_store.cpp src/uds/did_decoder.cpp
+
+#include "services/isf_broadcast.h"
+#include "uds/did_decoder.h"
+#include "logger/logger.h"
+#include <atomic>
+#include <cstdarg>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+static int failures = 0;
+
+#define CHECK(condition)                                                      \
+    do                                                                        \
+    {                                                                         \
+        if (!(condition))                                                     \
+        {                                                                     \
+            printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #condition); \
+            failures++;                                                       \
+        }                                                                     \
+    } while (0)
+
+void Logger::error(const char *func, const char *format, ...)
+{
+    va_list args;
+    va_start(args, format);
+    printf("%s: ", func);
+    vprintf(format, args);
+    printf("\n");
+    va_end(args);
+}
+
+int main()
+{
+    // What IsfBroadcast::separateSignals() does in setup()
+    for (const IsfBroadcastField &field : ISF_BROADCAST_FIELDS)
+    {
+        CHECK(signalStore.separate(findSignalId(field.target_ecu, field.target_name)));
+    }
+    const SignalId coolant = findSignalId(0x7E0, "Coolant Temp");
+    const SignalId engine_speed = findSignalId(0x7E0, "Engine Speed");
+    CHECK(signalStore.isSeparate(coolant) && signalStore.isSeparate(engine_speed));
+
+    // 0x7E0/0x01 with every signal before Coolant Temp unsubscribed, so a separated signal is decoded first
+    DidDecoder decoder;
+    bool subscribed = false;
+    for (const UdsDefinition &def : findUdsDefinitions(0x7E0, 0x01))
+    {
+        subscribed = subscribed || udsSignalId(def) == coolant;
+        if (subscribed)
+        {
+            decoder.add(def);
+        }
+    }
+    CHECK(decoder.size() > 2);
+    CHECK(udsSignalId(decoder.definition(0)) == coolant);
+
+    // Two signals of the DID that stay in its group
+    std::vector<SignalId> grouped;
+    for (size_t i = 0; i < decoder.size() && grouped.size() < 2; i++)
+    {
+        SignalId id = udsSignalId(decoder.definition(i));
+        if (!signalStore.isSeparate(id))
+        {
+            grouped.push_back(id);
+        }
+    }
+    CHECK(grouped.size() == 2);
+
+    uint8_t payload[64];
+    for (size_t i = 0; i < sizeof(payload); i++)
+    {
+        payload[i] = (uint8_t)(i * 29 + 3);
+    }
+    float change_fraction = 0.0f;
+    CHECK(decoder.decode(payload, sizeof(payload), change_fraction) == decoder.size());
+
+    // Publish as IsfService::transformResponse() does: the DID under its own sequence, separated signals alone
+    SignalSample samples[2];
+    SignalSample sample;
+    bool torn_read = false;
+    signalStore.beginDidPublish(udsSignalId(decoder.definition(0)));
+    decoder.forEachDecoded([&](const UdsDefinition &def, float value)
+                           {
+                               SignalId id = udsSignalId(def);
+                               if (!signalStore.isSeparate(id))
+                               {
+                                   signalStore.publish(id, value, 1000);
+                                   torn_read = torn_read || signalStore.snapshot(grouped.data(), samples, 2);
+                               }
+                           });
+    CHECK(!torn_read);
+    CHECK(signalStore.read(coolant, sample));   // Another group, not held up by the DID
+    signalStore.endDidPublish(udsSignalId(decoder.definition(0)));
+
+    CHECK(signalStore.snapshot(grouped.data(), samples, 2));
+    CHECK(samples[0].quality == SignalQuality::Valid && samples[0].timestamp == 1000);
+    CHECK(samples[1].quality == SignalQuality::Valid && samples[1].timestamp == 1000);
+
+    CHECK(signalStore.read(coolant, sample) && sample.quality == SignalQuality::NoData);
+    signalStore.beginPublish(coolant);
+    signalStore.publish(coolant, decoder.value(0), 1000);
+    CHECK(signalStore.snapshot(grouped.data(), samples, 2));    // A separated publish leaves the DID readable
+    signalStore.endPublish(coolant);
+    CHECK(signalStore.read(coolant, sample) && sample.value == decoder.value(0));
+
+    const SignalId mixed[2] = {coolant, grouped[0]};
+    CHECK(!signalStore.snapshot(mixed, samples, 2));
+
+    // A writer republishing the DID against a reader on another thread: both signals always come from one response
+    std::atomic<bool> done{false};
+    std::thread writer([&]
+                       {
+                           for (uint32_t round = 1; round <= 200000; round++)
+                           {
+                               signalStore.beginDidPublish(coolant);
+                               signalStore.publish(grouped[0], (float)round, round);
+                               signalStore.publish(grouped[1], (float)round, round);
+                               signalStore.endDidPublish(coolant);
+                           }
+                           done = true;
+                       });
+    int reads = 0;
+    int mismatches = 0;
+    while (!done)
+    {
+        if (signalStore.snapshot(grouped.data(), samples, 2))
+        {
+            reads++;
+            mismatches += samples[0].timestamp != samples[1].timestamp;
+        }
+    }
+    writer.join();
+    printf("concurrent snapshots: %d consistent reads, %d torn\n", reads, mismatches);
+    CHECK(reads > 0);
+    CHECK(mismatches == 0);
+
+    printf(failures ? "%d checks failed\n" : "All checks passed\n", failures);
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,253 @@
+// Host test and benchmark of UDS field extraction: every UDS_DEFINITIONS row through the specialised
+// kernels, the DidDecoder and the get_raw_value() path they replaced, on random payloads.
+//
+//   g++ -std=gnu++17 -O2 -Wall -Wextra -Isrc -Itest/host -o uds_extraction_test
+//       test/uds_extraction_test.cpp src/uds/did_decoder.cpp
+
+#include "uds/did_decoder.h"
+#include "uds/uds_mapper.h"
+#include "logger/logger.h"
+#include <chrono>
+#include <cstdarg>
+#include <cstdio>
+
+static int failures = 0;
+
+#define CHECK(condition)                                                      \
+    do                                                                        \
+    {                                                                         \
+        if (!(condition))                                                     \
+        {                                                                     \
+            printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #condition); \
+            failures++;                                                       \
+        }                                                                     \
+    } while (0)
+
+// Signals whose unit has no unitTypeInfos entry are refused by DidDecoder::add()
+static int refusedSignals = 0;
+
+void Logger::error(const char *, const char *, ...)
+{
+    refusedSignals++;
+}
+
+/**
+ * get_raw_value() as isf_service.cpp had it before the extraction kernels, logging removed:
+ * little-endian only, unsigned only, bounds checked on every call.
+ */
+static bool legacyRawValue(const uint8_t *data, int8_t byte_pos, int8_t bit_pos, int8_t bit_length, int8_t data_len,
+                           uint32_t &raw_value)
+{
+    const int MAX_BIT_LENGTH = 32;
+
+    if (bit_length <= 0 || bit_length > MAX_BIT_LENGTH)
+    {
+        return false;
+    }
+    if (byte_pos < 0 || byte_pos >= data_len)
+    {
+        return false;
+    }
+
+    int8_t total_bit_offset = bit_pos + bit_length;
+    int8_t required_bytes = (total_bit_offset + 7) / 8;
+    int8_t end_byte = byte_pos + required_bytes;
+    if (end_byte > data_len)
+    {
+        return false;
+    }
+
+    uint32_t raw = 0;
+    memcpy(&raw, &data[byte_pos], required_bytes);
+    raw >>= bit_pos;
+
+    uint32_t mask = (bit_length == MAX_BIT_LENGTH) ? 0xFFFFFFFF : ((1U << bit_length) - 1);
+    raw_value = raw & mask;
+    return true;
+}
+
+// Bit-by-bit reference, sharing no code with bit_extract.h
+static uint32_t referenceRawValue(const uint8_t *payload, const UdsDefinition &def)
+{
+    const int bytes = (def.bit_offset_position + def.bit_length + 7) / 8;
+    uint32_t raw = 0;
+    for (int i = 0; i < def.bit_length; i++)
+    {
+        // Bit k of the assembled word: Intel puts byte 0 lowest, Motorola puts it highest
+        int k = def.bit_offset_position + i;
+        int byte = def.byte_order == ByteOrder::Intel ? k / 8 : bytes - 1 - k / 8;
+        if ((payload[def.byte_position + byte] >> (k % 8)) & 1)
+        {
+            raw |= 1U << i;
+        }
+    }
+    if (def.is_signed && def.bit_length < 32 && (raw >> (def.bit_length - 1)) & 1)
+    {
+        raw |= ~0U << def.bit_length;
+    }
+    return raw;
+}
+
+static uint32_t nextRandom(uint32_t &state)
+{
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return state;
+}
+
+static uint32_t kernelRawValue(const uint8_t *payload, const UdsDefinition &def, RawExtractor extractor)
+{
+    const uint8_t *field = payload + def.byte_position;
+    return extractor != nullptr
+               ? extractor(field)
+               : extractBits(field, def.bit_offset_position, def.bit_length, def.byte_order, def.is_signed);
+}
+
+static constexpr int PAYLOADS = 64;
+static constexpr int PAYLOAD_LENGTH = 64;    // get_raw_value() takes the length as int8_t
+static constexpr int BENCHMARK_ROUNDS = 200;
+
+int main()
+{
+    static uint8_t payloads[PAYLOADS][PAYLOAD_LENGTH];
+    uint32_t state = 0x2545F491;
+    for (auto &payload : payloads)
+    {
+        for (uint8_t &byte : payload)
+        {
+            byte = (uint8_t)nextRandom(state);
+        }
+    }
+
+    // Resolved once per signal, as DidDecoder::add() does
+    static RawExtractor extractors[UDS_DEFINITION_COUNT];
+    for (size_t i = 0; i < UDS_DEFINITION_COUNT; i++)
+    {
+        const UdsDefinition &def = UDS_DEFINITIONS[i];
+        extractors[i] = selectExtractor(def.bit_offset_position, def.bit_length, def.byte_order, def.is_signed);
+    }
+
+    // Every row through the kernels against the reference, and against get_raw_value() where it applies
+    size_t kernel_rows = 0;
+    size_t legacy_rows = 0;
+    size_t legacy_length4_wrong = 0;
+    for (size_t row = 0; row < UDS_DEFINITION_COUNT; row++)
+    {
+        const UdsDefinition &def = UDS_DEFINITIONS[row];
+        CHECK(def.byte_position + fieldBytes(def.bit_offset_position, def.bit_length) <= PAYLOAD_LENGTH);
+        kernel_rows += extractors[row] != nullptr;
+
+        // Little-endian unsigned fields, and unsigned fields within one byte, are what get_raw_value() read right
+        bool legacy_applies = !def.is_signed && (def.byte_order == ByteOrder::Intel ||
+                                                 fieldBytes(def.bit_offset_position, def.bit_length) == 1);
+        legacy_rows += legacy_applies;
+
+        bool length4_wrong = false;
+        for (const auto &payload : payloads)
+        {
+            uint32_t expected = referenceRawValue(payload, def);
+            uint32_t raw = kernelRawValue(payload, def, extractors[row]);
+            if (raw != expected)
+            {
+                printf("%s: kernel 0x%08X, reference 0x%08X\n", udsName(def), (unsigned)raw, (unsigned)expected);
+                failures++;
+                break;
+            }
+
+            uint32_t legacy = 0;
+            if (legacy_applies)
+            {
+                CHECK(legacyRawValue(payload, def.byte_position, def.bit_offset_position, def.bit_length,
+                                     PAYLOAD_LENGTH, legacy));
+                CHECK(legacy == raw);
+            }
+
+            // The length the old transformResponse() actually passed
+            if (!legacyRawValue(payload, def.byte_position, def.bit_offset_position, 4, PAYLOAD_LENGTH, legacy) ||
+                legacy != expected)
+            {
+                length4_wrong = true;
+            }
+        }
+        legacy_length4_wrong += length4_wrong;
+    }
+    printf("%zu signals: %zu on specialised kernels, %zu also checked against get_raw_value(), "
+           "%zu misread by the old fixed bit_length of 4\n",
+           UDS_DEFINITION_COUNT, kernel_rows, legacy_rows, legacy_length4_wrong);
+
+    // The decoder reads the same raw values for every signal it accepts, DID by DID
+    size_t decoded_signals = 0;
+    for (size_t d = 0; d < UDS_DID_COUNT; d++)
+    {
+        DidDecoder decoder;
+        for (const UdsDefinition &def : findUdsDefinitions(UDS_DIDS[d].request_id, UDS_DIDS[d].did))
+        {
+            decoder.add(def);
+        }
+        if (decoder.empty())
+        {
+            continue;
+        }
+
+        float change_fraction = 0.0f;
+        for (const auto &payload : payloads)
+        {
+            CHECK(decoder.decode(payload, PAYLOAD_LENGTH, change_fraction) == decoder.size());
+            for (size_t i = 0; i < decoder.size(); i++)
+            {
+                CHECK(decoder.rawValue(i) == referenceRawValue(payload, decoder.definition(i)));
+            }
+        }
+        decoded_signals += decoder.size();
+    }
+    printf("%zu signals decoded through DidDecoder, %d refused for an unknown unit\n", decoded_signals,
+           refusedSignals);
+    CHECK(decoded_signals > 0);
+
+    // Timing over every row: the old call as transformResponse() made it, the old function with the real
+    // bit_length, and the kernels
+    using Clock = std::chrono::steady_clock;
+    volatile uint32_t sink = 0;
+    const double extractions = (double)BENCHMARK_ROUNDS * PAYLOADS * UDS_DEFINITION_COUNT;
+    double legacy_ns[2];
+
+    for (int with_length = 0; with_length < 2; with_length++)
+    {
+        Clock::time_point start = Clock::now();
+        for (int round = 0; round < BENCHMARK_ROUNDS; round++)
+        {
+            for (const auto &payload : payloads)
+            {
+                for (const UdsDefinition &def : UDS_DEFINITIONS)
+                {
+                    uint32_t raw = 0;
+                    legacyRawValue(payload, def.byte_position, def.bit_offset_position,
+                                   with_length ? def.bit_length : 4, PAYLOAD_LENGTH, raw);
+                    sink = sink + raw;
+                }
+            }
+        }
+        legacy_ns[with_length] = std::chrono::duration<double, std::nano>(Clock::now() - start).count() / extractions;
+    }
+
+    Clock::time_point start = Clock::now();
+    for (int round = 0; round < BENCHMARK_ROUNDS; round++)
+    {
+        for (const auto &payload : payloads)
+        {
+            for (size_t row = 0; row < UDS_DEFINITION_COUNT; row++)
+            {
+                sink = sink + kernelRawValue(payload, UDS_DEFINITIONS[row], extractors[row]);
+            }
+        }
+    }
+    double kernel_ns = std::chrono::duration<double, std::nano>(Clock::now() - start).count() / extractions;
+
+    printf("extraction: get_raw_value() %.2f ns/signal (bit_length 4), %.2f ns/signal (real bit_length), "
+           "kernels %.2f ns/signal\n",
+           legacy_ns[0], legacy_ns[1], kernel_ns);
+
+    printf(failures ? "%d checks failed\n" : "All checks passed\n", failures);
+    return failures ? 1 : 0;
+}
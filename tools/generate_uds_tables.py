@@ -0,0 +1,447 @@
+#!/usr/bin/env python3
+"""Generate src/uds/uds_tables.h from "ISF CAN UDS Message Definitions.csv".
+
+The CSV lists one row per numeric signal and one row per value of an
+enumerated signal. The generator folds those rows into flash-resident
+constexpr tables:
+
+* UDS_STRING_POOL  - every signal name and display value, stored once
+* UDS_ENUM_DISPLAY - per-signal display text tables indexed by raw value;
+                     signals with identical value lists share one table
+* UDS_DEFINITIONS  - one entry per signal, sorted by (ECU, DID, byte, bit)
+* UDS_DIDS         - (ECU, DID) -> block of UDS_DEFINITIONS, sorted for binary search
+
+The CSV bit_length column is a placeholder (Techstream exports 4 for every
+row), so true lengths are inferred unless a row gives a value other than 4:
+
+* enumerated and GENERAL signals are as wide as their largest listed value
+* numeric signals are one byte unless the next signal of the DID starts two
+  or more bytes later and one byte could not cover the value, i.e. the offset
+  lies outside 255 steps or 255 steps span less than a quarter of the unit
+  range from src/uds/unit_types.h
+
+Multi-byte values are Motorola (big-endian) and unsigned unless the optional
+byte_order ("intel"/"motorola") and signed ("0"/"1") columns say otherwise.
+
+Scale and offset are emitted as float because the ESP32-S3 FPU is single
+precision only. --precision-report compares the firmware's float arithmetic
+with the double reference for every numeric signal.
+
+Run it from the repository root after editing the CSV and commit the result:
+
+    python tools/generate_uds_tables.py
+
+--image writes the same tables as a binary image (src/uds/uds_image.h) for the
+"udsdefs" flash partition, which the firmware maps at boot in place of the
+built-in tables, so definitions can change without recompiling.
+"""
+
+import argparse
+import csv
+import math
+import re
+import struct
+import sys
+import zlib
+from pathlib import Path
+
+REPO_ROOT = Path(__file__).resolve().parent.parent
+DEFAULT_CSV = REPO_ROOT / "ISF CAN UDS Message Definitions.csv"
+DEFAULT_OUTPUT = REPO_ROOT / "src" / "uds" / "uds_tables.h"
+UNIT_TYPES_HEADER = REPO_ROOT / "src" / "uds" / "unit_types.h"
+
+MAX_UINT8 = 0xFF
+MAX_UINT16 = 0xFFFF
+
+PLACEHOLDER_BIT_LENGTH = 4
+GENERAL_UNIT = 0
+BYTE_ORDERS = {"motorola": "ByteOrder::Motorola", "intel": "ByteOrder::Intel"}
+
+# Marks raw values without display text; the string pool must stay below it
+STRING_NONE = 0xFFFF
+
+# Binary image layout, mirrored by UdsImageHeader and static_asserts in src/uds/uds_image.cpp
+IMAGE_MAGIC = 0x49534455  # "UDSI"
+IMAGE_VERSION = 2
+IMAGE_HEADER = struct.Struct("<IHHIIIIIIIIII")
+IMAGE_CRC_START = 12  # offsetof(UdsImageHeader, image_size)
+IMAGE_DEFINITION = struct.Struct("<HHBBBBBBBxffHHH2x")
+IMAGE_DID = struct.Struct("<HHHH")
+IMAGE_BYTE_ORDERS = {"ByteOrder::Intel": 0, "ByteOrder::Motorola": 1}
+
+# Raw values checked per signal by --precision-report; narrower fields are checked exhaustively
+PRECISION_SAMPLES = 4096
+
+
+class StringPool:
+    """Interns strings into one NUL-separated pool addressed by byte offset."""
+
+    def __init__(self):
+        self.offsets = {}
+        self.strings = []
+        self.size = 0
+
+    def intern(self, text):
+        if text not in self.offsets:
+            self.offsets[text] = self.size
+            self.strings.append(text)
+            self.size += len(text.encode("utf-8")) + 1
+        return self.offsets[text]
+
+
+def c_string(text):
+    escaped = text.replace("\\", "\\\\").replace('"', '\\"')
+    return '"' + escaped + '\\0"'
+
+
+def c_comment(text):
+    # A trailing backslash would splice the next table row into the comment
+    return text.replace("\\", "/")
+
+
+def parse_int(text):
+    return int(text, 0)
+
+
+def to_float32(value):
+    return struct.unpack("<f", struct.pack("<f", value))[0]
+
+
+def float_literal(value):
+    """Shortest C float literal that reads back as the same single-precision value."""
+    target = to_float32(value)
+    for digits in range(1, 10):
+        text = f"{target:.{digits}g}"
+        if to_float32(float(text)) == target:
+            break
+    if "e" not in text and "." not in text and "inf" not in text:
+        text += ".0"
+    return text + "f"
+
+
+def is_binary_fraction(scale, offset):
+    """True when raw * scale + offset is exact in Q-format, i.e. the scale is a power of two."""
+    if scale == 0:
+        return False
+    mantissa, _ = math.frexp(abs(scale))
+    return mantissa == 0.5 and (offset / scale).is_integer()
+
+
+def float_error(bit_length, is_signed, scale, offset):
+    """Largest |float - double| over the raw range, rounding after the multiply and the add like the firmware."""
+    scale32 = to_float32(scale)
+    offset32 = to_float32(offset)
+    count = 1 << bit_length
+    low = -(count >> 1) if is_signed else 0
+    step = max(1, count // PRECISION_SAMPLES)
+    raws = list(range(low, low + count, step)) + [low + count - 1]
+
+    worst = 0.0
+    for raw in raws:
+        single = to_float32(to_float32(to_float32(raw) * scale32) + offset32)
+        worst = max(worst, abs(single - (raw * scale + offset)))
+    return worst
+
+
+def print_precision_report(definitions):
+    rows = []
+    exact = 0
+    for (ecu, did, unit, byte_position, bit_offset, bit_length, byte_order, is_signed, is_calculated, scale, offset,
+         name_id, enum_first, enum_size, name) in definitions:
+        if enum_size or (scale == 1.0 and offset == 0.0):
+            continue
+        error = float_error(bit_length, is_signed == "true", scale, offset)
+        if is_binary_fraction(scale, offset) or error == 0.0:
+            exact += 1
+        rows.append((error / abs(scale) if scale else 0.0, error, ecu, did, bit_length, scale, offset, name))
+
+    rows.sort(reverse=True)
+    print(f"{'ECU':>5} {'DID':>4} {'bits':>4} {'scale':>12} {'offset':>10} {'max error':>12} {'LSB':>9}  signal")
+    for lsb, error, ecu, did, bit_length, scale, offset, name in rows:
+        if error == 0.0:
+            continue
+        print(f"0x{ecu:03X} 0x{did:02X} {bit_length:4} {scale:12.6g} {offset:10.6g} {error:12.3g} {lsb:9.2e}  {name}")
+    worst = rows[0][0] if rows else 0.0
+    print(f"{len(rows)} scaled signals, {exact} exact in float, worst error {worst:.2e} LSB")
+
+
+def load_unit_ranges(header_path):
+    """Reads {id: (min, max)} from the unitTypeInfos initialiser so the ranges have one source."""
+    number = r"(std::nullopt|-?[\d.]+f)"
+    pattern = re.compile(r"\{\s*(\d+),\s*\"\w+\",\s*\"[^\"]*\",\s*" + number + r",\s*" + number + r",\s*ValueType::\w+\s*\}")
+    ranges = {}
+    for unit, low, high in pattern.findall(header_path.read_text(encoding="utf-8")):
+        if low != "std::nullopt" and high != "std::nullopt":
+            ranges[int(unit)] = (float(low[:-1]), float(high[:-1]))
+    if not ranges:
+        raise ValueError(f"no unit ranges found in {header_path}")
+    return ranges
+
+
+def infer_bit_length(signal, next_byte, unit_ranges):
+    """Width of a signal whose CSV row only carries the placeholder length."""
+    ecu, did, byte_position, bit_offset, name = signal["key"]
+    unit, bit_length, scale, offset = signal["layout"]
+
+    if bit_length != PLACEHOLDER_BIT_LENGTH:
+        return bit_length
+
+    if signal["enums"]:
+        return max(1, max(signal["enums"]).bit_length())
+    if unit == GENERAL_UNIT or bit_offset != 0:
+        return 8 - bit_offset
+
+    gap = None if next_byte is None else next_byte - byte_position
+    if gap == 1:
+        return 8
+
+    one_byte_span = 255 * abs(scale)
+    if abs(offset) > one_byte_span:
+        return 16
+    if unit in unit_ranges:
+        low, high = unit_ranges[unit]
+        return 16 if one_byte_span < 0.25 * (high - low) else 8
+    return 16 if gap is not None else 8
+
+
+def load_signals(csv_path):
+    """Groups CSV rows into signals keyed by (ECU, DID, byte, bit, name)."""
+    signals = {}
+
+    with open(csv_path, newline="", encoding="utf-8") as f:
+        for line, row in enumerate(csv.DictReader(f), start=2):
+            key = (
+                parse_int(row["ecu_id_hex"]),
+                parse_int(row["uds_data_identifier_hex"]),
+                int(row["byte_position"]),
+                int(row["bitOffset_position"]),
+                row["parameter_name"],
+            )
+            layout = (
+                int(row["unit_type"]),
+                int(row["bit_length"]),
+                float(row["scaling_factor"]),
+                float(row["offset_value"]),
+            )
+            encoding = (
+                BYTE_ORDERS[(row.get("byte_order") or "motorola").lower()],
+                (row.get("signed") or "0") == "1",
+            )
+
+            signal = signals.get(key)
+            if signal is None:
+                signal = {"key": key, "layout": layout, "encoding": encoding, "enums": {}, "order": len(signals)}
+                signals[key] = signal
+            elif signal["layout"] != layout:
+                # Techstream exports some signals twice with different formulas; the first row wins
+                print(f"warning: line {line}: '{key[4]}' redefined with a different layout, keeping the first",
+                      file=sys.stderr)
+
+            if row["parameter_value"] != "":
+                value = int(row["parameter_value"])
+                display = row["parameter_display_value"]
+                previous = signal["enums"].setdefault(value, display)
+                if previous != display:
+                    raise ValueError(f"line {line}: '{key[4]}' value {value} has two display texts")
+
+    return sorted(signals.values(), key=lambda s: (s["key"][:4], s["order"]))
+
+
+def check_range(name, value, limit):
+    if not 0 <= value <= limit:
+        raise ValueError(f"{name} {value} does not fit the table field (max {limit})")
+
+
+def generate(csv_path, unit_header):
+    signals = load_signals(csv_path)
+    unit_ranges = load_unit_ranges(unit_header)
+
+    # First byte of the next field of the same DID, used to bound each field's width
+    next_bytes = {}
+    by_did = {}
+    for signal in signals:
+        by_did.setdefault(signal["key"][:2], set()).add(signal["key"][2])
+    for signal in signals:
+        later = [b for b in by_did[signal["key"][:2]] if b > signal["key"][2]]
+        next_bytes[id(signal)] = min(later) if later else None
+
+    pool = StringPool()
+    enum_display = []
+    enum_tables = {}
+    definitions = []
+    dids = []
+
+    for signal in signals:
+        ecu, did, byte_position, bit_offset, name = signal["key"]
+        unit, _, scale, offset = signal["layout"]
+        byte_order, is_signed = signal["encoding"]
+        bit_length = infer_bit_length(signal, next_bytes[id(signal)], unit_ranges)
+
+        for field, value, limit in (("ECU", ecu, MAX_UINT16), ("DID", did, MAX_UINT16), ("unit", unit, MAX_UINT8),
+                                    ("byte position", byte_position, MAX_UINT8), ("bit offset", bit_offset, 7),
+                                    ("bit length", bit_length, 32)):
+            check_range(field, value, limit)
+        if bit_offset + bit_length > 32:
+            raise ValueError(f"'{name}' spans more than four bytes")
+
+        # Dense table from raw value 0 to the largest listed value, so decoding is one array index
+        enums = signal["enums"]
+        enum_size = max(enums) + 1 if enums else 0
+        if enums:
+            check_range("enum value", max(enums), MAX_UINT8)
+        table = tuple(enums.get(value) for value in range(enum_size))
+        enum_first = enum_tables.get(table, 0)
+        if enum_size and table not in enum_tables:
+            enum_first = len(enum_display)
+            enum_tables[table] = enum_first
+            for display in table:
+                enum_display.append((STRING_NONE, None) if display is None else (pool.intern(display), display))
+
+        if not dids or dids[-1][:2] != [ecu, did]:
+            dids.append([ecu, did, len(definitions), 0])
+        dids[-1][3] += 1
+
+        # Every numeric row is scaled; enum rows carry their raw value to the display table
+        definitions.append((ecu, did, unit, byte_position, bit_offset, bit_length, byte_order,
+                            "true" if is_signed else "false", "false" if enum_size else "true", scale, offset,
+                            pool.intern(name), enum_first, enum_size, name))
+
+    check_range("string pool size", pool.size, STRING_NONE - 1)
+    check_range("enum table size", len(enum_display), MAX_UINT16)
+    check_range("definition table size", len(definitions), MAX_UINT16)
+
+    return {"pool": pool, "enum_display": enum_display, "enum_tables": enum_tables, "definitions": definitions,
+            "dids": dids}
+
+
+def render_header(tables):
+    pool = tables["pool"]
+    enum_display = tables["enum_display"]
+    enum_tables = tables["enum_tables"]
+    definitions = tables["definitions"]
+    dids = tables["dids"]
+
+    out = []
+    out.append("// Generated by tools/generate_uds_tables.py from \"ISF CAN UDS Message Definitions.csv\".")
+    out.append("// Do not edit by hand: change the CSV and re-run the generator.")
+    out.append("#ifndef _UDS_TABLES_H")
+    out.append("#define _UDS_TABLES_H")
+    out.append("")
+    out.append("#include \"uds_definition.h\"")
+    out.append("")
+    out.append(f"// {len(pool.strings)} unique names and display values")
+    out.append("inline constexpr char UDS_STRING_POOL[] =")
+    for i, text in enumerate(pool.strings):
+        out.append("    " + c_string(text) + (";" if i == len(pool.strings) - 1 else ""))
+    out.append("")
+    out.append(f"// {len(enum_tables)} distinct value tables")
+    out.append("inline constexpr uint16_t UDS_ENUM_DISPLAY[] = {")
+    for display_id, display in enum_display:
+        if display is None:
+            out.append("    UDS_STRING_NONE,")
+        else:
+            out.append(f"    {display_id}, // {c_comment(display)}")
+    out.append("};")
+    out.append("")
+    out.append("inline constexpr UdsDefinition UDS_DEFINITIONS[] = {")
+    for (ecu, did, unit, byte_position, bit_offset, bit_length, byte_order, is_signed, is_calculated, scale, offset,
+         name_id, enum_first, enum_size, name) in definitions:
+        out.append(f"    {{ 0x{ecu:03X}, 0x{did:02X}, {unit}, {byte_position}, {bit_offset}, {bit_length}, "
+                   f"{byte_order}, {is_signed}, {is_calculated}, {float_literal(scale)}, {float_literal(offset)}, {name_id}, {enum_first}, {enum_size} }}, // {c_comment(name)}")
+    out.append("};")
+    out.append("")
+    out.append("inline constexpr UdsDidEntry UDS_DIDS[] = {")
+    for ecu, did, first, count in dids:
+        out.append(f"    {{ 0x{ecu:03X}, 0x{did:02X}, {first}, {count} }},")
+    out.append("};")
+    out.append("")
+    out.append("#endif // _UDS_TABLES_H")
+    out.append("")
+
+    return "\n".join(out)
+
+
+def describe(tables):
+    return (f"{len(tables['definitions'])} signals in {len(tables['dids'])} DIDs, "
+            f"{len(tables['enum_tables'])} enum tables ({len(tables['enum_display'])} entries), "
+            f"{tables['pool'].size} byte string pool")
+
+
+def align4(data):
+    data += b"\0" * (-len(data) % 4)
+    return data
+
+
+def pack_image(tables):
+    """Binary image whose sections match the firmware structs byte for byte."""
+    body = bytearray()
+
+    definitions_offset = IMAGE_HEADER.size + len(body)
+    for (ecu, did, unit, byte_position, bit_offset, bit_length, byte_order, is_signed, is_calculated, scale, offset,
+         name_id, enum_first, enum_size, name) in tables["definitions"]:
+        body += IMAGE_DEFINITION.pack(ecu, did, unit, byte_position, bit_offset, bit_length,
+                                      IMAGE_BYTE_ORDERS[byte_order], is_signed == "true", is_calculated == "true",
+                                      scale, offset, name_id, enum_first, enum_size)
+
+    dids_offset = IMAGE_HEADER.size + len(body)
+    for ecu, did, first, count in tables["dids"]:
+        body += IMAGE_DID.pack(ecu, did, first, count)
+
+    enum_display_offset = IMAGE_HEADER.size + len(body)
+    for display_id, _ in tables["enum_display"]:
+        body += struct.pack("<H", display_id)
+    body = align4(body)
+
+    strings_offset = IMAGE_HEADER.size + len(body)
+    strings = b"".join(text.encode("utf-8") + b"\0" for text in tables["pool"].strings)
+    body = align4(body + strings)
+
+    image_size = IMAGE_HEADER.size + len(body)
+    fields = [image_size, definitions_offset, len(tables["definitions"]), dids_offset, len(tables["dids"]),
+              enum_display_offset, len(tables["enum_display"]), strings_offset, len(strings)]
+    header = IMAGE_HEADER.pack(IMAGE_MAGIC, IMAGE_VERSION, IMAGE_HEADER.size, 0, *fields)
+    crc = zlib.crc32(header[IMAGE_CRC_START:] + body)
+    return IMAGE_HEADER.pack(IMAGE_MAGIC, IMAGE_VERSION, IMAGE_HEADER.size, crc, *fields) + bytes(body)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--csv", type=Path, default=DEFAULT_CSV, help="signal definition CSV")
+    parser.add_argument("--output", type=Path, default=DEFAULT_OUTPUT, help="generated header")
+    parser.add_argument("--units", type=Path, default=UNIT_TYPES_HEADER, help="header with the unitTypeInfos ranges")
+    parser.add_argument("--check", action="store_true", help="fail if the header is out of date instead of writing it")
+    parser.add_argument("--precision-report", action="store_true",
+                        help="compare float decoding with the double reference instead of writing the header")
+    parser.add_argument("--image", type=Path, help="write a binary image for the udsdefs partition instead of the header")
+    args = parser.parse_args()
+
+    tables = generate(args.csv, args.units)
+    summary = describe(tables)
+
+    if args.precision_report:
+        print_precision_report(tables["definitions"])
+        return 0
+
+    if args.image:
+        image = pack_image(tables)
+        args.image.write_bytes(image)
+        print(f"Wrote {args.image}: {len(image)} bytes, {summary}")
+        return 0
+
+    header = render_header(tables)
+
+    if args.check:
+        current = args.output.read_text(encoding="utf-8") if args.output.exists() else ""
+        if current != header:
+            print(f"{args.output} is out of date, re-run {Path(__file__).name}", file=sys.stderr)
+            return 1
+        print(f"{args.output} is up to date ({summary})")
+        return 0
+
+    args.output.write_text(header, encoding="utf-8", newline="\n")
+    print(f"Wrote {args.output}: {summary}")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())